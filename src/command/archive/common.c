@@ -15,6 +15,7 @@ Archive Common
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/regExp.h"
+#include "common/type/pack.h"
 #include "common/wait.h"
 #include "config/config.h"
 #include "postgres/version.h"
@@ -30,6 +31,15 @@ STRING_EXTERN(WAL_SEGMENT_DIR_REGEXP_STR,                           WAL_SEGMENT_
 STRING_EXTERN(WAL_SEGMENT_FILE_REGEXP_STR,                          WAL_SEGMENT_FILE_REGEXP);
 STRING_EXTERN(WAL_TIMELINE_HISTORY_REGEXP_STR,                      WAL_TIMELINE_HISTORY_REGEXP);
 
+/***********************************************************************************************************************************
+WAL bundle header constants
+***********************************************************************************************************************************/
+#define WAL_BUNDLE_MAGIC                                            "PGBRWALB"
+#define WAL_BUNDLE_MAGIC_SIZE                                       (sizeof(WAL_BUNDLE_MAGIC) - 1)
+
+// The magic is followed by the size of the pack that contains the file list
+#define WAL_BUNDLE_HEADER_PREFIX_SIZE                               (WAL_BUNDLE_MAGIC_SIZE + sizeof(uint32_t))
+
 /***********************************************************************************************************************************
 Global error file constant
 ***********************************************************************************************************************************/
@@ -422,13 +432,27 @@ walSegmentFind(const Storage *storage, const String *archiveId, const String *wa
 
         do
         {
-            // Get a list of all WAL segments that match
-            StringList *list = storageListP(
-                storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(strSubN(walSegment, 0, 16))),
-                .expression = strNewFmt(
-                    "^%s%s-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$", strZ(strSubN(walSegment, 0, 24)),
-                        walIsPartial(walSegment) ? WAL_SEGMENT_PARTIAL_EXT : ""),
-                .nullOnMissing = true);
+            // Search the index when it exists since it lists every WAL file in the path
+            const String *const walPath = strSubN(walSegment, 0, 16);
+            const StringList *const indexList = walIndexRead(storage, archiveId, walPath);
+            StringList *list = NULL;
+
+            if (indexList != NULL)
+                list = walSegmentFindList(storage, archiveId, indexList, walSegment);
+            // Else get a list of all WAL segments and bundles that match
+            else
+            {
+                list = storageListP(
+                    storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(walPath)),
+                    .expression = strNewFmt(
+                        "^(%s%s-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}|" WAL_BUNDLE_REGEXP ")$", strZ(strSubN(walSegment, 0, 24)),
+                            walIsPartial(walSegment) ? WAL_SEGMENT_PARTIAL_EXT : ""),
+                    .nullOnMissing = true);
+
+                // Search bundles for the segment
+                if (list != NULL)
+                    list = walSegmentFindList(storage, archiveId, list, walSegment);
+            }
 
             // If there are results
             if (list != NULL && !strLstEmpty(list))
@@ -469,6 +493,409 @@ walSegmentFind(const Storage *storage, const String *archiveId, const String *wa
     FUNCTION_LOG_RETURN(STRING, result);
 }
 
+/**********************************************************************************************************************************/
+StringList *
+walSegmentFindList(const Storage *storage, const String *archiveId, const StringList *fileList, const String *walSegment)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(STRING_LIST, fileList);
+        FUNCTION_LOG_PARAM(STRING, walSegment);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archiveId != NULL);
+    ASSERT(fileList != NULL);
+    ASSERT(walSegment != NULL);
+
+    StringList *result = strLstNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *walSegmentPrefix = strNewFmt("%s-", strZ(walSegment));
+        StringList *foundList = strLstNew();
+
+        for (unsigned int fileIdx = 0; fileIdx < strLstSize(fileList); fileIdx++)
+        {
+            const String *file = strLstGet(fileList, fileIdx);
+
+            // Search the bundle if the segment is in its range. Partial segments are never bundled.
+            if (strEndsWithZ(file, WAL_BUNDLE_EXT))
+            {
+                if (!walIsPartial(walSegment) && strCmp(walSegment, strSubN(file, 0, WAL_SEGMENT_NAME_SIZE)) >= 0 &&
+                    strCmp(walSegment, strSubN(file, WAL_SEGMENT_NAME_SIZE + 1, WAL_SEGMENT_NAME_SIZE)) <= 0)
+                {
+                    const List *bundleFileList = walBundleHeaderRead(
+                        storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(file)));
+
+                    for (unsigned int bundleFileIdx = 0; bundleFileIdx < lstSize(bundleFileList); bundleFileIdx++)
+                    {
+                        const WalBundleFile *bundleFile = lstGet(bundleFileList, bundleFileIdx);
+
+                        // Skip copies of a file that has already been found, e.g. when a bundle was pushed again after an error
+                        if (strBeginsWith(bundleFile->file, walSegmentPrefix) && !strLstExists(foundList, bundleFile->file))
+                        {
+                            strLstAdd(result, strNewFmt("%s/%s", strZ(file), strZ(bundleFile->file)));
+                            strLstAdd(foundList, bundleFile->file);
+                        }
+                    }
+                }
+            }
+            // Else the segment is stored in its own file or is a bundle/file entry from the index
+            else if (strBeginsWith(strBase(file), walSegmentPrefix) && !strLstExists(foundList, strBase(file)))
+            {
+                strLstAdd(result, file);
+                strLstAdd(foundList, strBase(file));
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/**********************************************************************************************************************************/
+StorageRead *
+walSegmentReadNew(const Storage *storage, const String *archiveFile, bool compressible)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archiveFile);
+        FUNCTION_LOG_PARAM(BOOL, compressible);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archiveFile != NULL);
+
+    StorageRead *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *bundle = strPath(archiveFile);
+
+        // If the file is stored in a bundle then read only the part of the bundle that contains the file
+        if (strEndsWithZ(bundle, WAL_BUNDLE_EXT))
+        {
+            const String *bundlePath = strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strZ(bundle));
+            const String *file = strBase(archiveFile);
+            const List *bundleFileList = walBundleHeaderRead(storage, bundlePath);
+            const WalBundleFile *bundleFile = NULL;
+
+            for (unsigned int bundleFileIdx = 0; bundleFileIdx < lstSize(bundleFileList); bundleFileIdx++)
+            {
+                if (strEq(((const WalBundleFile *)lstGet(bundleFileList, bundleFileIdx))->file, file))
+                {
+                    bundleFile = lstGet(bundleFileList, bundleFileIdx);
+                    break;
+                }
+            }
+
+            if (bundleFile == NULL)
+                THROW_FMT(FileMissingError, "unable to find '%s' in WAL bundle '%s'", strZ(file), strZ(bundle));
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result = storageNewReadP(
+                    storage, bundlePath, .compressible = compressible, .offset = bundleFile->offset,
+                    .limit = VARUINT64(bundleFile->size));
+            }
+            MEM_CONTEXT_PRIOR_END();
+        }
+        // Else read the file directly
+        else
+        {
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result = storageNewReadP(
+                    storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strZ(archiveFile)), .compressible = compressible);
+            }
+            MEM_CONTEXT_PRIOR_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STORAGE_READ, result);
+}
+
+/**********************************************************************************************************************************/
+Buffer *
+walBundleHeader(const List *fileList)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(LIST, fileList);
+    FUNCTION_LOG_END();
+
+    ASSERT(fileList != NULL);
+    ASSERT(lstSize(fileList) <= WAL_BUNDLE_SEGMENT_MAX);
+
+    Buffer *result = bufNew(WAL_BUNDLE_HEADER_SIZE);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Write the file list
+        Buffer *pack = bufNew(0);
+        PackWrite *write = pckWriteNewBuf(pack);
+
+        pckWriteU32P(write, lstSize(fileList));
+        pckWriteArrayBeginP(write);
+
+        for (unsigned int fileIdx = 0; fileIdx < lstSize(fileList); fileIdx++)
+        {
+            const WalBundleFile *file = lstGet(fileList, fileIdx);
+
+            pckWriteStrP(write, file->file);
+            pckWriteU64P(write, file->offset);
+            pckWriteU64P(write, file->size);
+        }
+
+        pckWriteArrayEndP(write);
+        pckWriteEndP(write);
+
+        CHECK(bufUsed(pack) <= WAL_BUNDLE_HEADER_SIZE - WAL_BUNDLE_HEADER_PREFIX_SIZE);
+
+        // Write the magic and pack size followed by the pack. The remainder of the header is zeroed.
+        uint8_t packSize[sizeof(uint32_t)] =
+        {
+            (uint8_t)(bufUsed(pack) >> 24), (uint8_t)(bufUsed(pack) >> 16), (uint8_t)(bufUsed(pack) >> 8), (uint8_t)bufUsed(pack),
+        };
+
+        memset(bufPtr(result), 0, bufSize(result));
+        bufCatC(result, (const unsigned char *)WAL_BUNDLE_MAGIC, 0, WAL_BUNDLE_MAGIC_SIZE);
+        bufCatC(result, packSize, 0, sizeof(packSize));
+        bufCat(result, pack);
+        bufUsedSet(result, WAL_BUNDLE_HEADER_SIZE);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/**********************************************************************************************************************************/
+List *
+walBundleHeaderRead(const Storage *storage, const String *bundleFile)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, bundleFile);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(bundleFile != NULL);
+
+    List *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const Buffer *header = storageGetP(storageNewReadP(storage, bundleFile, .limit = VARUINT64(WAL_BUNDLE_HEADER_SIZE)));
+        const unsigned char *headerPtr = bufPtrConst(header);
+
+        // Check the magic and get the pack size
+        if (bufUsed(header) != WAL_BUNDLE_HEADER_SIZE || memcmp(headerPtr, WAL_BUNDLE_MAGIC, WAL_BUNDLE_MAGIC_SIZE) != 0)
+            THROW_FMT(FormatError, "invalid header in WAL bundle '%s'", strZ(storagePathP(storage, bundleFile)));
+
+        const size_t packSize =
+            (size_t)headerPtr[WAL_BUNDLE_MAGIC_SIZE] << 24 | (size_t)headerPtr[WAL_BUNDLE_MAGIC_SIZE + 1] << 16 |
+            (size_t)headerPtr[WAL_BUNDLE_MAGIC_SIZE + 2] << 8 | (size_t)headerPtr[WAL_BUNDLE_MAGIC_SIZE + 3];
+
+        if (packSize > WAL_BUNDLE_HEADER_SIZE - WAL_BUNDLE_HEADER_PREFIX_SIZE)
+            THROW_FMT(FormatError, "invalid header in WAL bundle '%s'", strZ(storagePathP(storage, bundleFile)));
+
+        // Read the file list
+        PackRead *read = pckReadNewBuf(bufNewC(headerPtr + WAL_BUNDLE_HEADER_PREFIX_SIZE, packSize));
+        const unsigned int fileTotal = pckReadU32P(read);
+
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            result = lstNewP(sizeof(WalBundleFile));
+        }
+        MEM_CONTEXT_PRIOR_END();
+
+        pckReadArrayBeginP(read);
+
+        for (unsigned int fileIdx = 0; fileIdx < fileTotal; fileIdx++)
+        {
+            const String *file = pckReadStrP(read);
+            const uint64_t offset = pckReadU64P(read);
+            const uint64_t size = pckReadU64P(read);
+
+            MEM_CONTEXT_BEGIN(lstMemContext(result))
+            {
+                lstAdd(result, &(WalBundleFile){.file = strDup(file), .offset = offset, .size = size});
+            }
+            MEM_CONTEXT_END();
+        }
+
+        pckReadArrayEndP(read);
+        pckReadEndP(read);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(LIST, result);
+}
+
+/**********************************************************************************************************************************/
+StringList *
+walIndexRead(const Storage *storage, const String *archiveId, const String *walPath)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(STRING, walPath);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archiveId != NULL);
+    ASSERT(walPath != NULL);
+
+    StringList *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const Buffer *index = storageGetP(
+            storageNewReadP(
+                storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s/" WAL_INDEX_FILE, strZ(archiveId), strZ(walPath)),
+                .ignoreMissing = true));
+
+        if (index != NULL)
+        {
+            const StringList *lineList = strLstNewSplitZ(strNewBuf(index), "\n");
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result = strLstNew();
+
+                // Each line is terminated so skip the empty string following the last terminator
+                for (unsigned int lineIdx = 0; lineIdx < strLstSize(lineList); lineIdx++)
+                {
+                    if (!strEmpty(strLstGet(lineList, lineIdx)))
+                        strLstAdd(result, strLstGet(lineList, lineIdx));
+                }
+            }
+            MEM_CONTEXT_PRIOR_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/***********************************************************************************************************************************
+List the WAL files already in a WAL path as index entries. Files stored in a bundle are read from the bundle header.
+***********************************************************************************************************************************/
+static StringList *
+walIndexPathList(const Storage *storage, const String *archiveId, const String *walPath)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(STRING, walPath);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archiveId != NULL);
+    ASSERT(walPath != NULL);
+
+    StringList *result = strLstNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const StringList *const fileList = strLstSort(
+            storageListP(
+                storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(walPath)),
+                .expression = strNewFmt(
+                    "^(%s[0-F]{8}(\\" WAL_SEGMENT_PARTIAL_EXT "){0,1}-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}|"
+                        WAL_BUNDLE_REGEXP ")$",
+                    strZ(walPath))),
+            sortOrderAsc);
+
+        for (unsigned int fileIdx = 0; fileIdx < strLstSize(fileList); fileIdx++)
+        {
+            const String *const file = strLstGet(fileList, fileIdx);
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                if (strEndsWithZ(file, WAL_BUNDLE_EXT))
+                {
+                    const List *const bundleFileList = walBundleHeaderRead(
+                        storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(file)));
+
+                    for (unsigned int bundleFileIdx = 0; bundleFileIdx < lstSize(bundleFileList); bundleFileIdx++)
+                    {
+                        strLstAdd(
+                            result,
+                            strNewFmt(
+                                "%s/%s", strZ(file), strZ(((const WalBundleFile *)lstGet(bundleFileList, bundleFileIdx))->file)));
+                    }
+                }
+                else
+                    strLstAdd(result, file);
+            }
+            MEM_CONTEXT_PRIOR_END();
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/**********************************************************************************************************************************/
+void
+walIndexAdd(const Storage *storage, const String *archiveId, const String *walPath, const StringList *fileList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, archiveId);
+        FUNCTION_LOG_PARAM(STRING, walPath);
+        FUNCTION_LOG_PARAM(STRING_LIST, fileList);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(archiveId != NULL);
+    ASSERT(walPath != NULL);
+    ASSERT(fileList != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Object stores do not support append so the index is read and the new files appended before it is written again. When
+        // there is no index start with the files already in the path (which include the files being added) so the index is
+        // complete. Entries are never removed so more than one entry for a WAL segment is reported as a duplicate, as it would be
+        // by listing.
+        StringList *indexList = walIndexRead(storage, archiveId, walPath);
+        bool indexUpdate = indexList == NULL;
+
+        if (indexList == NULL)
+            indexList = walIndexPathList(storage, archiveId, walPath);
+
+        for (unsigned int fileIdx = 0; fileIdx < strLstSize(fileList); fileIdx++)
+        {
+            const String *const file = strLstGet(fileList, fileIdx);
+
+            if (!strLstExists(indexList, file))
+            {
+                strLstAdd(indexList, file);
+                indexUpdate = true;
+            }
+        }
+
+        if (indexUpdate)
+        {
+            String *const index = strNew("");
+
+            for (unsigned int indexIdx = 0; indexIdx < strLstSize(indexList); indexIdx++)
+                strCatFmt(index, "%s\n", strZ(strLstGet(indexList, indexIdx)));
+
+            storagePutP(
+                storageNewWriteP(
+                    storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s/" WAL_INDEX_FILE, strZ(archiveId), strZ(walPath))),
+                BUFSTR(index));
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 String *
 walSegmentNext(const String *walSegment, size_t walSegmentSize, unsigned int pgVersion)
@@ -18,6 +18,8 @@ typedef enum
 } ArchiveMode;
 
 #include "common/compress/helper.h"
+#include "common/type/buffer.h"
+#include "common/type/list.h"
 #include "common/type/stringList.h"
 #include "storage/storage.h"
 
@@ -60,6 +62,48 @@ WAL segment constants
 #define WAL_TIMELINE_HISTORY_REGEXP                                 "^[0-F]{8}.history$"
     STRING_DECLARE(WAL_TIMELINE_HISTORY_REGEXP_STR);
 
+/***********************************************************************************************************************************
+WAL bundle constants
+
+A bundle stores several WAL segments from the same archive path in a single repository file named for the first and last segment it
+contains. The file begins with a fixed size header that lists the segment files (segment-checksum[.ext]) and where each can be
+found in the bundle. Each segment is compressed and encrypted separately so it can be read from the bundle exactly as if it had been
+stored in its own file.
+***********************************************************************************************************************************/
+#define WAL_BUNDLE_EXT                                              ".bundle"
+
+// Match on a WAL bundle
+#define WAL_BUNDLE_REGEXP                                           "[0-F]{24}-[0-F]{24}\\" WAL_BUNDLE_EXT
+
+// Maximum number of segments that can be stored in a bundle
+#define WAL_BUNDLE_SEGMENT_MAX                                      64
+
+// Maximum size of the segments stored in a bundle. Segments are held in memory until the bundle is written so this limits the
+// memory used by each process.
+#define WAL_BUNDLE_SIZE_MAX                                         ((uint64_t)128 * 1024 * 1024)
+
+// Size of the bundle header (large enough to hold WAL_BUNDLE_SEGMENT_MAX entries)
+#define WAL_BUNDLE_HEADER_SIZE                                      8192
+
+// File stored in a bundle
+typedef struct WalBundleFile
+{
+    const String *file;                                             // Segment file name with checksum and extension
+    uint64_t offset;                                                // Offset of the file in the bundle
+    uint64_t size;                                                  // Size of the file in the bundle
+} WalBundleFile;
+
+/***********************************************************************************************************************************
+WAL index constants
+
+Each WAL path in the archive may contain an index that lists the WAL files stored in the path, one per line, relative to the path.
+Files stored in a bundle are listed as bundle/file. The index is appended to by archive-push so WAL can be found without listing the
+path. When the index is created it lists all the files already in the path, so once it exists it is complete and a WAL segment that
+is not in the index is not in the path. The path is only listed when there is no index, e.g. for paths written by older versions or
+after expire has removed files from the path.
+***********************************************************************************************************************************/
+#define WAL_INDEX_FILE                                              "wal.index"
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -96,6 +140,27 @@ String *walPath(const String *walFile, const String *pgPath, const String *comma
 // thing.
 String *walSegmentFind(const Storage *storage, const String *archiveId, const String *walSegment, TimeMSec timeout);
 
+// Find matches for a WAL segment in a list of files from the WAL segment's archive path or index. Bundles in the list that could
+// contain the segment are searched using their header and matches found there are returned as bundle/file.
+StringList *walSegmentFindList(
+    const Storage *storage, const String *archiveId, const StringList *fileList, const String *walSegment);
+
+// Open a WAL file for read. The file is relative to the archive path and may be stored in a bundle, i.e. bundle/file.
+StorageRead *walSegmentReadNew(const Storage *storage, const String *archiveFile, bool compressible);
+
+// Render a bundle header from a list of WalBundleFile
+Buffer *walBundleHeader(const List *fileList);
+
+// Read the list of WalBundleFile from a bundle header
+List *walBundleHeaderRead(const Storage *storage, const String *bundleFile);
+
+// Read the index for a WAL path (the first 16 characters of a WAL segment). Returns NULL when the path has no index.
+StringList *walIndexRead(const Storage *storage, const String *archiveId, const String *walPath);
+
+// Append files to the index for a WAL path. Files already in the index are ignored. When there is no index the files already in the
+// path are added first.
+void walIndexAdd(const Storage *storage, const String *archiveId, const String *walPath, const StringList *fileList);
+
 // Get the next WAL segment given a WAL segment and WAL segment size
 String *walSegmentNext(const String *walSegment, size_t walSegmentSize, unsigned int pgVersion);
 
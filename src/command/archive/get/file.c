@@ -72,11 +72,7 @@ ArchiveGetFileResult archiveGetFile(
                 }
 
                 // Copy the file
-                storageCopyP(
-                    storageNewReadP(
-                        storageRepoIdx(actual->repoIdx), strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strZ(actual->file)),
-                        .compressible = compressible),
-                    destination);
+                storageCopyP(walSegmentReadNew(storageRepoIdx(actual->repoIdx), actual->file, compressible), destination);
             }
             MEM_CONTEXT_TEMP_END();
 
@@ -14,12 +14,17 @@ Archive Get Command
 #include "command/archive/get/protocol.h"
 #include "command/command.h"
 #include "common/debug.h"
+#include "common/io/bufferRead.h"
+#include "common/io/bufferWrite.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/regExp.h"
+#include "common/time.h"
+#include "common/type/json.h"
 #include "common/wait.h"
 #include "config/config.h"
 #include "config/exec.h"
+#include "info/info.h"
 #include "info/infoArchive.h"
 #include "postgres/interface.h"
 #include "protocol/helper.h"
@@ -77,7 +82,8 @@ archiveGetErrorAdd(StringList *warnList, bool log, unsigned int repoIdx, const E
 typedef struct ArchiveGetFindCachePath
 {
     const String *path;                                             // Cached path in the archiveId
-    const StringList *fileList;                                     // List of files in the cache path
+    const StringList *indexList;                                    // WAL index for the cache path (NULL when no index)
+    const StringList *fileList;                                     // List of files in the cache path (NULL until listed)
 } ArchiveGetFindCachePath;
 
 typedef struct ArchiveGetFindCacheArchive
@@ -146,26 +152,21 @@ archiveGetFind(
                     // If a WAL segment then search among the possible file names
                     if (isSegment)
                     {
-                        StringList *segmentList = NULL;
+                        const Storage *storage = storageRepoIdx(cacheRepo->repoIdx);
+                        const StringList *indexList = NULL;
+                        ArchiveGetFindCachePath *cachePath = NULL;
 
-                        // If a single file is requested then optimize by adding a restrictive expression to reduce bandwidth
+                        // If a single file is requested then read the index directly
                         if (single)
-                        {
-                            segmentList = storageListP(
-                                storageRepoIdx(cacheRepo->repoIdx),
-                                strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(cacheArchive->archiveId), strZ(path)),
-                                .expression = strNewFmt(
-                                    "^%s%s-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$", strZ(strSubN(archiveFileRequest, 0, 24)),
-                                        walIsPartial(archiveFileRequest) ? WAL_SEGMENT_PARTIAL_EXT : ""));
-                        }
-                        // Else multiple files will be requested so cache list results
+                            indexList = walIndexRead(storage, cacheArchive->archiveId, path);
+                        // Else multiple files will be requested so cache index and list results
                         else
                         {
                             // Partial files cannot be in a list with multiple requests
                             ASSERT(!walIsPartial(archiveFileRequest));
 
-                            // If the path does not exist in the cache then fetch it
-                            const ArchiveGetFindCachePath *cachePath = lstFind(cacheArchive->pathList, &path);
+                            // If the path does not exist in the cache then fetch the index
+                            cachePath = lstFind(cacheArchive->pathList, &path);
 
                             if (cachePath == NULL)
                             {
@@ -176,24 +177,57 @@ archiveGetFind(
                                         &(ArchiveGetFindCachePath)
                                         {
                                             .path = strDup(path),
-                                            .fileList = storageListP(
-                                                storageRepoIdx(cacheRepo->repoIdx),
-                                                strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(cacheArchive->archiveId), strZ(path)),
-                                                .expression = strNewFmt(
-                                                    "^%s[0-F]{8}-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}$", strZ(path))),
+                                            .indexList = walIndexRead(storage, cacheArchive->archiveId, path),
                                         });
                                 }
                                 MEM_CONTEXT_END();
                             }
 
-                            // Get a list of all WAL segments that match
-                            segmentList = strLstNew();
+                            indexList = cachePath->indexList;
+                        }
+
+                        // Search the index when it exists since it lists every WAL file in the path
+                        const StringList *segmentList = NULL;
+
+                        if (indexList != NULL)
+                            segmentList = walSegmentFindList(storage, cacheArchive->archiveId, indexList, archiveFileRequest);
+                        // Else search the files in the path
+                        else
+                        {
+                            const StringList *fileList = NULL;
 
-                            for (unsigned int fileIdx = 0; fileIdx < strLstSize(cachePath->fileList); fileIdx++)
+                            // If a single file is requested then optimize by adding a restrictive expression to reduce bandwidth
+                            if (single)
+                            {
+                                fileList = storageListP(
+                                    storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(cacheArchive->archiveId), strZ(path)),
+                                    .expression = strNewFmt(
+                                        "^(%s%s-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}|" WAL_BUNDLE_REGEXP ")$",
+                                        strZ(strSubN(archiveFileRequest, 0, 24)),
+                                        walIsPartial(archiveFileRequest) ? WAL_SEGMENT_PARTIAL_EXT : ""));
+                            }
+                            // Else list the path once and cache the result
+                            else
                             {
-                                if (strBeginsWith(strLstGet(cachePath->fileList, fileIdx), archiveFileRequest))
-                                    strLstAdd(segmentList, strLstGet(cachePath->fileList, fileIdx));
+                                if (cachePath->fileList == NULL)
+                                {
+                                    MEM_CONTEXT_BEGIN(lstMemContext(cacheArchive->pathList))
+                                    {
+                                        cachePath->fileList = storageListP(
+                                            storage,
+                                            strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(cacheArchive->archiveId), strZ(path)),
+                                            .expression = strNewFmt(
+                                                "^(%s[0-F]{8}-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}|" WAL_BUNDLE_REGEXP ")$",
+                                                strZ(path)));
+                                    }
+                                    MEM_CONTEXT_END();
+                                }
+
+                                fileList = cachePath->fileList;
                             }
+
+                            // Find the segment in the list, including bundles
+                            segmentList = walSegmentFindList(storage, cacheArchive->archiveId, fileList, archiveFileRequest);
                         }
 
                         // Add segments to match list
@@ -278,7 +312,11 @@ archiveGetFind(
                 StringList *hashList = strLstNew();
 
                 for (unsigned int matchIdx = 0; matchIdx < lstSize(matchList); matchIdx++)
-                    strLstAddIfMissing(hashList, strSubN(((ArchiveGetFile *)lstGet(matchList, matchIdx))->file, 25, 40));
+                {
+                    strLstAddIfMissing(
+                        hashList,
+                        strSubN(strBase(((ArchiveGetFile *)lstGet(matchList, matchIdx))->file), WAL_SEGMENT_NAME_SIZE + 1, 40));
+                }
 
                 // If there is more than one unique hash then there are duplicates
                 if (strLstSize(hashList) > 1)
@@ -353,6 +391,408 @@ archiveGetFind(
     FUNCTION_LOG_RETURN(BOOL, result);
 }
 
+/***********************************************************************************************************************************
+Build the list of repos/archiveIds where WAL may be found. Strings that must outlive the list are allocated in memContext.
+***********************************************************************************************************************************/
+static List *
+archiveGetCheckRepoList(const PgControl controlInfo, MemContext *const memContext, StringList *const warnList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PG_CONTROL, controlInfo);
+        FUNCTION_LOG_PARAM(MEM_CONTEXT, memContext);
+        FUNCTION_LOG_PARAM(STRING_LIST, warnList);
+    FUNCTION_LOG_END();
+
+    ASSERT(memContext != NULL);
+    ASSERT(warnList != NULL);
+
+    List *const result = lstNewP(sizeof(ArchiveGetFindCacheRepo));
+
+    for (unsigned int repoIdx = 0; repoIdx < cfgOptionGroupIdxTotal(cfgOptGrpRepo); repoIdx++)
+    {
+        // If a repo was specified then skip all other repos
+        if (cfgOptionTest(cfgOptRepo) && cfgOptionUInt(cfgOptRepo) != cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx))
+            continue;
+
+        TRY_BEGIN()
+        {
+            // Get the repo storage in case it is remote and encryption settings need to be pulled down
+            storageRepoIdx(repoIdx);
+
+            ArchiveGetFindCacheRepo cacheRepo =
+            {
+                .repoIdx = repoIdx,
+                .cipherType = cipherType(cfgOptionIdxStr(cfgOptRepoCipherType, repoIdx)),
+                .archiveList = lstNewP(sizeof(ArchiveGetFindCacheArchive)),
+                .warnList = strLstNew(),
+            };
+
+            // Attempt to load the archive info file
+            InfoArchive *info = infoArchiveLoadFile(
+                storageRepoIdx(repoIdx), INFO_ARCHIVE_PATH_FILE_STR, cacheRepo.cipherType,
+                cfgOptionIdxStrNull(cfgOptRepoCipherPass, repoIdx));
+
+            // Copy cipher pass into the result list context once rather than making a copy per candidate file later
+            MEM_CONTEXT_BEGIN(memContext)
+            {
+                cacheRepo.cipherPassArchive = strDup(infoArchiveCipherPass(info));
+            }
+            MEM_CONTEXT_END();
+
+            // Loop through pg history and determine which archiveIds to use
+            StringList *archivePathList = NULL;
+
+            for (unsigned int pgIdx = 0; pgIdx < infoPgDataTotal(infoArchivePg(info)); pgIdx++)
+            {
+                InfoPgData pgData = infoPgData(infoArchivePg(info), pgIdx);
+
+                // Only use the archive id if it matches the current cluster
+                if (pgData.systemId == controlInfo.systemId && pgData.version == controlInfo.version)
+                {
+                    const String *archiveId = infoPgArchiveId(infoArchivePg(info), pgIdx);
+                    bool found = true;
+
+                    // If the archiveId is in the past make sure the path exists
+                    if (pgIdx != 0)
+                    {
+                        // Get list of archiveId paths in the archive path
+                        if (archivePathList == NULL)
+                            archivePathList = storageListP(storageRepoIdx(repoIdx), STORAGE_REPO_ARCHIVE_STR);
+
+                        if (!strLstExists(archivePathList, archiveId))
+                            found = false;
+                    }
+
+                    // If the archiveId is most recent or has files then add it
+                    if (found)
+                    {
+                        ArchiveGetFindCacheArchive cacheArchive =
+                        {
+                            .pathList = lstNewP(sizeof(ArchiveGetFindCachePath), .comparator = lstComparatorStr),
+                        };
+
+                        // Copy archiveId into the result list context once rather than making a copy per candidate file later
+                        MEM_CONTEXT_BEGIN(memContext)
+                        {
+                            cacheArchive.archiveId = strDup(archiveId);
+                        }
+                        MEM_CONTEXT_END();
+
+                        lstAdd(cacheRepo.archiveList, &cacheArchive);
+                    }
+                }
+            }
+
+            // Error if no archive id was found -- this indicates a mismatch with the current cluster
+            if (lstEmpty(cacheRepo.archiveList))
+            {
+                archiveGetErrorAdd(
+                    warnList, true, repoIdx, &ArchiveMismatchError,
+                    strNewFmt(
+                        "unable to retrieve the archive id for database version '%s' and system-id '%" PRIu64 "'",
+                        strZ(pgVersionToStr(controlInfo.version)), controlInfo.systemId));
+            }
+            // Else add repo to list
+            else
+                lstAdd(result, &cacheRepo);
+        }
+        // Log errors as warnings and continue
+        CATCH_ANY()
+        {
+            archiveGetErrorAdd(warnList, true, repoIdx, errorType(), STR(errorMessage()));
+        }
+        TRY_END();
+    }
+
+    FUNCTION_LOG_RETURN(LIST, result);
+}
+
+/***********************************************************************************************************************************
+Check cache
+
+Loading archive.info from each repo is the most expensive part of the check and the results rarely change, so when
+archive-get-cache-ttl is set the repo list is cached in the spool path. The cache is an info file so it is checksummed and is only
+used if it matches the current cluster and repo configuration and is younger than the TTL. Since it contains the archive cipher
+passes it is only readable by the owner.
+***********************************************************************************************************************************/
+#define ARCHIVE_GET_CHECK_CACHE_FILE                                "check.cache"
+
+STRING_STATIC(ARCHIVE_GET_CHECK_CACHE_SECTION_CACHE_STR,            "cache");
+STRING_STATIC(ARCHIVE_GET_CHECK_CACHE_SECTION_DB_STR,               "db");
+STRING_STATIC(ARCHIVE_GET_CHECK_CACHE_SECTION_REPO_STR,             "repo");
+
+STRING_STATIC(ARCHIVE_GET_CHECK_CACHE_KEY_ARCHIVE_ID_STR,           "archive-id");
+STRING_STATIC(ARCHIVE_GET_CHECK_CACHE_KEY_CIPHER_PASS_STR,          "cipher-pass");
+STRING_STATIC(ARCHIVE_GET_CHECK_CACHE_KEY_CIPHER_TYPE_STR,          "cipher-type");
+STRING_STATIC(ARCHIVE_GET_CHECK_CACHE_KEY_PATH_STR,                 "path");
+STRING_STATIC(ARCHIVE_GET_CHECK_CACHE_KEY_SYSTEM_ID_STR,            "system-id");
+STRING_STATIC(ARCHIVE_GET_CHECK_CACHE_KEY_TIME_STR,                 "time");
+STRING_STATIC(ARCHIVE_GET_CHECK_CACHE_KEY_VERSION_STR,              "version");
+
+typedef struct ArchiveGetCheckCacheData
+{
+    MemContext *memContext;                                         // Mem context for loaded strings
+    const PgControl *controlInfo;                                   // Current cluster
+    bool valid;                                                     // Is the cache valid so far?
+    TimeMSec time;                                                  // Time the cache was saved
+    List *repoList;                                                 // Cached repo list
+} ArchiveGetCheckCacheData;
+
+static void
+archiveGetCheckCacheLoadCallback(void *const data, const String *const section, const String *const key, const Variant *const value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STRING, section);
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(VARIANT, value);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(section != NULL);
+    ASSERT(key != NULL);
+
+    ArchiveGetCheckCacheData *const cacheData = data;
+
+    if (strEq(section, ARCHIVE_GET_CHECK_CACHE_SECTION_CACHE_STR))
+    {
+        if (strEq(key, ARCHIVE_GET_CHECK_CACHE_KEY_TIME_STR))
+            cacheData->time = varUInt64Force(value);
+    }
+    else if (strEq(section, ARCHIVE_GET_CHECK_CACHE_SECTION_DB_STR))
+    {
+        if (strEq(key, ARCHIVE_GET_CHECK_CACHE_KEY_SYSTEM_ID_STR))
+            cacheData->valid &= varUInt64Force(value) == cacheData->controlInfo->systemId;
+        else if (strEq(key, ARCHIVE_GET_CHECK_CACHE_KEY_VERSION_STR))
+            cacheData->valid &= varUIntForce(value) == cacheData->controlInfo->version;
+    }
+    else if (strEq(section, ARCHIVE_GET_CHECK_CACHE_SECTION_REPO_STR))
+    {
+        const KeyValue *const repoKv = varKv(value);
+        const unsigned int repoKey = cvtZToUInt(strZ(key));
+        unsigned int repoIdx = 0;
+
+        // The repo must still be configured and would be checked
+        for (; repoIdx < cfgOptionGroupIdxTotal(cfgOptGrpRepo); repoIdx++)
+        {
+            if (cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx) == repoKey)
+                break;
+        }
+
+        if (repoIdx == cfgOptionGroupIdxTotal(cfgOptGrpRepo) || (cfgOptionTest(cfgOptRepo) && cfgOptionUInt(cfgOptRepo) != repoKey))
+            cacheData->valid = false;
+        // Else the repo path must not have changed since the cache was saved
+        else if (!strEq(
+                    varStr(kvGet(repoKv, VARSTR(ARCHIVE_GET_CHECK_CACHE_KEY_PATH_STR))), cfgOptionIdxStr(cfgOptRepoPath, repoIdx)))
+        {
+            cacheData->valid = false;
+        }
+        else
+        {
+            MEM_CONTEXT_BEGIN(cacheData->memContext)
+            {
+                ArchiveGetFindCacheRepo cacheRepo =
+                {
+                    .repoIdx = repoIdx,
+                    .cipherType = cipherType(varStr(kvGet(repoKv, VARSTR(ARCHIVE_GET_CHECK_CACHE_KEY_CIPHER_TYPE_STR)))),
+                    .cipherPassArchive = strDup(varStr(kvGet(repoKv, VARSTR(ARCHIVE_GET_CHECK_CACHE_KEY_CIPHER_PASS_STR)))),
+                    .archiveList = lstNewP(sizeof(ArchiveGetFindCacheArchive)),
+                    .warnList = strLstNew(),
+                };
+
+                const StringList *const archiveIdList = strLstNewSplitZ(
+                    varStr(kvGet(repoKv, VARSTR(ARCHIVE_GET_CHECK_CACHE_KEY_ARCHIVE_ID_STR))), ",");
+
+                for (unsigned int archiveIdx = 0; archiveIdx < strLstSize(archiveIdList); archiveIdx++)
+                {
+                    ArchiveGetFindCacheArchive cacheArchive =
+                    {
+                        .archiveId = strDup(strLstGet(archiveIdList, archiveIdx)),
+                        .pathList = lstNewP(sizeof(ArchiveGetFindCachePath), .comparator = lstComparatorStr),
+                    };
+
+                    lstAdd(cacheRepo.archiveList, &cacheArchive);
+                }
+
+                lstAdd(cacheData->repoList, &cacheRepo);
+            }
+            MEM_CONTEXT_END();
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Load the cached repo list. NULL is returned if the cache is missing, invalid, or expired.
+static List *
+archiveGetCheckCacheLoad(const PgControl controlInfo, MemContext *const memContext)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PG_CONTROL, controlInfo);
+        FUNCTION_LOG_PARAM(MEM_CONTEXT, memContext);
+    FUNCTION_LOG_END();
+
+    ASSERT(memContext != NULL);
+
+    List *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const Buffer *const cache = storageGetP(
+            storageNewReadP(
+                storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_CHECK_CACHE_FILE), .ignoreMissing = true));
+
+        if (cache != NULL)
+        {
+            ArchiveGetCheckCacheData cacheData =
+            {
+                .memContext = memContext,
+                .controlInfo = &controlInfo,
+                .valid = true,
+                .repoList = lstNewP(sizeof(ArchiveGetFindCacheRepo)),
+            };
+
+            // A cache that cannot be loaded is treated the same as an expired cache
+            TRY_BEGIN()
+            {
+                infoNewLoad(ioBufferReadNew(cache), archiveGetCheckCacheLoadCallback, &cacheData);
+            }
+            CATCH_ANY()
+            {
+                LOG_DETAIL_FMT("unable to load archive-get check cache: [%s] %s", errorTypeName(errorType()), errorMessage());
+                cacheData.valid = false;
+            }
+            TRY_END();
+
+            // The repos must match the repos that would be checked
+            unsigned int repoTotal = 0;
+
+            for (unsigned int repoIdx = 0; repoIdx < cfgOptionGroupIdxTotal(cfgOptGrpRepo); repoIdx++)
+            {
+                if (!cfgOptionTest(cfgOptRepo) || cfgOptionUInt(cfgOptRepo) == cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx))
+                    repoTotal++;
+            }
+
+            const TimeMSec timeNow = timeMSec();
+
+            if (cacheData.valid && lstSize(cacheData.repoList) == repoTotal && cacheData.time <= timeNow &&
+                timeNow - cacheData.time < cfgOptionUInt64(cfgOptArchiveGetCacheTtl))
+            {
+                result = lstMove(cacheData.repoList, memContextPrior());
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(LIST, result);
+}
+
+typedef struct ArchiveGetCheckCacheSaveData
+{
+    const PgControl *controlInfo;                                   // Current cluster
+    const List *repoList;                                           // Repo list to save
+} ArchiveGetCheckCacheSaveData;
+
+static void
+archiveGetCheckCacheSaveCallback(void *const data, const String *const sectionNext, InfoSave *const infoSaveData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STRING, sectionNext);
+        FUNCTION_TEST_PARAM(INFO_SAVE, infoSaveData);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(infoSaveData != NULL);
+
+    const ArchiveGetCheckCacheSaveData *const saveData = data;
+
+    if (infoSaveSection(infoSaveData, ARCHIVE_GET_CHECK_CACHE_SECTION_CACHE_STR, sectionNext))
+    {
+        infoSaveValue(
+            infoSaveData, ARCHIVE_GET_CHECK_CACHE_SECTION_CACHE_STR, ARCHIVE_GET_CHECK_CACHE_KEY_TIME_STR,
+            jsonFromUInt64(timeMSec()));
+    }
+
+    if (infoSaveSection(infoSaveData, ARCHIVE_GET_CHECK_CACHE_SECTION_DB_STR, sectionNext))
+    {
+        infoSaveValue(
+            infoSaveData, ARCHIVE_GET_CHECK_CACHE_SECTION_DB_STR, ARCHIVE_GET_CHECK_CACHE_KEY_SYSTEM_ID_STR,
+            jsonFromUInt64(saveData->controlInfo->systemId));
+        infoSaveValue(
+            infoSaveData, ARCHIVE_GET_CHECK_CACHE_SECTION_DB_STR, ARCHIVE_GET_CHECK_CACHE_KEY_VERSION_STR,
+            jsonFromUInt(saveData->controlInfo->version));
+    }
+
+    if (infoSaveSection(infoSaveData, ARCHIVE_GET_CHECK_CACHE_SECTION_REPO_STR, sectionNext))
+    {
+        for (unsigned int repoListIdx = 0; repoListIdx < lstSize(saveData->repoList); repoListIdx++)
+        {
+            const ArchiveGetFindCacheRepo *const cacheRepo = lstGet(saveData->repoList, repoListIdx);
+            StringList *const archiveIdList = strLstNew();
+
+            for (unsigned int archiveIdx = 0; archiveIdx < lstSize(cacheRepo->archiveList); archiveIdx++)
+                strLstAdd(archiveIdList, ((ArchiveGetFindCacheArchive *)lstGet(cacheRepo->archiveList, archiveIdx))->archiveId);
+
+            KeyValue *const repoKv = kvNew();
+
+            kvPut(repoKv, VARSTR(ARCHIVE_GET_CHECK_CACHE_KEY_ARCHIVE_ID_STR), VARSTR(strLstJoin(archiveIdList, ",")));
+            kvPut(repoKv, VARSTR(ARCHIVE_GET_CHECK_CACHE_KEY_CIPHER_TYPE_STR), VARSTR(cipherTypeName(cacheRepo->cipherType)));
+            kvPut(
+                repoKv, VARSTR(ARCHIVE_GET_CHECK_CACHE_KEY_PATH_STR), VARSTR(cfgOptionIdxStr(cfgOptRepoPath, cacheRepo->repoIdx)));
+
+            if (cacheRepo->cipherPassArchive != NULL)
+                kvPut(repoKv, VARSTR(ARCHIVE_GET_CHECK_CACHE_KEY_CIPHER_PASS_STR), VARSTR(cacheRepo->cipherPassArchive));
+
+            infoSaveValue(
+                infoSaveData, ARCHIVE_GET_CHECK_CACHE_SECTION_REPO_STR,
+                strNewFmt("%u", cfgOptionGroupIdxToKey(cfgOptGrpRepo, cacheRepo->repoIdx)), jsonFromKv(repoKv));
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Save the repo list to the cache. Errors are logged but otherwise ignored since the cache is only an optimization.
+static void
+archiveGetCheckCacheSave(const PgControl controlInfo, const List *const repoList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PG_CONTROL, controlInfo);
+        FUNCTION_LOG_PARAM(LIST, repoList);
+    FUNCTION_LOG_END();
+
+    ASSERT(repoList != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        TRY_BEGIN()
+        {
+            Buffer *const cache = bufNew(0);
+
+            infoSave(
+                infoNew(NULL), ioBufferWriteNew(cache), archiveGetCheckCacheSaveCallback,
+                &(ArchiveGetCheckCacheSaveData){.controlInfo = &controlInfo, .repoList = repoList});
+
+            storagePutP(
+                storageNewWriteP(
+                    storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_CHECK_CACHE_FILE), .modeFile = 0600),
+                cache);
+        }
+        CATCH_ANY()
+        {
+            LOG_DETAIL_FMT("unable to save archive-get check cache: [%s] %s", errorTypeName(errorType()), errorMessage());
+        }
+        TRY_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Find WAL in the repos
+***********************************************************************************************************************************/
 static ArchiveGetCheckResult
 archiveGetCheck(const StringList *archiveRequestList)
 {
@@ -373,146 +813,313 @@ archiveGetCheck(const StringList *archiveRequestList)
         // Get pg control info
         PgControl controlInfo = pgControlFromFile(storagePg());
 
-        // Build list of repos/archiveIds where WAL may be found
-        List *cacheRepoList = lstNewP(sizeof(ArchiveGetFindCacheRepo));
+        // The cache requires the spool path so it is only available in async mode
+        const bool cacheEnabled = cfgOptionBool(cfgOptArchiveAsync) && cfgOptionUInt64(cfgOptArchiveGetCacheTtl) > 0;
+        List *cacheRepoList = NULL;
 
-        for (unsigned int repoIdx = 0; repoIdx < cfgOptionGroupIdxTotal(cfgOptGrpRepo); repoIdx++)
+        // Attempt to find files using the cached repo list. If the first file is not found or there is an error then the repo list
+        // may be stale, so discard the result and check again without the cache.
+        if (cacheEnabled)
         {
-            // If a repo was specified then skip all other repos
-            if (cfgOptionTest(cfgOptRepo) && cfgOptionUInt(cfgOptRepo) != cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx))
-                continue;
+            cacheRepoList = archiveGetCheckCacheLoad(controlInfo, lstMemContext(result.archiveFileMapList));
 
-            TRY_BEGIN()
+            if (cacheRepoList != NULL)
             {
-                // Get the repo storage in case it is remote and encryption settings need to be pulled down
-                storageRepoIdx(repoIdx);
-
-                ArchiveGetFindCacheRepo cacheRepo =
-                {
-                    .repoIdx = repoIdx,
-                    .cipherType = cipherType(cfgOptionIdxStr(cfgOptRepoCipherType, repoIdx)),
-                    .archiveList = lstNewP(sizeof(ArchiveGetFindCacheArchive)),
-                    .warnList = strLstNew(),
-                };
-
-                // Attempt to load the archive info file
-                InfoArchive *info = infoArchiveLoadFile(
-                    storageRepoIdx(repoIdx), INFO_ARCHIVE_PATH_FILE_STR, cacheRepo.cipherType,
-                    cfgOptionIdxStrNull(cfgOptRepoCipherPass, repoIdx));
-
-                // Copy cipher pass into the result list context once rather than making a copy per candidate file later
                 MEM_CONTEXT_BEGIN(lstMemContext(result.archiveFileMapList))
                 {
-                    cacheRepo.cipherPassArchive = strDup(infoArchiveCipherPass(info));
+                    result.warnList = strLstNew();
                 }
                 MEM_CONTEXT_END();
 
-                // Loop through pg history and determine which archiveIds to use
-                StringList *archivePathList = NULL;
+                for (unsigned int archiveRequestIdx = 0; archiveRequestIdx < strLstSize(archiveRequestList); archiveRequestIdx++)
+                {
+                    if (!archiveGetFind(
+                            strLstGet(archiveRequestList, archiveRequestIdx), &result, cacheRepoList, result.warnList,
+                            strLstSize(archiveRequestList) == 1))
+                    {
+                        break;
+                    }
+                }
 
-                for (unsigned int pgIdx = 0; pgIdx < infoPgDataTotal(infoArchivePg(info)); pgIdx++)
+                if (result.errorType == NULL && !lstEmpty(result.archiveFileMapList))
                 {
-                    InfoPgData pgData = infoPgData(infoArchivePg(info), pgIdx);
+                    lstSort(result.archiveFileMapList, sortOrderAsc);
+                }
+                else
+                {
+                    LOG_DETAIL("archive-get check cache is stale, checking repos");
 
-                    // Only use the archive id if it matches the current cluster
-                    if (pgData.systemId == controlInfo.systemId && pgData.version == controlInfo.version)
-                    {
-                        const String *archiveId = infoPgArchiveId(infoArchivePg(info), pgIdx);
-                        bool found = true;
+                    lstFree(result.archiveFileMapList);
 
-                        // If the archiveId is in the past make sure the path exists
-                        if (pgIdx != 0)
+                    MEM_CONTEXT_PRIOR_BEGIN()
+                    {
+                        result = (ArchiveGetCheckResult)
                         {
-                            // Get list of archiveId paths in the archive path
-                            if (archivePathList == NULL)
-                                archivePathList = storageListP(storageRepoIdx(repoIdx), STORAGE_REPO_ARCHIVE_STR);
+                            .archiveFileMapList = lstNewP(sizeof(ArchiveFileMap), .comparator = lstComparatorStr),
+                        };
+                    }
+                    MEM_CONTEXT_PRIOR_END();
 
-                            if (!strLstExists(archivePathList, archiveId))
-                                found = false;
-                        }
+                    cacheRepoList = NULL;
+                }
+            }
+        }
 
-                        // If the archiveId is most recent or has files then add it
-                        if (found)
-                        {
-                            ArchiveGetFindCacheArchive cacheArchive =
-                            {
-                                .pathList = lstNewP(sizeof(ArchiveGetFindCachePath), .comparator = lstComparatorStr),
-                            };
+        // Build list of repos/archiveIds where WAL may be found and cache it when all repos are valid
+        if (cacheRepoList == NULL)
+        {
+            cacheRepoList = archiveGetCheckRepoList(controlInfo, lstMemContext(result.archiveFileMapList), warnList);
 
-                            // Copy archiveId into the result list context once rather than making a copy per candidate file later
-                            MEM_CONTEXT_BEGIN(lstMemContext(result.archiveFileMapList))
-                            {
-                                cacheArchive.archiveId = strDup(archiveId);
-                            }
-                            MEM_CONTEXT_END();
+            if (cacheEnabled && strLstEmpty(warnList))
+                archiveGetCheckCacheSave(controlInfo, cacheRepoList);
 
-                            lstAdd(cacheRepo.archiveList, &cacheArchive);
-                        }
-                    }
-                }
+            // Error if there are no repos to check
+            if (lstEmpty(cacheRepoList))
+            {
+                ASSERT(!strLstEmpty(warnList));
 
-                // Error if no archive id was found -- this indicates a mismatch with the current cluster
-                if (lstEmpty(cacheRepo.archiveList))
+                // Set as global error since processing cannot continue past this segment
+                MEM_CONTEXT_BEGIN(lstMemContext(result.archiveFileMapList))
                 {
-                    archiveGetErrorAdd(
-                        warnList, true, repoIdx, &ArchiveMismatchError,
-                        strNewFmt(
-                            "unable to retrieve the archive id for database version '%s' and system-id '%" PRIu64 "'",
-                            strZ(pgVersionToStr(controlInfo.version)), controlInfo.systemId));
+                    result.errorType = &RepoInvalidError;
+                    result.errorMessage = strNew(UNABLE_TO_FIND_VALID_REPO_MSG);
+                    result.warnList = strLstMove(warnList, memContextCurrent());
                 }
-                // Else add repo to list
-                else
-                    lstAdd(cacheRepoList, &cacheRepo);
+                MEM_CONTEXT_END();
             }
-            // Log errors as warnings and continue
-            CATCH_ANY()
+            else
             {
-                archiveGetErrorAdd(warnList, true, repoIdx, errorType(), STR(errorMessage()));
-            }
-            TRY_END();
-        }
+                // Any remaining errors will be reported as warnings since at least one repo is valid
+                MEM_CONTEXT_BEGIN(lstMemContext(result.archiveFileMapList))
+                {
+                    result.warnList = strLstMove(warnList, memContextCurrent());
+                }
+                MEM_CONTEXT_END();
 
-        // Error if there are no repos to check
-        if (lstEmpty(cacheRepoList))
-        {
-            ASSERT(!strLstEmpty(warnList));
+                // Find files in the list
+                for (unsigned int archiveRequestIdx = 0; archiveRequestIdx < strLstSize(archiveRequestList); archiveRequestIdx++)
+                {
+                    if (!archiveGetFind(
+                            strLstGet(archiveRequestList, archiveRequestIdx), &result, cacheRepoList, warnList,
+                            strLstSize(archiveRequestList) == 1))
+                    {
+                        break;
+                    }
+                }
 
-            // Set as global error since processing cannot continue past this segment
-            MEM_CONTEXT_BEGIN(lstMemContext(result.archiveFileMapList))
-            {
-                result.errorType = &RepoInvalidError;
-                result.errorMessage = strNew(UNABLE_TO_FIND_VALID_REPO_MSG);
-                result.warnList = strLstMove(warnList, memContextCurrent());
+                // Sort the list to make searching for files faster
+                lstSort(result.archiveFileMapList, sortOrderAsc);
             }
-            MEM_CONTEXT_END();
         }
-        else
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_STRUCT(result);
+}
+
+/***********************************************************************************************************************************
+Adaptive queue
+
+When archive-get-queue-adaptive is enabled the number of WAL segments kept in the queue is sized from the rate at which PostgreSQL
+consumes WAL and the rate at which the async process fetches it, so replay does not wait on a fetch but the spool is not filled
+beyond what is needed. The foreground process records consumption and the async process records fetch timing, each in a stat file
+in the queue so there is only one writer per file. Until both have been recorded the queue is sized from archive-get-queue-max.
+***********************************************************************************************************************************/
+#define ARCHIVE_GET_QUEUE_STAT_EXT                                  ".stat"
+#define ARCHIVE_GET_QUEUE_STAT_CONSUME                              "consume" ARCHIVE_GET_QUEUE_STAT_EXT
+#define ARCHIVE_GET_QUEUE_STAT_FETCH                                "fetch" ARCHIVE_GET_QUEUE_STAT_EXT
+
+STRING_STATIC(ARCHIVE_GET_QUEUE_STAT_TIME_STR,                      "time");
+STRING_STATIC(ARCHIVE_GET_QUEUE_STAT_INTERVAL_STR,                  "interval");
+STRING_STATIC(ARCHIVE_GET_QUEUE_STAT_LATENCY_STR,                   "latency");
+
+// Save a stat file. The stats are only used to size the queue so losing an update in a crash does no harm. Syncs are skipped so
+// restore_command, which records consumption for every segment, does not wait on the disk.
+static void
+archiveGetQueueStatSave(const char *const file, const KeyValue *const stat)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRINGZ, file);
+        FUNCTION_TEST_PARAM(KEY_VALUE, stat);
+    FUNCTION_TEST_END();
+
+    ASSERT(file != NULL);
+    ASSERT(stat != NULL);
+
+    storagePutP(
+        storageNewWriteP(
+            storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_IN "/%s", file), .noSyncFile = true, .noSyncPath = true),
+        BUFSTR(jsonFromKv(stat)));
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Load a stat file. An empty KeyValue is returned when the file does not exist.
+static KeyValue *
+archiveGetQueueStatLoad(const char *const file)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRINGZ, file);
+    FUNCTION_TEST_END();
+
+    ASSERT(file != NULL);
+
+    const Buffer *const stat = storageGetP(
+        storageNewReadP(storageSpool(), strNewFmt(STORAGE_SPOOL_ARCHIVE_IN "/%s", file), .ignoreMissing = true));
+
+    FUNCTION_TEST_RETURN(stat == NULL ? kvNew() : jsonToKv(strNewBuf(stat)));
+}
+
+// Get a stat value or zero when it has not been recorded
+static TimeMSec
+archiveGetQueueStat(const KeyValue *const stat, const String *const key)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(KEY_VALUE, stat);
+        FUNCTION_TEST_PARAM(STRING, key);
+    FUNCTION_TEST_END();
+
+    ASSERT(stat != NULL);
+    ASSERT(key != NULL);
+
+    const Variant *const value = kvGet(stat, VARSTR(key));
+
+    FUNCTION_TEST_RETURN(value == NULL ? 0 : varUInt64Force(value));
+}
+
+// Add a sample to a moving average that gives the most weight to recent samples
+static void
+archiveGetQueueStatSample(KeyValue *const stat, const String *const key, const TimeMSec sample)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(KEY_VALUE, stat);
+        FUNCTION_TEST_PARAM(STRING, key);
+        FUNCTION_TEST_PARAM(TIME_MSEC, sample);
+    FUNCTION_TEST_END();
+
+    ASSERT(stat != NULL);
+    ASSERT(key != NULL);
+
+    const TimeMSec average = archiveGetQueueStat(stat, key);
+
+    kvPut(stat, VARSTR(key), VARUINT64(average == 0 ? sample : (average * 3 + sample) / 4));
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Record that PostgreSQL consumed a WAL segment from the queue. When PostgreSQL had to wait for the segment the interval measures
+// the fetch rate rather than the replay rate so only the time is recorded.
+static void
+archiveGetQueueConsume(const bool waited)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(BOOL, waited);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        KeyValue *const stat = archiveGetQueueStatLoad(ARCHIVE_GET_QUEUE_STAT_CONSUME);
+        const TimeMSec time = archiveGetQueueStat(stat, ARCHIVE_GET_QUEUE_STAT_TIME_STR);
+        const TimeMSec now = timeMSec();
+
+        if (!waited && time != 0 && now > time)
+            archiveGetQueueStatSample(stat, ARCHIVE_GET_QUEUE_STAT_INTERVAL_STR, now - time);
+
+        kvPut(stat, VARSTR(ARCHIVE_GET_QUEUE_STAT_TIME_STR), VARUINT64(now));
+
+        archiveGetQueueStatSave(ARCHIVE_GET_QUEUE_STAT_CONSUME, stat);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Record fetch timing for a run of the async process. Latency is the time until the first segment was ready, including startup,
+// and interval is the time per segment after that.
+static void
+archiveGetQueueFetch(const TimeMSec begin, const TimeMSec first, const TimeMSec last, const unsigned int total)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(TIME_MSEC, begin);
+        FUNCTION_LOG_PARAM(TIME_MSEC, first);
+        FUNCTION_LOG_PARAM(TIME_MSEC, last);
+        FUNCTION_LOG_PARAM(UINT, total);
+    FUNCTION_LOG_END();
+
+    ASSERT(total > 0);
+    ASSERT(first >= begin && last >= first);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        KeyValue *const stat = archiveGetQueueStatLoad(ARCHIVE_GET_QUEUE_STAT_FETCH);
+
+        // Samples are at least 1ms so a recorded value is never zero
+        archiveGetQueueStatSample(stat, ARCHIVE_GET_QUEUE_STAT_LATENCY_STR, first - begin + 1);
+
+        if (total > 1)
+            archiveGetQueueStatSample(stat, ARCHIVE_GET_QUEUE_STAT_INTERVAL_STR, (last - first) / (total - 1) + 1);
+
+        archiveGetQueueStatSave(ARCHIVE_GET_QUEUE_STAT_FETCH, stat);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Determine how many WAL segments should be in the queue
+***********************************************************************************************************************************/
+static unsigned int
+archiveGetQueueTotal(const uint64_t queueSize, const size_t walSegmentSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT64, queueSize);
+        FUNCTION_LOG_PARAM(SIZE, walSegmentSize);
+    FUNCTION_LOG_END();
+
+    // The queue total must be at least 2 or it doesn't make sense to have async turned on at all
+    unsigned int result = (unsigned int)(queueSize / walSegmentSize);
+
+    if (result < 2)
+        result = 2;
+
+    // Size the queue from the consume and fetch rates. The async process is started when the queue is half empty, so the half that
+    // remains must last until the async process makes the next segments ready. Segment k of the new run is ready at latency +
+    // (k - 1) * fetch and needed at (half + k - 1) * consume. When fetch <= consume the first segment is the hardest to get in
+    // time, otherwise the last is. If fetch is twice consume or more the queue cannot keep up so the maximum is used.
+    if (cfgOptionBool(cfgOptArchiveGetQueueAdaptive))
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
         {
-            // Any remaining errors will be reported as warnings since at least one repo is valid
-            MEM_CONTEXT_BEGIN(lstMemContext(result.archiveFileMapList))
-            {
-                result.warnList = strLstMove(warnList, memContextCurrent());
-            }
-            MEM_CONTEXT_END();
+            const TimeMSec consume = archiveGetQueueStat(
+                archiveGetQueueStatLoad(ARCHIVE_GET_QUEUE_STAT_CONSUME), ARCHIVE_GET_QUEUE_STAT_INTERVAL_STR);
+            const KeyValue *const fetchStat = archiveGetQueueStatLoad(ARCHIVE_GET_QUEUE_STAT_FETCH);
+            const TimeMSec latency = archiveGetQueueStat(fetchStat, ARCHIVE_GET_QUEUE_STAT_LATENCY_STR);
+            const TimeMSec fetch = archiveGetQueueStat(fetchStat, ARCHIVE_GET_QUEUE_STAT_INTERVAL_STR);
 
-            // Find files in the list
-            for (unsigned int archiveRequestIdx = 0; archiveRequestIdx < strLstSize(archiveRequestList); archiveRequestIdx++)
+            if (consume != 0 && latency != 0 && fetch < consume * 2)
             {
-                if (!archiveGetFind(
-                        strLstGet(archiveRequestList, archiveRequestIdx), &result, cacheRepoList, warnList,
-                        strLstSize(archiveRequestList) == 1))
+                // Segments needed for the first segment of the new run to be ready in time
+                uint64_t half = (latency + consume - 1) / consume;
+
+                // Segments needed for the last segment of the new run to be ready in time
+                if (fetch > consume && latency + consume > fetch)
                 {
-                    break;
+                    const uint64_t halfLast = (latency + consume - fetch + (consume * 2 - fetch) - 1) / (consume * 2 - fetch);
+
+                    if (halfLast > half)
+                        half = halfLast;
                 }
-            }
 
-            // Sort the list to make searching for files faster
-            lstSort(result.archiveFileMapList, sortOrderAsc);
+                // Add a segment for variation in the rates
+                if ((half + 1) * 2 < result)
+                    result = (unsigned int)(half + 1) * 2;
+            }
         }
+        MEM_CONTEXT_TEMP_END();
     }
-    MEM_CONTEXT_TEMP_END();
 
-    FUNCTION_LOG_RETURN_STRUCT(result);
+    FUNCTION_LOG_RETURN(UINT, result);
 }
 
 /***********************************************************************************************************************************
@@ -541,12 +1148,8 @@ queueNeed(const String *walSegment, bool found, uint64_t queueSize, size_t walSe
         const String *walSegmentFirst =
             found ? walSegmentNext(walSegment, walSegmentSize, pgVersion) : walSegment;
 
-        // Determine how many WAL segments should be in the queue.  The queue total must be at least 2 or it doesn't make sense to
-        // have async turned on at all.
-        unsigned int walSegmentQueueTotal = (unsigned int)(queueSize / walSegmentSize);
-
-        if (walSegmentQueueTotal < 2)
-            walSegmentQueueTotal = 2;
+        // Determine how many WAL segments should be in the queue
+        unsigned int walSegmentQueueTotal = archiveGetQueueTotal(queueSize, walSegmentSize);
 
         // Build the ideal queue -- the WAL segments we want in the queue after the async process has run
         StringList *idealQueue = strLstSort(
@@ -570,10 +1173,13 @@ queueNeed(const String *walSegment, bool found, uint64_t queueSize, size_t walSe
                 strLstAdd(keepQueue, file);
             }
             // Else delete if it does not match an ok file for a WAL segment that has already been preserved. If an ok file exists
-            // in addition to the segment then it contains warnings which need to be preserved.
+            // in addition to the segment then it contains warnings which need to be preserved. Stat files for the adaptive queue
+            // and the check cache are preserved while they are enabled.
             else if (
-                !strEndsWithZ(file, STATUS_EXT_OK) ||
-                !strLstExists(actualQueue, strSubN(file, 0, strSize(file) - STATUS_EXT_OK_SIZE)))
+                !(strEndsWithZ(file, ARCHIVE_GET_QUEUE_STAT_EXT) && cfgOptionBool(cfgOptArchiveGetQueueAdaptive)) &&
+                !(strEqZ(file, ARCHIVE_GET_CHECK_CACHE_FILE) && cfgOptionUInt64(cfgOptArchiveGetCacheTtl) > 0) &&
+                (!strEndsWithZ(file, STATUS_EXT_OK) ||
+                 !strLstExists(actualQueue, strSubN(file, 0, strSize(file) - STATUS_EXT_OK_SIZE))))
             {
                 storageRemoveP(storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_IN "/%s", strZ(file)), .errorOnMissing = true);
             }
@@ -681,6 +1287,11 @@ cmdArchiveGet(void)
                     LOG_INFO_FMT(FOUND_IN_ARCHIVE_MSG " asynchronously", strZ(walSegment));
                     result = 0;
 
+                    // Record consumption for the adaptive queue. If the segment was not found on the first check then PostgreSQL
+                    // had to wait for it.
+                    if (cfgOptionBool(cfgOptArchiveGetQueueAdaptive))
+                        archiveGetQueueConsume(throwOnError);
+
                     // Get a list of WAL segments left in the queue
                     StringList *queue = storageListP(
                         storageSpool(), STORAGE_SPOOL_ARCHIVE_IN_STR, .expression = WAL_SEGMENT_REGEXP_STR, .errorOnMissing = true);
@@ -691,7 +1302,14 @@ cmdArchiveGet(void)
                         uint64_t walSegmentSize = storageInfoP(storageLocal(), walDestination).size;
 
                         // Use WAL segment size to estimate queue size and determine if the async process should be launched
-                        queueFull = strLstSize(queue) * walSegmentSize > cfgOptionUInt64(cfgOptArchiveGetQueueMax) / 2;
+                        if (cfgOptionBool(cfgOptArchiveGetQueueAdaptive))
+                        {
+                            queueFull =
+                                strLstSize(queue) > archiveGetQueueTotal(
+                                    cfgOptionUInt64(cfgOptArchiveGetQueueMax), (size_t)walSegmentSize) / 2;
+                        }
+                        else
+                            queueFull = strLstSize(queue) * walSegmentSize > cfgOptionUInt64(cfgOptArchiveGetQueueMax) / 2;
                     }
                 }
 
@@ -858,6 +1476,12 @@ cmdArchiveGetAsync(void)
     {
         TRY_BEGIN()
         {
+            // Fetch timing for the adaptive queue
+            const TimeMSec fetchBegin = timeMSec();
+            TimeMSec fetchFirst = 0;
+            TimeMSec fetchLast = 0;
+            unsigned int fetchTotal = 0;
+
             // PostgreSQL must be local
             pgIsLocalVerify();
 
@@ -887,7 +1511,8 @@ cmdArchiveGetAsync(void)
                 ArchiveGetAsyncData jobData = {.archiveFileMapList = checkResult.archiveFileMapList};
 
                 ProtocolParallel *parallelExec = protocolParallelNew(
-                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, archiveGetAsyncCallback, &jobData);
+                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, cfgOptionUInt(cfgOptJobQueueMax),
+                    archiveGetAsyncCallback, &jobData);
 
                 for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
                     protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
@@ -947,6 +1572,14 @@ cmdArchiveGetAsync(void)
                                     storageSpool(),
                                     strNewFmt(STORAGE_SPOOL_ARCHIVE_IN "/%s." STORAGE_FILE_TEMP_EXT, strZ(walSegment))),
                                 storageNewWriteP(storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_IN "/%s", strZ(walSegment))));
+
+                            // Update fetch timing
+                            fetchLast = timeMSec();
+
+                            if (fetchTotal == 0)
+                                fetchFirst = fetchLast;
+
+                            fetchTotal++;
                         }
                         // Else the job errored
                         else
@@ -966,6 +1599,10 @@ cmdArchiveGetAsync(void)
                     }
                 }
                 while (!protocolParallelDone(parallelExec));
+
+                // Record fetch timing for the adaptive queue
+                if (cfgOptionBool(cfgOptArchiveGetQueueAdaptive) && fetchTotal > 0)
+                    archiveGetQueueFetch(fetchBegin, fetchFirst, fetchLast, fetchTotal);
             }
 
             // Log an error from archiveGetCheck() after any existing files have been fetched. This ordering is important because we
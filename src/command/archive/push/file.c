@@ -9,6 +9,7 @@ Archive Push File
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
 #include "common/debug.h"
+#include "common/io/bufferWrite.h"
 #include "common/io/filter/group.h"
 #include "common/io/io.h"
 #include "common/log.h"
@@ -92,11 +93,134 @@ archivePushFileIo(ArchivePushFileIoType type, IoWrite *write, const Buffer *buff
     FUNCTION_TEST_RETURN(result);
 }
 
+/***********************************************************************************************************************************
+Compare archive version and systemId to the WAL header
+***********************************************************************************************************************************/
+static void
+archivePushHeaderCheck(const String *walSource, unsigned int pgVersion, uint64_t pgSystemId)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, walSource);
+        FUNCTION_TEST_PARAM(UINT, pgVersion);
+        FUNCTION_TEST_PARAM(UINT64, pgSystemId);
+    FUNCTION_TEST_END();
+
+    ASSERT(walSource != NULL);
+
+    PgWal walInfo = pgWalFromFile(walSource, storageLocal());
+
+    if (walInfo.version != pgVersion || walInfo.systemId != pgSystemId)
+    {
+        THROW_FMT(
+            ArchiveMismatchError,
+            "WAL file '%s' version %s, system-id %" PRIu64 " do not match stanza version %s, system-id %" PRIu64,
+            strZ(walSource), strZ(pgVersionToStr(walInfo.version)), walInfo.systemId, strZ(pgVersionToStr(pgVersion)),
+            pgSystemId);
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Warning when a WAL segment already exists in the repo with the same checksum
+***********************************************************************************************************************************/
+static String *
+archivePushExistsWarning(const String *walSegment, unsigned int repoIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, walSegment);
+        FUNCTION_TEST_PARAM(UINT, repoIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(walSegment != NULL);
+
+    FUNCTION_TEST_RETURN(
+        strNewFmt(
+            "WAL file '%s' already exists in the repo%u archive with the same checksum"
+            "\nHINT: this is valid in some recovery scenarios but may also indicate a problem.",
+            strZ(walSegment), cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx)));
+}
+
+/***********************************************************************************************************************************
+Copy WAL files to the spool queues of deferred repos
+
+The copy is done here rather than by the async process so that it runs in parallel with the other pushes. When a copy fails the repo
+is added to the list of repos to push to now (or the error is reported when the repo is not valid) so the WAL files are not lost.
+The queues where all the WAL files were copied are added to the queued list.
+***********************************************************************************************************************************/
+static void
+archivePushQueue(
+    const StringList *const sourceList, const StringList *const fileList, const List *const queueList, List *const repoList,
+    StringList *const errorList, StringList *const warnList, StringList *const queuedList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING_LIST, sourceList);
+        FUNCTION_TEST_PARAM(STRING_LIST, fileList);
+        FUNCTION_TEST_PARAM(LIST, queueList);
+        FUNCTION_TEST_PARAM(LIST, repoList);
+        FUNCTION_TEST_PARAM(STRING_LIST, errorList);
+        FUNCTION_TEST_PARAM(STRING_LIST, warnList);
+        FUNCTION_TEST_PARAM(STRING_LIST, queuedList);
+    FUNCTION_TEST_END();
+
+    ASSERT(sourceList != NULL);
+    ASSERT(fileList != NULL);
+    ASSERT(strLstSize(sourceList) == strLstSize(fileList));
+    ASSERT(queueList != NULL);
+    ASSERT(repoList != NULL);
+    ASSERT(errorList != NULL);
+    ASSERT(warnList != NULL);
+    ASSERT(queuedList != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        for (unsigned int queueIdx = 0; queueIdx < lstSize(queueList); queueIdx++)
+        {
+            const ArchivePushFileQueue *const queue = lstGet(queueList, queueIdx);
+            bool queued = true;
+
+            TRY_BEGIN()
+            {
+                for (unsigned int fileIdx = 0; fileIdx < strLstSize(fileList); fileIdx++)
+                {
+                    storageCopyP(
+                        storageNewReadP(storageLocal(), strLstGet(sourceList, fileIdx)),
+                        storageNewWriteP(
+                            storageLocalWrite(), strNewFmt("%s/%s", strZ(queue->path), strZ(strLstGet(fileList, fileIdx)))));
+                }
+            }
+            CATCH_ANY()
+            {
+                strLstAdd(
+                    warnList,
+                    strNewFmt(
+                        "unable to queue WAL for deferred repo%u: [%s] %s",
+                        cfgOptionGroupIdxToKey(cfgOptGrpRepo, queue->repoData.repoIdx), errorTypeName(errorType()),
+                        errorMessage()));
+
+                queued = false;
+            }
+            TRY_END();
+
+            if (queued)
+                strLstAdd(queuedList, queue->path);
+            else if (queue->error == NULL)
+                lstAdd(repoList, &queue->repoData);
+            else
+                strLstAdd(errorList, queue->error);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 ArchivePushFileResult
 archivePushFile(
     const String *walSource, bool headerCheck, unsigned int pgVersion, uint64_t pgSystemId, const String *archiveFile,
-    CompressType compressType, int compressLevel, const List *const repoList, const StringList *const priorErrorList)
+    CompressType compressType, int compressLevel, const List *const repoList, const List *const queueList,
+    const StringList *const priorErrorList)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, walSource);
@@ -107,16 +231,23 @@ archivePushFile(
         FUNCTION_LOG_PARAM(ENUM, compressType);
         FUNCTION_LOG_PARAM(INT, compressLevel);
         FUNCTION_LOG_PARAM_P(VOID, repoList);
+        FUNCTION_LOG_PARAM_P(VOID, queueList);
         FUNCTION_LOG_PARAM(STRING_LIST, priorErrorList);
     FUNCTION_LOG_END();
 
     ASSERT(walSource != NULL);
     ASSERT(archiveFile != NULL);
     ASSERT(repoList != NULL);
+    ASSERT(queueList != NULL);
     ASSERT(priorErrorList != NULL);
     ASSERT(lstSize(repoList) > 0);
 
-    ArchivePushFileResult result = {.warnList = strLstNew()};
+    ArchivePushFileResult result =
+    {
+        .warnList = strLstNew(),
+        .indexList = lstNewP(sizeof(ArchivePushFileIndex)),
+        .queueList = strLstNew(),
+    };
     StringList *errorList = strLstDup(priorErrorList);
 
     MEM_CONTEXT_TEMP_BEGIN()
@@ -126,27 +257,31 @@ archivePushFile(
 
         // If this is a segment compare archive version and systemId to the WAL header
         if (headerCheck && isSegment)
-        {
-            PgWal walInfo = pgWalFromFile(walSource, storageLocal());
+            archivePushHeaderCheck(walSource, pgVersion, pgSystemId);
 
-            if (walInfo.version != pgVersion || walInfo.systemId != pgSystemId)
-            {
-                THROW_FMT(
-                    ArchiveMismatchError,
-                    "WAL file '%s' version %s, system-id %" PRIu64 " do not match stanza version %s, system-id %" PRIu64,
-                    strZ(walSource), strZ(pgVersionToStr(walInfo.version)), walInfo.systemId, strZ(pgVersionToStr(pgVersion)),
-                    pgSystemId);
-            }
-        }
+        // Copy the file to the queues of deferred repos. Repos where the copy failed are pushed to with the others.
+        List *const repoPushList = lstNewP(sizeof(ArchivePushFileRepoData));
+
+        StringList *const walSourceList = strLstNew();
+        StringList *const archiveFileList = strLstNew();
+
+        for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoList); repoListIdx++)
+            lstAdd(repoPushList, lstGet(repoList, repoListIdx));
+
+        strLstAdd(walSourceList, walSource);
+        strLstAdd(archiveFileList, archiveFile);
+
+        archivePushQueue(
+            walSourceList, archiveFileList, queueList, repoPushList, errorList, result.warnList, result.queueList);
 
         // Set archive destination initially to the archive file, this will be updated later for wal segments
         String *archiveDestination = strDup(archiveFile);
 
         // Assume that all repos need a copy of the archive file
         bool destinationCopyAny = true;
-        bool *destinationCopy = memNew(sizeof(bool) * lstSize(repoList));
+        bool *destinationCopy = memNew(sizeof(bool) * lstSize(repoPushList));
 
-        for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoList); repoListIdx++)
+        for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoPushList); repoListIdx++)
             destinationCopy[repoListIdx] = true;
 
         // Get wal segment checksum and compare it to what exists in the repo, if any
@@ -163,9 +298,9 @@ archivePushFile(
             const String *walSegmentChecksum = varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
 
             // Check each repo for the WAL segment
-            for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoList); repoListIdx++)
+            for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoPushList); repoListIdx++)
             {
-                const ArchivePushFileRepoData *const repoData = lstGet(repoList, repoListIdx);
+                const ArchivePushFileRepoData *const repoData = lstGet(repoPushList, repoListIdx);
 
                 // Check if the WAL segement already exists in the repo
                 const String *walSegmentFile = NULL;
@@ -188,7 +323,8 @@ archivePushFile(
                 // If the WAL segment was found validate the checksum
                 if (walSegmentFile != NULL)
                 {
-                    String *walSegmentRepoChecksum = strSubN(walSegmentFile, strSize(archiveFile) + 1, HASH_TYPE_SHA1_SIZE_HEX);
+                    String *walSegmentRepoChecksum = strSubN(
+                        strBase(walSegmentFile), strSize(archiveFile) + 1, HASH_TYPE_SHA1_SIZE_HEX);
 
                     // If the checksums are the same then succeed but warn in case this is a symptom of some other issue
                     if (strEq(walSegmentChecksum, walSegmentRepoChecksum))
@@ -196,12 +332,7 @@ archivePushFile(
                         MEM_CONTEXT_PRIOR_BEGIN()
                         {
                             // Add warning to the result that will be returned to the main process
-                            strLstAdd(
-                                result.warnList,
-                                strNewFmt(
-                                    "WAL file '%s' already exists in the repo%u archive with the same checksum"
-                                    "\nHINT: this is valid in some recovery scenarios but may also indicate a problem.",
-                                    strZ(archiveFile), cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoData->repoIdx)));
+                            strLstAdd(result.warnList, archivePushExistsWarning(archiveFile, repoData->repoIdx));
                         }
                         MEM_CONTEXT_PRIOR_END();
 
@@ -244,11 +375,11 @@ archivePushFile(
             }
 
             // Initialize per-repo destination files
-            StorageWrite **destination = memNew(sizeof(StorageWrite *) * lstSize(repoList));
+            StorageWrite **destination = memNew(sizeof(StorageWrite *) * lstSize(repoPushList));
 
-            for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoList); repoListIdx++)
+            for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoPushList); repoListIdx++)
             {
-                const ArchivePushFileRepoData *const repoData = lstGet(repoList, repoListIdx);
+                const ArchivePushFileRepoData *const repoData = lstGet(repoPushList, repoListIdx);
 
                 // Does this repo need a copy?
                 if (destinationCopy[repoListIdx])
@@ -273,9 +404,9 @@ archivePushFile(
             ioReadOpen(storageReadIo(source));
 
             // Open the destination files now that we know the source file exists and is readable
-            for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoList); repoListIdx++)
+            for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoPushList); repoListIdx++)
             {
-                const unsigned int repoIdx = ((ArchivePushFileRepoData *)lstGet(repoList, repoListIdx))->repoIdx;
+                const unsigned int repoIdx = ((ArchivePushFileRepoData *)lstGet(repoPushList, repoListIdx))->repoIdx;
 
                 if (destinationCopy[repoListIdx])
                 {
@@ -293,9 +424,9 @@ archivePushFile(
                 ioRead(storageReadIo(source), read);
 
                 // Write to each destination
-                for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoList); repoListIdx++)
+                for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoPushList); repoListIdx++)
                 {
-                    const unsigned int repoIdx = ((ArchivePushFileRepoData *)lstGet(repoList, repoListIdx))->repoIdx;
+                    const unsigned int repoIdx = ((ArchivePushFileRepoData *)lstGet(repoPushList, repoListIdx))->repoIdx;
 
                     if (destinationCopy[repoListIdx])
                     {
@@ -312,9 +443,9 @@ archivePushFile(
             // Close the source and destination files
             ioReadClose(storageReadIo(source));
 
-            for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoList); repoListIdx++)
+            for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoPushList); repoListIdx++)
             {
-                const unsigned int repoIdx = ((ArchivePushFileRepoData *)lstGet(repoList, repoListIdx))->repoIdx;
+                const unsigned int repoIdx = ((ArchivePushFileRepoData *)lstGet(repoPushList, repoListIdx))->repoIdx;
 
                 if (destinationCopy[repoListIdx])
                 {
@@ -322,6 +453,31 @@ archivePushFile(
                         archivePushFileIoTypeClose, storageWriteIo(destination[repoListIdx]), NULL, repoIdx, errorList);
                 }
             }
+
+            // Return an index entry for the WAL segment in each repo where it was written
+            if (isSegment)
+            {
+                for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoPushList); repoListIdx++)
+                {
+                    if (destinationCopy[repoListIdx])
+                    {
+                        const ArchivePushFileRepoData *const repoData = lstGet(repoPushList, repoListIdx);
+
+                        MEM_CONTEXT_BEGIN(lstMemContext(result.indexList))
+                        {
+                            lstAdd(
+                                result.indexList,
+                                &(ArchivePushFileIndex)
+                                {
+                                    .repoIdx = repoData->repoIdx,
+                                    .archiveId = strDup(repoData->archiveId),
+                                    .file = strDup(archiveDestination),
+                                });
+                        }
+                        MEM_CONTEXT_END();
+                    }
+                }
+            }
         }
     }
     MEM_CONTEXT_TEMP_END();
@@ -333,3 +489,299 @@ archivePushFile(
 
     FUNCTION_LOG_RETURN_STRUCT(result);
 }
+
+/**********************************************************************************************************************************/
+List *
+archivePushBundle(
+    const String *walPath, bool headerCheck, unsigned int pgVersion, uint64_t pgSystemId, const StringList *walSegmentList,
+    CompressType compressType, int compressLevel, const List *const repoList, const List *const queueList,
+    const StringList *const priorErrorList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, walPath);
+        FUNCTION_LOG_PARAM(BOOL, headerCheck);
+        FUNCTION_LOG_PARAM(UINT, pgVersion);
+        FUNCTION_LOG_PARAM(UINT64, pgSystemId);
+        FUNCTION_LOG_PARAM(STRING_LIST, walSegmentList);
+        FUNCTION_LOG_PARAM(ENUM, compressType);
+        FUNCTION_LOG_PARAM(INT, compressLevel);
+        FUNCTION_LOG_PARAM_P(VOID, repoList);
+        FUNCTION_LOG_PARAM_P(VOID, queueList);
+        FUNCTION_LOG_PARAM(STRING_LIST, priorErrorList);
+    FUNCTION_LOG_END();
+
+    ASSERT(walPath != NULL);
+    ASSERT(walSegmentList != NULL);
+    ASSERT(strLstSize(walSegmentList) > 0 && strLstSize(walSegmentList) <= WAL_BUNDLE_SEGMENT_MAX);
+    ASSERT(repoList != NULL);
+    ASSERT(queueList != NULL);
+    ASSERT(priorErrorList != NULL);
+    ASSERT(lstSize(repoList) > 0);
+
+    List *result = lstNewP(sizeof(ArchivePushFileResult));
+    StringList *errorList = strLstDup(priorErrorList);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Read and compress each segment once so the result can be stored in all repos
+        StringList *walSourceList = strLstNew();
+        StringList *archiveFileList = strLstNew();
+        Buffer **archiveBufList = memNew(sizeof(Buffer *) * strLstSize(walSegmentList));
+
+        for (unsigned int walSegmentIdx = 0; walSegmentIdx < strLstSize(walSegmentList); walSegmentIdx++)
+        {
+            const String *walSegment = strLstGet(walSegmentList, walSegmentIdx);
+            const String *walSource = strLstAdd(walSourceList, strNewFmt("%s/%s", strZ(walPath), strZ(walSegment)));
+
+            ASSERT(walIsSegment(walSegment) && !walIsPartial(walSegment));
+            ASSERT(strEq(strSubN(walSegment, 0, 16), strSubN(strLstGet(walSegmentList, 0), 0, 16)));
+
+            if (headerCheck)
+                archivePushHeaderCheck(walSource, pgVersion, pgSystemId);
+
+            // Generate a sha1 checksum for the segment while compressing it
+            IoRead *read = storageReadIo(storageNewReadP(storageLocal(), walSource));
+            ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
+
+            if (compressType != compressTypeNone)
+                ioFilterGroupAdd(ioReadFilterGroup(read), compressFilter(compressType, compressLevel));
+
+            ioReadOpen(read);
+            archiveBufList[walSegmentIdx] = ioReadBuf(read);
+            ioReadClose(read);
+
+            strLstAdd(
+                archiveFileList,
+                strNewFmt(
+                    "%s-%s%s", strZ(walSegment),
+                    strZ(varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR))),
+                    strZ(compressExtStr(compressType))));
+
+            MEM_CONTEXT_BEGIN(lstMemContext(result))
+            {
+                lstAdd(
+                    result,
+                    &(ArchivePushFileResult)
+                    {
+                        .warnList = strLstNew(),
+                        .indexList = lstNewP(sizeof(ArchivePushFileIndex)),
+                        .queueList = strLstNew(),
+                    });
+            }
+            MEM_CONTEXT_END();
+        }
+
+        // Copy the segments to the queues of deferred repos. Repos where the copy failed are pushed to with the others. Warnings
+        // are returned with the first segment.
+        List *const repoPushList = lstNewP(sizeof(ArchivePushFileRepoData));
+        StringList *const queuedList = strLstNew();
+
+        for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoList); repoListIdx++)
+            lstAdd(repoPushList, lstGet(repoList, repoListIdx));
+
+        archivePushQueue(
+            walSourceList, walSegmentList, queueList, repoPushList, errorList,
+            ((ArchivePushFileResult *)lstGet(result, 0))->warnList, queuedList);
+
+        for (unsigned int walSegmentIdx = 0; walSegmentIdx < strLstSize(walSegmentList); walSegmentIdx++)
+        {
+            ArchivePushFileResult *fileResult = lstGet(result, walSegmentIdx);
+
+            for (unsigned int queuedIdx = 0; queuedIdx < strLstSize(queuedList); queuedIdx++)
+                strLstAdd(fileResult->queueList, strLstGet(queuedList, queuedIdx));
+        }
+
+        // Store the segments that each repo does not already have in a bundle
+        for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoPushList); repoListIdx++)
+        {
+            const ArchivePushFileRepoData *const repoData = lstGet(repoPushList, repoListIdx);
+            const Storage *const storage = storageRepoIdx(repoData->repoIdx);
+            const String *const walSegmentPath = strSubN(strLstGet(walSegmentList, 0), 0, 16);
+            bool bundleWrite = true;
+
+            // List the archive path once to check for segments that have already been pushed
+            StringList *repoFileList = NULL;
+
+            TRY_BEGIN()
+            {
+                repoFileList = storageListP(
+                    storage, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(repoData->archiveId), strZ(walSegmentPath)),
+                    .expression = strNewFmt(
+                        "^(%s[0-F]{8}-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}|" WAL_BUNDLE_REGEXP ")$", strZ(walSegmentPath)));
+            }
+            CATCH_ANY()
+            {
+                archivePushErrorAdd(errorList, repoData->repoIdx);
+                bundleWrite = false;
+            }
+            TRY_END();
+
+            // If there was an error try the next repo
+            if (!bundleWrite)
+                continue;
+
+            // Add each segment that is not already in the repo to the bundle
+            List *bundleFileList = lstNewP(sizeof(WalBundleFile));
+            Buffer **bundleBufList = memNew(sizeof(Buffer *) * strLstSize(walSegmentList));
+            unsigned int *bundleSegmentIdxList = memNew(sizeof(unsigned int) * strLstSize(walSegmentList));
+            uint64_t bundleOffset = WAL_BUNDLE_HEADER_SIZE;
+
+            for (unsigned int walSegmentIdx = 0; walSegmentIdx < strLstSize(walSegmentList); walSegmentIdx++)
+            {
+                const String *walSegment = strLstGet(walSegmentList, walSegmentIdx);
+                const String *archiveFile = strLstGet(archiveFileList, walSegmentIdx);
+                const String *walSegmentChecksum = strSubN(archiveFile, strSize(walSegment) + 1, HASH_TYPE_SHA1_SIZE_HEX);
+                StringList *walSegmentFileList = NULL;
+
+                TRY_BEGIN()
+                {
+                    walSegmentFileList = walSegmentFindList(storage, repoData->archiveId, repoFileList, walSegment);
+                }
+                CATCH_ANY()
+                {
+                    archivePushErrorAdd(errorList, repoData->repoIdx);
+                    bundleWrite = false;
+                }
+                TRY_END();
+
+                // If there was an error skip this repo
+                if (!bundleWrite)
+                    break;
+
+                // If the segment was found then validate the checksum
+                if (!strLstEmpty(walSegmentFileList))
+                {
+                    for (unsigned int fileIdx = 0; fileIdx < strLstSize(walSegmentFileList); fileIdx++)
+                    {
+                        const String *walSegmentRepoChecksum = strSubN(
+                            strBase(strLstGet(walSegmentFileList, fileIdx)), strSize(walSegment) + 1, HASH_TYPE_SHA1_SIZE_HEX);
+
+                        // Error so we don't overwrite the existing segment. Do not continue processing after this error since it
+                        // indicates corruption, split brain, or some other unrecoverable error.
+                        if (!strEq(walSegmentChecksum, walSegmentRepoChecksum))
+                        {
+                            THROW_FMT(
+                                ArchiveDuplicateError,
+                                "WAL file '%s' already exists in the repo%u archive with a different checksum", strZ(walSegment),
+                                cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoData->repoIdx));
+                        }
+                    }
+
+                    // The checksums are the same so succeed but warn in case this is a symptom of some other issue
+                    ArchivePushFileResult *fileResult = lstGet(result, walSegmentIdx);
+
+                    MEM_CONTEXT_BEGIN(lstMemContext(result))
+                    {
+                        strLstAdd(fileResult->warnList, archivePushExistsWarning(walSegment, repoData->repoIdx));
+                    }
+                    MEM_CONTEXT_END();
+
+                    continue;
+                }
+
+                // Encrypt the segment for this repo if there is a cipher
+                Buffer *bundleBuf = archiveBufList[walSegmentIdx];
+
+                if (repoData->cipherType != cipherTypeNone)
+                {
+                    Buffer *encryptBuf = bufNew(0);
+                    IoWrite *encrypt = ioBufferWriteNew(encryptBuf);
+                    ioFilterGroupAdd(
+                        ioWriteFilterGroup(encrypt),
+                        cipherBlockNew(cipherModeEncrypt, repoData->cipherType, BUFSTR(repoData->cipherPass), NULL));
+
+                    ioWriteOpen(encrypt);
+                    ioWrite(encrypt, bundleBuf);
+                    ioWriteClose(encrypt);
+
+                    bundleBuf = encryptBuf;
+                }
+
+                bundleBufList[lstSize(bundleFileList)] = bundleBuf;
+                bundleSegmentIdxList[lstSize(bundleFileList)] = walSegmentIdx;
+                lstAdd(
+                    bundleFileList, &(WalBundleFile){.file = archiveFile, .offset = bundleOffset, .size = bufUsed(bundleBuf)});
+                bundleOffset += bufUsed(bundleBuf);
+            }
+
+            // Write the bundle
+            if (bundleWrite && !lstEmpty(bundleFileList))
+            {
+                StorageWrite *destination = storageNewWriteP(
+                    storageRepoIdxWrite(repoData->repoIdx),
+                    strNewFmt(
+                        STORAGE_REPO_ARCHIVE "/%s/%s-%s" WAL_BUNDLE_EXT, strZ(repoData->archiveId),
+                        strZ(strSubN(((WalBundleFile *)lstGet(bundleFileList, 0))->file, 0, WAL_SEGMENT_NAME_SIZE)),
+                        strZ(strSubN(((WalBundleFile *)lstGetLast(bundleFileList))->file, 0, WAL_SEGMENT_NAME_SIZE))),
+                    .compressible = false);
+
+                bundleWrite = archivePushFileIo(
+                    archivePushFileIoTypeOpen, storageWriteIo(destination), NULL, repoData->repoIdx, errorList);
+
+                if (bundleWrite)
+                {
+                    bundleWrite = archivePushFileIo(
+                        archivePushFileIoTypeWrite, storageWriteIo(destination), walBundleHeader(bundleFileList),
+                        repoData->repoIdx, errorList);
+                }
+
+                for (unsigned int bundleFileIdx = 0; bundleWrite && bundleFileIdx < lstSize(bundleFileList); bundleFileIdx++)
+                {
+                    bundleWrite = archivePushFileIo(
+                        archivePushFileIoTypeWrite, storageWriteIo(destination), bundleBufList[bundleFileIdx], repoData->repoIdx,
+                        errorList);
+                }
+
+                if (bundleWrite)
+                {
+                    bundleWrite = archivePushFileIo(
+                        archivePushFileIoTypeClose, storageWriteIo(destination), NULL, repoData->repoIdx, errorList);
+                }
+
+                // Return an index entry for each bundled WAL segment
+                if (bundleWrite)
+                {
+                    const String *bundle = strBase(storageWriteName(destination));
+
+                    for (unsigned int bundleFileIdx = 0; bundleFileIdx < lstSize(bundleFileList); bundleFileIdx++)
+                    {
+                        ArchivePushFileResult *fileResult = lstGet(result, bundleSegmentIdxList[bundleFileIdx]);
+
+                        MEM_CONTEXT_BEGIN(lstMemContext(fileResult->indexList))
+                        {
+                            lstAdd(
+                                fileResult->indexList,
+                                &(ArchivePushFileIndex)
+                                {
+                                    .repoIdx = repoData->repoIdx,
+                                    .archiveId = strDup(repoData->archiveId),
+                                    .file = strNewFmt(
+                                        "%s/%s", strZ(bundle),
+                                        strZ(((WalBundleFile *)lstGet(bundleFileList, bundleFileIdx))->file)),
+                                });
+                        }
+                        MEM_CONTEXT_END();
+                    }
+                }
+            }
+
+            // Free the encrypted segments so only one repo's copy is held in memory at a time
+            if (repoData->cipherType != cipherTypeNone)
+            {
+                for (unsigned int bundleFileIdx = 0; bundleFileIdx < lstSize(bundleFileList); bundleFileIdx++)
+                    bufFree(bundleBufList[bundleFileIdx]);
+            }
+
+            memFree(bundleBufList);
+            memFree(bundleSegmentIdxList);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    // Throw any errors, even if some pushes were successful. It is important that PostgreSQL receives an error so it does not
+    // remove the files.
+    if (strLstSize(errorList) > 0)
+        THROW_FMT(CommandError, CFGCMD_ARCHIVE_PUSH " command encountered error(s):\n%s", strZ(strLstJoin(errorList, "\n")));
+
+    FUNCTION_LOG_RETURN(LIST, result);
+}
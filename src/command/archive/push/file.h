@@ -6,7 +6,9 @@ Archive Push File
 
 #include "common/compress/helper.h"
 #include "common/crypto/common.h"
+#include "common/type/list.h"
 #include "common/type/string.h"
+#include "common/type/stringList.h"
 #include "storage/storage.h"
 
 /***********************************************************************************************************************************
@@ -21,17 +23,45 @@ typedef struct ArchivePushFileRepoData
     const String *cipherPass;
 } ArchivePushFileRepoData;
 
+/***********************************************************************************************************************************
+Queue in the spool where the archive file will be copied for a deferred repository. When the copy fails the file is pushed to the
+repository immediately, or the error is reported when the repository is not valid.
+***********************************************************************************************************************************/
+typedef struct ArchivePushFileQueue
+{
+    const String *path;                                             // Absolute path of the queue
+    const String *error;                                            // Error when the repo is not valid, else repoData is set
+    ArchivePushFileRepoData repoData;                               // Repo data
+} ArchivePushFileQueue;
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
+// Entry to add to the WAL index of a repo. The index is updated by the caller so updates can be batched.
+typedef struct ArchivePushFileIndex
+{
+    unsigned int repoIdx;                                           // Repo where the file was stored
+    const String *archiveId;                                        // Archive id where the file was stored
+    const String *file;                                             // Index entry, i.e. file or bundle/file
+} ArchivePushFileIndex;
+
 typedef struct ArchivePushFileResult
 {
     StringList *warnList;                                           // Warnings from a successful operation
+    List *indexList;                                                // Entries to add to the WAL index (ArchivePushFileIndex)
+    StringList *queueList;                                          // Queue paths where the file was copied
 } ArchivePushFileResult;
 
 // Copy a file from the source to the archive
 ArchivePushFileResult archivePushFile(
     const String *walSource, bool headerCheck, unsigned int pgVersion, uint64_t pgSystemId, const String *archiveFile,
-    CompressType compressType, int compressLevel, const List *const repoList, const StringList *const priorErrorList);
+    CompressType compressType, int compressLevel, const List *const repoList, const List *const queueList,
+    const StringList *const priorErrorList);
+
+// Copy WAL segments from the same archive path to a bundle in the archive. Returns an ArchivePushFileResult for each segment.
+List *archivePushBundle(
+    const String *walPath, bool headerCheck, unsigned int pgVersion, uint64_t pgSystemId, const StringList *walSegmentList,
+    CompressType compressType, int compressLevel, const List *const repoList, const List *const queueList,
+    const StringList *const priorErrorList);
 
 #endif
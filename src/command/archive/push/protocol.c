@@ -16,6 +16,117 @@ Archive Push Protocol Handler
 Constants
 ***********************************************************************************************************************************/
 STRING_EXTERN(PROTOCOL_COMMAND_ARCHIVE_PUSH_FILE_STR,               PROTOCOL_COMMAND_ARCHIVE_PUSH_FILE);
+STRING_EXTERN(PROTOCOL_COMMAND_ARCHIVE_PUSH_BUNDLE_STR,             PROTOCOL_COMMAND_ARCHIVE_PUSH_BUNDLE);
+
+/***********************************************************************************************************************************
+Build the repo data list from the parameters that follow the fixed parameters
+***********************************************************************************************************************************/
+#define ARCHIVE_PUSH_PARAM_REPO_TOTAL                               8
+
+static List *
+archivePushRepoList(const VariantList *paramList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(VARIANT_LIST, paramList);
+    FUNCTION_TEST_END();
+
+    ASSERT(paramList != NULL);
+
+    List *result = lstNewP(sizeof(ArchivePushFileRepoData));
+    unsigned int repoListSize = varUIntForce(varLstGet(paramList, ARCHIVE_PUSH_PARAM_REPO_TOTAL));
+    unsigned int paramIdx = ARCHIVE_PUSH_PARAM_REPO_TOTAL + 1;
+
+    for (unsigned int repoListIdx = 0; repoListIdx < repoListSize; repoListIdx++)
+    {
+        lstAdd(
+            result,
+            &(ArchivePushFileRepoData)
+            {
+                .repoIdx = varUIntForce(varLstGet(paramList, paramIdx)),
+                .archiveId = varStr(varLstGet(paramList, paramIdx + 1)),
+                .cipherType = (CipherType)varUIntForce(varLstGet(paramList, paramIdx + 2)),
+                .cipherPass = varStr(varLstGet(paramList, paramIdx + 3)),
+            });
+
+        paramIdx += 4;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Build the queue list for deferred repos from the parameters that follow the repo data
+***********************************************************************************************************************************/
+static List *
+archivePushQueueList(const VariantList *paramList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(VARIANT_LIST, paramList);
+    FUNCTION_TEST_END();
+
+    ASSERT(paramList != NULL);
+
+    List *result = lstNewP(sizeof(ArchivePushFileQueue));
+    unsigned int paramIdx =
+        ARCHIVE_PUSH_PARAM_REPO_TOTAL + 1 + varUIntForce(varLstGet(paramList, ARCHIVE_PUSH_PARAM_REPO_TOTAL)) * 4;
+    unsigned int queueListSize = varUIntForce(varLstGet(paramList, paramIdx));
+
+    paramIdx++;
+
+    for (unsigned int queueListIdx = 0; queueListIdx < queueListSize; queueListIdx++)
+    {
+        lstAdd(
+            result,
+            &(ArchivePushFileQueue)
+            {
+                .path = varStr(varLstGet(paramList, paramIdx)),
+                .error = varStr(varLstGet(paramList, paramIdx + 1)),
+                .repoData =
+                {
+                    .repoIdx = varUIntForce(varLstGet(paramList, paramIdx + 2)),
+                    .archiveId = varStr(varLstGet(paramList, paramIdx + 3)),
+                    .cipherType = (CipherType)varUIntForce(varLstGet(paramList, paramIdx + 4)),
+                    .cipherPass = varStr(varLstGet(paramList, paramIdx + 5)),
+                },
+            });
+
+        paramIdx += 6;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Render the result for a file as a list of the warnings, the index entries (repo index, archive id, and file for each entry), and the
+queue paths where the file was copied
+***********************************************************************************************************************************/
+static Variant *
+archivePushFileResultVar(const ArchivePushFileResult *const fileResult)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, fileResult);
+    FUNCTION_TEST_END();
+
+    ASSERT(fileResult != NULL);
+
+    VariantList *const indexList = varLstNew();
+
+    for (unsigned int indexIdx = 0; indexIdx < lstSize(fileResult->indexList); indexIdx++)
+    {
+        const ArchivePushFileIndex *const index = lstGet(fileResult->indexList, indexIdx);
+
+        varLstAdd(indexList, varNewUInt(index->repoIdx));
+        varLstAdd(indexList, varNewStr(index->archiveId));
+        varLstAdd(indexList, varNewStr(index->file));
+    }
+
+    VariantList *const result = varLstNew();
+    varLstAdd(result, varNewVarLst(varLstNewStrLst(fileResult->warnList)));
+    varLstAdd(result, varNewVarLst(indexList));
+    varLstAdd(result, varNewVarLst(varLstNewStrLst(fileResult->queueList)));
+
+    FUNCTION_TEST_RETURN(varNewVarLst(result));
+}
 
 /**********************************************************************************************************************************/
 void
@@ -31,36 +142,50 @@ archivePushFileProtocol(const VariantList *paramList, ProtocolServer *server)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Build the repo data list
-        List *repoList = lstNewP(sizeof(ArchivePushFileRepoData));
-        unsigned int repoListSize = varUIntForce(varLstGet(paramList, 8));
-        unsigned int paramIdx = 9;
-
-        for (unsigned int repoListIdx = 0; repoListIdx < repoListSize; repoListIdx++)
-        {
-            lstAdd(
-                repoList,
-                &(ArchivePushFileRepoData)
-                {
-                    .repoIdx = varUIntForce(varLstGet(paramList, paramIdx)),
-                    .archiveId = varStr(varLstGet(paramList, paramIdx + 1)),
-                    .cipherType = (CipherType)varUIntForce(varLstGet(paramList, paramIdx + 2)),
-                    .cipherPass = varStr(varLstGet(paramList, paramIdx + 3)),
-                });
-
-            paramIdx += 4;
-        }
-
         // Push the file
         ArchivePushFileResult fileResult = archivePushFile(
             varStr(varLstGet(paramList, 0)), varBool(varLstGet(paramList, 1)), varUIntForce(varLstGet(paramList, 2)),
             varUInt64(varLstGet(paramList, 3)), varStr(varLstGet(paramList, 4)),
-            (CompressType)varUIntForce(varLstGet(paramList, 5)), varIntForce(varLstGet(paramList, 6)), repoList,
-            strLstNewVarLst(varVarLst(varLstGet(paramList, 7))));
+            (CompressType)varUIntForce(varLstGet(paramList, 5)), varIntForce(varLstGet(paramList, 6)),
+            archivePushRepoList(paramList), archivePushQueueList(paramList), strLstNewVarLst(varVarLst(varLstGet(paramList, 7))));
 
         // Return result
         VariantList *result = varLstNew();
-        varLstAdd(result, varNewVarLst(varLstNewStrLst(fileResult.warnList)));
+        varLstAdd(result, archivePushFileResultVar(&fileResult));
+
+        protocolServerResponse(server, varNewVarLst(result));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+archivePushBundleProtocol(const VariantList *paramList, ProtocolServer *server)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(VARIANT_LIST, paramList);
+        FUNCTION_LOG_PARAM(PROTOCOL_SERVER, server);
+    FUNCTION_LOG_END();
+
+    ASSERT(paramList != NULL);
+    ASSERT(server != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Push the bundle
+        const List *fileResultList = archivePushBundle(
+            varStr(varLstGet(paramList, 0)), varBool(varLstGet(paramList, 1)), varUIntForce(varLstGet(paramList, 2)),
+            varUInt64(varLstGet(paramList, 3)), strLstNewVarLst(varVarLst(varLstGet(paramList, 4))),
+            (CompressType)varUIntForce(varLstGet(paramList, 5)), varIntForce(varLstGet(paramList, 6)),
+            archivePushRepoList(paramList), archivePushQueueList(paramList), strLstNewVarLst(varVarLst(varLstGet(paramList, 7))));
+
+        // Return result for each segment
+        VariantList *result = varLstNew();
+
+        for (unsigned int fileResultIdx = 0; fileResultIdx < lstSize(fileResultList); fileResultIdx++)
+            varLstAdd(result, archivePushFileResultVar(lstGet(fileResultList, fileResultIdx)));
 
         protocolServerResponse(server, varNewVarLst(result));
     }
@@ -13,17 +13,21 @@ Constants
 ***********************************************************************************************************************************/
 #define PROTOCOL_COMMAND_ARCHIVE_PUSH_FILE                          "archivePushFile"
     STRING_DECLARE(PROTOCOL_COMMAND_ARCHIVE_PUSH_FILE_STR);
+#define PROTOCOL_COMMAND_ARCHIVE_PUSH_BUNDLE                        "archivePushBundle"
+    STRING_DECLARE(PROTOCOL_COMMAND_ARCHIVE_PUSH_BUNDLE_STR);
 
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
 // Process protocol requests
 void archivePushFileProtocol(const VariantList *paramList, ProtocolServer *server);
+void archivePushBundleProtocol(const VariantList *paramList, ProtocolServer *server);
 
 /***********************************************************************************************************************************
 Protocol commands for ProtocolServerHandler arrays passed to protocolServerProcess()
 ***********************************************************************************************************************************/
 #define PROTOCOL_SERVER_HANDLER_ARCHIVE_PUSH_LIST                                                                                  \
-    {.command = PROTOCOL_COMMAND_ARCHIVE_PUSH_FILE, .handler = archivePushFileProtocol},
+    {.command = PROTOCOL_COMMAND_ARCHIVE_PUSH_FILE, .handler = archivePushFileProtocol},                                           \
+    {.command = PROTOCOL_COMMAND_ARCHIVE_PUSH_BUNDLE, .handler = archivePushBundleProtocol},
 
 #endif
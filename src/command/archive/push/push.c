@@ -36,6 +36,11 @@ Ready file extension constants
 #define STATUS_EXT_READY                                            ".ready"
 #define STATUS_EXT_READY_SIZE                                       (sizeof(STATUS_EXT_READY) - 1)
 
+/***********************************************************************************************************************************
+Path in the spool out directory where WAL files are queued for deferred repositories
+***********************************************************************************************************************************/
+#define ARCHIVE_PUSH_DEFER_PATH                                     "defer"
+
 /***********************************************************************************************************************************
 Format the warning when a file is dropped
 ***********************************************************************************************************************************/
@@ -124,9 +129,9 @@ archivePushReadyList(const String *walPath)
 Determine which WAL files need to be pushed to the archive when in async mode
 
 This is the heart of the "look ahead" functionality in async archiving.  Any files in the out directory that do not end in ok are
-removed and any ok files that do not have a corresponding ready file in archive_status (meaning it has been acknowledged by
-PostgreSQL) are removed.  Then all ready files that do not have a corresponding ok file (meaning it has already been processed) are
-returned for processing.
+removed (except for the path where WAL files are queued for deferred repositories) and any ok files that do not have a corresponding
+ready file in archive_status (meaning it has been acknowledged by PostgreSQL) are removed.  Then all ready files that do not have a
+corresponding ok file (meaning it has already been processed) are returned for processing.
 ***********************************************************************************************************************************/
 static StringList *
 archivePushProcessList(const String *walPath)
@@ -157,7 +162,7 @@ archivePushProcessList(const String *walPath)
 
             if (strEndsWithZ(statusFile, STATUS_EXT_OK))
                 strLstAdd(okList, strSubN(statusFile, 0, strSize(statusFile) - STATUS_EXT_OK_SIZE));
-            else
+            else if (!strEqZ(statusFile, ARCHIVE_PUSH_DEFER_PATH))
             {
                 storageRemoveP(
                     storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_OUT "/%s", strZ(statusFile)), .errorOnMissing = true);
@@ -298,6 +303,80 @@ archivePushCheck(bool pgPathSet)
     FUNCTION_LOG_RETURN_STRUCT(result);
 }
 
+/***********************************************************************************************************************************
+Add WAL files to the index in each repo where they were stored
+
+Entries are grouped by repo and WAL path so each index is read and written once for all the WAL files that were stored. WAL is found
+using the index without listing the path, so a WAL file that was stored must not be missing from the index. If the index cannot be
+updated then it is removed so the path will be listed instead, and the push fails if the index cannot be removed either.
+***********************************************************************************************************************************/
+static void
+archivePushIndexUpdate(const List *const indexList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(LIST, indexList);
+    FUNCTION_LOG_END();
+
+    ASSERT(indexList != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        bool *const indexDone = memNew(sizeof(bool) * (lstSize(indexList) + 1));
+
+        for (unsigned int indexIdx = 0; indexIdx < lstSize(indexList); indexIdx++)
+            indexDone[indexIdx] = false;
+
+        for (unsigned int indexIdx = 0; indexIdx < lstSize(indexList); indexIdx++)
+        {
+            if (indexDone[indexIdx])
+                continue;
+
+            // Gather all the files for the same repo and WAL path
+            const ArchivePushFileIndex *const index = lstGet(indexList, indexIdx);
+            const String *const walPath = strSubN(index->file, 0, 16);
+            StringList *const fileList = strLstNew();
+
+            for (unsigned int indexFindIdx = indexIdx; indexFindIdx < lstSize(indexList); indexFindIdx++)
+            {
+                const ArchivePushFileIndex *const indexFind = lstGet(indexList, indexFindIdx);
+
+                if (!indexDone[indexFindIdx] && indexFind->repoIdx == index->repoIdx &&
+                    strEq(indexFind->archiveId, index->archiveId) && strBeginsWith(indexFind->file, walPath))
+                {
+                    strLstAdd(fileList, indexFind->file);
+                    indexDone[indexFindIdx] = true;
+                }
+            }
+
+            bool indexRemove = false;
+
+            TRY_BEGIN()
+            {
+                walIndexAdd(storageRepoIdxWrite(index->repoIdx), index->archiveId, walPath, fileList);
+            }
+            CATCH_ANY()
+            {
+                LOG_WARN_FMT(
+                    "unable to update WAL index in the repo%u archive: [%s] %s",
+                    cfgOptionGroupIdxToKey(cfgOptGrpRepo, index->repoIdx), errorTypeName(errorType()), errorMessage());
+
+                indexRemove = true;
+            }
+            TRY_END();
+
+            if (indexRemove)
+            {
+                storageRemoveP(
+                    storageRepoIdxWrite(index->repoIdx),
+                    strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s/" WAL_INDEX_FILE, strZ(index->archiveId), strZ(walPath)));
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 void
 cmdArchivePush(void)
@@ -414,12 +493,15 @@ cmdArchivePush(void)
                 ArchivePushFileResult fileResult = archivePushFile(
                     walFile, cfgOptionBool(cfgOptArchiveHeaderCheck), archiveInfo.pgVersion, archiveInfo.pgSystemId, archiveFile,
                     compressTypeEnum(cfgOptionStr(cfgOptCompressType)), cfgOptionInt(cfgOptCompressLevel), archiveInfo.repoList,
-                    archiveInfo.errorList);
+                    lstNewP(sizeof(ArchivePushFileQueue)), archiveInfo.errorList);
 
                 // If a warning was returned then log it
                 for (unsigned int warnIdx = 0; warnIdx < strLstSize(fileResult.warnList); warnIdx++)
                     LOG_WARN(strZ(strLstGet(fileResult.warnList, warnIdx)));
 
+                // Add the file to the index in each repo where it was stored
+                archivePushIndexUpdate(fileResult.indexList);
+
                 // Log success
                 LOG_INFO_FMT("pushed WAL file '%s' to the archive", strZ(archiveFile));
             }
@@ -430,17 +512,481 @@ cmdArchivePush(void)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Repositories with repo-archive-push-defer enabled are not pushed to before PostgreSQL is notified. Instead, WAL files are copied to
+a queue in the spool path and pushed to each deferred repository by separate jobs, so a slow repository does not delay archiving.
+***********************************************************************************************************************************/
+typedef struct ArchivePushDeferRepo
+{
+    unsigned int repoIdx;                                           // Repo index
+    const ArchivePushFileRepoData *repoData;                        // Repo data (NULL when the repo is not valid)
+    const String *error;                                            // Error when the repo is not valid
+    const String *path;                                             // Queue path in the spool
+    StringList *queue;                                              // WAL files in the queue
+    unsigned int queueIdx;                                          // Current index in the queue to be processed
+    uint64_t queueSize;                                             // Total size of WAL files in the queue
+} ArchivePushDeferRepo;
+
+// Split deferred repos from the repos that must be pushed to before PostgreSQL is notified. Deferral is disabled when there are no
+// valid repos left to push to before notifying PostgreSQL.
+static List *
+archivePushDeferInit(ArchivePushCheckResult *const archiveInfo)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, archiveInfo);
+    FUNCTION_LOG_END();
+
+    ASSERT(archiveInfo != NULL);
+
+    List *const result = lstNewP(sizeof(ArchivePushDeferRepo));
+    bool required = false;
+
+    for (unsigned int repoListIdx = 0; repoListIdx < lstSize(archiveInfo->repoList); repoListIdx++)
+    {
+        const ArchivePushFileRepoData *const repoData = lstGet(archiveInfo->repoList, repoListIdx);
+
+        if (!cfgOptionIdxBool(cfgOptRepoArchivePushDefer, repoData->repoIdx))
+            required = true;
+    }
+
+    if (required)
+    {
+        List *const repoList = lstNewP(sizeof(ArchivePushFileRepoData));
+        StringList *const errorList = strLstNew();
+
+        for (unsigned int repoIdx = 0; repoIdx < cfgOptionGroupIdxTotal(cfgOptGrpRepo); repoIdx++)
+        {
+            // Find the repo data or the error when the repo is not valid
+            const ArchivePushFileRepoData *repoData = NULL;
+            const String *error = NULL;
+
+            for (unsigned int repoListIdx = 0; repoListIdx < lstSize(archiveInfo->repoList); repoListIdx++)
+            {
+                const ArchivePushFileRepoData *const repoDataFind = lstGet(archiveInfo->repoList, repoListIdx);
+
+                if (repoDataFind->repoIdx == repoIdx)
+                {
+                    repoData = repoDataFind;
+                    break;
+                }
+            }
+
+            if (repoData == NULL)
+            {
+                const String *const errorPrefix = strNewFmt("repo%u: ", cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx));
+
+                for (unsigned int errorIdx = 0; errorIdx < strLstSize(archiveInfo->errorList); errorIdx++)
+                {
+                    if (strBeginsWith(strLstGet(archiveInfo->errorList, errorIdx), errorPrefix))
+                    {
+                        error = strLstGet(archiveInfo->errorList, errorIdx);
+                        break;
+                    }
+                }
+
+                ASSERT(error != NULL);
+            }
+
+            // Add deferred repos to the defer list and all others to the list of repos to push to before notifying PostgreSQL
+            if (cfgOptionIdxBool(cfgOptRepoArchivePushDefer, repoIdx))
+            {
+                if (repoData == NULL)
+                    LOG_WARN_FMT("WAL will be queued but not pushed for deferred %s", strZ(error));
+
+                lstAdd(
+                    result,
+                    &(ArchivePushDeferRepo)
+                    {
+                        .repoIdx = repoIdx,
+                        .repoData = repoData,
+                        .error = error,
+                        .path = strNewFmt(
+                            STORAGE_SPOOL_ARCHIVE_OUT "/" ARCHIVE_PUSH_DEFER_PATH "/repo%u",
+                            cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx)),
+                    });
+            }
+            else if (repoData != NULL)
+                lstAdd(repoList, repoData);
+            else
+                strLstAdd(errorList, error);
+        }
+
+        archiveInfo->repoList = repoList;
+        archiveInfo->errorList = errorList;
+    }
+
+    FUNCTION_LOG_RETURN(LIST, result);
+}
+
+// Load the queue for a deferred repo from the spool
+static void
+archivePushDeferLoad(ArchivePushDeferRepo *const defer)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, defer);
+    FUNCTION_LOG_END();
+
+    ASSERT(defer != NULL);
+
+    defer->queue = strLstNew();
+    defer->queueIdx = 0;
+    defer->queueSize = 0;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const StringList *const fileList = strLstSort(storageListP(storageSpool(), defer->path), sortOrderAsc);
+
+        for (unsigned int fileIdx = 0; fileIdx < strLstSize(fileList); fileIdx++)
+        {
+            const String *const file = strLstGet(fileList, fileIdx);
+            const String *const filePath = strNewFmt("%s/%s", strZ(defer->path), strZ(file));
+
+            // Remove temp files left by a copy that did not complete. WAL file names never end in .tmp.
+            if (strEndsWithZ(file, ".tmp"))
+            {
+                storageRemoveP(storageSpoolWrite(), filePath);
+                continue;
+            }
+
+            strLstAdd(defer->queue, file);
+            defer->queueSize += storageInfoP(storageSpool(), filePath).size;
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    if (defer->repoData != NULL && !strLstEmpty(defer->queue))
+    {
+        LOG_INFO_FMT(
+            "push %u deferred WAL file(s) to the repo%u archive", strLstSize(defer->queue),
+            cfgOptionGroupIdxToKey(cfgOptGrpRepo, defer->repoIdx));
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 typedef struct ArchivePushAsyncData
 {
+    MemContext *memContext;                                         // Context for data kept until the async process exits
     const String *walPath;                                          // Path to pg_wal/pg_xlog
-    const StringList *walFileList;                                  // List of wal files to process
+    StringList *walFileList;                                        // List of wal files to process
     unsigned int walFileIdx;                                        // Current index in the list to be processed
     CompressType compressType;                                      // Type of compression for WAL segments
     int compressLevel;                                              // Compression level for wal files
+    unsigned int bundleMax;                                         // Max WAL segments to store in a single bundle
+    uint64_t deferMax;                                              // Max size of the queue for each deferred repo
     ArchivePushCheckResult archiveInfo;                             // Archive info
+    List *deferList;                                                // Deferred repos
+    unsigned int deferIdx;                                          // Next deferred repo to get a job from
+    unsigned int clientTotal;                                       // Clients that push to the required repos
+    unsigned int jobTotal;                                          // Jobs running that push to the required repos
+    bool error;                                                     // Has a push to the required repos failed?
+    List *indexList;                                                // Entries to add to the WAL index
+    List *okList;                                                   // Status to write once the WAL files are in the index
+    StringList *queueRemoveList;                                    // Queue files to remove once the WAL files are in the index
 } ArchivePushAsyncData;
 
+// Status of a WAL file that was pushed
+typedef struct ArchivePushAsyncOk
+{
+    const String *walFile;                                          // WAL file that was pushed
+    const String *warning;                                          // Warnings for the WAL file (NULL when there are none)
+} ArchivePushAsyncOk;
+
+// Add the index entries from a job result (a list of the repo index, archive id, and file for each entry) to the list that will be
+// added to the WAL index when the jobs are complete
+static void
+archivePushAsyncIndexAdd(ArchivePushAsyncData *const jobData, const VariantList *const indexList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+        FUNCTION_TEST_PARAM(VARIANT_LIST, indexList);
+    FUNCTION_TEST_END();
+
+    ASSERT(jobData != NULL);
+    ASSERT(indexList != NULL);
+    ASSERT(varLstSize(indexList) % 3 == 0);
+
+    MEM_CONTEXT_BEGIN(lstMemContext(jobData->indexList))
+    {
+        for (unsigned int indexIdx = 0; indexIdx < varLstSize(indexList); indexIdx += 3)
+        {
+            lstAdd(
+                jobData->indexList,
+                &(ArchivePushFileIndex)
+                {
+                    .repoIdx = varUIntForce(varLstGet(indexList, indexIdx)),
+                    .archiveId = strDup(varStr(varLstGet(indexList, indexIdx + 1))),
+                    .file = strDup(varStr(varLstGet(indexList, indexIdx + 2))),
+                });
+        }
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Add the WAL files in the index to each repo where they were stored. Only then are PostgreSQL notified and the WAL files removed
+// from the queues of deferred repos, so a WAL file is never considered pushed when it could not be found. The lists are reset for
+// the jobs that follow.
+static void
+archivePushAsyncIndexUpdate(ArchivePushAsyncData *const jobData)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, jobData);
+    FUNCTION_LOG_END();
+
+    ASSERT(jobData != NULL);
+
+    archivePushIndexUpdate(jobData->indexList);
+
+    for (unsigned int okIdx = 0; okIdx < lstSize(jobData->okList); okIdx++)
+    {
+        const ArchivePushAsyncOk *const ok = lstGet(jobData->okList, okIdx);
+        archiveAsyncStatusOkWrite(archiveModePush, ok->walFile, ok->warning);
+    }
+
+    for (unsigned int queueIdx = 0; queueIdx < strLstSize(jobData->queueRemoveList); queueIdx++)
+        storageRemoveP(storageSpoolWrite(), strLstGet(jobData->queueRemoveList, queueIdx), .errorOnMissing = true);
+
+    MEM_CONTEXT_BEGIN(jobData->memContext)
+    {
+        lstFree(jobData->indexList);
+        jobData->indexList = lstNewP(sizeof(ArchivePushFileIndex));
+        lstFree(jobData->okList);
+        jobData->okList = lstNewP(sizeof(ArchivePushAsyncOk));
+        strLstFree(jobData->queueRemoveList);
+        jobData->queueRemoveList = strLstNew();
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Build the command to push a WAL file or a bundle of WAL files (when walFile is a list) to a list of repos and copy it to the
+// queues of deferred repos
+static ProtocolCommand *
+archivePushAsyncCommand(
+    const ArchivePushAsyncData *const jobData, const String *const walSource, const Variant *const walFile,
+    const List *const repoList, const List *const queueList, const StringList *const errorList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+        FUNCTION_TEST_PARAM(STRING, walSource);
+        FUNCTION_TEST_PARAM(VARIANT, walFile);
+        FUNCTION_TEST_PARAM(LIST, repoList);
+        FUNCTION_TEST_PARAM(LIST, queueList);
+        FUNCTION_TEST_PARAM(STRING_LIST, errorList);
+    FUNCTION_TEST_END();
+
+    ProtocolCommand *const result = protocolCommandNew(
+        varType(walFile) == varTypeString ? PROTOCOL_COMMAND_ARCHIVE_PUSH_FILE_STR : PROTOCOL_COMMAND_ARCHIVE_PUSH_BUNDLE_STR);
+
+    protocolCommandParamAdd(result, VARSTR(walSource));
+    protocolCommandParamAdd(result, VARBOOL(cfgOptionBool(cfgOptArchiveHeaderCheck)));
+    protocolCommandParamAdd(result, VARUINT(jobData->archiveInfo.pgVersion));
+    protocolCommandParamAdd(result, VARUINT64(jobData->archiveInfo.pgSystemId));
+    protocolCommandParamAdd(result, walFile);
+    protocolCommandParamAdd(result, VARUINT(jobData->compressType));
+    protocolCommandParamAdd(result, VARINT(jobData->compressLevel));
+    protocolCommandParamAdd(result, varNewVarLst(varLstNewStrLst(errorList)));
+    protocolCommandParamAdd(result, VARUINT(lstSize(repoList)));
+
+    // Add data for each repo to push to
+    for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoList); repoListIdx++)
+    {
+        const ArchivePushFileRepoData *const data = lstGet(repoList, repoListIdx);
+
+        protocolCommandParamAdd(result, VARUINT(data->repoIdx));
+        protocolCommandParamAdd(result, VARSTR(data->archiveId));
+        protocolCommandParamAdd(result, VARUINT(data->cipherType));
+        protocolCommandParamAdd(result, VARSTR(data->cipherPass));
+    }
+
+    // Add data for each deferred repo queue to copy to
+    protocolCommandParamAdd(result, VARUINT(lstSize(queueList)));
+
+    for (unsigned int queueListIdx = 0; queueListIdx < lstSize(queueList); queueListIdx++)
+    {
+        const ArchivePushFileQueue *const queue = lstGet(queueList, queueListIdx);
+
+        protocolCommandParamAdd(result, VARSTR(queue->path));
+        protocolCommandParamAdd(result, VARSTR(queue->error));
+        protocolCommandParamAdd(result, VARUINT(queue->repoData.repoIdx));
+        protocolCommandParamAdd(result, VARSTR(queue->repoData.archiveId));
+        protocolCommandParamAdd(result, VARUINT(queue->repoData.cipherType));
+        protocolCommandParamAdd(result, VARSTR(queue->repoData.cipherPass));
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Get the next job to push WAL files from pg_wal to the repos that must have them before PostgreSQL is notified
+static ProtocolParallelJob *
+archivePushAsyncJob(ArchivePushAsyncData *const jobData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+    FUNCTION_TEST_END();
+
+    ProtocolParallelJob *result = NULL;
+
+    if (jobData->walFileIdx < strLstSize(jobData->walFileList))
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            const String *walFile = strLstGet(jobData->walFileList, jobData->walFileIdx);
+            jobData->walFileIdx++;
+
+            // Gather consecutive full segments that follow in the same WAL path into a bundle. Partials and history files are
+            // always pushed individually. The segments are held in memory by the local until the bundle is written so the bundle is
+            // also limited by size.
+            StringList *bundleList = strLstNew();
+            strLstAdd(bundleList, walFile);
+
+            if (jobData->bundleMax > 1 && walIsSegment(walFile) && !walIsPartial(walFile))
+            {
+                const uint64_t walSegmentSize = storageInfoP(
+                    storageLocal(), strNewFmt("%s/%s", strZ(jobData->walPath), strZ(walFile)), .ignoreMissing = true).size;
+                const String *walFileExpected = walFile;
+                unsigned int bundleMax = 1;
+
+                // Only bundle when the segment size is valid since it is required to find the next segment
+                if (walSegmentSize > 0 && walSegmentSize <= UINT32_MAX && UINT32_MAX % walSegmentSize == walSegmentSize - 1 &&
+                    (jobData->archiveInfo.pgVersion >= PG_VERSION_11 || walSegmentSize == 16 * 1024 * 1024))
+                {
+                    bundleMax = jobData->bundleMax;
+
+                    if (bundleMax * walSegmentSize > WAL_BUNDLE_SIZE_MAX)
+                    {
+                        bundleMax = walSegmentSize >= WAL_BUNDLE_SIZE_MAX ?
+                            1 : (unsigned int)(WAL_BUNDLE_SIZE_MAX / walSegmentSize);
+                    }
+                }
+
+                while (jobData->walFileIdx < strLstSize(jobData->walFileList) && strLstSize(bundleList) < bundleMax)
+                {
+                    const String *walFileNext = strLstGet(jobData->walFileList, jobData->walFileIdx);
+                    walFileExpected = walSegmentNext(walFileExpected, (size_t)walSegmentSize, jobData->archiveInfo.pgVersion);
+
+                    if (!strEq(walFileNext, walFileExpected) || !strEq(strSubN(walFileNext, 0, 16), strSubN(walFile, 0, 16)))
+                        break;
+
+                    strLstAdd(bundleList, walFileNext);
+                    jobData->walFileIdx++;
+                }
+            }
+
+            // Queue the WAL files for deferred repos unless they are already queued, e.g. when a failed push is retried. The local
+            // copies the WAL files to the queues. When a queue is full the repo is pushed to now (or its error is reported when the
+            // repo is not valid) so the spool does not grow without bound.
+            List *const repoList = lstNewP(sizeof(ArchivePushFileRepoData));
+            List *const queueList = lstNewP(sizeof(ArchivePushFileQueue));
+            StringList *const errorList = strLstDup(jobData->archiveInfo.errorList);
+
+            for (unsigned int repoListIdx = 0; repoListIdx < lstSize(jobData->archiveInfo.repoList); repoListIdx++)
+                lstAdd(repoList, lstGet(jobData->archiveInfo.repoList, repoListIdx));
+
+            for (unsigned int deferIdx = 0; deferIdx < lstSize(jobData->deferList); deferIdx++)
+            {
+                const ArchivePushDeferRepo *const defer = lstGet(jobData->deferList, deferIdx);
+                bool queued = true;
+                uint64_t size = 0;
+
+                for (unsigned int bundleIdx = 0; bundleIdx < strLstSize(bundleList); bundleIdx++)
+                {
+                    const String *const bundleFile = strLstGet(bundleList, bundleIdx);
+
+                    if (!strLstExists(defer->queue, bundleFile))
+                    {
+                        size += storageInfoP(storagePg(), strNewFmt("%s/%s", strZ(jobData->walPath), strZ(bundleFile))).size;
+                        queued = false;
+                    }
+                }
+
+                if (queued)
+                    continue;
+
+                if (defer->queueSize + size <= jobData->deferMax)
+                {
+                    lstAdd(
+                        queueList,
+                        &(ArchivePushFileQueue)
+                        {
+                            .path = storagePathP(storageSpool(), defer->path),
+                            .error = defer->error,
+                            .repoData =
+                                defer->repoData != NULL ? *defer->repoData : (ArchivePushFileRepoData){.repoIdx = defer->repoIdx},
+                        });
+                }
+                else if (defer->repoData != NULL)
+                    lstAdd(repoList, defer->repoData);
+                else
+                    strLstAdd(errorList, defer->error);
+            }
+
+            const bool bundle = strLstSize(bundleList) > 1;
+            const Variant *const key = bundle ? varNewVarLst(varLstNewStrLst(bundleList)) : VARSTR(walFile);
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result = protocolParallelJobNew(
+                    key,
+                    archivePushAsyncCommand(
+                        jobData, bundle ? jobData->walPath : strNewFmt("%s/%s", strZ(jobData->walPath), strZ(walFile)), key,
+                        repoList, queueList, errorList));
+            }
+            MEM_CONTEXT_PRIOR_END();
+
+            jobData->jobTotal++;
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Get the next job to push a WAL file from the queue of a deferred repo. The job key is a list of the repo index and WAL file.
+static ProtocolParallelJob *
+archivePushAsyncDeferJob(const ArchivePushAsyncData *const jobData, ArchivePushDeferRepo *const defer)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+        FUNCTION_TEST_PARAM_P(VOID, defer);
+    FUNCTION_TEST_END();
+
+    ProtocolParallelJob *result = NULL;
+
+    if (defer->repoData != NULL && defer->queueIdx < strLstSize(defer->queue))
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            const String *const walFile = strLstGet(defer->queue, defer->queueIdx);
+            defer->queueIdx++;
+
+            List *const repoList = lstNewP(sizeof(ArchivePushFileRepoData));
+            lstAdd(repoList, defer->repoData);
+
+            VariantList *const key = varLstNew();
+            varLstAdd(key, varNewUInt(defer->repoIdx));
+            varLstAdd(key, varNewStr(walFile));
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result = protocolParallelJobNew(
+                    varNewVarLst(key),
+                    archivePushAsyncCommand(
+                        jobData, storagePathP(storageSpool(), strNewFmt("%s/%s", strZ(defer->path), strZ(walFile))),
+                        VARSTR(walFile), repoList, lstNewP(sizeof(ArchivePushFileQueue)), strLstNew()));
+            }
+            MEM_CONTEXT_PRIOR_END();
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 static ProtocolParallelJob *
 archivePushAsyncCallback(void *data, unsigned int clientIdx)
 {
@@ -449,45 +995,399 @@ archivePushAsyncCallback(void *data, unsigned int clientIdx)
         FUNCTION_TEST_PARAM(UINT, clientIdx);
     FUNCTION_TEST_END();
 
-    // No special logic based on the client, we'll just get the next job
-    (void)clientIdx;
-
-    // Get a new job if there are any left
     ArchivePushAsyncData *jobData = data;
+    ProtocolParallelJob *result = NULL;
+
+    // Clients up to process-max only push the WAL files that must be stored before PostgreSQL is notified so they are always free
+    // for new WAL. The last client pushes from the queues of the deferred repos in turn, but only while no WAL is being pushed to
+    // the required repos so the deferred pushes do not compete with them. No more deferred pushes are started after an error so
+    // the async process can exit.
+    if (clientIdx < jobData->clientTotal)
+        result = archivePushAsyncJob(jobData);
+    else if (!jobData->error && jobData->jobTotal == 0 && jobData->walFileIdx == strLstSize(jobData->walFileList))
+    {
+        for (unsigned int deferOffset = 0; deferOffset < lstSize(jobData->deferList) && result == NULL; deferOffset++)
+        {
+            const unsigned int deferIdx = (jobData->deferIdx + deferOffset) % lstSize(jobData->deferList);
 
-    if (jobData->walFileIdx < strLstSize(jobData->walFileList))
+            result = archivePushAsyncDeferJob(jobData, lstGet(jobData->deferList, deferIdx));
+
+            if (result != NULL)
+                jobData->deferIdx = deferIdx + 1;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Process the result of a job that pushed WAL files from pg_wal. The status files are written so PostgreSQL can be notified and the
+// WAL files are added to the queues of the deferred repos where the local copied them.
+static void
+archivePushAsyncResult(ArchivePushAsyncData *const jobData, const ProtocolParallelJob *const job)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, jobData);
+        FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL_JOB, job);
+    FUNCTION_LOG_END();
+
+    ASSERT(jobData->jobTotal > 0);
+
+    MEM_CONTEXT_TEMP_BEGIN()
     {
-        const String *walFile = strLstGet(jobData->walFileList, jobData->walFileIdx);
-        jobData->walFileIdx++;
-
-        ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_ARCHIVE_PUSH_FILE_STR);
-        protocolCommandParamAdd(command, VARSTR(strNewFmt("%s/%s", strZ(jobData->walPath), strZ(walFile))));
-        protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptArchiveHeaderCheck)));
-        protocolCommandParamAdd(command, VARUINT(jobData->archiveInfo.pgVersion));
-        protocolCommandParamAdd(command, VARUINT64(jobData->archiveInfo.pgSystemId));
-        protocolCommandParamAdd(command, VARSTR(walFile));
-        protocolCommandParamAdd(command, VARUINT(jobData->compressType));
-        protocolCommandParamAdd(command, VARINT(jobData->compressLevel));
-        protocolCommandParamAdd(command, varNewVarLst(varLstNewStrLst(jobData->archiveInfo.errorList)));
-        protocolCommandParamAdd(command, VARUINT(lstSize(jobData->archiveInfo.repoList)));
-
-        // Add data for each repo to push to
-        for (unsigned int repoListIdx = 0; repoListIdx < lstSize(jobData->archiveInfo.repoList); repoListIdx++)
+        const unsigned int processId = protocolParallelJobProcessId(job);
+        const Variant *const jobKey = protocolParallelJobKey(job);
+
+        // The key is a list of WAL files when the job pushed a bundle
+        StringList *walFileList = NULL;
+
+        if (varType(jobKey) == varTypeString)
         {
-            ArchivePushFileRepoData *data = lstGet(jobData->archiveInfo.repoList, repoListIdx);
+            walFileList = strLstNew();
+            strLstAdd(walFileList, varStr(jobKey));
+        }
+        else
+            walFileList = strLstNewVarLst(varVarLst(jobKey));
+
+        // The job was successful
+        if (protocolParallelJobErrorCode(job) == 0)
+        {
+            // Get job result
+            const VariantList *fileResult = varVarLst(protocolParallelJobResult(job));
+
+            for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(walFileList); walFileIdx++)
+            {
+                const String *walFile = strLstGet(walFileList, walFileIdx);
+                const VariantList *walFileResult = varVarLst(varLstGet(fileResult, walFileIdx));
+
+                // Output file warnings
+                StringList *fileWarnList = strLstNewVarLst(varVarLst(varLstGet(walFileResult, 0)));
+
+                for (unsigned int warnIdx = 0; warnIdx < strLstSize(fileWarnList); warnIdx++)
+                    LOG_WARN_PID(processId, strZ(strLstGet(fileWarnList, warnIdx)));
 
-            protocolCommandParamAdd(command, VARUINT(data->repoIdx));
-            protocolCommandParamAdd(command, VARSTR(data->archiveId));
-            protocolCommandParamAdd(command, VARUINT(data->cipherType));
-            protocolCommandParamAdd(command, VARSTR(data->cipherPass));
+                // Save index entries to add when the jobs are complete
+                archivePushAsyncIndexAdd(jobData, varVarLst(varLstGet(walFileResult, 1)));
+
+                // Add the WAL file to the queue of each deferred repo where it was copied. A WAL file is only queued once even when
+                // the push is retried.
+                const StringList *const queuePathList = strLstNewVarLst(varVarLst(varLstGet(walFileResult, 2)));
+
+                for (unsigned int deferIdx = 0; deferIdx < lstSize(jobData->deferList); deferIdx++)
+                {
+                    ArchivePushDeferRepo *const defer = lstGet(jobData->deferList, deferIdx);
+
+                    if (strLstExists(queuePathList, storagePathP(storageSpool(), defer->path)) &&
+                        !strLstExists(defer->queue, walFile))
+                    {
+                        strLstAdd(defer->queue, walFile);
+                        defer->queueSize += storageInfoP(
+                            storageSpool(), strNewFmt("%s/%s", strZ(defer->path), strZ(walFile))).size;
+                    }
+                }
+
+                // Log success
+                LOG_DETAIL_PID_FMT(processId, "pushed WAL file '%s' to the archive", strZ(walFile));
+
+                // Write the status file once the WAL file is in the index
+                MEM_CONTEXT_BEGIN(lstMemContext(jobData->okList))
+                {
+                    lstAdd(
+                        jobData->okList,
+                        &(ArchivePushAsyncOk)
+                        {
+                            .walFile = strDup(walFile),
+                            .warning = strLstEmpty(fileWarnList) ? NULL : strLstJoin(fileWarnList, "\n"),
+                        });
+                }
+                MEM_CONTEXT_END();
+            }
         }
+        // Else the job errored
+        else
+        {
+            for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(walFileList); walFileIdx++)
+            {
+                const String *walFile = strLstGet(walFileList, walFileIdx);
+
+                LOG_WARN_PID_FMT(
+                    processId, "could not push WAL file '%s' to the archive (will be retried): [%d] %s", strZ(walFile),
+                    protocolParallelJobErrorCode(job), strZ(protocolParallelJobErrorMessage(job)));
 
-        FUNCTION_TEST_RETURN(protocolParallelJobNew(VARSTR(walFile), command));
+                archiveAsyncStatusErrorWrite(
+                    archiveModePush, walFile, protocolParallelJobErrorCode(job), protocolParallelJobErrorMessage(job));
+
+                // Remove copies the local made to the queues of deferred repos since they will be made again when the push is
+                // retried
+                for (unsigned int deferIdx = 0; deferIdx < lstSize(jobData->deferList); deferIdx++)
+                {
+                    const ArchivePushDeferRepo *const defer = lstGet(jobData->deferList, deferIdx);
+
+                    if (!strLstExists(defer->queue, walFile))
+                        storageRemoveP(storageSpoolWrite(), strNewFmt("%s/%s", strZ(defer->path), strZ(walFile)));
+                }
+            }
+
+            jobData->error = true;
+        }
+
+        jobData->jobTotal--;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Process the result of a job that pushed from the queue of a deferred repo. The WAL file is removed from the queue on success and
+// will be retried by the next async process on error. Errors do not affect the status of the WAL file since PostgreSQL has already
+// been notified.
+static void
+archivePushAsyncDeferResult(ArchivePushAsyncData *const jobData, const ProtocolParallelJob *const job)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, jobData);
+        FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL_JOB, job);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const unsigned int processId = protocolParallelJobProcessId(job);
+        const VariantList *const jobKey = varVarLst(protocolParallelJobKey(job));
+        const unsigned int repoIdx = varUInt(varLstGet(jobKey, 0));
+        const String *const walFile = varStr(varLstGet(jobKey, 1));
+
+        // Find the deferred repo
+        ArchivePushDeferRepo *defer = NULL;
+
+        for (unsigned int deferIdx = 0; deferIdx < lstSize(jobData->deferList); deferIdx++)
+        {
+            defer = lstGet(jobData->deferList, deferIdx);
+
+            if (defer->repoIdx == repoIdx)
+                break;
+        }
+
+        ASSERT(defer != NULL && defer->repoIdx == repoIdx);
+
+        if (protocolParallelJobErrorCode(job) == 0)
+        {
+            // Output file warnings
+            const VariantList *const fileResult = varVarLst(varLstGet(varVarLst(protocolParallelJobResult(job)), 0));
+            const StringList *const fileWarnList = strLstNewVarLst(varVarLst(varLstGet(fileResult, 0)));
+
+            for (unsigned int warnIdx = 0; warnIdx < strLstSize(fileWarnList); warnIdx++)
+                LOG_WARN_PID(processId, strZ(strLstGet(fileWarnList, warnIdx)));
+
+            // Save index entries to add when the jobs are complete
+            archivePushAsyncIndexAdd(jobData, varVarLst(varLstGet(fileResult, 1)));
+
+            // Remove the WAL file from the queue so there is room for more. The WAL file has already been dispatched so it is
+            // before the current index in the queue. The file is removed from the spool once the WAL file is in the index.
+            const String *const file = strNewFmt("%s/%s", strZ(defer->path), strZ(walFile));
+
+            strLstRemove(defer->queue, walFile);
+            defer->queueIdx--;
+
+            defer->queueSize -= storageInfoP(storageSpool(), file).size;
+            strLstAdd(jobData->queueRemoveList, file);
+
+            LOG_DETAIL_PID_FMT(
+                processId, "pushed WAL file '%s' to the repo%u archive (deferred)", strZ(walFile),
+                cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx));
+        }
+        else
+        {
+            LOG_WARN_PID_FMT(
+                processId, "could not push WAL file '%s' to the repo%u archive (will be retried): [%d] %s", strZ(walFile),
+                cfgOptionGroupIdxToKey(cfgOptGrpRepo, repoIdx), protocolParallelJobErrorCode(job),
+                strZ(protocolParallelJobErrorMessage(job)));
+        }
     }
+    MEM_CONTEXT_TEMP_END();
 
-    FUNCTION_TEST_RETURN(NULL);
+    FUNCTION_LOG_RETURN_VOID();
 }
 
+// Wait for jobs to complete and process the results
+static void
+archivePushAsyncProcess(ArchivePushAsyncData *const jobData, ProtocolParallel *const parallelExec)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, jobData);
+        FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL, parallelExec);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const unsigned int completed = protocolParallelProcess(parallelExec);
+
+        for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+        {
+            protocolKeepAlive();
+
+            ProtocolParallelJob *const job = protocolParallelResult(parallelExec);
+            const Variant *const jobKey = protocolParallelJobKey(job);
+
+            // The key is a repo index and WAL file when the job pushed from the queue of a deferred repo
+            if (varType(jobKey) == varTypeVariantList && varType(varLstGet(varVarLst(jobKey), 0)) == varTypeUInt)
+                archivePushAsyncDeferResult(jobData, job);
+            else
+                archivePushAsyncResult(jobData, job);
+
+            protocolParallelJobFree(job);
+        }
+
+        // Add the WAL files pushed by the completed jobs to the index. This is done once for all the jobs that completed so the
+        // index is rewritten less often and the updates from multiple processes are not lost.
+        if (completed > 0)
+            archivePushAsyncIndexUpdate(jobData);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Keep local processes and remotes alive while they are not running jobs
+static void
+archivePushAsyncKeepAlive(ProtocolParallel *const parallelExec, TimeMSec *const keepAliveTime)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_PARALLEL, parallelExec);
+        FUNCTION_TEST_PARAM_P(TIME_MSEC, keepAliveTime);
+    FUNCTION_TEST_END();
+
+    ASSERT(keepAliveTime != NULL);
+
+    if (timeMSec() - *keepAliveTime >= cfgOptionUInt64(cfgOptProtocolTimeout) / 2)
+    {
+        if (parallelExec != NULL)
+            protocolParallelKeepAlive(parallelExec);
+
+        protocolKeepAlive();
+        *keepAliveTime = timeMSec();
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Push WAL files from the queues of deferred repos until they are empty
+
+Returns a list of WAL files to process as soon as any become ready so deferred pushes never delay notifying PostgreSQL, or an empty
+list when the queues are empty. Deferred pushes that are running when new WAL files are found continue while the new WAL files are
+pushed. After an error no more deferred pushes are started and no new WAL files are returned so the async process can exit.
+***********************************************************************************************************************************/
+#define ARCHIVE_PUSH_DEFER_SCAN_MS                                  1000
+
+static StringList *
+archivePushAsyncDefer(ArchivePushAsyncData *const jobData, ProtocolParallel *const parallelExec)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, jobData);
+        FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL, parallelExec);
+    FUNCTION_LOG_END();
+
+    ASSERT(jobData != NULL);
+    ASSERT(parallelExec != NULL);
+
+    StringList *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        TimeMSec keepAliveTime = timeMSec();
+        TimeMSec scanTime = timeMSec();
+
+        result = strLstNew();
+
+        // Deferred pushes are not started while WAL files are being pushed to the required repos so process at least once to start
+        // them
+        do
+        {
+            archivePushAsyncProcess(jobData, parallelExec);
+
+            if (!jobData->error && timeMSec() - scanTime >= ARCHIVE_PUSH_DEFER_SCAN_MS)
+            {
+                // Stop if a stop file has been created
+                lockStopTest();
+
+                archivePushAsyncKeepAlive(parallelExec, &keepAliveTime);
+
+                // Check for new WAL files
+                strLstFree(result);
+                result = archivePushProcessList(jobData->walPath);
+
+                if (!strLstEmpty(result))
+                    break;
+
+                scanTime = timeMSec();
+            }
+        }
+        while (!protocolParallelDone(parallelExec));
+
+        result = strLstMove(result, memContextPrior());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/***********************************************************************************************************************************
+Wait for more WAL files to be ready for processing
+
+Returns a list of WAL files to process or an empty list if none became ready before the linger time expired. The archive lock is
+held the entire time so archive-push processes started by PostgreSQL will wait on status files rather than spawning a new async
+process. The wait between checks starts short since WAL files tend to arrive in bursts and backs off to limit the load on an idle
+system. Local processes and remotes are kept alive while waiting so they can be reused.
+***********************************************************************************************************************************/
+#define ARCHIVE_PUSH_LINGER_SLEEP_MIN_MS                            100
+#define ARCHIVE_PUSH_LINGER_SLEEP_MAX_MS                            2000
+
+static StringList *
+archivePushAsyncLinger(const String *const walPath, const TimeMSec lingerTime, ProtocolParallel *const parallelExec)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, walPath);
+        FUNCTION_LOG_PARAM(TIME_MSEC, lingerTime);
+        FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL, parallelExec);
+    FUNCTION_LOG_END();
+
+    ASSERT(walPath != NULL);
+    ASSERT(lingerTime > 0);
+
+    StringList *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const TimeMSec timeEnd = timeMSec() + lingerTime;
+        TimeMSec keepAliveTime = timeMSec();
+        TimeMSec sleepTime = ARCHIVE_PUSH_LINGER_SLEEP_MIN_MS;
+
+        do
+        {
+            const TimeMSec timeNow = timeMSec();
+            const TimeMSec timeRemaining = timeNow < timeEnd ? timeEnd - timeNow : 0;
+
+            sleepMSec(sleepTime < timeRemaining ? sleepTime : timeRemaining);
+            sleepTime = sleepTime * 2 < ARCHIVE_PUSH_LINGER_SLEEP_MAX_MS ? sleepTime * 2 : ARCHIVE_PUSH_LINGER_SLEEP_MAX_MS;
+
+            // Stop lingering if a stop file has been created
+            lockStopTest();
+
+            // Keep local processes and remotes alive while waiting
+            archivePushAsyncKeepAlive(parallelExec, &keepAliveTime);
+
+            // Check for new WAL files
+            result = archivePushProcessList(walPath);
+        }
+        while (strLstEmpty(result) && timeMSec() < timeEnd);
+
+        result = strLstMove(result, memContextPrior());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/**********************************************************************************************************************************/
 void
 cmdArchivePushAsync(void)
 {
@@ -508,9 +1408,13 @@ cmdArchivePushAsync(void)
 
         ArchivePushAsyncData jobData =
         {
+            .memContext = memContextCurrent(),
             .walPath = strLstGet(commandParam, 0),
             .compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType)),
             .compressLevel = cfgOptionInt(cfgOptCompressLevel),
+            .bundleMax = cfgOptionUInt(cfgOptArchivePushBundleMax),
+            .deferMax = cfgOptionUInt64(cfgOptArchivePushDeferMax),
+            .clientTotal = cfgOptionUInt(cfgOptProcessMax),
         };
 
         TRY_BEGIN()
@@ -525,86 +1429,105 @@ cmdArchivePushAsync(void)
             if (strLstEmpty(jobData.walFileList))
                 THROW(AssertError, "no WAL files to process");
 
-            LOG_INFO_FMT(
-                "push %u WAL file(s) to archive: %s%s", strLstSize(jobData.walFileList), strZ(strLstGet(jobData.walFileList, 0)),
-                strLstSize(jobData.walFileList) == 1 ?
-                    "" : strZ(strNewFmt("...%s", strZ(strLstGet(jobData.walFileList, strLstSize(jobData.walFileList) - 1)))));
+            // Time to linger waiting for more WAL files after the current list has been pushed
+            const TimeMSec lingerTime = cfgOptionUInt64(cfgOptArchivePushLinger);
 
-            // Drop files if queue max has been exceeded
-            if (cfgOptionTest(cfgOptArchivePushQueueMax) && archivePushDrop(jobData.walPath, jobData.walFileList))
-            {
-                for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(jobData.walFileList); walFileIdx++)
-                {
-                    const String *walFile = strLstGet(jobData.walFileList, walFileIdx);
-                    const String *warning = archivePushDropWarning(walFile, cfgOptionUInt64(cfgOptArchivePushQueueMax));
+            // The parallel executor is created once so local processes and remotes are reused when lingering
+            ProtocolParallel *parallelExec = NULL;
 
-                    archiveAsyncStatusOkWrite(archiveModePush, walFile, warning);
-                    LOG_WARN(strZ(warning));
-                }
-            }
-            // Else continue processing
-            else
+            do
             {
-                // Check archive info for each repo
-                jobData.archiveInfo = archivePushCheck(true);
-
-                // Create the parallel executor
-                ProtocolParallel *parallelExec = protocolParallelNew(
-                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, archivePushAsyncCallback, &jobData);
+                jobData.walFileIdx = 0;
 
-                for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
-                    protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
-
-                // Process jobs
-                do
+                MEM_CONTEXT_TEMP_BEGIN()
                 {
-                    unsigned int completed = protocolParallelProcess(parallelExec);
-
-                    for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+                    LOG_INFO_FMT(
+                        "push %u WAL file(s) to archive: %s%s", strLstSize(jobData.walFileList),
+                        strZ(strLstGet(jobData.walFileList, 0)),
+                        strLstSize(jobData.walFileList) == 1 ?
+                            "" :
+                            strZ(strNewFmt("...%s", strZ(strLstGet(jobData.walFileList, strLstSize(jobData.walFileList) - 1)))));
+
+                    // Drop files if queue max has been exceeded
+                    if (cfgOptionTest(cfgOptArchivePushQueueMax) && archivePushDrop(jobData.walPath, jobData.walFileList))
                     {
-                        protocolKeepAlive();
-
-                        // Get the job and job key
-                        ProtocolParallelJob *job = protocolParallelResult(parallelExec);
-                        unsigned int processId = protocolParallelJobProcessId(job);
-                        const String *walFile = varStr(protocolParallelJobKey(job));
-
-                        // The job was successful
-                        if (protocolParallelJobErrorCode(job) == 0)
+                        for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(jobData.walFileList); walFileIdx++)
                         {
-                            // Get job result
-                            const VariantList *fileResult = varVarLst(protocolParallelJobResult(job));
-
-                            // Output file warnings
-                            StringList *fileWarnList = strLstNewVarLst(varVarLst(varLstGet(fileResult, 0)));
+                            const String *walFile = strLstGet(jobData.walFileList, walFileIdx);
+                            const String *warning = archivePushDropWarning(walFile, cfgOptionUInt64(cfgOptArchivePushQueueMax));
 
-                            for (unsigned int warnIdx = 0; warnIdx < strLstSize(fileWarnList); warnIdx++)
-                                LOG_WARN_PID(processId, strZ(strLstGet(fileWarnList, warnIdx)));
-
-                            // Log success
-                            LOG_DETAIL_PID_FMT(processId, "pushed WAL file '%s' to the archive", strZ(walFile));
-
-                            // Write the status file
-                            archiveAsyncStatusOkWrite(
-                                archiveModePush, walFile, strLstEmpty(fileWarnList) ? NULL : strLstJoin(fileWarnList, "\n"));
+                            archiveAsyncStatusOkWrite(archiveModePush, walFile, warning);
+                            LOG_WARN(strZ(warning));
                         }
-                        // Else the job errored
-                        else
-                        {
-                            LOG_WARN_PID_FMT(
-                                processId,
-                                "could not push WAL file '%s' to the archive (will be retried): [%d] %s", strZ(walFile),
-                                protocolParallelJobErrorCode(job), strZ(protocolParallelJobErrorMessage(job)));
 
-                            archiveAsyncStatusErrorWrite(
-                                archiveModePush, walFile, protocolParallelJobErrorCode(job), protocolParallelJobErrorMessage(job));
+                        // The dropped files do not need to be pushed
+                        jobData.walFileIdx = strLstSize(jobData.walFileList);
+                    }
+                    // Else continue processing
+                    else
+                    {
+                        // Create the parallel executor the first time. Clients are kept when there are no jobs so they can be
+                        // reused when lingering. When there are deferred repos an additional client pushes from their queues and
+                        // the executor returns often enough to check for new WAL files while the deferred pushes are running.
+                        if (parallelExec == NULL)
+                        {
+                            MEM_CONTEXT_PRIOR_BEGIN()
+                            {
+                                // Check archive info for each repo. This only needs to be done once since the result can be reused
+                                // when lingering.
+                                jobData.archiveInfo = archivePushCheck(true);
+                                jobData.deferList = archivePushDeferInit(&jobData.archiveInfo);
+                                jobData.indexList = lstNewP(sizeof(ArchivePushFileIndex));
+                                jobData.okList = lstNewP(sizeof(ArchivePushAsyncOk));
+                                jobData.queueRemoveList = strLstNew();
+
+                                // Load the queues for deferred repos
+                                for (unsigned int deferIdx = 0; deferIdx < lstSize(jobData.deferList); deferIdx++)
+                                    archivePushDeferLoad(lstGet(jobData.deferList, deferIdx));
+
+                                parallelExec = protocolParallelNew(
+                                    lstEmpty(jobData.deferList) ?
+                                        cfgOptionUInt64(cfgOptProtocolTimeout) / 2 : ARCHIVE_PUSH_DEFER_SCAN_MS,
+                                    cfgOptionUInt(cfgOptJobQueueMax), archivePushAsyncCallback, &jobData);
+                                protocolParallelClientKeepSet(parallelExec, true);
+
+                                const unsigned int clientTotal = jobData.clientTotal + (lstEmpty(jobData.deferList) ? 0 : 1);
+
+                                for (unsigned int processIdx = 1; processIdx <= clientTotal; processIdx++)
+                                {
+                                    protocolParallelClientAdd(
+                                        parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
+                                }
+                            }
+                            MEM_CONTEXT_PRIOR_END();
                         }
 
-                        protocolParallelJobFree(job);
+                        // Process jobs until the WAL files have been pushed to the required repos. Deferred pushes may still be
+                        // running.
+                        do
+                        {
+                            archivePushAsyncProcess(&jobData, parallelExec);
+                        }
+                        while (jobData.walFileIdx < strLstSize(jobData.walFileList) || jobData.jobTotal > 0);
                     }
                 }
-                while (!protocolParallelDone(parallelExec));
+                MEM_CONTEXT_TEMP_END();
+
+                // Push from the queues of deferred repos while checking for new WAL files. When the queues are empty linger waiting
+                // for more WAL files unless there were errors. On error exit so the next async process starts with a fresh check of
+                // the repositories.
+                StringList *walFileList = parallelExec != NULL ? archivePushAsyncDefer(&jobData, parallelExec) : strLstNew();
+
+                if (strLstEmpty(walFileList) && lingerTime > 0 && !jobData.error)
+                {
+                    strLstFree(walFileList);
+                    walFileList = archivePushAsyncLinger(jobData.walPath, lingerTime, parallelExec);
+                }
+
+                strLstFree(jobData.walFileList);
+                jobData.walFileList = walFileList;
             }
+            while (!strLstEmpty(jobData.walFileList));
         }
         // On any global error write a single error file to cover all unprocessed files
         CATCH_ANY()
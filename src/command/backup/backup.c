@@ -495,21 +495,14 @@ backupBuildIncr(const InfoBackup *infoBackup, Manifest *manifest, Manifest *mani
     // No incremental if no prior manifest
     if (manifestPrior != NULL)
     {
-        MEM_CONTEXT_TEMP_BEGIN()
-        {
-            // Move the manifest to this context so it will be freed when we are done
-            manifestMove(manifestPrior, MEM_CONTEXT_TEMP());
+        // Build incremental manifest
+        manifestBuildIncr(manifest, manifestPrior, backupType(cfgOptionStr(cfgOptType)), archiveStart);
 
-            // Build incremental manifest
-            manifestBuildIncr(manifest, manifestPrior, backupType(cfgOptionStr(cfgOptType)), archiveStart);
+        // Set the cipher subpass from prior manifest since we want a single subpass for the entire backup set
+        manifestCipherSubPassSet(manifest, manifestCipherSubPass(manifestPrior));
 
-            // Set the cipher subpass from prior manifest since we want a single subpass for the entire backup set
-            manifestCipherSubPassSet(manifest, manifestCipherSubPass(manifestPrior));
-
-            // Incremental was built
-            result = true;
-        }
-        MEM_CONTEXT_TEMP_END();
+        // Incremental was built
+        result = true;
     }
 
     FUNCTION_LOG_RETURN(BOOL, result);
@@ -618,6 +611,8 @@ void backupResumeCallback(void *data, const StorageInfo *info)
                 removeReason = "reference in resumed manifest";
             else if (fileResume->checksumSha1[0] == '\0')
                 removeReason = "no checksum in resumed manifest";
+            else if (fileResume->blockIncrSize != 0)
+                removeReason = "block incremental in resumed manifest";
             else if (file->size != fileResume->size)
                 removeReason = "mismatched size";
             else if (!resumeData->delta && file->timestamp != fileResume->timestamp)
@@ -629,7 +624,8 @@ void backupResumeCallback(void *data, const StorageInfo *info)
             {
                 manifestFileUpdate(
                     resumeData->manifest, manifestName, file->size, fileResume->sizeRepo, fileResume->checksumSha1, NULL,
-                    fileResume->checksumPage, fileResume->checksumPageError, fileResume->checksumPageErrorList);
+                    fileResume->checksumPage, fileResume->checksumPageError, fileResume->checksumPageErrorList, 0, 0,
+                    fileResume->checksumRangeSize, fileResume->checksumRange);
             }
 
             // Remove the file if it could not be resumed
@@ -1089,6 +1085,10 @@ backupJobResult(
             const uint64_t repoSize = varUInt64(varLstGet(jobResult, 2));
             const String *const copyChecksum = varStr(varLstGet(jobResult, 3));
             const KeyValue *const checksumPageResult = varKv(varLstGet(jobResult, 4));
+            const uint64_t blockIncrSize = varUInt64(varLstGet(jobResult, 5));
+            const uint64_t blockIncrMapSize = varUInt64(varLstGet(jobResult, 6));
+            const uint64_t checksumRangeSize = varUInt64(varLstGet(jobResult, 7));
+            const String *const checksumRange = varStr(varLstGet(jobResult, 8));
 
             // Increment backup copy progress
             sizeCopied += copySize;
@@ -1214,7 +1214,7 @@ backupJobResult(
                 // Update file info and remove any reference to the file's existence in a prior backup
                 manifestFileUpdate(
                     manifest, file->name, copySize, repoSize, strZ(copyChecksum), VARSTR(NULL), file->checksumPage,
-                    checksumPageError, checksumPageErrorList);
+                    checksumPageError, checksumPageErrorList, blockIncrSize, blockIncrMapSize, checksumRangeSize, checksumRange);
             }
         }
         MEM_CONTEXT_TEMP_END();
@@ -1288,13 +1288,14 @@ backupProcessQueueComparator(const void *item1, const void *item2)
     FUNCTION_TEST_RETURN(strCmp((*(ManifestFile **)item1)->name, (*(ManifestFile **)item2)->name));
 }
 
-// Helper to generate the backup queues
+// Helper to generate the backup queues. The bytes in each queue are returned in queueSizeList.
 static uint64_t
-backupProcessQueue(Manifest *manifest, List **queueList)
+backupProcessQueue(Manifest *manifest, List **queueList, List **queueSizeList)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
         FUNCTION_LOG_PARAM_P(LIST, queueList);
+        FUNCTION_LOG_PARAM_P(LIST, queueSizeList);
     FUNCTION_LOG_END();
 
     ASSERT(manifest != NULL);
@@ -1303,8 +1304,9 @@ backupProcessQueue(Manifest *manifest, List **queueList)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Create list of process queue
+        // Create list of process queue and queue sizes
         *queueList = lstNewP(sizeof(List *));
+        *queueSizeList = lstNewP(sizeof(uint64_t));
 
         // Generate the list of targets
         StringList *targetList = strLstNew();
@@ -1328,6 +1330,7 @@ backupProcessQueue(Manifest *manifest, List **queueList)
             {
                 List *queue = lstNewP(sizeof(ManifestFile *), .comparator = backupProcessQueueComparator);
                 lstAdd(*queueList, &queue);
+                lstAdd(*queueSizeList, &(uint64_t){0});
             }
         }
         MEM_CONTEXT_END();
@@ -1353,6 +1356,7 @@ backupProcessQueue(Manifest *manifest, List **queueList)
             if (backupStandby && file->primary)
             {
                 lstAdd(*(List **)lstGet(*queueList, 0), &file);
+                *(uint64_t *)lstGet(*queueSizeList, 0) += file->size;
             }
             // Else find the correct queue by matching the file to a target
             else
@@ -1374,6 +1378,7 @@ backupProcessQueue(Manifest *manifest, List **queueList)
 
                 // Add file to queue
                 lstAdd(*(List **)lstGet(*queueList, targetIdx + queueOffset), &file);
+                *(uint64_t *)lstGet(*queueSizeList, targetIdx + queueOffset) += file->size;
             }
 
             // Add size to total
@@ -1403,32 +1408,41 @@ backupProcessQueue(Manifest *manifest, List **queueList)
 
         // Move process queues to prior context
         lstMove(*queueList, memContextPrior());
+        lstMove(*queueSizeList, memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
 
     FUNCTION_LOG_RETURN(UINT64, result);
 }
 
-// Helper to caculate the next queue to scan based on the client index
+// Helper to find the queue to take a job from when the queue of a process is empty. The queue with the most bytes remaining is
+// chosen so a large queue is shared by all processes rather than being left to the process that owns it. Queues before queueOffset
+// are not considered.
 static int
-backupJobQueueNext(unsigned int clientIdx, int queueIdx, unsigned int queueTotal)
+backupJobQueueSteal(const List *queueList, const List *queueSizeList, unsigned int queueOffset)
 {
     FUNCTION_TEST_BEGIN();
-        FUNCTION_TEST_PARAM(UINT, clientIdx);
-        FUNCTION_TEST_PARAM(INT, queueIdx);
-        FUNCTION_TEST_PARAM(UINT, queueTotal);
+        FUNCTION_TEST_PARAM(LIST, queueList);
+        FUNCTION_TEST_PARAM(LIST, queueSizeList);
+        FUNCTION_TEST_PARAM(UINT, queueOffset);
     FUNCTION_TEST_END();
 
-    // Move (forward or back) to the next queue
-    queueIdx += clientIdx % 2 ? -1 : 1;
+    ASSERT(queueList != NULL);
+    ASSERT(queueSizeList != NULL);
 
-    // Deal with wrapping on either end
-    if (queueIdx < 0)
-        FUNCTION_TEST_RETURN((int)queueTotal - 1);
-    else if (queueIdx == (int)queueTotal)
-        FUNCTION_TEST_RETURN(0);
+    int result = -1;
 
-    FUNCTION_TEST_RETURN(queueIdx);
+    for (unsigned int queueIdx = queueOffset; queueIdx < lstSize(queueList); queueIdx++)
+    {
+        if (!lstEmpty(*(List **)lstGet(queueList, queueIdx)) &&
+            (result == -1 ||
+             *(uint64_t *)lstGet(queueSizeList, queueIdx) > *(uint64_t *)lstGet(queueSizeList, (unsigned int)result)))
+        {
+            result = (int)queueIdx;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
 }
 
 // Callback to fetch backup jobs for the parallel executor
@@ -1442,8 +1456,14 @@ typedef struct BackupJobData
     const int compressLevel;                                        // Compress level if backup is compressed
     const bool delta;                                               // Is this a checksum delta backup?
     const uint64_t lsnStart;                                        // Starting lsn for the backup
+    const uint64_t blockIncrSize;                                   // Block incremental size (0 if disabled)
+    const uint64_t checksumRangeSize;                               // Size of ranges to checksum in large files (0 if disabled)
+    const Manifest *const manifestPrior;                            // Prior manifest to find block maps (NULL for full backup)
 
     List *queueList;                                                // List of processing queues
+    List *queueSizeList;                                            // Bytes remaining in each processing queue
+    unsigned int stealTotal;                                        // Jobs taken from the queue of another process
+    uint64_t stealSize;                                             // Bytes taken from the queue of another process
 } BackupJobData;
 
 static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx)
@@ -1462,56 +1482,92 @@ static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx
         // Get a new job if there are any left
         BackupJobData *jobData = data;
 
-        // Determine where to begin scanning the queue (we'll stop when we get back here).  When copying from the primary during
-        // backup from standby only queue 0 will be used.
+        // Take jobs from the queue of this process first. When it is empty take them from the queue with most bytes remaining. When
+        // copying from the primary during backup from standby only queue 0 will be used and processes copying from the standby will
+        // never use queue 0.
         unsigned int queueOffset = jobData->backupStandby && clientIdx > 0 ? 1 : 0;
         int queueIdx = jobData->backupStandby && clientIdx == 0 ?
-            0 : (int)(clientIdx % (lstSize(jobData->queueList) - queueOffset));
-        int queueEnd = queueIdx;
+            0 : (int)(clientIdx % (lstSize(jobData->queueList) - queueOffset) + queueOffset);
+        bool steal = false;
 
-        do
+        if (lstEmpty(*(List **)lstGet(jobData->queueList, (unsigned int)queueIdx)) && (!jobData->backupStandby || clientIdx > 0))
         {
-            List *queue = *(List **)lstGet(jobData->queueList, (unsigned int)queueIdx + queueOffset);
+            queueIdx = backupJobQueueSteal(jobData->queueList, jobData->queueSizeList, queueOffset);
+            steal = true;
+        }
+
+        List *const queue = queueIdx == -1 ? NULL : *(List **)lstGet(jobData->queueList, (unsigned int)queueIdx);
 
-            if (!lstEmpty(queue))
+        if (queue != NULL && !lstEmpty(queue))
+        {
+            const ManifestFile *file = *(ManifestFile **)lstGet(queue, 0);
+
+            // Create backup job
+            ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_BACKUP_FILE_STR);
+
+            protocolCommandParamAdd(command, VARSTR(manifestPathPg(file->name)));
+            protocolCommandParamAdd(
+                command, VARBOOL(!strEq(file->name, STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL))));
+            protocolCommandParamAdd(command, VARUINT64(file->size));
+            protocolCommandParamAdd(command, VARBOOL(!file->primary));
+            protocolCommandParamAdd(command, file->checksumSha1[0] != 0 ? VARSTRZ(file->checksumSha1) : NULL);
+            protocolCommandParamAdd(command, VARBOOL(file->checksumPage));
+            protocolCommandParamAdd(command, VARUINT64(jobData->lsnStart));
+            protocolCommandParamAdd(command, VARSTR(file->name));
+            protocolCommandParamAdd(command, VARBOOL(file->reference != NULL));
+            protocolCommandParamAdd(command, VARUINT(jobData->compressType));
+            protocolCommandParamAdd(command, VARINT(jobData->compressLevel));
+            protocolCommandParamAdd(command, VARSTR(jobData->backupLabel));
+            protocolCommandParamAdd(command, VARBOOL(jobData->delta));
+            protocolCommandParamAdd(command, VARUINT(jobData->cipherType));
+            protocolCommandParamAdd(command, VARSTR(jobData->cipherSubPass));
+
+            // Use block incremental when enabled and the file has at least one full block. The block map in the prior backup
+            // can be used to find unchanged blocks only when it was created with the same block size.
+            const uint64_t blockIncrSize = file->size >= jobData->blockIncrSize ? jobData->blockIncrSize : 0;
+            const ManifestFile *const filePrior =
+                blockIncrSize != 0 && jobData->manifestPrior != NULL ?
+                    manifestFileFindDefault(jobData->manifestPrior, file->name, NULL) : NULL;
+
+            protocolCommandParamAdd(command, VARUINT64(blockIncrSize));
+
+            if (filePrior != NULL && filePrior->blockIncrSize == blockIncrSize)
             {
-                const ManifestFile *file = *(ManifestFile **)lstGet(queue, 0);
+                protocolCommandParamAdd(
+                    command,
+                    VARSTR(
+                        filePrior->reference != NULL ?
+                            filePrior->reference : manifestData(jobData->manifestPrior)->backupLabel));
+                protocolCommandParamAdd(command, VARUINT64(filePrior->sizeRepo - filePrior->blockIncrMapSize));
+                protocolCommandParamAdd(command, VARUINT64(filePrior->blockIncrMapSize));
+            }
+            else
+            {
+                protocolCommandParamAdd(command, NULL);
+                protocolCommandParamAdd(command, VARUINT64(0));
+                protocolCommandParamAdd(command, VARUINT64(0));
+            }
 
-                // Create backup job
-                ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_BACKUP_FILE_STR);
+            // Checksum each range of files that are large enough to be restored in ranges. Block incremental files are stored in
+            // blocks so they are never restored in ranges.
+            protocolCommandParamAdd(
+                command,
+                VARUINT64(blockIncrSize == 0 && file->size > jobData->checksumRangeSize ? jobData->checksumRangeSize : 0));
 
-                protocolCommandParamAdd(command, VARSTR(manifestPathPg(file->name)));
-                protocolCommandParamAdd(
-                    command, VARBOOL(!strEq(file->name, STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL))));
-                protocolCommandParamAdd(command, VARUINT64(file->size));
-                protocolCommandParamAdd(command, VARBOOL(!file->primary));
-                protocolCommandParamAdd(command, file->checksumSha1[0] != 0 ? VARSTRZ(file->checksumSha1) : NULL);
-                protocolCommandParamAdd(command, VARBOOL(file->checksumPage));
-                protocolCommandParamAdd(command, VARUINT64(jobData->lsnStart));
-                protocolCommandParamAdd(command, VARSTR(file->name));
-                protocolCommandParamAdd(command, VARBOOL(file->reference != NULL));
-                protocolCommandParamAdd(command, VARUINT(jobData->compressType));
-                protocolCommandParamAdd(command, VARINT(jobData->compressLevel));
-                protocolCommandParamAdd(command, VARSTR(jobData->backupLabel));
-                protocolCommandParamAdd(command, VARBOOL(jobData->delta));
-                protocolCommandParamAdd(command, VARUINT(jobData->cipherType));
-                protocolCommandParamAdd(command, VARSTR(jobData->cipherSubPass));
-
-                // Remove job from the queue
-                lstRemoveIdx(queue, 0);
-
-                // Assign job to result
-                result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(file->name), command), memContextPrior());
-
-                // Break out of the loop early since we found a job
-                break;
+            // Remove job from the queue
+            lstRemoveIdx(queue, 0);
+            *(uint64_t *)lstGet(jobData->queueSizeList, (unsigned int)queueIdx) -= file->size;
+
+            // Update scheduling stats
+            if (steal)
+            {
+                jobData->stealTotal++;
+                jobData->stealSize += file->size;
             }
 
-            // Don't get next queue when copying from primary during backup from standby since the primary only has one queue
-            if (!jobData->backupStandby || clientIdx > 0)
-                queueIdx = backupJobQueueNext(clientIdx, queueIdx, lstSize(jobData->queueList) - queueOffset);
+            // Assign job to result
+            result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(file->name), command), memContextPrior());
         }
-        while (queueIdx != queueEnd);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -1519,11 +1575,14 @@ static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx
 }
 
 static void
-backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart, const String *cipherPassBackup)
+backupProcess(
+    BackupData *backupData, Manifest *manifest, const Manifest *manifestPrior, const String *lsnStart,
+    const String *cipherPassBackup)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(BACKUP_DATA, backupData);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
+        FUNCTION_LOG_PARAM(MANIFEST, manifestPrior);
         FUNCTION_LOG_PARAM(STRING, lsnStart);
         FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
     FUNCTION_LOG_END();
@@ -1589,13 +1648,16 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
             .cipherSubPass = manifestCipherSubPass(manifest),
             .delta = cfgOptionBool(cfgOptDelta),
             .lsnStart = cfgOptionBool(cfgOptOnline) ? pgLsnFromStr(lsnStart) : 0xFFFFFFFFFFFFFFFF,
+            .blockIncrSize = cfgOptionBool(cfgOptRepoBlock) ? cfgOptionUInt64(cfgOptRepoBlockSize) : 0,
+            .checksumRangeSize = cfgOptionUInt64(cfgOptSplitSize),
+            .manifestPrior = manifestPrior,
         };
 
-        uint64_t sizeTotal = backupProcessQueue(manifest, &jobData.queueList);
+        uint64_t sizeTotal = backupProcessQueue(manifest, &jobData.queueList, &jobData.queueSizeList);
 
         // Create the parallel executor
         ProtocolParallel *parallelExec = protocolParallelNew(
-            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, backupJobCallback, &jobData);
+            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, cfgOptionUInt(cfgOptJobQueueMax), backupJobCallback, &jobData);
 
         // First client is always on the primary
         protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypePg, backupData->pgIdxPrimary, 1));
@@ -1657,6 +1719,14 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
         }
         MEM_CONTEXT_TEMP_END();
 
+        // Report how work was balanced between processes
+        if (processMax > 1)
+        {
+            LOG_DETAIL_FMT(
+                "%u file(s) (%s) taken from the queue of another process", jobData.stealTotal,
+                strZ(strSizeFormat(jobData.stealSize)));
+        }
+
 #ifdef DEBUG
         // Ensure that all processing queues are empty
         for (unsigned int queueIdx = 0; queueIdx < lstSize(jobData.queueList); queueIdx++)
@@ -1784,8 +1854,8 @@ backupArchiveCheckCopy(Manifest *manifest, unsigned int walSegmentSize, const St
                         CompressType backupCompressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType));
 
                         // Open the archive file
-                        StorageRead *read = storageNewReadP(
-                            storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(archiveFile)));
+                        StorageRead *read = walSegmentReadNew(
+                            storageRepo(), strNewFmt("%s/%s", strZ(archiveId), strZ(archiveFile)), false);
                         IoFilterGroup *filterGroup = ioReadFilterGroup(storageReadIo(read));
 
                         // Decrypt with archive key if encrypted
@@ -1982,7 +2052,7 @@ cmdBackup(void)
         manifestBuildValidate(
             manifest, cfgOptionBool(cfgOptDelta), backupTime(backupData, true), compressTypeEnum(cfgOptionStr(cfgOptCompressType)));
 
-        // Build an incremental backup if type is not full (manifestPrior will be freed in this call)
+        // Build an incremental backup if type is not full
         if (!backupBuildIncr(infoBackup, manifest, manifestPrior, backupStartResult.walSegmentName))
             manifestCipherSubPassSet(manifest, cipherPassGen(cipherType(cfgOptionStr(cfgOptRepoCipherType))));
 
@@ -2002,7 +2072,7 @@ cmdBackup(void)
         backupManifestSaveCopy(manifest, cipherPassBackup);
 
         // Process the backup manifest
-        backupProcess(backupData, manifest, backupStartResult.lsn, cipherPassBackup);
+        backupProcess(backupData, manifest, manifestPrior, backupStartResult.lsn, cipherPassBackup);
 
         // Stop the backup
         BackupStopResult backupStopResult = backupStop(backupData, manifest);
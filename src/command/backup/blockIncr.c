@@ -0,0 +1,399 @@
+/***********************************************************************************************************************************
+Block Incremental
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <string.h>
+
+#include "command/backup/blockIncr.h"
+#include "common/crypto/cipherBlock.h"
+#include "common/debug.h"
+#include "common/io/bufferRead.h"
+#include "common/io/bufferWrite.h"
+#include "common/io/filter/group.h"
+#include "common/io/io.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/pack.h"
+#include "storage/helper.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct BlockMap
+{
+    BlockMapPub pub;                                                // Publicly accessible variables
+    StringList *referenceList;                                      // List of references used by the map
+};
+
+/**********************************************************************************************************************************/
+BlockMap *
+blockMapNew(void)
+{
+    FUNCTION_TEST_VOID();
+
+    BlockMap *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("BlockMap")
+    {
+        this = memNew(sizeof(BlockMap));
+
+        *this = (BlockMap)
+        {
+            .pub =
+            {
+                .memContext = MEM_CONTEXT_NEW(),
+                .list = lstNewP(sizeof(BlockMapItem)),
+            },
+            .referenceList = strLstNew(),
+        };
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_TEST_RETURN(this);
+}
+
+/**********************************************************************************************************************************/
+BlockMap *
+blockMapNewBuf(const Buffer *const map)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BUFFER, map);
+    FUNCTION_LOG_END();
+
+    ASSERT(map != NULL);
+
+    BlockMap *this = blockMapNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        PackRead *const read = pckReadNewBuf(map);
+
+        // Read the references
+        StringList *const referenceList = strLstNew();
+
+        pckReadArrayBeginP(read);
+
+        while (pckReadNext(read))
+            strLstAdd(referenceList, pckReadStrP(read, .id = pckReadId(read)));
+
+        pckReadArrayEndP(read);
+
+        // Read the blocks
+        const uint64_t blockTotal = pckReadU64P(read);
+
+        pckReadArrayBeginP(read);
+
+        for (uint64_t blockIdx = 0; blockIdx < blockTotal; blockIdx++)
+        {
+            const unsigned int referenceIdx = pckReadU32P(read);
+
+            if (referenceIdx >= strLstSize(referenceList))
+                THROW_FMT(FormatError, "block map reference %u is out of range", referenceIdx);
+
+            BlockMapItem item =
+            {
+                .reference = strLstGet(referenceList, referenceIdx),
+                .offset = pckReadU64P(read),
+                .size = pckReadU64P(read),
+            };
+
+            const Buffer *const checksum = pckReadBinP(read);
+
+            if (bufUsed(checksum) != HASH_TYPE_SHA1_SIZE)
+                THROW_FMT(FormatError, "block map checksum size %zu is invalid", bufUsed(checksum));
+
+            memcpy(item.checksum, bufPtrConst(checksum), HASH_TYPE_SHA1_SIZE);
+
+            blockMapAdd(this, &item);
+        }
+
+        pckReadArrayEndP(read);
+        pckReadEndP(read);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BLOCK_MAP, this);
+}
+
+/**********************************************************************************************************************************/
+BlockMap *
+blockMapAdd(BlockMap *const this, const BlockMapItem *const item)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BLOCK_MAP, this);
+        FUNCTION_TEST_PARAM_P(VOID, item);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(item != NULL);
+    ASSERT(item->reference != NULL);
+
+    MEM_CONTEXT_BEGIN(this->pub.memContext)
+    {
+        BlockMapItem itemAdd = *item;
+
+        // Store the reference in the map's reference list so the caller's string does not need to remain valid
+        itemAdd.reference = strLstAddIfMissing(this->referenceList, item->reference);
+
+        lstAdd(this->pub.list, &itemAdd);
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN(this);
+}
+
+/**********************************************************************************************************************************/
+// Helper to find the index of a block reference. References always point into the reference list so comparing pointers is enough.
+static unsigned int
+blockMapReferenceIdx(const BlockMap *const this, const String *const reference)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BLOCK_MAP, this);
+        FUNCTION_TEST_PARAM(STRING, reference);
+    FUNCTION_TEST_END();
+
+    unsigned int result = 0;
+
+    while (strLstGet(this->referenceList, result) != reference)
+        result++;
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+Buffer *
+blockMapBuf(const BlockMap *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BLOCK_MAP, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    Buffer *const result = bufNew(0);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        PackWrite *const write = pckWriteNewBuf(result);
+
+        // Write the references
+        pckWriteArrayBeginP(write);
+
+        for (unsigned int referenceIdx = 0; referenceIdx < strLstSize(this->referenceList); referenceIdx++)
+            pckWriteStrP(write, strLstGet(this->referenceList, referenceIdx));
+
+        pckWriteArrayEndP(write);
+
+        // Write the blocks
+        pckWriteU64P(write, blockMapSize(this));
+        pckWriteArrayBeginP(write);
+
+        for (unsigned int blockIdx = 0; blockIdx < blockMapSize(this); blockIdx++)
+        {
+            const BlockMapItem *const item = blockMapGet(this, blockIdx);
+
+            pckWriteU32P(write, blockMapReferenceIdx(this, item->reference));
+            pckWriteU64P(write, item->offset);
+            pckWriteU64P(write, item->size);
+            pckWriteBinP(write, BUF(item->checksum, HASH_TYPE_SHA1_SIZE));
+        }
+
+        pckWriteArrayEndP(write);
+        pckWriteEndP(write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/**********************************************************************************************************************************/
+Buffer *
+blockIncrEncode(
+    const Buffer *const block, const CompressType compressType, const int compressLevel, const CipherType cipherType,
+    const String *const cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BUFFER, block);
+        FUNCTION_LOG_PARAM(ENUM, compressType);
+        FUNCTION_LOG_PARAM(INT, compressLevel);
+        FUNCTION_LOG_PARAM(ENUM, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(block != NULL);
+    ASSERT((cipherType == cipherTypeNone && cipherPass == NULL) || (cipherType != cipherTypeNone && cipherPass != NULL));
+
+    Buffer *const result = bufNew(0);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        IoWrite *const write = ioBufferWriteNew(result);
+
+        if (compressType != compressTypeNone)
+            ioFilterGroupAdd(ioWriteFilterGroup(write), compressFilter(compressType, compressLevel));
+
+        if (cipherType != cipherTypeNone)
+            ioFilterGroupAdd(ioWriteFilterGroup(write), cipherBlockNew(cipherModeEncrypt, cipherType, BUFSTR(cipherPass), NULL));
+
+        ioWriteOpen(write);
+        ioWrite(write, block);
+        ioWriteClose(write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/**********************************************************************************************************************************/
+Buffer *
+blockIncrDecode(const Buffer *const block, const CompressType compressType, const String *const cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BUFFER, block);
+        FUNCTION_LOG_PARAM(ENUM, compressType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(block != NULL);
+
+    Buffer *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        IoRead *const read = ioBufferReadNew(block);
+
+        if (cipherPass != NULL)
+        {
+            ioFilterGroupAdd(
+                ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+        }
+
+        if (compressType != compressTypeNone)
+            ioFilterGroupAdd(ioReadFilterGroup(read), decompressFilter(compressType));
+
+        ioReadOpen(read);
+
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            result = ioReadBuf(read);
+        }
+        MEM_CONTEXT_PRIOR_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/**********************************************************************************************************************************/
+void
+blockIncrRead(
+    const Storage *const storage, const String *const repoFile, const String *const mapReference, const uint64_t mapOffset,
+    const uint64_t mapSize, const CompressType compressType, const String *const cipherPass, IoWrite *const destination)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, repoFile);
+        FUNCTION_LOG_PARAM(STRING, mapReference);
+        FUNCTION_LOG_PARAM(UINT64, mapOffset);
+        FUNCTION_LOG_PARAM(UINT64, mapSize);
+        FUNCTION_LOG_PARAM(ENUM, compressType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+        FUNCTION_LOG_PARAM(IO_WRITE, destination);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(repoFile != NULL);
+    ASSERT(mapReference != NULL);
+    ASSERT(mapSize > 0);
+    ASSERT(destination != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Load the block map from the end of the repository file
+        const BlockMap *const blockMap = blockMapNewBuf(
+            blockIncrDecode(
+                storageGetP(
+                    storageNewReadP(
+                        storage,
+                        strNewFmt(
+                            STORAGE_REPO_BACKUP "/%s/%s%s", strZ(mapReference), strZ(repoFile), strZ(compressExtStr(compressType))),
+                        .offset = mapOffset, .limit = VARUINT64(mapSize))),
+                compressType, cipherPass));
+
+        // Read the blocks. Blocks that are stored contiguously in the same repository file are read with a single request.
+        unsigned int blockIdx = 0;
+
+        while (blockIdx < blockMapSize(blockMap))
+        {
+            const BlockMapItem *const blockFirst = blockMapGet(blockMap, blockIdx);
+            unsigned int blockTotal = 1;
+            uint64_t readSize = blockFirst->size;
+
+            while (blockIdx + blockTotal < blockMapSize(blockMap))
+            {
+                const BlockMapItem *const blockNext = blockMapGet(blockMap, blockIdx + blockTotal);
+
+                if (blockNext->reference != blockFirst->reference || blockNext->offset != blockFirst->offset + readSize)
+                    break;
+
+                readSize += blockNext->size;
+                blockTotal++;
+            }
+
+            MEM_CONTEXT_TEMP_BEGIN()
+            {
+                IoRead *const read = storageReadIo(
+                    storageNewReadP(
+                        storage,
+                        strNewFmt(
+                            STORAGE_REPO_BACKUP "/%s/%s%s", strZ(blockFirst->reference), strZ(repoFile),
+                            strZ(compressExtStr(compressType))),
+                        .offset = blockFirst->offset, .limit = VARUINT64(readSize)));
+
+                ioReadOpen(read);
+
+                MEM_CONTEXT_TEMP_RESET_BEGIN()
+                {
+                    for (unsigned int blockReadIdx = 0; blockReadIdx < blockTotal; blockReadIdx++)
+                    {
+                        const BlockMapItem *const block = blockMapGet(blockMap, blockIdx + blockReadIdx);
+                        Buffer *const blockRaw = bufNew((size_t)block->size);
+
+                        ioRead(read, blockRaw);
+
+                        if (!bufFull(blockRaw))
+                        {
+                            THROW_FMT(
+                                FileReadError, "unexpected eof reading block %u of '%s' from backup '%s'", blockIdx + blockReadIdx,
+                                strZ(repoFile), strZ(block->reference));
+                        }
+
+                        // Decode the block and verify the checksum
+                        const Buffer *const blockData = blockIncrDecode(blockRaw, compressType, cipherPass);
+
+                        if (!bufEq(cryptoHashOne(HASH_TYPE_SHA1_STR, blockData), BUF(block->checksum, HASH_TYPE_SHA1_SIZE)))
+                        {
+                            THROW_FMT(
+                                ChecksumError, "invalid checksum for block %u of '%s' from backup '%s'", blockIdx + blockReadIdx,
+                                strZ(repoFile), strZ(block->reference));
+                        }
+
+                        ioWrite(destination, blockData);
+
+                        // Free memory used by the block
+                        MEM_CONTEXT_TEMP_RESET(1);
+                    }
+                }
+                MEM_CONTEXT_TEMP_END();
+
+                ioReadClose(read);
+            }
+            MEM_CONTEXT_TEMP_END();
+
+            blockIdx += blockTotal;
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
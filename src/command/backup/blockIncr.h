@@ -0,0 +1,111 @@
+/***********************************************************************************************************************************
+Block Incremental
+
+Files backed up with block incremental are split into blocks of equal size (except for the last block, which may be smaller). Each
+block that has changed since the prior backup is compressed and encrypted separately and stored in the repository file. The block
+map is appended to the end of the repository file (also compressed and encrypted) and describes where each block of the original
+file can be found -- either in the current backup or in a prior backup in the same backup set.
+
+The block map is a pack containing an array of the backup references used by the map followed by the total number of blocks and an
+array of blocks, where each block consists of the reference index, offset in the repository file, size in the repository file, and
+SHA1 checksum of the block.
+***********************************************************************************************************************************/
+#ifndef COMMAND_BACKUP_BLOCK_INCR_H
+#define COMMAND_BACKUP_BLOCK_INCR_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct BlockMap BlockMap;
+
+#include "common/compress/helper.h"
+#include "common/crypto/common.h"
+#include "common/crypto/hash.h"
+#include "common/io/write.h"
+#include "common/type/buffer.h"
+#include "common/type/list.h"
+#include "common/type/object.h"
+#include "storage/storage.h"
+
+/***********************************************************************************************************************************
+Block map item
+***********************************************************************************************************************************/
+typedef struct BlockMapItem
+{
+    const String *reference;                                        // Backup label where the block is stored
+    uint64_t offset;                                                // Offset of the block in the repository file
+    uint64_t size;                                                  // Size of the block in the repository file
+    unsigned char checksum[HASH_TYPE_SHA1_SIZE];                    // SHA1 checksum of the original block
+} BlockMapItem;
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+BlockMap *blockMapNew(void);
+
+// Load a block map from a buffer
+BlockMap *blockMapNewBuf(const Buffer *map);
+
+/***********************************************************************************************************************************
+Getters/Setters
+***********************************************************************************************************************************/
+typedef struct BlockMapPub
+{
+    MemContext *memContext;                                         // Mem context
+    List *list;                                                     // Block list
+} BlockMapPub;
+
+// Get a block
+__attribute__((always_inline)) static inline const BlockMapItem *
+blockMapGet(const BlockMap *const this, const unsigned int mapIdx)
+{
+    return (const BlockMapItem *)lstGet(THIS_PUB(BlockMap)->list, mapIdx);
+}
+
+// Total blocks in the map
+__attribute__((always_inline)) static inline unsigned int
+blockMapSize(const BlockMap *const this)
+{
+    return lstSize(THIS_PUB(BlockMap)->list);
+}
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Add a block to the map
+BlockMap *blockMapAdd(BlockMap *this, const BlockMapItem *item);
+
+// Render the block map into a buffer
+Buffer *blockMapBuf(const BlockMap *this);
+
+// Compress and encrypt a block (or the block map) for storage in the repository
+Buffer *blockIncrEncode(
+    const Buffer *block, CompressType compressType, int compressLevel, CipherType cipherType, const String *cipherPass);
+
+// Decrypt and decompress a block (or the block map) read from the repository
+Buffer *blockIncrDecode(const Buffer *block, CompressType compressType, const String *cipherPass);
+
+// Reassemble a block incremental file from the repository and write it to the destination. The destination must already be open
+// and will not be closed.
+void blockIncrRead(
+    const Storage *storage, const String *repoFile, const String *mapReference, uint64_t mapOffset, uint64_t mapSize,
+    CompressType compressType, const String *cipherPass, IoWrite *destination);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+__attribute__((always_inline)) static inline void
+blockMapFree(BlockMap *const this)
+{
+    objFree(this);
+}
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_BLOCK_MAP_TYPE                                                                                                \
+    BlockMap *
+#define FUNCTION_LOG_BLOCK_MAP_FORMAT(value, buffer, bufferSize)                                                                   \
+    objToLog(value, "BlockMap", buffer, bufferSize)
+
+#endif
@@ -5,8 +5,10 @@ Backup File
 
 #include <string.h>
 
+#include "command/backup/blockIncr.h"
 #include "command/backup/file.h"
 #include "command/backup/pageChecksum.h"
+#include "command/backup/rangeChecksum.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
 #include "common/debug.h"
@@ -39,7 +41,8 @@ backupFile(
     const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, bool pgFileCopyExactSize, const String *pgFileChecksum,
     bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference,
     CompressType repoFileCompressType, int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType,
-    const String *cipherPass)
+    const String *cipherPass, uint64_t blockIncrSize, const String *blockIncrMapPriorReference, uint64_t blockIncrMapPriorOffset,
+    uint64_t blockIncrMapPriorSize, uint64_t checksumRangeSize)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, pgFile);                         // Database file to copy to the repo
@@ -57,12 +60,19 @@ backupFile(
         FUNCTION_LOG_PARAM(BOOL, delta);                            // Is the delta option on?
         FUNCTION_LOG_PARAM(ENUM, cipherType);                       // Encryption type
         FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to access the repo file if encrypted
+        FUNCTION_LOG_PARAM(UINT64, blockIncrSize);                  // Block size for block incremental (0 if disabled)
+        FUNCTION_LOG_PARAM(STRING, blockIncrMapPriorReference);     // Backup where the prior block map is stored
+        FUNCTION_LOG_PARAM(UINT64, blockIncrMapPriorOffset);        // Offset of the prior block map in the repo file
+        FUNCTION_LOG_PARAM(UINT64, blockIncrMapPriorSize);          // Size of the prior block map (0 if no prior map)
+        FUNCTION_LOG_PARAM(UINT64, checksumRangeSize);              // Size of ranges to checksum (0 if disabled)
     FUNCTION_LOG_END();
 
     ASSERT(pgFile != NULL);
     ASSERT(repoFile != NULL);
     ASSERT(backupLabel != NULL);
     ASSERT((cipherType == cipherTypeNone && cipherPass == NULL) || (cipherType != cipherTypeNone && cipherPass != NULL));
+    ASSERT(blockIncrMapPriorSize == 0 || (blockIncrSize != 0 && blockIncrMapPriorReference != NULL));
+    ASSERT(blockIncrSize == 0 || checksumRangeSize == 0);
 
     // Backup file results
     BackupFileResult result = {.backupCopyResult = backupCopyResultCopy};
@@ -189,8 +199,130 @@ backupFile(
             }
         }
 
-        // Copy the file
-        if (result.backupCopyResult == backupCopyResultCopy || result.backupCopyResult == backupCopyResultReCopy)
+        // Copy the file using block incremental. Each block is stored separately so only blocks that have changed since the prior
+        // backup need to be stored in the repo.
+        if ((result.backupCopyResult == backupCopyResultCopy || result.backupCopyResult == backupCopyResultReCopy) &&
+            blockIncrSize != 0)
+        {
+            // Load the block map from the prior backup. Blocks with a checksum that matches the prior map will be referenced rather
+            // than stored again.
+            const BlockMap *blockMapPrior = NULL;
+
+            if (blockIncrMapPriorSize != 0)
+            {
+                blockMapPrior = blockMapNewBuf(
+                    blockIncrDecode(
+                        storageGetP(
+                            storageNewReadP(
+                                storageRepo(),
+                                strNewFmt(
+                                    STORAGE_REPO_BACKUP "/%s/%s%s", strZ(blockIncrMapPriorReference), strZ(repoFile),
+                                    strZ(compressExtStr(repoFileCompressType))),
+                                .offset = blockIncrMapPriorOffset, .limit = VARUINT64(blockIncrMapPriorSize))),
+                        repoFileCompressType, cipherPass));
+            }
+
+            // Setup pg file for read. Only read as many bytes as passed in pgFileSize for the same reason as the full copy below.
+            IoRead *const read = storageReadIo(
+                storageNewReadP(
+                    storagePg(), pgFile, .ignoreMissing = pgFileIgnoreMissing,
+                    .limit = pgFileCopyExactSize ? VARUINT64(pgFileSize) : NULL));
+            ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
+            ioFilterGroupAdd(ioReadFilterGroup(read), ioSizeNew());
+
+            // Add page checksum filter
+            if (pgFileChecksumPage)
+            {
+                ioFilterGroupAdd(
+                    ioReadFilterGroup(read), pageChecksumNew(segmentNumber(pgFile), PG_SEGMENT_PAGE_DEFAULT,
+                    pgFileChecksumPageLsnLimit));
+            }
+
+            // If the pg file exists then copy changed blocks to the repo
+            if (ioReadOpen(read))
+            {
+                IoWrite *const write = storageWriteIo(storageNewWriteP(storageRepoWrite(), repoPathFile));
+                ioWriteOpen(write);
+
+                BlockMap *const blockMap = blockMapNew();
+                uint64_t repoOffset = 0;
+
+                MEM_CONTEXT_TEMP_RESET_BEGIN()
+                {
+                    while (!ioReadEof(read))
+                    {
+                        Buffer *const block = bufNew((size_t)blockIncrSize);
+                        ioRead(read, block);
+
+                        if (!bufEmpty(block))
+                        {
+                            const unsigned int blockIdx = blockMapSize(blockMap);
+                            BlockMapItem blockItem = {.reference = backupLabel, .offset = repoOffset};
+
+                            memcpy(
+                                blockItem.checksum, bufPtrConst(cryptoHashOne(HASH_TYPE_SHA1_STR, block)), HASH_TYPE_SHA1_SIZE);
+
+                            // Reference the block in the prior backup if it has not changed
+                            if (blockMapPrior != NULL && blockIdx < blockMapSize(blockMapPrior) &&
+                                memcmp(
+                                    blockMapGet(blockMapPrior, blockIdx)->checksum, blockItem.checksum, HASH_TYPE_SHA1_SIZE) == 0)
+                            {
+                                blockItem = *blockMapGet(blockMapPrior, blockIdx);
+                            }
+                            // Else store the block in the repo
+                            else
+                            {
+                                const Buffer *const blockRepo = blockIncrEncode(
+                                    block, repoFileCompressType, repoFileCompressLevel, cipherType, cipherPass);
+
+                                ioWrite(write, blockRepo);
+
+                                blockItem.size = bufUsed(blockRepo);
+                                repoOffset += blockItem.size;
+                            }
+
+                            blockMapAdd(blockMap, &blockItem);
+                        }
+
+                        // Free memory used by the block
+                        MEM_CONTEXT_TEMP_RESET(1);
+                    }
+                }
+                MEM_CONTEXT_TEMP_END();
+
+                ioReadClose(read);
+
+                // Store the block map at the end of the repo file
+                const Buffer *const blockMapRepo = blockIncrEncode(
+                    blockMapBuf(blockMap), repoFileCompressType, repoFileCompressLevel, cipherType, cipherPass);
+
+                ioWrite(write, blockMapRepo);
+                ioWriteClose(write);
+
+                MEM_CONTEXT_PRIOR_BEGIN()
+                {
+                    // Get sizes and checksum
+                    result.copySize = varUInt64Force(ioFilterGroupResult(ioReadFilterGroup(read), SIZE_FILTER_TYPE_STR));
+                    result.copyChecksum = strDup(varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR)));
+                    result.repoSize = repoOffset + bufUsed(blockMapRepo);
+                    result.blockIncrSize = blockIncrSize;
+                    result.blockIncrMapSize = bufUsed(blockMapRepo);
+
+                    // Get results of page checksum validation
+                    if (pgFileChecksumPage)
+                    {
+                        result.pageChecksumResult = kvDup(
+                            varKv(ioFilterGroupResult(ioReadFilterGroup(read), PAGE_CHECKSUM_FILTER_TYPE_STR)));
+                    }
+                }
+                MEM_CONTEXT_PRIOR_END();
+            }
+            // Else if source file is missing and the read setup indicated ignore a missing file, the database removed it so skip it
+            else
+                result.backupCopyResult = backupCopyResultSkip;
+        }
+        // Else copy the entire file
+        else if (result.backupCopyResult == backupCopyResultCopy || result.backupCopyResult == backupCopyResultReCopy)
         {
             // Is the file compressible during the copy?
             bool compressible = repoFileCompressType == compressTypeNone && cipherType == cipherTypeNone;
@@ -212,6 +344,10 @@ backupFile(
                     pgFileChecksumPageLsnLimit));
             }
 
+            // Add range checksum filter so ranges of the file can be verified independently during restore
+            if (checksumRangeSize != 0)
+                ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), rangeChecksumNew(checksumRangeSize));
+
             // Add compression
             if (repoFileCompressType != compressTypeNone)
             {
@@ -250,6 +386,15 @@ backupFile(
                         result.pageChecksumResult = kvDup(
                             varKv(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), PAGE_CHECKSUM_FILTER_TYPE_STR)));
                     }
+
+                    // Get range checksums when there is more than one range, i.e. the file did not shrink since the manifest was
+                    // built
+                    if (checksumRangeSize != 0 && result.copySize > checksumRangeSize)
+                    {
+                        result.checksumRangeSize = checksumRangeSize;
+                        result.checksumRange = strDup(
+                            varStr(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), RANGE_CHECKSUM_FILTER_TYPE_STR)));
+                    }
                 }
                 MEM_CONTEXT_PRIOR_END();
             }
@@ -262,9 +407,10 @@ backupFile(
         // written. This has to be checked after the file is at rest because filesystem compression may affect the actual repo size
         // and this cannot be calculated in stream.
         //
-        // If the file was checksummed then get the size in all cases since we don't already have it.
+        // If the file was checksummed then get the size in all cases since we don't already have it. Block incremental files are
+        // excluded because the block map is located using the size of the data that was written.
         if (((result.backupCopyResult == backupCopyResultCopy || result.backupCopyResult == backupCopyResultReCopy) &&
-                storageFeature(storageRepo(), storageFeatureCompress)) ||
+                result.blockIncrMapSize == 0 && storageFeature(storageRepo(), storageFeatureCompress)) ||
             result.backupCopyResult == backupCopyResultChecksum)
         {
             result.repoSize = storageInfoP(storageRepo(), repoPathFile).size;
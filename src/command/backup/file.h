@@ -31,12 +31,17 @@ typedef struct BackupFileResult
     String *copyChecksum;
     uint64_t repoSize;
     KeyValue *pageChecksumResult;
+    uint64_t blockIncrSize;
+    uint64_t blockIncrMapSize;
+    uint64_t checksumRangeSize;
+    String *checksumRange;
 } BackupFileResult;
 
 BackupFileResult backupFile(
     const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, bool pgFileCopyExactSize, const String *pgFileChecksum,
     bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference,
     CompressType repoFileCompressType, int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType,
-    const String *cipherPass);
+    const String *cipherPass, uint64_t blockIncrSize, const String *blockIncrMapPriorReference, uint64_t blockIncrMapPriorOffset,
+    uint64_t blockIncrMapPriorSize, uint64_t checksumRangeSize);
 
 #endif
@@ -38,7 +38,9 @@ backupFileProtocol(const VariantList *paramList, ProtocolServer *server)
             varUInt64(varLstGet(paramList, 6)), varStr(varLstGet(paramList, 7)), varBool(varLstGet(paramList, 8)),
             (CompressType)varUIntForce(varLstGet(paramList, 9)), varIntForce(varLstGet(paramList, 10)),
             varStr(varLstGet(paramList, 11)), varBool(varLstGet(paramList, 12)),
-            (CipherType)varUIntForce(varLstGet(paramList, 13)), varStr(varLstGet(paramList, 14)));
+            (CipherType)varUIntForce(varLstGet(paramList, 13)), varStr(varLstGet(paramList, 14)),
+            varUInt64(varLstGet(paramList, 15)), varStr(varLstGet(paramList, 16)), varUInt64(varLstGet(paramList, 17)),
+            varUInt64(varLstGet(paramList, 18)), varUInt64(varLstGet(paramList, 19)));
 
         // Return backup result
         VariantList *resultList = varLstNew();
@@ -47,6 +49,10 @@ backupFileProtocol(const VariantList *paramList, ProtocolServer *server)
         varLstAdd(resultList, varNewUInt64(result.repoSize));
         varLstAdd(resultList, varNewStr(result.copyChecksum));
         varLstAdd(resultList, result.pageChecksumResult != NULL ? varNewKv(result.pageChecksumResult) : NULL);
+        varLstAdd(resultList, varNewUInt64(result.blockIncrSize));
+        varLstAdd(resultList, varNewUInt64(result.blockIncrMapSize));
+        varLstAdd(resultList, varNewUInt64(result.checksumRangeSize));
+        varLstAdd(resultList, varNewStr(result.checksumRange));
 
         protocolServerResponse(server, varNewVarLst(resultList));
     }
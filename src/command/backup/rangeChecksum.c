@@ -0,0 +1,164 @@
+/***********************************************************************************************************************************
+Range Checksum Filter
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "command/backup/rangeChecksum.h"
+#include "common/crypto/hash.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(RANGE_CHECKSUM_FILTER_TYPE_STR,                       RANGE_CHECKSUM_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct RangeChecksum
+{
+    MemContext *memContext;                                         // Mem context of filter
+
+    uint64_t rangeSize;                                             // Size of each range
+    uint64_t rangeUsed;                                             // Bytes of the current range that have been hashed
+    IoFilter *hash;                                                 // Hash of the current range
+    String *checksum;                                               // Checksums of the completed ranges
+} RangeChecksum;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_RANGE_CHECKSUM_TYPE                                                                                           \
+    RangeChecksum *
+#define FUNCTION_LOG_RANGE_CHECKSUM_FORMAT(value, buffer, bufferSize)                                                              \
+    objToLog(value, "RangeChecksum", buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Add the checksum of the current range and start the next range
+***********************************************************************************************************************************/
+static void
+rangeChecksumNext(RangeChecksum *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(RANGE_CHECKSUM, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->rangeUsed > 0);
+
+    strCat(this->checksum, varStr(ioFilterResult(this->hash)));
+    ioFilterFree(this->hash);
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        this->hash = cryptoHashNew(HASH_TYPE_SHA1_STR);
+    }
+    MEM_CONTEXT_END();
+
+    this->rangeUsed = 0;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Hash the input a range at a time
+***********************************************************************************************************************************/
+static void
+rangeChecksumProcess(THIS_VOID, const Buffer *input)
+{
+    THIS(RangeChecksum);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(RANGE_CHECKSUM, this);
+        FUNCTION_LOG_PARAM(BUFFER, input);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(input != NULL);
+
+    size_t inputOffset = 0;
+
+    while (inputOffset < bufUsed(input))
+    {
+        // Hash as much of the input as fits in the current range
+        const size_t size =
+            bufUsed(input) - inputOffset < this->rangeSize - this->rangeUsed ?
+                bufUsed(input) - inputOffset : (size_t)(this->rangeSize - this->rangeUsed);
+
+        ioFilterProcessIn(this->hash, BUF(bufPtrConst(input) + inputOffset, size));
+        this->rangeUsed += size;
+        inputOffset += size;
+
+        // Add the checksum when the range is complete
+        if (this->rangeUsed == this->rangeSize)
+            rangeChecksumNext(this);
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Return the checksums of all ranges, including the last partial range
+***********************************************************************************************************************************/
+static Variant *
+rangeChecksumResult(THIS_VOID)
+{
+    THIS(RangeChecksum);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(RANGE_CHECKSUM, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    if (this->rangeUsed > 0)
+        rangeChecksumNext(this);
+
+    FUNCTION_LOG_RETURN(VARIANT, varNewStr(this->checksum));
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+rangeChecksumNew(uint64_t rangeSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(UINT64, rangeSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(rangeSize > 0);
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("RangeChecksum")
+    {
+        RangeChecksum *driver = memNew(sizeof(RangeChecksum));
+
+        *driver = (RangeChecksum)
+        {
+            .memContext = memContextCurrent(),
+            .rangeSize = rangeSize,
+            .hash = cryptoHashNew(HASH_TYPE_SHA1_STR),
+            .checksum = strNew(""),
+        };
+
+        // Create param list
+        VariantList *paramList = varLstNew();
+        varLstAdd(paramList, varNewUInt64(rangeSize));
+
+        this = ioFilterNewP(
+            RANGE_CHECKSUM_FILTER_TYPE_STR, driver, paramList, .in = rangeChecksumProcess, .result = rangeChecksumResult);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+IoFilter *
+rangeChecksumNewVar(const VariantList *paramList)
+{
+    return rangeChecksumNew(varUInt64(varLstGet(paramList, 0)));
+}
@@ -0,0 +1,25 @@
+/***********************************************************************************************************************************
+Range Checksum Filter
+
+Calculate a SHA1 checksum for each range of a file so ranges can be verified independently, e.g. when a large file is restored in
+ranges by multiple processes. The result is the hex checksums of the ranges concatenated in order. The last range may be smaller
+than the range size.
+***********************************************************************************************************************************/
+#ifndef COMMAND_BACKUP_RANGE_CHECKSUM_H
+#define COMMAND_BACKUP_RANGE_CHECKSUM_H
+
+#include "common/io/filter/filter.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define RANGE_CHECKSUM_FILTER_TYPE                                  "rangeChecksum"
+    STRING_DECLARE(RANGE_CHECKSUM_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+IoFilter *rangeChecksumNew(uint64_t rangeSize);
+IoFilter *rangeChecksumNewVar(const VariantList *paramList);
+
+#endif
@@ -683,19 +683,25 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
                                                 .expression = STRDEF("^[0-F]{24}.*$")),
                                             sortOrderAsc);
 
+                                    bool indexRemoved = false;
+
                                     for (unsigned int subIdx = 0; subIdx < strLstSize(walSubPathList); subIdx++)
                                     {
                                         removeArchive = true;
                                         String *walSubPath = strLstGet(walSubPathList, subIdx);
 
+                                        // A bundle contains a range of segments so it is used if any part of the range is used
+                                        const String *walSubPathBegin = strSubN(walSubPath, 0, 24);
+                                        const String *walSubPathEnd = strEndsWithZ(walSubPath, WAL_BUNDLE_EXT) ?
+                                            strSubN(walSubPath, 25, 24) : walSubPathBegin;
+
                                         // Determine if the individual archive log is used in a backup
                                         for (unsigned int rangeIdx = 0; rangeIdx < lstSize(archiveRangeList); rangeIdx++)
                                         {
                                             ArchiveRange *archiveRange = lstGet(archiveRangeList, rangeIdx);
 
-                                            if (strCmp(strSubN(walSubPath, 0, 24), archiveRange->start) >= 0 &&
-                                                (archiveRange->stop == NULL ||
-                                                 strCmp(strSubN(walSubPath, 0, 24), archiveRange->stop) <= 0))
+                                            if (strCmp(walSubPathEnd, archiveRange->start) >= 0 &&
+                                                (archiveRange->stop == NULL || strCmp(walSubPathBegin, archiveRange->stop) <= 0))
                                             {
                                                 removeArchive = false;
                                                 break;
@@ -708,6 +714,19 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
                                             // Execute the real expiration and deletion only if the dry-run mode is disabled
                                             if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
                                             {
+                                                // Remove the index first since it may list the file. A new index is
+                                                // created from the path when the next file is added.
+                                                if (!indexRemoved)
+                                                {
+                                                    storageRemoveP(
+                                                        storageRepoIdxWrite(repoIdx),
+                                                        strNewFmt(
+                                                            STORAGE_REPO_ARCHIVE "/%s/%s/" WAL_INDEX_FILE, strZ(archiveId),
+                                                            strZ(walPath)));
+
+                                                    indexRemoved = true;
+                                                }
+
                                                 storageRemoveP(
                                                     storageRepoIdxWrite(repoIdx),
                                                     strNewFmt(
@@ -717,9 +736,9 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
 
                                             // Track that this archive was removed
                                             archiveExpire.total++;
-                                            archiveExpire.stop = strDup(strSubN(walSubPath, 0, 24));
+                                            archiveExpire.stop = strDup(walSubPathEnd);
                                             if (archiveExpire.start == NULL)
-                                                archiveExpire.start = strDup(strSubN(walSubPath, 0, 24));
+                                                archiveExpire.start = strDup(walSubPathBegin);
                                         }
                                         else
                                             logExpire(&archiveExpire, archiveId, repoIdx);
@@ -920,6 +920,93 @@ static const unsigned char helpDataPack[] =
             0x20, 0x69, 0x66, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x63, 0x6F, 0x70, 0x79, 0x20, 0x69, 0x73, 0x20,
             0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2E,
 
+        // archive-get-cache-ttl option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        pckTypeStr << 4 | 0x08, 0x2F, // Summary
+            0x54, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72,
+            0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x67, 0x65, 0x74, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+            0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xAD, 0x05, // Description
+            0x42, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x66, 0x65,
+            0x74, 0x63, 0x68, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x68, 0x72, 0x6F, 0x6E, 0x6F,
+            0x75, 0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x67, 0x65, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+            0x73, 0x73, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+            0x2E, 0x69, 0x6E, 0x66, 0x6F, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x72, 0x65, 0x70, 0x6F,
+            0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E, 0x65, 0x20,
+            0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75,
+            0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x6F,
+            0x72, 0x65, 0x64, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F,
+            0x6E, 0x20, 0x69, 0x73, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x7A, 0x65,
+            0x72, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x63, 0x61, 0x63,
+            0x68, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x6F, 0x6F, 0x6C, 0x2D, 0x70, 0x61, 0x74,
+            0x68, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20,
+            0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20, 0x73, 0x6F,
+            0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x68, 0x72, 0x6F, 0x6E, 0x6F, 0x75, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+            0x73, 0x73, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+            0x6C, 0x6F, 0x61, 0x64, 0x20, 0x69, 0x74, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x69, 0x73, 0x20, 0x64, 0x69, 0x73, 0x63, 0x61, 0x72, 0x64,
+            0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72, 0x20,
+            0x6F, 0x72, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67,
+            0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x77,
+            0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x20, 0x57, 0x41,
+            0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20,
+            0x66, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68,
+            0x65, 0x64, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x61, 0x66, 0x74, 0x65,
+            0x72, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x2D, 0x75, 0x70, 0x67, 0x72, 0x61, 0x64, 0x65, 0x2E, 0x20,
+            0x54, 0x68, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F,
+            0x6E, 0x20, 0x70, 0x61, 0x73, 0x73, 0x70, 0x68, 0x72, 0x61, 0x73, 0x65, 0x73, 0x20, 0x73, 0x6F, 0x20, 0x69, 0x74, 0x20,
+            0x69, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x72, 0x65, 0x61, 0x64, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x79, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69,
+            0x6F, 0x6E, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x75, 0x6E, 0x6C,
+            0x65, 0x73, 0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x69, 0x73,
+            0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2E,
+
+        // archive-get-queue-adaptive option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        pckTypeStr << 4 | 0x08, 0x3B, // Summary
+            0x53, 0x69, 0x7A, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x67, 0x65, 0x74,
+            0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6C,
+            0x61, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x72, 0x61, 0x74, 0x65, 0x73, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xF0, 0x04, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69,
+            0x76, 0x65, 0x2D, 0x67, 0x65, 0x74, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x66, 0x69, 0x6C, 0x6C,
+            0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x67, 0x65, 0x74, 0x2D, 0x71, 0x75,
+            0x65, 0x75, 0x65, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x68, 0x72, 0x6F, 0x6E, 0x6F, 0x75, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73,
+            0x73, 0x20, 0x72, 0x75, 0x6E, 0x73, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70,
+            0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x74, 0x69, 0x6D, 0x65, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x72, 0x65, 0x71,
+            0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51,
+            0x4C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x6E,
+            0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x68, 0x72, 0x6F, 0x6E, 0x6F, 0x75, 0x73,
+            0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x57, 0x41,
+            0x4C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x73, 0x6F,
+            0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x62,
+            0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x72, 0x65, 0x71,
+            0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x69, 0x74, 0x2E, 0x20, 0x41, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x74, 0x68,
+            0x61, 0x74, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x73, 0x20, 0x75, 0x70, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x70,
+            0x6C, 0x61, 0x79, 0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x65, 0x77, 0x65, 0x72, 0x20, 0x57, 0x41, 0x4C, 0x20,
+            0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x75, 0x73, 0x65, 0x73, 0x20, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x73,
+            0x70, 0x61, 0x63, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x6F, 0x6F, 0x6C, 0x2D, 0x70, 0x61,
+            0x74, 0x68, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x6C, 0x65, 0x73, 0x73, 0x20,
+            0x57, 0x41, 0x4C, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20,
+            0x6E, 0x65, 0x65, 0x64, 0x65, 0x64, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65,
+            0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x73, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x74, 0x61,
+            0x72, 0x67, 0x65, 0x74, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x20, 0x67, 0x72, 0x6F, 0x77,
+            0x73, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76,
+            0x65, 0x2D, 0x67, 0x65, 0x74, 0x2D, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2D, 0x6D, 0x61, 0x78, 0x2C, 0x20, 0x77, 0x68, 0x69,
+            0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x75, 0x6E, 0x74, 0x69,
+            0x6C, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x6D, 0x65, 0x61, 0x73, 0x75, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74,
+            0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x6D, 0x61, 0x64, 0x65, 0x2E,
+
         // archive-get-queue-max option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -1046,6 +1133,123 @@ static const unsigned char helpDataPack[] =
             0x61, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x20, 0x63,
             0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E,
 
+        // archive-push-bundle-max option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        pckTypeStr << 4 | 0x08, 0x31, // Summary
+            0x4D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73,
+            0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C,
+            0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xAC, 0x04, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x69,
+            0x73, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74,
+            0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20,
+            0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65,
+            0x64, 0x2C, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x65, 0x63, 0x75, 0x74, 0x69, 0x76, 0x65, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65,
+            0x6E, 0x74, 0x73, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x74, 0x6F,
+            0x67, 0x65, 0x74, 0x68, 0x65, 0x72, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x62,
+            0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+            0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63,
+            0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x73, 0x65, 0x6E, 0x74,
+            0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2C, 0x20,
+            0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x65, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x6C, 0x79, 0x20,
+            0x62, 0x65, 0x6E, 0x65, 0x66, 0x69, 0x63, 0x69, 0x61, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63,
+            0x74, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x73, 0x2E, 0x20, 0x53, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61,
+            0x72, 0x65, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x76, 0x65, 0x64, 0x20, 0x69,
+            0x6E, 0x64, 0x69, 0x76, 0x69, 0x64, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x62, 0x79, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69,
+            0x76, 0x65, 0x2D, 0x67, 0x65, 0x74, 0x2E, 0x0A, 0x0A,
+            0x53, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65,
+            0x20, 0x61, 0x72, 0x65, 0x20, 0x68, 0x65, 0x6C, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20,
+            0x75, 0x6E, 0x74, 0x69, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20,
+            0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65,
+            0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20,
+            0x31, 0x32, 0x38, 0x4D, 0x42, 0x20, 0x6F, 0x66, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74,
+            0x73, 0x20, 0x72, 0x65, 0x67, 0x61, 0x72, 0x64, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x69, 0x73,
+            0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x2E, 0x20, 0x50, 0x61, 0x72, 0x74, 0x69, 0x61, 0x6C, 0x20, 0x57, 0x41,
+            0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6F,
+            0x72, 0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x65, 0x76, 0x65, 0x72, 0x20, 0x62,
+            0x75, 0x6E, 0x64, 0x6C, 0x65, 0x64, 0x2E,
+
+        // archive-push-defer-max option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        pckTypeStr << 4 | 0x08, 0x3D, // Summary
+            0x4D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x73, 0x70, 0x6F, 0x6F, 0x6C, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68,
+            0x20, 0x64, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+            0x2E,
+        pckTypeStr << 4 | 0x08, 0xB2, 0x03, // Description
+            0x57, 0x41, 0x4C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x62, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20,
+            0x61, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65,
+            0x70, 0x6F, 0x2D, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x64, 0x65, 0x66, 0x65,
+            0x72, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x64,
+            0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x6F, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x61,
+            0x6E, 0x64, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63,
+            0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70,
+            0x6F, 0x6F, 0x6C, 0x65, 0x64, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x72, 0x65, 0x70, 0x6F,
+            0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x65, 0x78, 0x63, 0x65, 0x65, 0x64, 0x20,
+            0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x2C, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73,
+            0x20, 0x61, 0x72, 0x65, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x50, 0x6F,
+            0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x69, 0x66, 0x69, 0x65, 0x64,
+            0x2C, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x20, 0x61, 0x73, 0x20, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66, 0x65, 0x72, 0x72, 0x61,
+            0x6C, 0x20, 0x77, 0x61, 0x73, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x75, 0x6E, 0x74, 0x69,
+            0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x63, 0x61, 0x74,
+            0x63, 0x68, 0x65, 0x73, 0x20, 0x75, 0x70, 0x2E, 0x0A, 0x0A,
+            0x53, 0x69, 0x7A, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20,
+            0x69, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0x20, 0x6F,
+            0x72, 0x20, 0x4B, 0x42, 0x2C, 0x20, 0x4D, 0x42, 0x2C, 0x20, 0x47, 0x42, 0x2C, 0x20, 0x54, 0x42, 0x2C, 0x20, 0x6F, 0x72,
+            0x20, 0x50, 0x42, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70,
+            0x6C, 0x69, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x31,
+            0x30, 0x32, 0x34, 0x2E,
+
+        // archive-push-linger option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        pckTypeStr << 4 | 0x08, 0x3E, // Summary
+            0x54, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x68, 0x72, 0x6F, 0x6E, 0x6F, 0x75,
+            0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+            0x73, 0x73, 0x20, 0x77, 0x61, 0x69, 0x74, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x57, 0x41,
+            0x4C, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xF5, 0x04, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x69,
+            0x73, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67,
+            0x72, 0x6F, 0x75, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x20, 0x70,
+            0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x65, 0x78, 0x69, 0x74,
+            0x73, 0x20, 0x61, 0x73, 0x20, 0x73, 0x6F, 0x6F, 0x6E, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x71, 0x75, 0x65,
+            0x75, 0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x20, 0x61,
+            0x6E, 0x64, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x6D, 0x75, 0x73,
+            0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x53,
+            0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6B,
+            0x65, 0x65, 0x70, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x72, 0x75, 0x6E,
+            0x6E, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+            0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x73,
+            0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x71, 0x75, 0x65,
+            0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+            0x57, 0x41, 0x4C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x62, 0x65, 0x63, 0x6F,
+            0x6D, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x65, 0x61, 0x6E,
+            0x74, 0x69, 0x6D, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68,
+            0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x61, 0x72,
+            0x74, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2C, 0x20,
+            0x63, 0x68, 0x65, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74,
+            0x6F, 0x72, 0x79, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6E,
+            0x67, 0x2E, 0x0A, 0x0A,
+            0x57, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x6C, 0x69,
+            0x6E, 0x67, 0x65, 0x72, 0x73, 0x20, 0x69, 0x74, 0x20, 0x68, 0x6F, 0x6C, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61,
+            0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x6C, 0x6F, 0x63, 0x6B, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x72, 0x63, 0x68,
+            0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x50,
+            0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C,
+            0x79, 0x20, 0x77, 0x61, 0x69, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x75,
+            0x73, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x54,
+            0x68, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x6C, 0x65,
+            0x73, 0x73, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x2D, 0x74, 0x69, 0x6D,
+            0x65, 0x6F, 0x75, 0x74, 0x2E,
+
         // archive-push-queue-max option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -1322,6 +1526,62 @@ static const unsigned char helpDataPack[] =
             0x74, 0x20, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x70,
             0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x29,
 
+        // compress-zst-long option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        pckTypeStr << 4 | 0x08, 0x2F, // Summary
+            0x55, 0x73, 0x65, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x6D, 0x61,
+            0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x7A, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72,
+            0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xA4, 0x02, // Description
+            0x4C, 0x6F, 0x6E, 0x67, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x69,
+            0x6E, 0x67, 0x20, 0x66, 0x69, 0x6E, 0x64, 0x73, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x64, 0x61,
+            0x74, 0x61, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x66, 0x61, 0x72, 0x20, 0x61, 0x70, 0x61, 0x72, 0x74,
+            0x20, 0x69, 0x6E, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x77, 0x68, 0x69,
+            0x63, 0x68, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x69, 0x6D, 0x70, 0x72, 0x6F, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63,
+            0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x20, 0x66, 0x6F, 0x72,
+            0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0x20, 0x4D, 0x6F, 0x72,
+            0x65, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72,
+            0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x73, 0x20,
+            0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6C, 0x6F, 0x6E, 0x67,
+            0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x63,
+            0x61, 0x6E, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65,
+            0x73, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20,
+            0x6F, 0x66, 0x20, 0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73,
+            0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x20, 0x7A, 0x73, 0x74, 0x2E,
+
+        // compress-zst-worker option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        pckTypeStr << 4 | 0x08, 0x23, // Summary
+            0x57, 0x6F, 0x72, 0x6B, 0x65, 0x72, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x7A,
+            0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xAE, 0x03, // Description
+            0x53, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74,
+            0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72,
+            0x65, 0x73, 0x73, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x63,
+            0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x7A, 0x73, 0x74, 0x2E, 0x20, 0x54, 0x68,
+            0x69, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65,
+            0x73, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x75,
+            0x73, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x63,
+            0x6F, 0x72, 0x65, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20, 0x75,
+            0x73, 0x65, 0x66, 0x75, 0x6C, 0x20, 0x6E, 0x65, 0x61, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F,
+            0x66, 0x20, 0x61, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+            0x20, 0x61, 0x20, 0x66, 0x65, 0x77, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x72,
+            0x65, 0x6D, 0x61, 0x69, 0x6E, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x6F,
+            0x66, 0x20, 0x30, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x72,
+            0x65, 0x61, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x4E, 0x6F, 0x74, 0x65, 0x20,
+            0x74, 0x68, 0x61, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x77, 0x69,
+            0x6C, 0x6C, 0x20, 0x75, 0x73, 0x65, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x61,
+            0x6E, 0x79, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+            0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61,
+            0x64, 0x73, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x61, 0x73, 0x20, 0x68, 0x69, 0x67, 0x68, 0x20, 0x61, 0x73,
+            0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x20, 0x74,
+            0x68, 0x69, 0x73, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E,
+
         // config option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -1482,6 +1742,37 @@ static const unsigned char helpDataPack[] =
             0x65, 0x72, 0x6D, 0x69, 0x6E, 0x65, 0x20, 0x69, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C,
             0x20, 0x62, 0x65, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x64, 0x2E,
 
+        // delta-block option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65,
+        pckTypeStr << 4 | 0x08, 0x26, // Summary
+            0x44, 0x65, 0x6C, 0x74, 0x61, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x62,
+            0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xB4, 0x03, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x61, 0x20, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x20, 0x72,
+            0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x65, 0x77, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x65, 0x6E, 0x74, 0x69, 0x72, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20,
+            0x6E, 0x6F, 0x74, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
+            0x2E, 0x20, 0x57, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20,
+            0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B,
+            0x75, 0x70, 0x20, 0x61, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x74, 0x69, 0x6D, 0x65,
+            0x20, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x74, 0x68, 0x61,
+            0x74, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x20, 0x61, 0x72, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E,
+            0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x6C, 0x79, 0x20, 0x72, 0x65, 0x64, 0x75,
+            0x63, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74,
+            0x65, 0x6E, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73,
+            0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x79, 0x6E, 0x63, 0x69, 0x6E,
+            0x67, 0x20, 0x61, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x64, 0x62, 0x79, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x68, 0x65,
+            0x63, 0x6B, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65,
+            0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x76, 0x65, 0x72, 0x69,
+            0x66, 0x69, 0x65, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61,
+            0x73, 0x20, 0x6E, 0x6F, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x64,
+            0x65, 0x6C, 0x74, 0x61, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2E,
+
         // dry-run option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -1778,6 +2069,65 @@ static const unsigned char helpDataPack[] =
             0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61,
             0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x2E,
 
+        // io-uring option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        pckTypeStr << 4 | 0x08, 0x2A, // Summary
+            0x51, 0x75, 0x65, 0x75, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x61, 0x6E, 0x64,
+            0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69, 0x6F, 0x5F, 0x75, 0x72, 0x69, 0x6E,
+            0x67, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x8D, 0x04, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20,
+            0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2D, 0x73,
+            0x69, 0x7A, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x78, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65,
+            0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x61, 0x68, 0x65, 0x61, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20,
+            0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x62, 0x65, 0x68, 0x69, 0x6E, 0x64, 0x20, 0x73, 0x65, 0x76, 0x65, 0x72,
+            0x61, 0x6C, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73, 0x20, 0x61, 0x74, 0x20, 0x61, 0x20, 0x74, 0x69, 0x6D, 0x65,
+            0x20, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x4C, 0x69, 0x6E, 0x75, 0x78, 0x20, 0x69, 0x6F, 0x5F, 0x75, 0x72, 0x69, 0x6E,
+            0x67, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x49, 0x2F, 0x4F, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x6C,
+            0x61, 0x70, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x6D, 0x69, 0x6E,
+            0x67, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+            0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61,
+            0x63, 0x6B, 0x75, 0x70, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x2E, 0x20, 0x54, 0x68,
+            0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x69, 0x73, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65,
+            0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x72, 0x61,
+            0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F,
+            0x72, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x2E, 0x20,
+            0x54, 0x68, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x20, 0x61, 0x20, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20,
+            0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x61, 0x63, 0x68,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x6E, 0x64, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x61,
+            0x73, 0x74, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 0x4E,
+            0x56, 0x4D, 0x65, 0x2E, 0x0A, 0x0A,
+            0x49, 0x66, 0x20, 0x69, 0x6F, 0x5F, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73,
+            0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x69, 0x6C,
+            0x64, 0x20, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x2C, 0x20, 0x6F, 0x72, 0x20,
+            0x69, 0x73, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x70, 0x6F, 0x6C, 0x69, 0x63,
+            0x79, 0x2C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x61, 0x6E,
+            0x64, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x6C, 0x79, 0x2E,
+
+        // job-queue-max option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        pckTypeStr << 4 | 0x08, 0x23, // Summary
+            0x4D, 0x61, 0x78, 0x20, 0x6A, 0x6F, 0x62, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x66, 0x6F,
+            0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xFB, 0x01, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63,
+            0x65, 0x73, 0x73, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x6A, 0x6F,
+            0x62, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73,
+            0x75, 0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x6A, 0x6F, 0x62,
+            0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x2E, 0x20,
+            0x51, 0x75, 0x65, 0x75, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E,
+            0x65, 0x20, 0x6A, 0x6F, 0x62, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x20, 0x61, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+            0x73, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E,
+            0x65, 0x78, 0x74, 0x20, 0x6A, 0x6F, 0x62, 0x20, 0x69, 0x6D, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x2C,
+            0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65, 0x72, 0x20, 0x77,
+            0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x73,
+            0x6D, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E,
+
         // job-retry option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeBool << 4 | 0x0A, // Internal
@@ -2532,6 +2882,80 @@ static const unsigned char helpDataPack[] =
             0x73, 0x73, 0x2C, 0x20, 0x65, 0x74, 0x63, 0x2E, 0x29, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74,
             0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E,
 
+        // read-advise option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x06, // Section
+            0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
+        pckTypeStr << 4 | 0x08, 0x44, // Summary
+            0x41, 0x64, 0x76, 0x69, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20, 0x74, 0x68,
+            0x61, 0x74, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20,
+            0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6E, 0x67,
+            0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xB4, 0x04, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65,
+            0x72, 0x6E, 0x65, 0x6C, 0x20, 0x69, 0x73, 0x20, 0x61, 0x64, 0x76, 0x69, 0x73, 0x65, 0x64, 0x20, 0x74, 0x68, 0x61, 0x74,
+            0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65,
+            0x6E, 0x74, 0x69, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x72, 0x65, 0x75, 0x73,
+            0x65, 0x64, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77,
+            0x65, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x72,
+            0x6F, 0x70, 0x70, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65,
+            0x61, 0x64, 0x2E, 0x20, 0x50, 0x61, 0x67, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20,
+            0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x62, 0x65,
+            0x66, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x72, 0x65, 0x61, 0x64,
+            0x20, 0x74, 0x68, 0x65, 0x6D, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6B, 0x65, 0x70, 0x74, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65,
+            0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x75, 0x73, 0x65, 0x20,
+            0x62, 0x79, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20,
+            0x6D, 0x61, 0x6B, 0x65, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2D, 0x61, 0x68, 0x65, 0x61, 0x64, 0x20, 0x6D, 0x6F, 0x72,
+            0x65, 0x20, 0x61, 0x67, 0x67, 0x72, 0x65, 0x73, 0x73, 0x69, 0x76, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x65,
+            0x76, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+            0x65, 0x76, 0x69, 0x63, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x69, 0x6E, 0x67,
+            0x20, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x66,
+            0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2C, 0x20,
+            0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6D,
+            0x70, 0x61, 0x63, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x6F,
+            0x6E, 0x20, 0x71, 0x75, 0x65, 0x72, 0x79, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x6E, 0x63, 0x79, 0x2E, 0x20, 0x4F, 0x6E, 0x20,
+            0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x73, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61,
+            0x67, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68,
+            0x65, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x74, 0x65, 0x72, 0x6D, 0x69, 0x6E,
+            0x65, 0x64, 0x20, 0x6E, 0x6F, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x72, 0x6F, 0x70,
+            0x70, 0x65, 0x64, 0x2E,
+
+        // read-pipeline option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x06, // Section
+            0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
+        pckTypeStr << 4 | 0x08, 0x2F, // Summary
+            0x52, 0x65, 0x61, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x65, 0x70, 0x61,
+            0x72, 0x61, 0x74, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20,
+            0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xD4, 0x03, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x50,
+            0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x74, 0x20, 0x6C, 0x65,
+            0x61, 0x73, 0x74, 0x20, 0x31, 0x36, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x2D,
+            0x73, 0x69, 0x7A, 0x65, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x64, 0x69,
+            0x73, 0x6B, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x70, 0x72, 0x6F,
+            0x63, 0x65, 0x73, 0x73, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+            0x6E, 0x74, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x20, 0x63,
+            0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x6D, 0x65, 0x64, 0x2C, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73,
+            0x65, 0x64, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x65, 0x64, 0x2E, 0x20, 0x53,
+            0x6D, 0x61, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61,
+            0x64, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6C, 0x79, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x63, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x6F, 0x75, 0x74, 0x77, 0x65, 0x69, 0x67, 0x68, 0x73, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x70, 0x2E, 0x20, 0x4F, 0x76, 0x65, 0x72, 0x6C, 0x61, 0x70,
+            0x70, 0x69, 0x6E, 0x67, 0x20, 0x64, 0x69, 0x73, 0x6B, 0x20, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68,
+            0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x20, 0x65,
+            0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x6F, 0x20, 0x6D, 0x6F,
+            0x72, 0x65, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x20, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20,
+            0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x75,
+            0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x20, 0x74, 0x68,
+            0x72, 0x6F, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x6D, 0x65, 0x61, 0x6E,
+            0x73, 0x20, 0x66, 0x65, 0x77, 0x65, 0x72, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x63,
+            0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x53, 0x53, 0x48, 0x20, 0x73,
+            0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x73, 0x2E,
+
         // recovery-option option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x07, // Section
@@ -2627,6 +3051,50 @@ static const unsigned char helpDataPack[] =
             0x74, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x63, 0x68, 0x6F,
             0x6F, 0x73, 0x65, 0x2E,
 
+        // repo-archive-push-defer option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        pckTypeStr << 4 | 0x08, 0x2D, // Summary
+            0x50, 0x75, 0x73, 0x68, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F,
+            0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72,
+            0x6F, 0x75, 0x6E, 0x64, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x94, 0x05, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70,
+            0x75, 0x73, 0x68, 0x20, 0x6E, 0x6F, 0x74, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65,
+            0x53, 0x51, 0x4C, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+            0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x64, 0x20, 0x6F, 0x6E,
+            0x6C, 0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x69, 0x74, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E,
+            0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x72, 0x65, 0x70,
+            0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x20, 0x73, 0x6C, 0x6F, 0x77, 0x20, 0x72,
+            0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x6F, 0x6E, 0x65, 0x20,
+            0x69, 0x6E, 0x20, 0x61, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x72, 0x65, 0x67, 0x69, 0x6F, 0x6E, 0x2C, 0x20,
+            0x64, 0x65, 0x6C, 0x61, 0x79, 0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x6F, 0x20,
+            0x61, 0x6C, 0x6C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x73, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E,
+            0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6E,
+            0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F,
+            0x6E, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x66, 0x69,
+            0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x73, 0x70, 0x6F, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67,
+            0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x6F, 0x6E,
+            0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x69, 0x65, 0x73, 0x20,
+            0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x64, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65,
+            0x64, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x69, 0x74, 0x2E, 0x20, 0x54, 0x68,
+            0x65, 0x20, 0x64, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72,
+            0x79, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x20, 0x75, 0x70, 0x20, 0x66, 0x72,
+            0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x6F, 0x6F, 0x6C, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x75, 0x73,
+            0x69, 0x6E, 0x67, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6F, 0x77, 0x6E, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2C, 0x20, 0x77,
+            0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x62, 0x6F, 0x75, 0x6E, 0x64, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61,
+            0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x2D, 0x64, 0x65, 0x66, 0x65, 0x72, 0x2D, 0x6D, 0x61,
+            0x78, 0x2E, 0x0A, 0x0A,
+            0x41, 0x74, 0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74,
+            0x6F, 0x72, 0x79, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x64, 0x65, 0x66, 0x65,
+            0x72, 0x72, 0x65, 0x64, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73,
+            0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0x20,
+            0x44, 0x65, 0x66, 0x65, 0x72, 0x72, 0x61, 0x6C, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 0x69, 0x67, 0x6E,
+            0x6F, 0x72, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x61, 0x73,
+            0x79, 0x6E, 0x63, 0x20, 0x69, 0x73, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2E,
+
         // repo-azure-account option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x0A, // Section
@@ -2716,6 +3184,77 @@ static const unsigned char helpDataPack[] =
             0x2A, 0x20, 0x73, 0x61, 0x73, 0x20, 0x2D, 0x20, 0x53, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73,
             0x73, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x74, 0x75, 0x72, 0x65,
 
+        // repo-block option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        pckTypeStr << 4 | 0x08, 0x20, // Summary
+            0x45, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65,
+            0x6E, 0x74, 0x61, 0x6C, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xB1, 0x05, // Description
+            0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x20, 0x61, 0x6C,
+            0x6C, 0x6F, 0x77, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x67, 0x72, 0x61, 0x6E, 0x75, 0x6C,
+            0x61, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x73, 0x20, 0x62, 0x79, 0x20, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x74,
+            0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
+            0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x65, 0x64,
+            0x20, 0x75, 0x70, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x2E, 0x20, 0x54,
+            0x68, 0x69, 0x73, 0x20, 0x73, 0x61, 0x76, 0x65, 0x73, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x61,
+            0x6E, 0x20, 0x69, 0x6D, 0x70, 0x72, 0x6F, 0x76, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x70, 0x65, 0x72,
+            0x66, 0x6F, 0x72, 0x6D, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66,
+            0x69, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x69, 0x6E, 0x20,
+            0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x20, 0x66, 0x65, 0x77, 0x20, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x73, 0x2C, 0x20, 0x65,
+            0x2E, 0x67, 0x2E, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73,
+            0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x0A, 0x0A,
+            0x45, 0x61, 0x63, 0x68, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65,
+            0x73, 0x73, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x65, 0x64, 0x20, 0x73,
+            0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x62, 0x6C, 0x6F, 0x63,
+            0x6B, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69,
+            0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x20, 0x57, 0x68,
+            0x65, 0x6E, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x20, 0x69, 0x6E,
+            0x20, 0x61, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x74, 0x69, 0x61, 0x6C, 0x20, 0x6F, 0x72, 0x20, 0x69,
+            0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x6F, 0x6E,
+            0x6C, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x68,
+            0x61, 0x76, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x74, 0x6F, 0x72,
+            0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6D, 0x61, 0x70,
+            0x20, 0x72, 0x65, 0x66, 0x65, 0x72, 0x65, 0x6E, 0x63, 0x65, 0x73, 0x20, 0x75, 0x6E, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65,
+            0x64, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x62, 0x61,
+            0x63, 0x6B, 0x75, 0x70, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x73, 0x73,
+            0x65, 0x6D, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x6D, 0x61, 0x70, 0x2E, 0x0A, 0x0A,
+            0x4F, 0x6E, 0x6C, 0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6C, 0x65, 0x61, 0x73, 0x74, 0x20,
+            0x61, 0x73, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x61, 0x73, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x62, 0x6C, 0x6F,
+            0x63, 0x6B, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x77,
+            0x69, 0x74, 0x68, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61,
+            0x6C, 0x2E,
+
+        // repo-block-size option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        pckTypeStr << 4 | 0x08, 0x28, // Summary
+            0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
+            0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xC1, 0x02, // Description
+            0x53, 0x6D, 0x61, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63,
+            0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x61, 0x74, 0x61,
+            0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x20,
+            0x66, 0x65, 0x77, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20,
+            0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x62, 0x75, 0x74, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63,
+            0x6B, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x68, 0x65,
+            0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E,
+            0x64, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x62, 0x6C,
+            0x6F, 0x63, 0x6B, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20,
+            0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65,
+            0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x73, 0x65, 0x74, 0x20, 0x73,
+            0x69, 0x6E, 0x63, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x70, 0x72, 0x69,
+            0x6F, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x62,
+            0x65, 0x20, 0x72, 0x65, 0x75, 0x73, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6C,
+            0x6F, 0x63, 0x6B, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65,
+            0x2E,
+
         // repo-cipher-pass option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x0A, // Section
@@ -3423,6 +3962,36 @@ static const unsigned char helpDataPack[] =
             0x73, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x6F, 0x72, 0x61, 0x72, 0x79, 0x20, 0x63,
             0x72, 0x65, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x61, 0x6C, 0x73, 0x2E,
 
+        // repo-s3-upload-concurrency option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        pckTypeStr << 4 | 0x08, 0x21, // Summary
+            0x53, 0x33, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64,
+            0x20, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x63, 0x79, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xA4, 0x03, // Description
+            0x4C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x70, 0x6C, 0x6F,
+            0x61, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x53, 0x33, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x2E,
+            0x20, 0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72,
+            0x74, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x62, 0x65, 0x66, 0x6F,
+            0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x69, 0x73, 0x20,
+            0x73, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x73, 0x20, 0x74,
+            0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x68, 0x69, 0x67, 0x68, 0x20, 0x6C, 0x61,
+            0x74, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x20, 0x41,
+            0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x74,
+            0x6F, 0x20, 0x62, 0x65, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72,
+            0x72, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x28, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x65,
+            0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20, 0x63,
+            0x61, 0x6E, 0x20, 0x69, 0x6D, 0x70, 0x72, 0x6F, 0x76, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x70, 0x75,
+            0x74, 0x20, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x64, 0x64,
+            0x69, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x73, 0x69, 0x6E, 0x63,
+            0x65, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6C, 0x69, 0x67, 0x68,
+            0x74, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x65, 0x64, 0x2E, 0x20,
+            0x4D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x70, 0x65, 0x72, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x6C, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x69,
+            0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x2E,
+
         // repo-s3-uri-style option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0B, 0x0A, // Section
@@ -3526,10 +4095,57 @@ static const unsigned char helpDataPack[] =
                 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x73, 0x33, 0x2D, 0x70, 0x6F, 0x72, 0x74,
         0x00, // Deprecated names end
 
-        // repo-storage-verify-tls option
+        // repo-storage-read-concurrency option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x0A, 0x0A, // Section
             0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        pckTypeStr << 4 | 0x08, 0x24, // Summary
+            0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x72,
+            0x65, 0x61, 0x64, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x63, 0x79, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xF0, 0x05, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65,
+            0x20, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x73, 0x74, 0x6F,
+            0x72, 0x61, 0x67, 0x65, 0x20, 0x28, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x53, 0x33, 0x2C, 0x20, 0x41, 0x7A, 0x75, 0x72, 0x65,
+            0x29, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75,
+            0x65, 0x73, 0x74, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0x20, 0x66,
+            0x6F, 0x72, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x69,
+            0x6D, 0x69, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67,
+            0x6C, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x61, 0x63,
+            0x68, 0x69, 0x65, 0x76, 0x65, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72, 0x72, 0x65,
+            0x6E, 0x63, 0x79, 0x20, 0x69, 0x73, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20,
+            0x6F, 0x6E, 0x65, 0x2C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x6F, 0x77, 0x6E, 0x6C,
+            0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68,
+            0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75,
+            0x65, 0x73, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x20, 0x61, 0x74, 0x20, 0x6F, 0x6E,
+            0x63, 0x65, 0x20, 0x28, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61,
+            0x74, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x73, 0x73, 0x65,
+            0x6D, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2E, 0x20, 0x52, 0x61, 0x6E, 0x67,
+            0x65, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x62, 0x65, 0x69,
+            0x6E, 0x67, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x65, 0x64,
+            0x20, 0x69, 0x6E, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72,
+            0x79, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x70, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x61,
+            0x74, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x73, 0x69, 0x7A,
+            0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72, 0x72, 0x65,
+            0x6E, 0x63, 0x79, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20,
+            0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70,
+            0x61, 0x72, 0x74, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x75, 0x70,
+            0x6C, 0x6F, 0x61, 0x64, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x61, 0x66, 0x74, 0x65,
+            0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x61, 0x72,
+            0x65, 0x20, 0x63, 0x6F, 0x6E, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x62, 0x65, 0x69, 0x6E, 0x67, 0x20, 0x75, 0x6E, 0x63, 0x68, 0x61, 0x6E,
+            0x67, 0x65, 0x64, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20,
+            0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61,
+            0x6E, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x70,
+            0x6C, 0x61, 0x63, 0x65, 0x64, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x6F, 0x77,
+            0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20,
+            0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6D, 0x69,
+            0x78, 0x65, 0x64, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2E,
+
+        // repo-storage-verify-tls option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
         pckTypeStr << 4 | 0x08, 0x26, // Summary
             0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x63,
             0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x2E,
@@ -3748,10 +4364,53 @@ static const unsigned char helpDataPack[] =
 
         0x00, // Command overrides end
 
-        // spool-path option
+        // split-size option
         // -------------------------------------------------------------------------------------------------------------------------
         pckTypeStr << 4 | 0x09, 0x07, // Section
             0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        pckTypeStr << 4 | 0x08, 0x1B, // Summary
+            0x43, 0x6F, 0x70, 0x79, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20,
+            0x72, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x2E,
+        pckTypeStr << 4 | 0x08, 0x9D, 0x05, // Description
+            0x41, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x72,
+            0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20,
+            0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x20, 0x76, 0x65, 0x72, 0x79, 0x20, 0x6C,
+            0x61, 0x72, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20,
+            0x62, 0x65, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x20, 0x61, 0x66, 0x74, 0x65,
+            0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65,
+            0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x65, 0x64, 0x2E, 0x20, 0x57, 0x68, 0x65,
+            0x6E, 0x20, 0x73, 0x65, 0x74, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2C,
+            0x20, 0x61, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65,
+            0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x6F, 0x66, 0x20,
+            0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6C,
+            0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x69, 0x7A, 0x65,
+            0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65,
+            0x73, 0x74, 0x6F, 0x72, 0x65, 0x2C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x61,
+            0x6E, 0x67, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F,
+            0x70, 0x69, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x20, 0x62, 0x79, 0x20, 0x61, 0x6C,
+            0x6C, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20,
+            0x61, 0x6E, 0x64, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x76, 0x65, 0x72,
+            0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x20, 0x6F,
+            0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x69, 0x74, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65,
+            0x64, 0x2E, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x73, 0x70,
+            0x6C, 0x69, 0x74, 0x20, 0x64, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x77,
+            0x68, 0x65, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x69, 0x73, 0x20, 0x67,
+            0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F,
+            0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x6F, 0x72, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x65,
+            0x64, 0x2E, 0x20, 0x44, 0x65, 0x6C, 0x74, 0x61, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x73, 0x20, 0x61, 0x6E,
+            0x64, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x2E,
+            0x20, 0x42, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x73, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x20,
+            0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E,
+            0x67, 0x6C, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66,
+            0x61, 0x75, 0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x30, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x73,
+            0x70, 0x6C, 0x69, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x2E,
+
+        // spool-path option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x0B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
         pckTypeStr << 4 | 0x08, 0x24, // Summary
             0x50, 0x61, 0x74, 0x68, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x72, 0x61, 0x6E, 0x73, 0x69, 0x65, 0x6E, 0x74,
             0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x2E,
@@ -4248,6 +4907,37 @@ static const unsigned char helpDataPack[] =
 
         0x00, // Command overrides end
 
+        // write-flush option
+        // -------------------------------------------------------------------------------------------------------------------------
+        pckTypeStr << 4 | 0x09, 0x07, // Section
+            0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65,
+        pckTypeStr << 4 | 0x08, 0x27, // Summary
+            0x46, 0x6C, 0x75, 0x73, 0x68, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73,
+            0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2E,
+        pckTypeStr << 4 | 0x08, 0xA8, 0x03, // Description
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x2C, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x62, 0x61, 0x63, 0x6B, 0x20,
+            0x6F, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x66,
+            0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+            0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x62, 0x79, 0x74, 0x65,
+            0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x2C,
+            0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65,
+            0x6E, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x77, 0x61, 0x69,
+            0x74, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64, 0x72, 0x6F, 0x70, 0x70, 0x65, 0x64, 0x20, 0x66,
+            0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2E, 0x20,
+            0x54, 0x68, 0x69, 0x73, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x6D, 0x6F, 0x75, 0x6E,
+            0x74, 0x20, 0x6F, 0x66, 0x20, 0x64, 0x69, 0x72, 0x74, 0x79, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x62, 0x6F, 0x75, 0x6E,
+            0x64, 0x65, 0x64, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F,
+            0x72, 0x65, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x66, 0x69, 0x6C, 0x6C, 0x20, 0x6D, 0x65, 0x6D,
+            0x6F, 0x72, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x69, 0x72, 0x74, 0x79, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73,
+            0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x73, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x77, 0x68, 0x69, 0x6C,
+            0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x2C, 0x20,
+            0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x6F,
+            0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x65, 0x76, 0x69, 0x63, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x6F, 0x72,
+            0x6B, 0x69, 0x6E, 0x67, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x70, 0x72,
+            0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+            0x20, 0x6F, 0x66, 0x20, 0x30, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x66, 0x6C, 0x75, 0x73, 0x68,
+            0x69, 0x6E, 0x67, 0x2E,
+
     0x00, // Options end
 
     0x00, // Pack end
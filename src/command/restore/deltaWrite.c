@@ -0,0 +1,258 @@
+/***********************************************************************************************************************************
+Restore Delta Write
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "command/restore/deltaWrite.h"
+#include "common/debug.h"
+#include "common/io/write.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct DeltaWrite
+{
+    MemContext *memContext;                                         // Object mem context
+    const String *name;                                             // File name
+    int fd;                                                         // File descriptor
+    uint64_t offset;                                                // Offset in the file of the next write
+    Buffer *compare;                                                // Existing data to compare
+} DeltaWrite;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_DELTA_WRITE_TYPE                                                                                              \
+    DeltaWrite *
+#define FUNCTION_LOG_DELTA_WRITE_FORMAT(value, buffer, bufferSize)                                                                 \
+    objToLog(value, "DeltaWrite", buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Close file descriptor
+***********************************************************************************************************************************/
+static void
+deltaWriteFreeResource(THIS_VOID)
+{
+    THIS(DeltaWrite);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(DELTA_WRITE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    THROW_ON_SYS_ERROR_FMT(close(this->fd) == -1, FileCloseError, "unable to close file '%s' after write", strZ(this->name));
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Open the existing file
+***********************************************************************************************************************************/
+static void
+deltaWriteOpen(THIS_VOID)
+{
+    THIS(DeltaWrite);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(DELTA_WRITE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->fd == -1);
+
+    this->fd = open(strZ(this->name), O_RDWR);
+    THROW_ON_SYS_ERROR_FMT(this->fd == -1, FileOpenError, "unable to open file '%s' for write", strZ(this->name));
+
+    // Set free callback to ensure the file descriptor is freed
+    memContextCallbackSet(this->memContext, deltaWriteFreeResource, this);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write a range of the buffer at the same offset in the file
+***********************************************************************************************************************************/
+static void
+deltaWriteRange(DeltaWrite *const this, const Buffer *const buffer, const size_t begin, const size_t end)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(DELTA_WRITE, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+        FUNCTION_LOG_PARAM(SIZE, begin);
+        FUNCTION_LOG_PARAM(SIZE, end);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(buffer != NULL);
+    ASSERT(begin < end && end <= bufUsed(buffer));
+
+    size_t written = begin;
+
+    while (written < end)
+    {
+        const ssize_t writeSize = pwrite(
+            this->fd, bufPtrConst(buffer) + written, end - written, (off_t)(this->offset + written));
+
+        if (writeSize == -1)
+            THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->name));
+
+        written += (size_t)writeSize;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Compare the buffer with the existing data a block at a time and write runs of blocks that differ
+***********************************************************************************************************************************/
+static void
+deltaWrite(THIS_VOID, const Buffer *const buffer)
+{
+    THIS(DeltaWrite);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(DELTA_WRITE, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->fd != -1);
+    ASSERT(buffer != NULL);
+
+    // Read the existing data at the same offset. The existing file may be shorter than the data so stop at EOF.
+    if (bufSize(this->compare) < bufUsed(buffer))
+        bufResize(this->compare, bufUsed(buffer));
+
+    bufUsedZero(this->compare);
+
+    while (bufUsed(this->compare) < bufUsed(buffer))
+    {
+        const ssize_t readSize = pread(
+            this->fd, bufRemainsPtr(this->compare), bufUsed(buffer) - bufUsed(this->compare),
+            (off_t)(this->offset + bufUsed(this->compare)));
+
+        if (readSize == -1)
+            THROW_SYS_ERROR_FMT(FileReadError, "unable to read '%s'", strZ(this->name));
+
+        if (readSize == 0)
+            break;
+
+        bufUsedInc(this->compare, (size_t)readSize);
+    }
+
+    // Find runs of blocks that differ so adjacent blocks are written together
+    size_t runBegin = 0;
+    bool run = false;
+
+    for (size_t blockBegin = 0; blockBegin < bufUsed(buffer); blockBegin += DELTA_WRITE_BLOCK_SIZE)
+    {
+        const size_t blockSize =
+            bufUsed(buffer) - blockBegin < DELTA_WRITE_BLOCK_SIZE ? bufUsed(buffer) - blockBegin : DELTA_WRITE_BLOCK_SIZE;
+        const bool differ =
+            blockBegin + blockSize > bufUsed(this->compare) ||
+            memcmp(bufPtrConst(buffer) + blockBegin, bufPtrConst(this->compare) + blockBegin, blockSize) != 0;
+
+        if (differ && !run)
+        {
+            runBegin = blockBegin;
+            run = true;
+        }
+        else if (!differ && run)
+        {
+            deltaWriteRange(this, buffer, runBegin, blockBegin);
+            run = false;
+        }
+    }
+
+    if (run)
+        deltaWriteRange(this, buffer, runBegin, bufUsed(buffer));
+
+    this->offset += bufUsed(buffer);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Truncate, sync, and close the file
+***********************************************************************************************************************************/
+static void
+deltaWriteClose(THIS_VOID)
+{
+    THIS(DeltaWrite);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(DELTA_WRITE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->fd != -1);
+
+    // Remove any existing data past the end of the data written
+    THROW_ON_SYS_ERROR_FMT(
+        ftruncate(this->fd, (off_t)this->offset) == -1, FileWriteError, "unable to truncate '%s'", strZ(this->name));
+
+    THROW_ON_SYS_ERROR_FMT(fsync(this->fd) == -1, FileSyncError, "unable to sync file '%s' after write", strZ(this->name));
+
+    // Close the file
+    memContextCallbackClear(this->memContext);
+    deltaWriteFreeResource(this);
+    this->fd = -1;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get file descriptor
+***********************************************************************************************************************************/
+static int
+deltaWriteFd(const THIS_VOID)
+{
+    THIS(const DeltaWrite);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(DELTA_WRITE, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->fd);
+}
+
+/**********************************************************************************************************************************/
+IoWrite *
+deltaWriteNew(const String *const name)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STRING, name);
+    FUNCTION_LOG_END();
+
+    ASSERT(name != NULL);
+
+    IoWrite *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("DeltaWrite")
+    {
+        DeltaWrite *driver = memNew(sizeof(DeltaWrite));
+
+        *driver = (DeltaWrite)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .name = strDup(name),
+            .fd = -1,
+            .compare = bufNew(0),
+        };
+
+        this = ioWriteNewP(driver, .close = deltaWriteClose, .fd = deltaWriteFd, .open = deltaWriteOpen, .write = deltaWrite);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_WRITE, this);
+}
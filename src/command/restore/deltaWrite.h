@@ -0,0 +1,23 @@
+/***********************************************************************************************************************************
+Restore Delta Write
+
+Update an existing file so it matches the data written. The file is compared a block at a time and only blocks that differ are
+written, so when most of the file already matches the backup (e.g. when resyncing a standby) very little is written. The file is
+truncated to the size of the data written when it is closed.
+***********************************************************************************************************************************/
+#ifndef COMMAND_RESTORE_DELTA_WRITE_H
+#define COMMAND_RESTORE_DELTA_WRITE_H
+
+#include "common/io/write.h"
+
+/***********************************************************************************************************************************
+Size of the blocks compared, which matches the default PostgreSQL page size
+***********************************************************************************************************************************/
+#define DELTA_WRITE_BLOCK_SIZE                                      ((size_t)(8 * 1024))
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+IoWrite *deltaWriteNew(const String *name);
+
+#endif
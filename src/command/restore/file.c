@@ -4,9 +4,12 @@ Restore File
 #include "build.auto.h"
 
 #include <fcntl.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <utime.h>
 
+#include "command/backup/blockIncr.h"
+#include "command/restore/deltaWrite.h"
 #include "command/restore/file.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
@@ -15,22 +18,104 @@ Restore File
 #include "common/io/filter/size.h"
 #include "common/io/io.h"
 #include "common/log.h"
+#include "common/user.h"
 #include "config/config.h"
 #include "storage/helper.h"
 
+/**********************************************************************************************************************************/
+void
+restoreCleanOwnership(
+    const String *pgPath, const String *manifestUserName, const String *manifestGroupName, uid_t actualUserId, gid_t actualGroupId,
+    bool new)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, pgPath);
+        FUNCTION_TEST_PARAM(STRING, manifestUserName);
+        FUNCTION_TEST_PARAM(STRING, manifestGroupName);
+        FUNCTION_TEST_PARAM(UINT, actualUserId);
+        FUNCTION_TEST_PARAM(UINT, actualGroupId);
+        FUNCTION_TEST_PARAM(BOOL, new);
+    FUNCTION_TEST_END();
+
+    ASSERT(pgPath != NULL);
+
+    // Get the expected user id
+    uid_t expectedUserId = userId();
+
+    if (manifestUserName != NULL)
+    {
+        uid_t manifestUserId = userIdFromName(manifestUserName);
+
+        if (manifestUserId != (uid_t)-1)
+            expectedUserId = manifestUserId;
+    }
+
+    // Get the expected group id
+    gid_t expectedGroupId = groupId();
+
+    if (manifestGroupName != NULL)
+    {
+        uid_t manifestGroupId = groupIdFromName(manifestGroupName);
+
+        if (manifestGroupId != (uid_t)-1)
+            expectedGroupId = manifestGroupId;
+    }
+
+    // Update ownership if not as expected
+    if (actualUserId != expectedUserId || actualGroupId != expectedGroupId)
+    {
+        // If this is a newly created file/link/path then there's no need to log updated permissions
+        if (!new)
+            LOG_DETAIL_FMT("update ownership for '%s'", strZ(pgPath));
+
+        THROW_ON_SYS_ERROR_FMT(
+            lchown(strZ(pgPath), expectedUserId, expectedGroupId) == -1, FileOwnerError, "unable to set ownership for '%s'",
+            strZ(pgPath));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+restoreCleanMode(const String *pgPath, mode_t manifestMode, const StorageInfo *info)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, pgPath);
+        FUNCTION_TEST_PARAM(MODE, manifestMode);
+        FUNCTION_TEST_PARAM_P(STORAGE_INFO, info);
+    FUNCTION_TEST_END();
+
+    ASSERT(pgPath != NULL);
+    ASSERT(info != NULL);
+
+    // Update mode if not as expected
+    if (manifestMode != info->mode)
+    {
+        LOG_DETAIL_FMT("update mode for '%s' to %04o", strZ(pgPath), manifestMode);
+
+        THROW_ON_SYS_ERROR_FMT(
+            chmod(strZ(pgPath), manifestMode) == -1, FileOwnerError, "unable to set mode for '%s'", strZ(pgPath));
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 bool
 restoreFile(
     const String *repoFile, unsigned int repoIdx, const String *repoFileReference, CompressType repoFileCompressType,
-    const String *pgFile, const String *pgFileChecksum, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified,
-    mode_t pgFileMode, const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool deltaForce,
-    const String *cipherPass)
+    uint64_t repoFileBlockIncrMapOffset, uint64_t repoFileBlockIncrMapSize, const String *pgFile, const String *pgFileChecksum,
+    bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified, mode_t pgFileMode, const String *pgFileUser,
+    const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool force, bool deltaBlock, const String *cipherPass)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, repoFile);
         FUNCTION_LOG_PARAM(UINT, repoIdx);
         FUNCTION_LOG_PARAM(STRING, repoFileReference);
         FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);
+        FUNCTION_LOG_PARAM(UINT64, repoFileBlockIncrMapOffset);
+        FUNCTION_LOG_PARAM(UINT64, repoFileBlockIncrMapSize);
         FUNCTION_LOG_PARAM(STRING, pgFile);
         FUNCTION_LOG_PARAM(STRING, pgFileChecksum);
         FUNCTION_LOG_PARAM(BOOL, pgFileZero);
@@ -41,7 +126,8 @@ restoreFile(
         FUNCTION_LOG_PARAM(STRING, pgFileGroup);
         FUNCTION_LOG_PARAM(TIME, copyTimeBegin);
         FUNCTION_LOG_PARAM(BOOL, delta);
-        FUNCTION_LOG_PARAM(BOOL, deltaForce);
+        FUNCTION_LOG_PARAM(BOOL, force);
+        FUNCTION_LOG_PARAM(BOOL, deltaBlock);
         FUNCTION_TEST_PARAM(STRING, cipherPass);
     FUNCTION_LOG_END();
 
@@ -57,23 +143,43 @@ restoreFile(
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
+        // Get info for the existing file when the clean left it in place. The clean does not check files that are in the backup so
+        // the processes restoring files update ownership and mode in parallel rather than serially before the restore begins.
+        StorageInfo info = {.exists = false};
+
+        if (delta || force)
+        {
+            info = storageInfoP(storagePg(), pgFile, .ignoreMissing = true);
+
+            // Update ownership and mode of the existing file first so it can be read and written
+            if (info.exists && info.type == storageTypeFile)
+            {
+                const String *const pgFilePath = storagePathP(storagePg(), pgFile);
+
+                restoreCleanOwnership(pgFilePath, pgFileUser, pgFileGroup, info.userId, info.groupId, false);
+                restoreCleanMode(pgFilePath, pgFileMode, &info);
+            }
+            // Else the file is linked so the clean has checked the link. Get info for the linked file for the delta.
+            else if (info.exists)
+                info = storageInfoP(storagePg(), pgFile, .ignoreMissing = true, .followLink = true);
+        }
+
         // Perform delta if requested.  Delta zero-length files to avoid overwriting the file if the timestamp is correct.
         if (delta && !pgFileZero)
         {
             // Perform delta if the file exists
-            StorageInfo info = storageInfoP(storagePg(), pgFile, .ignoreMissing = true, .followLink = true);
-
             if (info.exists)
             {
                 // If force then use size/timestamp delta
-                if (deltaForce)
+                if (force)
                 {
                     // Make sure that timestamp/size are equal and that timestamp is before the copy start time of the backup
                     if (info.size == pgFileSize && info.timeModified == pgFileModified && info.timeModified < copyTimeBegin)
                         result = false;
                 }
-                // Else use size and checksum
-                else
+                // Else use size and checksum. Block delta compares the file with the backup a block at a time while restoring so it
+                // does not need to read the whole file first.
+                else if (!deltaBlock)
                 {
                     // Only continue delta if the file size is as expected
                     if (info.size == pgFileSize)
@@ -114,33 +220,69 @@ restoreFile(
         // Copy file from repository to database or create zero-length/sparse file
         if (result)
         {
+            // When block delta is requested and the file exists only write the blocks that differ. Owner and mode of existing files
+            // have already been set so only the time needs to be set afterwards.
+            const bool pgFileDeltaBlock = deltaBlock && info.exists && !pgFileZero && pgFileSize != 0;
+
             // Create destination file
-            StorageWrite *pgFileWrite = storageNewWriteP(
-                storagePgWrite(), pgFile, .modeFile = pgFileMode, .user = pgFileUser, .group = pgFileGroup,
-                .timeModified = pgFileModified, .noAtomic = true, .noCreatePath = true, .noSyncPath = true);
+            StorageWrite *pgFileWrite = NULL;
+            IoWrite *pgWrite = NULL;
+
+            if (pgFileDeltaBlock)
+                pgWrite = deltaWriteNew(storagePathP(storagePg(), pgFile));
+            else
+            {
+                pgFileWrite = storageNewWriteP(
+                    storagePgWrite(), pgFile, .modeFile = pgFileMode, .user = pgFileUser, .group = pgFileGroup,
+                    .timeModified = pgFileModified, .noAtomic = true, .noCreatePath = true, .noSyncPath = true);
+                pgWrite = storageWriteIo(pgFileWrite);
+            }
 
             // If size is zero/sparse no need to actually copy
             if (pgFileSize == 0 || pgFileZero)
             {
-                ioWriteOpen(storageWriteIo(pgFileWrite));
+                ioWriteOpen(pgWrite);
 
                 // Truncate the file to specified length (note in this case the file with grow, not shrink)
                 if (pgFileZero)
                 {
                     THROW_ON_SYS_ERROR_FMT(
-                        ftruncate(ioWriteFd(storageWriteIo(pgFileWrite)), (off_t)pgFileSize) == -1, FileWriteError,
+                        ftruncate(ioWriteFd(pgWrite), (off_t)pgFileSize) == -1, FileWriteError,
                         "unable to truncate '%s'", strZ(pgFile));
 
                     // Report the file as not copied
                     result = false;
                 }
 
-                ioWriteClose(storageWriteIo(pgFileWrite));
+                ioWriteClose(pgWrite);
+            }
+            // Else reassemble the file from blocks stored with block incremental
+            else if (repoFileBlockIncrMapSize != 0)
+            {
+                ioFilterGroupAdd(ioWriteFilterGroup(pgWrite), cryptoHashNew(HASH_TYPE_SHA1_STR));
+
+                ioWriteOpen(pgWrite);
+                blockIncrRead(
+                    storageRepoIdx(repoIdx), repoFile, repoFileReference, repoFileBlockIncrMapOffset, repoFileBlockIncrMapSize,
+                    repoFileCompressType, cipherPass, pgWrite);
+                ioWriteClose(pgWrite);
+
+                // Validate checksum
+                const String *const checksum = varStr(
+                    ioFilterGroupResult(ioWriteFilterGroup(pgWrite), CRYPTO_HASH_FILTER_TYPE_STR));
+
+                if (!strEq(pgFileChecksum, checksum))
+                {
+                    THROW_FMT(
+                        ChecksumError,
+                        "error restoring '%s': actual checksum '%s' does not match expected checksum '%s'", strZ(pgFile),
+                        strZ(checksum), strZ(pgFileChecksum));
+                }
             }
             // Else perform the copy
             else
             {
-                IoFilterGroup *filterGroup = ioWriteFilterGroup(storageWriteIo(pgFileWrite));
+                IoFilterGroup *filterGroup = ioWriteFilterGroup(pgWrite);
 
                 // Add decryption filter
                 if (cipherPass != NULL)
@@ -163,14 +305,34 @@ restoreFile(
                 ioFilterGroupAdd(filterGroup, ioSizeNew());
 
                 // Copy file
-                storageCopyP(
-                    storageNewReadP(
-                        storageRepoIdx(repoIdx),
-                        strNewFmt(
-                            STORAGE_REPO_BACKUP "/%s/%s%s", strZ(repoFileReference), strZ(repoFile),
-                            strZ(compressExtStr(repoFileCompressType))),
-                        .compressible = compressible),
-                    pgFileWrite);
+                StorageRead *const repoFileRead = storageNewReadP(
+                    storageRepoIdx(repoIdx),
+                    strNewFmt(
+                        STORAGE_REPO_BACKUP "/%s/%s%s", strZ(repoFileReference), strZ(repoFile),
+                        strZ(compressExtStr(repoFileCompressType))),
+                    .compressible = compressible);
+
+                if (pgFileDeltaBlock)
+                {
+                    IoRead *const read = storageReadIo(repoFileRead);
+                    Buffer *const buffer = bufNew(ioBufferSize());
+
+                    ioReadOpen(read);
+                    ioWriteOpen(pgWrite);
+
+                    do
+                    {
+                        ioRead(read, buffer);
+                        ioWrite(pgWrite, buffer);
+                        bufUsedZero(buffer);
+                    }
+                    while (!ioReadEof(read));
+
+                    ioReadClose(read);
+                    ioWriteClose(pgWrite);
+                }
+                else
+                    storageCopyP(repoFileRead, pgFileWrite);
 
                 // Validate checksum
                 if (!strEq(pgFileChecksum, varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))))
@@ -181,9 +343,124 @@ restoreFile(
                         strZ(varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))), strZ(pgFileChecksum));
                 }
             }
+
+            // Set the time of the file updated by block delta
+            if (pgFileDeltaBlock)
+            {
+                THROW_ON_SYS_ERROR_FMT(
+                    utime(
+                        strZ(storagePathP(storagePg(), pgFile)),
+                        &((struct utimbuf){.actime = pgFileModified, .modtime = pgFileModified})) == -1,
+                    FileInfoError, "unable to set time for '%s'", strZ(storagePathP(storagePg(), pgFile)));
+            }
         }
     }
     MEM_CONTEXT_TEMP_END();
 
     FUNCTION_LOG_RETURN(BOOL, result);
 }
+
+/**********************************************************************************************************************************/
+uint64_t
+restoreFileRange(
+    const String *const repoFile, const unsigned int repoIdx, const String *const repoFileReference, const String *const pgFile,
+    const uint64_t offset, const uint64_t size, const String *const checksum)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, repoFile);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+        FUNCTION_LOG_PARAM(STRING, repoFileReference);
+        FUNCTION_LOG_PARAM(STRING, pgFile);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(UINT64, size);
+        FUNCTION_LOG_PARAM(STRING, checksum);
+    FUNCTION_LOG_END();
+
+    ASSERT(repoFile != NULL);
+    ASSERT(repoFileReference != NULL);
+    ASSERT(pgFile != NULL);
+    ASSERT(size > 0);
+    ASSERT(checksum != NULL);
+
+    uint64_t result = 0;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Open the existing file without truncating it since other processes may be writing other ranges
+        const String *const pgFilePath = storagePathP(storagePg(), pgFile);
+        const int fd = open(strZ(pgFilePath), O_WRONLY);
+
+        THROW_ON_SYS_ERROR_FMT(fd == -1, FileOpenError, "unable to open file '%s' for write", strZ(pgFilePath));
+
+        TRY_BEGIN()
+        {
+            // Read the range from the repository and write it at the same offset
+            IoRead *const read = storageReadIo(
+                storageNewReadP(
+                    storageRepoIdx(repoIdx), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s", strZ(repoFileReference), strZ(repoFile)),
+                    .offset = offset, .limit = VARUINT64(size)));
+            ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
+
+            Buffer *const buffer = bufNew(ioBufferSize());
+
+            ioReadOpen(read);
+
+            do
+            {
+                ioRead(read, buffer);
+
+                size_t written = 0;
+
+                while (written < bufUsed(buffer))
+                {
+                    const ssize_t writeSize = pwrite(
+                        fd, bufPtrConst(buffer) + written, bufUsed(buffer) - written, (off_t)(offset + result + written));
+
+                    if (writeSize == -1)
+                        THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(pgFilePath));
+
+                    written += (size_t)writeSize;
+                }
+
+                result += bufUsed(buffer);
+                bufUsedZero(buffer);
+            }
+            while (!ioReadEof(read));
+
+            ioReadClose(read);
+
+            // The repository file must contain the entire range
+            if (result != size)
+            {
+                THROW_FMT(
+                    FileReadError, "error restoring '%s': expected %" PRIu64 " bytes at offset %" PRIu64 " but read %" PRIu64,
+                    strZ(pgFile), size, offset, result);
+            }
+
+            // Validate the checksum of the range
+            const String *const rangeChecksum = varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
+
+            if (!strEq(checksum, rangeChecksum))
+            {
+                THROW_FMT(
+                    ChecksumError,
+                    "error restoring '%s': actual checksum '%s' does not match expected checksum '%s' for range at offset %" PRIu64,
+                    strZ(pgFile), strZ(rangeChecksum), strZ(checksum), offset);
+            }
+
+            THROW_ON_SYS_ERROR_FMT(fsync(fd) == -1, FileSyncError, "unable to sync file '%s' after write", strZ(pgFilePath));
+        }
+        CATCH_ANY()
+        {
+            // Close the file without checking for errors so the original error is reported
+            close(fd);
+            RETHROW();
+        }
+        TRY_END();
+
+        THROW_ON_SYS_ERROR_FMT(close(fd) == -1, FileCloseError, "unable to close file '%s' after write", strZ(pgFilePath));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(UINT64, result);
+}
@@ -15,8 +15,23 @@ Functions
 // Copy a file from the backup to the specified destination
 bool restoreFile(
     const String *repoFile, unsigned int repoIdx, const String *repoFileReference, CompressType repoFileCompressType,
-    const String *pgFile, const String *pgFileChecksum, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified,
-    mode_t pgFileMode, const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool deltaForce,
-    const String *cipherPass);
+    uint64_t repoFileBlockIncrMapOffset, uint64_t repoFileBlockIncrMapSize, const String *pgFile, const String *pgFileChecksum,
+    bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified, mode_t pgFileMode, const String *pgFileUser,
+    const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool force, bool deltaBlock, const String *cipherPass);
+
+// Update ownership of a file/link/path to the user/group in the manifest, or the current user/group when those do not exist. Links
+// are not followed. Set new when the file/link/path was just created so the update is not logged.
+void restoreCleanOwnership(
+    const String *pgPath, const String *manifestUserName, const String *manifestGroupName, uid_t actualUserId, gid_t actualGroupId,
+    bool new);
+
+// Update mode of a file/path to the mode in the manifest
+void restoreCleanMode(const String *pgPath, mode_t manifestMode, const StorageInfo *info);
+
+// Copy a range of an uncompressed and unencrypted file from the backup to the same offset in the destination, which must already
+// exist. The range is verified with the range checksum stored in the manifest. The number of bytes copied is returned.
+uint64_t restoreFileRange(
+    const String *repoFile, unsigned int repoIdx, const String *repoFileReference, const String *pgFile, uint64_t offset,
+    uint64_t size, const String *checksum);
 
 #endif
@@ -16,6 +16,7 @@ Restore Protocol Handler
 Constants
 ***********************************************************************************************************************************/
 STRING_EXTERN(PROTOCOL_COMMAND_RESTORE_FILE_STR,                    PROTOCOL_COMMAND_RESTORE_FILE);
+STRING_EXTERN(PROTOCOL_COMMAND_RESTORE_FILE_RANGE_STR,              PROTOCOL_COMMAND_RESTORE_FILE_RANGE);
 
 /**********************************************************************************************************************************/
 void
@@ -36,13 +37,42 @@ restoreFileProtocol(const VariantList *paramList, ProtocolServer *server)
             VARBOOL(
                 restoreFile(
                     varStr(varLstGet(paramList, 0)), varUIntForce(varLstGet(paramList, 1)), varStr(varLstGet(paramList, 2)),
-                    (CompressType)varUIntForce(varLstGet(paramList, 3)), varStr(varLstGet(paramList, 4)),
-                    varStr(varLstGet(paramList, 5)), varBoolForce(varLstGet(paramList, 6)), varUInt64(varLstGet(paramList, 7)),
-                    (time_t)varInt64Force(varLstGet(paramList, 8)),
-                    (mode_t)cvtZToUIntBase(strZ(varStr(varLstGet(paramList, 9))), 8),
-                    varStr(varLstGet(paramList, 10)), varStr(varLstGet(paramList, 11)),
-                    (time_t)varInt64Force(varLstGet(paramList, 12)), varBoolForce(varLstGet(paramList, 13)),
-                    varBoolForce(varLstGet(paramList, 14)), varStr(varLstGet(paramList, 15)))));
+                    (CompressType)varUIntForce(varLstGet(paramList, 3)), varUInt64(varLstGet(paramList, 4)),
+                    varUInt64(varLstGet(paramList, 5)), varStr(varLstGet(paramList, 6)), varStr(varLstGet(paramList, 7)),
+                    varBoolForce(varLstGet(paramList, 8)), varUInt64(varLstGet(paramList, 9)),
+                    (time_t)varInt64Force(varLstGet(paramList, 10)),
+                    (mode_t)cvtZToUIntBase(strZ(varStr(varLstGet(paramList, 11))), 8),
+                    varStr(varLstGet(paramList, 12)), varStr(varLstGet(paramList, 13)),
+                    (time_t)varInt64Force(varLstGet(paramList, 14)), varBoolForce(varLstGet(paramList, 15)),
+                    varBoolForce(varLstGet(paramList, 16)), varBoolForce(varLstGet(paramList, 17)),
+                    varStr(varLstGet(paramList, 18)))));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+restoreFileRangeProtocol(const VariantList *paramList, ProtocolServer *server)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(VARIANT_LIST, paramList);
+        FUNCTION_LOG_PARAM(PROTOCOL_SERVER, server);
+    FUNCTION_LOG_END();
+
+    ASSERT(paramList != NULL);
+    ASSERT(server != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        protocolServerResponse(
+            server,
+            VARUINT64(
+                restoreFileRange(
+                    varStr(varLstGet(paramList, 0)), varUIntForce(varLstGet(paramList, 1)), varStr(varLstGet(paramList, 2)),
+                    varStr(varLstGet(paramList, 3)), varUInt64(varLstGet(paramList, 4)), varUInt64(varLstGet(paramList, 5)),
+                    varStr(varLstGet(paramList, 6)))));
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -13,17 +13,21 @@ Constants
 ***********************************************************************************************************************************/
 #define PROTOCOL_COMMAND_RESTORE_FILE                               "restoreFile"
     STRING_DECLARE(PROTOCOL_COMMAND_RESTORE_FILE_STR);
+#define PROTOCOL_COMMAND_RESTORE_FILE_RANGE                         "restoreFileRange"
+    STRING_DECLARE(PROTOCOL_COMMAND_RESTORE_FILE_RANGE_STR);
 
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
 // Process protocol requests
 void restoreFileProtocol(const VariantList *paramList, ProtocolServer *server);
+void restoreFileRangeProtocol(const VariantList *paramList, ProtocolServer *server);
 
 /***********************************************************************************************************************************
 Protocol commands for ProtocolServerHandler arrays passed to protocolServerProcess()
 ***********************************************************************************************************************************/
 #define PROTOCOL_SERVER_HANDLER_RESTORE_LIST                                                                                       \
-    {.command = PROTOCOL_COMMAND_RESTORE_FILE, .handler = restoreFileProtocol},
+    {.command = PROTOCOL_COMMAND_RESTORE_FILE, .handler = restoreFileProtocol},                                                    \
+    {.command = PROTOCOL_COMMAND_RESTORE_FILE_RANGE, .handler = restoreFileRangeProtocol},
 
 #endif
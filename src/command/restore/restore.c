@@ -7,7 +7,9 @@ Restore Command
 #include <sys/stat.h>
 #include <time.h>
 #include <unistd.h>
+#include <utime.h>
 
+#include "command/restore/file.h"
 #include "command/restore/protocol.h"
 #include "command/restore/restore.h"
 #include "common/crypto/cipherBlock.h"
@@ -777,85 +779,6 @@ typedef struct RestoreCleanCallbackData
     StringList *fileIgnore;                                         // Files to ignore during clean
 } RestoreCleanCallbackData;
 
-// Helper to update ownership on a file/link/path
-static void
-restoreCleanOwnership(
-    const String *pgPath, const String *manifestUserName, const String *manifestGroupName, uid_t actualUserId, gid_t actualGroupId,
-    bool new)
-{
-    FUNCTION_TEST_BEGIN();
-        FUNCTION_TEST_PARAM(STRING, pgPath);
-        FUNCTION_TEST_PARAM(STRING, manifestUserName);
-        FUNCTION_TEST_PARAM(STRING, manifestGroupName);
-        FUNCTION_TEST_PARAM(UINT, actualUserId);
-        FUNCTION_TEST_PARAM(UINT, actualGroupId);
-        FUNCTION_TEST_PARAM(BOOL, new);
-    FUNCTION_TEST_END();
-
-    ASSERT(pgPath != NULL);
-
-    // Get the expected user id
-    uid_t expectedUserId = userId();
-
-    if (manifestUserName != NULL)
-    {
-        uid_t manifestUserId = userIdFromName(manifestUserName);
-
-        if (manifestUserId != (uid_t)-1)
-            expectedUserId = manifestUserId;
-    }
-
-    // Get the expected group id
-    gid_t expectedGroupId = groupId();
-
-    if (manifestGroupName != NULL)
-    {
-        uid_t manifestGroupId = groupIdFromName(manifestGroupName);
-
-        if (manifestGroupId != (uid_t)-1)
-            expectedGroupId = manifestGroupId;
-    }
-
-    // Update ownership if not as expected
-    if (actualUserId != expectedUserId || actualGroupId != expectedGroupId)
-    {
-        // If this is a newly created file/link/path then there's no need to log updated permissions
-        if (!new)
-            LOG_DETAIL_FMT("update ownership for '%s'", strZ(pgPath));
-
-        THROW_ON_SYS_ERROR_FMT(
-            lchown(strZ(pgPath), expectedUserId, expectedGroupId) == -1, FileOwnerError, "unable to set ownership for '%s'",
-            strZ(pgPath));
-    }
-
-    FUNCTION_TEST_RETURN_VOID();
-}
-
-// Helper to update mode on a file/path
-static void
-restoreCleanMode(const String *pgPath, mode_t manifestMode, const StorageInfo *info)
-{
-    FUNCTION_TEST_BEGIN();
-        FUNCTION_TEST_PARAM(STRING, pgPath);
-        FUNCTION_TEST_PARAM(MODE, manifestMode);
-        FUNCTION_TEST_PARAM(INFO, info);
-    FUNCTION_TEST_END();
-
-    ASSERT(pgPath != NULL);
-    ASSERT(info != NULL);
-
-    // Update mode if not as expected
-    if (manifestMode != info->mode)
-    {
-        LOG_DETAIL_FMT("update mode for '%s' to %04o", strZ(pgPath), manifestMode);
-
-        THROW_ON_SYS_ERROR_FMT(
-            chmod(strZ(pgPath), manifestMode) == -1, FileOwnerError, "unable to set mode for '%s'", strZ(pgPath));
-    }
-
-    FUNCTION_TEST_RETURN_VOID();
-}
-
 // storageInfoList() callback that cleans the paths
 static void
 restoreCleanInfoListCallback(void *data, const StorageInfo *info)
@@ -902,16 +825,11 @@ restoreCleanInfoListCallback(void *data, const StorageInfo *info)
 
     switch (info->type)
     {
+        // Files in the manifest are left for the restore to check since the processes restoring files update ownership and mode of
+        // existing files in parallel. This means only the file type is required so stat() is not called for every file.
         case storageTypeFile:
         {
-            const ManifestFile *manifestFile = manifestFileFindDefault(cleanData->manifest, manifestName, NULL);
-
-            if (manifestFile != NULL)
-            {
-                restoreCleanOwnership(pgPath, manifestFile->user, manifestFile->group, info->userId, info->groupId, false);
-                restoreCleanMode(pgPath, manifestFile->mode, info);
-            }
-            else
+            if (manifestFileFindDefault(cleanData->manifest, manifestName, NULL) == NULL)
             {
                 LOG_DETAIL_FMT("remove invalid file '%s'", strZ(pgPath));
                 storageRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true);
@@ -926,13 +844,18 @@ restoreCleanInfoListCallback(void *data, const StorageInfo *info)
 
             if (manifestLink != NULL)
             {
-                if (!strEq(manifestLink->destination, info->linkDestination))
+                const StorageInfo linkInfo = storageInfoP(storageLocal(), pgPath);
+
+                if (!strEq(manifestLink->destination, linkInfo.linkDestination))
                 {
                     LOG_DETAIL_FMT("remove link '%s' because destination changed", strZ(pgPath));
                     storageRemoveP(storageLocalWrite(), pgPath, .errorOnMissing = true);
                 }
                 else
-                    restoreCleanOwnership(pgPath, manifestLink->user, manifestLink->group, info->userId, info->groupId, false);
+                {
+                    restoreCleanOwnership(
+                        pgPath, manifestLink->user, manifestLink->group, linkInfo.userId, linkInfo.groupId, false);
+                }
             }
             else
             {
@@ -950,8 +873,10 @@ restoreCleanInfoListCallback(void *data, const StorageInfo *info)
             if (manifestPath != NULL)
             {
                 // Check ownership/permissions
-                restoreCleanOwnership(pgPath, manifestPath->user, manifestPath->group, info->userId, info->groupId, false);
-                restoreCleanMode(pgPath, manifestPath->mode, info);
+                const StorageInfo pathInfo = storageInfoP(storageLocal(), pgPath);
+
+                restoreCleanOwnership(pgPath, manifestPath->user, manifestPath->group, pathInfo.userId, pathInfo.groupId, false);
+                restoreCleanMode(pgPath, manifestPath->mode, &pathInfo);
 
                 // Recurse into the path
                 RestoreCleanCallbackData cleanDataSub = *cleanData;
@@ -961,7 +886,7 @@ restoreCleanInfoListCallback(void *data, const StorageInfo *info)
 
                 storageInfoListP(
                     storageLocalWrite(), cleanDataSub.targetPath, restoreCleanInfoListCallback, &cleanDataSub,
-                    .errorOnMissing = true, .sortOrder = sortOrderAsc);
+                    .level = storageInfoLevelType, .errorOnMissing = true, .sortOrder = sortOrderAsc);
             }
             else
             {
@@ -1084,7 +1009,7 @@ restoreCleanBuild(Manifest *manifest)
                     {
                         storageInfoListP(
                             storageLocal(), cleanData->targetPath, restoreCleanInfoListCallback, cleanData,
-                            .errorOnMissing = true);
+                            .level = storageInfoLevelType, .errorOnMissing = true);
                     }
                     else
                     {
@@ -1164,8 +1089,8 @@ restoreCleanBuild(Manifest *manifest)
 
                     // Clean the target
                     storageInfoListP(
-                        storageLocalWrite(), cleanData->targetPath, restoreCleanInfoListCallback, cleanData, .errorOnMissing = true,
-                        .sortOrder = sortOrderAsc);
+                        storageLocalWrite(), cleanData->targetPath, restoreCleanInfoListCallback, cleanData,
+                        .level = storageInfoLevelType, .errorOnMissing = true, .sortOrder = sortOrderAsc);
                 }
             }
             // If the target does not exist we'll attempt to create it
@@ -1863,12 +1788,14 @@ restoreProcessQueueComparator(const void *item1, const void *item2)
     FUNCTION_TEST_RETURN(strCmp((*(ManifestFile **)item1)->name, (*(ManifestFile **)item2)->name));
 }
 
+// The bytes in each queue are returned in queueSizeList
 static uint64_t
-restoreProcessQueue(Manifest *manifest, List **queueList)
+restoreProcessQueue(Manifest *manifest, List **queueList, List **queueSizeList)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
         FUNCTION_LOG_PARAM_P(LIST, queueList);
+        FUNCTION_LOG_PARAM_P(LIST, queueSizeList);
     FUNCTION_LOG_END();
 
     ASSERT(manifest != NULL);
@@ -1877,8 +1804,9 @@ restoreProcessQueue(Manifest *manifest, List **queueList)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Create list of process queue
+        // Create list of process queue and queue sizes
         *queueList = lstNewP(sizeof(List *));
+        *queueSizeList = lstNewP(sizeof(uint64_t));
 
         // Generate the list of processing queues (there is always at least one)
         StringList *targetList = strLstNew();
@@ -1899,6 +1827,7 @@ restoreProcessQueue(Manifest *manifest, List **queueList)
             {
                 List *queue = lstNewP(sizeof(ManifestFile *), .comparator = restoreProcessQueueComparator);
                 lstAdd(*queueList, &queue);
+                lstAdd(*queueSizeList, &(uint64_t){0});
             }
         }
         MEM_CONTEXT_END();
@@ -1925,6 +1854,7 @@ restoreProcessQueue(Manifest *manifest, List **queueList)
 
             // Add file to queue
             lstAdd(*(List **)lstGet(*queueList, targetIdx), &file);
+            *(uint64_t *)lstGet(*queueSizeList, targetIdx) += file->size;
 
             // Add size to total
             result += file->size;
@@ -1936,6 +1866,7 @@ restoreProcessQueue(Manifest *manifest, List **queueList)
 
         // Move process queues to prior context
         lstMove(*queueList, memContextPrior());
+        lstMove(*queueSizeList, memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -1980,8 +1911,19 @@ restoreFilePgPath(const Manifest *manifest, const String *manifestName)
     FUNCTION_TEST_RETURN(result);
 }
 
+// File being copied in ranges
+typedef struct RestoreJobSplit
+{
+    const ManifestFile *file;                                       // File being copied
+    uint64_t sizeRemaining;                                         // Bytes in ranges that have not been copied yet
+} RestoreJobSplit;
+
+// Files copied in ranges are logged when the last range has been copied but the size of each range is added to the size restored as
+// it completes
 static uint64_t
-restoreJobResult(const Manifest *manifest, ProtocolParallelJob *job, RegExp *zeroExp, uint64_t sizeTotal, uint64_t sizeRestored)
+restoreJobResult(
+    const Manifest *manifest, ProtocolParallelJob *job, RegExp *zeroExp, uint64_t sizeTotal, uint64_t sizeRestored,
+    List *splitList)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
@@ -1989,9 +1931,11 @@ restoreJobResult(const Manifest *manifest, ProtocolParallelJob *job, RegExp *zer
         FUNCTION_LOG_PARAM(REGEXP, zeroExp);
         FUNCTION_LOG_PARAM(UINT64, sizeTotal);
         FUNCTION_LOG_PARAM(UINT64, sizeRestored);
+        FUNCTION_LOG_PARAM(LIST, splitList);
     FUNCTION_LOG_END();
 
     ASSERT(manifest != NULL);
+    ASSERT(splitList != NULL);
 
     // The job was successful
     if (protocolParallelJobErrorCode(job) == 0)
@@ -1999,55 +1943,104 @@ restoreJobResult(const Manifest *manifest, ProtocolParallelJob *job, RegExp *zer
         MEM_CONTEXT_TEMP_BEGIN()
         {
             const ManifestFile *file = manifestFileFind(manifest, varStr(protocolParallelJobKey(job)));
-            bool zeroed = restoreFileZeroed(file->name, zeroExp);
-            bool copy = varBool(protocolParallelJobResult(job));
 
-            String *log = strNew("restore");
+            // A range of a file was copied
+            if (varType(protocolParallelJobResult(job)) == varTypeUInt64)
+            {
+                const uint64_t rangeSize = varUInt64(protocolParallelJobResult(job));
 
-            // Note if file was zeroed (i.e. selective restore)
-            if (zeroed)
-                strCatZ(log, " zeroed");
+                sizeRestored += rangeSize;
 
-            // Add filename
-            strCatFmt(log, " file %s", strZ(restoreFilePgPath(manifest, file->name)));
+                LOG_DETAIL_PID_FMT(
+                    protocolParallelJobProcessId(job), "restore file %s range (%s, %" PRIu64 "%%)",
+                    strZ(restoreFilePgPath(manifest, file->name)), strZ(strSizeFormat(rangeSize)), sizeRestored * 100 / sizeTotal);
 
-            // If not copied and not zeroed add details to explain why it was not copied
-            if (!copy && !zeroed)
-            {
-                strCatZ(log, " - ");
-
-                // On force we match on size and modification time
-                if (cfgOptionBool(cfgOptForce))
+                // Each range was verified against its checksum by the process that copied it so once all ranges have been copied
+                // only the time needs to be set
+                for (unsigned int splitIdx = 0; splitIdx < lstSize(splitList); splitIdx++)
                 {
-                    strCatFmt(
-                        log, "exists and matches size %" PRIu64 " and modification time %" PRIu64, file->size,
-                        (uint64_t)file->timestamp);
+                    RestoreJobSplit *const split = lstGet(splitList, splitIdx);
+
+                    if (split->file == file)
+                    {
+                        split->sizeRemaining -= rangeSize;
+
+                        if (split->sizeRemaining == 0)
+                        {
+                            const String *const pgFile = storagePathP(storagePg(), restoreFilePgPath(manifest, file->name));
+
+                            THROW_ON_SYS_ERROR_FMT(
+                                utime(
+                                    strZ(pgFile),
+                                    &((struct utimbuf){.actime = file->timestamp, .modtime = file->timestamp})) == -1,
+                                FileInfoError, "unable to set time for '%s'", strZ(pgFile));
+
+                            LOG_INFO_PID_FMT(
+                                protocolParallelJobProcessId(job), "restore file %s in ranges (%s, %" PRIu64 "%%)",
+                                strZ(restoreFilePgPath(manifest, file->name)), strZ(strSizeFormat(file->size)),
+                                sizeRestored * 100 / sizeTotal);
+
+                            lstRemoveIdx(splitList, splitIdx);
+                        }
+
+                        break;
+                    }
                 }
-                // Else a checksum delta or file is zero-length
-                else
+            }
+            // Else a file was restored
+            else
+            {
+                bool zeroed = restoreFileZeroed(file->name, zeroExp);
+                bool copy = varBool(protocolParallelJobResult(job));
+
+                String *log = strNew("restore");
+
+                // Note if file was zeroed (i.e. selective restore)
+                if (zeroed)
+                    strCatZ(log, " zeroed");
+
+                // Add filename
+                strCatFmt(log, " file %s", strZ(restoreFilePgPath(manifest, file->name)));
+
+                // If not copied and not zeroed add details to explain why it was not copied
+                if (!copy && !zeroed)
                 {
-                    strCatZ(log, "exists and ");
+                    strCatZ(log, " - ");
 
-                    // No need to copy zero-length files
-                    if (file->size == 0)
+                    // On force we match on size and modification time
+                    if (cfgOptionBool(cfgOptForce))
                     {
-                        strCatZ(log, "is zero size");
+                        strCatFmt(
+                            log, "exists and matches size %" PRIu64 " and modification time %" PRIu64, file->size,
+                            (uint64_t)file->timestamp);
                     }
-                    // The file matched the manifest checksum so did not need to be copied
+                    // Else a checksum delta or file is zero-length
                     else
-                        strCatZ(log, "matches backup");
+                    {
+                        strCatZ(log, "exists and ");
+
+                        // No need to copy zero-length files
+                        if (file->size == 0)
+                        {
+                            strCatZ(log, "is zero size");
+                        }
+                        // The file matched the manifest checksum so did not need to be copied
+                        else
+                            strCatZ(log, "matches backup");
+                    }
                 }
-            }
 
-            // Add size and percent complete
-            sizeRestored += file->size;
-            strCatFmt(log, " (%s, %" PRIu64 "%%)", strZ(strSizeFormat(file->size)), sizeRestored * 100 / sizeTotal);
+                // Add size and percent complete
+                sizeRestored += file->size;
 
-            // If not zero-length add the checksum
-            if (file->size != 0 && !zeroed)
-                strCatFmt(log, " checksum %s", file->checksumSha1);
+                strCatFmt(log, " (%s, %" PRIu64 "%%)", strZ(strSizeFormat(file->size)), sizeRestored * 100 / sizeTotal);
 
-            LOG_PID(copy ? logLevelInfo : logLevelDetail, protocolParallelJobProcessId(job), 0, strZ(log));
+                // If not zero-length add the checksum
+                if (file->size != 0 && !zeroed)
+                    strCatFmt(log, " checksum %s", file->checksumSha1);
+
+                LOG_PID(copy ? logLevelInfo : logLevelDetail, protocolParallelJobProcessId(job), 0, strZ(log));
+            }
         }
         MEM_CONTEXT_TEMP_END();
 
@@ -2069,30 +2062,99 @@ typedef struct RestoreJobData
     unsigned int repoIdx;                                           // Internal repo idx
     Manifest *manifest;                                             // Backup manifest
     List *queueList;                                                // List of processing queues
+    List *queueSizeList;                                            // Bytes remaining in each processing queue
+    unsigned int stealTotal;                                        // Jobs taken from the queue of another process
+    uint64_t stealSize;                                             // Bytes taken from the queue of another process
     RegExp *zeroExp;                                                // Identify files that should be sparse zeroed
     const String *cipherSubPass;                                    // Passphrase used to decrypt files in the backup
+    bool split;                                                     // Copy files with range checksums in ranges?
+    const ManifestFile *splitFile;                                  // File with ranges left to copy (or NULL)
+    uint64_t splitOffset;                                           // Offset of the next range to copy
+    List *splitList;                                                // Files with ranges that have not all been copied
 } RestoreJobData;
 
-// Helper to caculate the next queue to scan based on the client index
+// Helper to find the queue to take a job from when the queue of a process is empty. The queue with the most bytes remaining is
+// chosen so a large queue is shared by all processes rather than being left to the process that owns it.
 static int
-restoreJobQueueNext(unsigned int clientIdx, int queueIdx, unsigned int queueTotal)
+restoreJobQueueSteal(const List *queueList, const List *queueSizeList)
 {
     FUNCTION_TEST_BEGIN();
-        FUNCTION_TEST_PARAM(UINT, clientIdx);
-        FUNCTION_TEST_PARAM(INT, queueIdx);
-        FUNCTION_TEST_PARAM(UINT, queueTotal);
+        FUNCTION_TEST_PARAM(LIST, queueList);
+        FUNCTION_TEST_PARAM(LIST, queueSizeList);
+    FUNCTION_TEST_END();
+
+    ASSERT(queueList != NULL);
+    ASSERT(queueSizeList != NULL);
+
+    int result = -1;
+
+    for (unsigned int queueIdx = 0; queueIdx < lstSize(queueList); queueIdx++)
+    {
+        if (!lstEmpty(*(List **)lstGet(queueList, queueIdx)) &&
+            (result == -1 ||
+             *(uint64_t *)lstGet(queueSizeList, queueIdx) > *(uint64_t *)lstGet(queueSizeList, (unsigned int)result)))
+        {
+            result = (int)queueIdx;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Helper to determine if a file should be copied in ranges
+static bool
+restoreJobSplit(const RestoreJobData *jobData, const ManifestFile *file)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+        FUNCTION_TEST_PARAM(MANIFEST_FILE, file);
     FUNCTION_TEST_END();
 
-    // Move (forward or back) to the next queue
-    queueIdx += clientIdx % 2 ? -1 : 1;
+    ASSERT(jobData != NULL);
+    ASSERT(file != NULL);
+
+    FUNCTION_TEST_RETURN(
+        jobData->split && file->checksumRange != NULL && !restoreFileZeroed(file->name, jobData->zeroExp));
+}
+
+// Helper to create a command to restore a file
+static ProtocolCommand *
+restoreJobCommand(const RestoreJobData *jobData, const ManifestFile *file, bool delta, bool force, bool deltaBlock)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+        FUNCTION_TEST_PARAM(MANIFEST_FILE, file);
+        FUNCTION_TEST_PARAM(BOOL, delta);
+        FUNCTION_TEST_PARAM(BOOL, force);
+        FUNCTION_TEST_PARAM(BOOL, deltaBlock);
+    FUNCTION_TEST_END();
 
-    // Deal with wrapping on either end
-    if (queueIdx < 0)
-        FUNCTION_TEST_RETURN((int)queueTotal - 1);
-    else if (queueIdx == (int)queueTotal)
-        FUNCTION_TEST_RETURN(0);
+    ASSERT(jobData != NULL);
+    ASSERT(file != NULL);
+
+    ProtocolCommand *result = protocolCommandNew(PROTOCOL_COMMAND_RESTORE_FILE_STR);
+    protocolCommandParamAdd(result, VARSTR(file->name));
+    protocolCommandParamAdd(result, VARUINT(jobData->repoIdx));
+    protocolCommandParamAdd(
+        result, file->reference != NULL ? VARSTR(file->reference) : VARSTR(manifestData(jobData->manifest)->backupLabel));
+    protocolCommandParamAdd(result, VARUINT(manifestData(jobData->manifest)->backupOptionCompressType));
+    protocolCommandParamAdd(result, VARUINT64(file->sizeRepo - file->blockIncrMapSize));
+    protocolCommandParamAdd(result, VARUINT64(file->blockIncrMapSize));
+    protocolCommandParamAdd(result, VARSTR(restoreFilePgPath(jobData->manifest, file->name)));
+    protocolCommandParamAdd(result, VARSTRZ(file->checksumSha1));
+    protocolCommandParamAdd(result, VARBOOL(restoreFileZeroed(file->name, jobData->zeroExp)));
+    protocolCommandParamAdd(result, VARUINT64(file->size));
+    protocolCommandParamAdd(result, VARUINT64((uint64_t)file->timestamp));
+    protocolCommandParamAdd(result, VARSTR(strNewFmt("%04o", file->mode)));
+    protocolCommandParamAdd(result, VARSTR(file->user));
+    protocolCommandParamAdd(result, VARSTR(file->group));
+    protocolCommandParamAdd(result, VARUINT64((uint64_t)manifestData(jobData->manifest)->backupTimestampCopyStart));
+    protocolCommandParamAdd(result, VARBOOL(delta));
+    protocolCommandParamAdd(result, VARBOOL(force));
+    protocolCommandParamAdd(result, VARBOOL(deltaBlock));
+    protocolCommandParamAdd(result, VARSTR(jobData->cipherSubPass));
 
-    FUNCTION_TEST_RETURN(queueIdx);
+    FUNCTION_TEST_RETURN(result);
 }
 
 // Callback to fetch restore jobs for the parallel executor
@@ -2112,52 +2174,114 @@ static ProtocolParallelJob *restoreJobCallback(void *data, unsigned int clientId
         // Get a new job if there are any left
         RestoreJobData *jobData = data;
 
-        // Determine where to begin scanning the queue (we'll stop when we get back here)
-        int queueIdx = (int)(clientIdx % lstSize(jobData->queueList));
-        int queueEnd = queueIdx;
+        // Continue with the file being copied in ranges
+        const ManifestFile *file = jobData->splitFile;
 
-        do
+        if (file == NULL)
         {
-            List *queue = *(List **)lstGet(jobData->queueList, (unsigned int)queueIdx);
+            // Take jobs from the queue of this process first. When it is empty take them from the queue with most bytes remaining.
+            int queueIdx = (int)(clientIdx % lstSize(jobData->queueList));
+            bool steal = false;
 
-            if (!lstEmpty(queue))
+            if (lstEmpty(*(List **)lstGet(jobData->queueList, (unsigned int)queueIdx)))
             {
-                const ManifestFile *file = *(ManifestFile **)lstGet(queue, 0);
+                queueIdx = restoreJobQueueSteal(jobData->queueList, jobData->queueSizeList);
+                steal = true;
+            }
+
+            if (queueIdx != -1)
+            {
+                List *const queue = *(List **)lstGet(jobData->queueList, (unsigned int)queueIdx);
+                file = *(ManifestFile **)lstGet(queue, 0);
 
-                // Create restore job
-                ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_RESTORE_FILE_STR);
+                // Remove job from the queue
+                lstRemoveIdx(queue, 0);
+                *(uint64_t *)lstGet(jobData->queueSizeList, (unsigned int)queueIdx) -= file->size;
+
+                // Update scheduling stats
+                if (steal)
+                {
+                    jobData->stealTotal++;
+                    jobData->stealSize += file->size;
+                }
+
+                // Copy a large file in ranges so all processes can share it
+                if (restoreJobSplit(jobData, file))
+                {
+                    const String *const pgFile = restoreFilePgPath(jobData->manifest, file->name);
+
+                    // Update ownership and mode of a file left in place by force since truncating it will not change them
+                    if (cfgOptionBool(cfgOptForce))
+                    {
+                        const StorageInfo info = storageInfoP(storagePg(), pgFile, .ignoreMissing = true);
+
+                        if (info.exists && info.type == storageTypeFile)
+                        {
+                            const String *const pgFilePath = storagePathP(storagePg(), pgFile);
+
+                            restoreCleanOwnership(pgFilePath, file->user, file->group, info.userId, info.groupId, false);
+                            restoreCleanMode(pgFilePath, file->mode, &info);
+                        }
+                    }
+
+                    // Create the file so the ranges can be written at any offset in any order
+                    storagePutP(
+                        storageNewWriteP(
+                            storagePgWrite(), pgFile, .modeFile = file->mode, .user = file->user, .group = file->group,
+                            .noAtomic = true, .noCreatePath = true, .noSyncPath = true),
+                        NULL);
+
+                    jobData->splitFile = file;
+                    jobData->splitOffset = 0;
+                    lstAdd(jobData->splitList, &(RestoreJobSplit){.file = file, .sizeRemaining = file->size});
+                }
+            }
+        }
+
+        if (file != NULL)
+        {
+            ProtocolCommand *command = NULL;
+
+            // Create restore range job
+            if (jobData->splitFile != NULL)
+            {
+                const uint64_t rangeSize =
+                    file->size - jobData->splitOffset < file->checksumRangeSize ?
+                        file->size - jobData->splitOffset : file->checksumRangeSize;
+
+                command = protocolCommandNew(PROTOCOL_COMMAND_RESTORE_FILE_RANGE_STR);
                 protocolCommandParamAdd(command, VARSTR(file->name));
                 protocolCommandParamAdd(command, VARUINT(jobData->repoIdx));
                 protocolCommandParamAdd(
                     command, file->reference != NULL ?
                         VARSTR(file->reference) : VARSTR(manifestData(jobData->manifest)->backupLabel));
-                protocolCommandParamAdd(command, VARUINT(manifestData(jobData->manifest)->backupOptionCompressType));
                 protocolCommandParamAdd(command, VARSTR(restoreFilePgPath(jobData->manifest, file->name)));
-                protocolCommandParamAdd(command, VARSTRZ(file->checksumSha1));
-                protocolCommandParamAdd(command, VARBOOL(restoreFileZeroed(file->name, jobData->zeroExp)));
-                protocolCommandParamAdd(command, VARUINT64(file->size));
-                protocolCommandParamAdd(command, VARUINT64((uint64_t)file->timestamp));
-                protocolCommandParamAdd(command, VARSTR(strNewFmt("%04o", file->mode)));
-                protocolCommandParamAdd(command, VARSTR(file->user));
-                protocolCommandParamAdd(command, VARSTR(file->group));
-                protocolCommandParamAdd(command, VARUINT64((uint64_t)manifestData(jobData->manifest)->backupTimestampCopyStart));
-                protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptDelta)));
-                protocolCommandParamAdd(command, VARBOOL(cfgOptionBool(cfgOptDelta) && cfgOptionBool(cfgOptForce)));
-                protocolCommandParamAdd(command, VARSTR(jobData->cipherSubPass));
-
-                // Remove job from the queue
-                lstRemoveIdx(queue, 0);
+                protocolCommandParamAdd(command, VARUINT64(jobData->splitOffset));
+                protocolCommandParamAdd(command, VARUINT64(rangeSize));
+                protocolCommandParamAdd(
+                    command,
+                    VARSTR(
+                        strSubN(
+                            file->checksumRange, (size_t)(jobData->splitOffset / file->checksumRangeSize) * HASH_TYPE_SHA1_SIZE_HEX,
+                            HASH_TYPE_SHA1_SIZE_HEX)));
 
-                // Assign job to result
-                result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(file->name), command), memContextPrior());
+                // Move to the next range or finish the file
+                jobData->splitOffset += rangeSize;
 
-                // Break out of the loop early since we found a job
-                break;
+                if (jobData->splitOffset == file->size)
+                    jobData->splitFile = NULL;
+            }
+            // Else create restore job
+            else
+            {
+                command = restoreJobCommand(
+                    jobData, file, cfgOptionBool(cfgOptDelta), cfgOptionBool(cfgOptForce),
+                    cfgOptionBool(cfgOptDelta) && cfgOptionBool(cfgOptDeltaBlock));
             }
 
-            queueIdx = restoreJobQueueNext(clientIdx, queueIdx, lstSize(jobData->queueList));
+            // Assign job to result
+            result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(file->name), command), memContextPrior());
         }
-        while (queueIdx != queueEnd);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -2222,14 +2346,23 @@ cmdRestore(void)
         restoreCleanBuild(jobData.manifest);
 
         // Generate processing queues
-        uint64_t sizeTotal = restoreProcessQueue(jobData.manifest, &jobData.queueList);
+        uint64_t sizeTotal = restoreProcessQueue(jobData.manifest, &jobData.queueList, &jobData.queueSizeList);
+
+        // Copy files with range checksums in ranges when there is more than one process. Ranges are read directly from the
+        // repository so the backup must not be compressed or encrypted. A delta restore checksums the whole file so files are not
+        // split.
+        jobData.splitList = lstNewP(sizeof(RestoreJobSplit));
+        jobData.split =
+            cfgOptionUInt64(cfgOptSplitSize) != 0 && cfgOptionUInt(cfgOptProcessMax) > 1 && !cfgOptionBool(cfgOptDelta) &&
+            manifestData(jobData.manifest)->backupOptionCompressType == compressTypeNone && jobData.cipherSubPass == NULL &&
+            storageFeature(storageRepoIdx(jobData.repoIdx), storageFeatureLimitRead);
 
         // Save manifest to the data directory so we can restart a delta restore even if the PG_VERSION file is missing
         manifestSave(jobData.manifest, storageWriteIo(storageNewWriteP(storagePgWrite(), BACKUP_MANIFEST_FILE_STR)));
 
         // Create the parallel executor
         ProtocolParallel *parallelExec = protocolParallelNew(
-            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, restoreJobCallback, &jobData);
+            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, cfgOptionUInt(cfgOptJobQueueMax), restoreJobCallback, &jobData);
 
         for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
             protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
@@ -2244,11 +2377,20 @@ cmdRestore(void)
             for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
             {
                 sizeRestored = restoreJobResult(
-                    jobData.manifest, protocolParallelResult(parallelExec), jobData.zeroExp, sizeTotal, sizeRestored);
+                    jobData.manifest, protocolParallelResult(parallelExec), jobData.zeroExp, sizeTotal, sizeRestored,
+                    jobData.splitList);
             }
         }
         while (!protocolParallelDone(parallelExec));
 
+        // Report how work was balanced between processes
+        if (cfgOptionUInt(cfgOptProcessMax) > 1)
+        {
+            LOG_DETAIL_FMT(
+                "%u file(s) (%s) taken from the queue of another process", jobData.stealTotal,
+                strZ(strSizeFormat(jobData.stealSize)));
+        }
+
         // Write recovery settings
         restoreRecoveryWrite(jobData.manifest);
 
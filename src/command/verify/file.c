@@ -3,10 +3,13 @@ Verify File
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include "command/archive/common.h"
+#include "command/backup/blockIncr.h"
 #include "command/verify/file.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
 #include "common/debug.h"
+#include "common/io/bufferWrite.h"
 #include "common/io/filter/group.h"
 #include "common/io/filter/sink.h"
 #include "common/io/filter/size.h"
@@ -14,16 +17,93 @@ Verify File
 #include "common/log.h"
 #include "storage/helper.h"
 
+/***********************************************************************************************************************************
+Verify a file stored with block incremental by reassembling it from the block map. The backup label and manifest file name are
+extracted from the file path so the blocks can be located in other backups.
+***********************************************************************************************************************************/
+static VerifyResult
+verifyFileBlockIncr(
+    const String *const filePathName, const String *const fileChecksum, const uint64_t fileSize, const String *const cipherPass,
+    const uint64_t blockIncrMapSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, filePathName);
+        FUNCTION_LOG_PARAM(STRING, fileChecksum);
+        FUNCTION_LOG_PARAM(UINT64, fileSize);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+        FUNCTION_LOG_PARAM(UINT64, blockIncrMapSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(strBeginsWithZ(filePathName, STORAGE_REPO_BACKUP "/"));
+
+    VerifyResult result = verifyOk;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const StorageInfo info = storageInfoP(storageRepo(), filePathName, .ignoreMissing = true);
+
+        // If the file exists check the checksum/size
+        if (info.exists)
+        {
+            // Split the path into backup label and manifest file name (without compression extension)
+            const CompressType compressType = compressTypeFromName(filePathName);
+            const String *const labelFile = strSub(filePathName, sizeof(STORAGE_REPO_BACKUP));
+            const String *const label = strSubN(labelFile, 0, (size_t)(strChr(labelFile, '/')));
+            const String *const file = strSubN(
+                labelFile, strSize(label) + 1, strSize(labelFile) - strSize(label) - 1 - strSize(compressExtStr(compressType)));
+
+            // Reassemble the file to calculate the checksum/size
+            IoWrite *const write = ioBufferWriteNew(bufNew(0));
+            ioFilterGroupAdd(ioWriteFilterGroup(write), cryptoHashNew(HASH_TYPE_SHA1_STR));
+            ioFilterGroupAdd(ioWriteFilterGroup(write), ioSizeNew());
+            ioFilterGroupAdd(ioWriteFilterGroup(write), ioSinkNew());
+
+            ioWriteOpen(write);
+
+            TRY_BEGIN()
+            {
+                blockIncrRead(
+                    storageRepo(), file, label, info.size - blockIncrMapSize, blockIncrMapSize, compressType, cipherPass, write);
+            }
+            // A block with an invalid checksum means the file checksum will not match
+            CATCH(ChecksumError)
+            {
+                result = verifyChecksumMismatch;
+            }
+            TRY_END();
+
+            if (result == verifyOk)
+            {
+                ioWriteClose(write);
+
+                // Validate checksum
+                if (!strEq(fileChecksum, varStr(ioFilterGroupResult(ioWriteFilterGroup(write), CRYPTO_HASH_FILTER_TYPE_STR))))
+                    result = verifyChecksumMismatch;
+                // Validate size
+                else if (fileSize != varUInt64Force(ioFilterGroupResult(ioWriteFilterGroup(write), SIZE_FILTER_TYPE_STR)))
+                    result = verifySizeInvalid;
+            }
+        }
+        else
+            result = verifyFileMissing;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_STRUCT(result);
+}
+
 /**********************************************************************************************************************************/
 VerifyResult
 verifyFile(
-    const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass)
+    const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass,
+    uint64_t blockIncrMapSize)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, filePathName);                   // Fully qualified file name
         FUNCTION_LOG_PARAM(STRING, fileChecksum);                   // Checksum for the file
         FUNCTION_LOG_PARAM(UINT64, fileSize);                       // Size of file
         FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to access the repo file if encrypted
+        FUNCTION_LOG_PARAM(UINT64, blockIncrMapSize);               // Size of the block map if stored with block incremental
     FUNCTION_LOG_END();
 
     ASSERT(filePathName != NULL);
@@ -32,45 +112,54 @@ verifyFile(
     // Is the file valid?
     VerifyResult result = verifyOk;
 
-    MEM_CONTEXT_TEMP_BEGIN()
+    // Verify files stored with block incremental separately
+    if (blockIncrMapSize != 0)
+        result = verifyFileBlockIncr(filePathName, fileChecksum, fileSize, cipherPass, blockIncrMapSize);
+    else
     {
-        // Prepare the file for reading
-        IoRead *read = storageReadIo(storageNewReadP(storageRepo(), filePathName, .ignoreMissing = true));
-        IoFilterGroup *filterGroup = ioReadFilterGroup(read);
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Prepare the file for reading. WAL stored in a bundle is read from the part of the bundle that contains it.
+            IoRead *read = storageReadIo(
+                strEndsWithZ(strPath(filePathName), WAL_BUNDLE_EXT) ?
+                    walSegmentReadNew(storageRepo(), strSub(filePathName, sizeof(STORAGE_REPO_ARCHIVE)), false) :
+                    storageNewReadP(storageRepo(), filePathName, .ignoreMissing = true));
+            IoFilterGroup *filterGroup = ioReadFilterGroup(read);
 
-        // Add decryption filter
-        if (cipherPass != NULL)
-            ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+            // Add decryption filter
+            if (cipherPass != NULL)
+                ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
 
-        // Add decompression filter
-        if (compressTypeFromName(filePathName) != compressTypeNone)
-            ioFilterGroupAdd(filterGroup, decompressFilter(compressTypeFromName(filePathName)));
+            // Add decompression filter
+            if (compressTypeFromName(filePathName) != compressTypeNone)
+                ioFilterGroupAdd(filterGroup, decompressFilter(compressTypeFromName(filePathName)));
 
-        // Add sha1 filter
-        ioFilterGroupAdd(filterGroup, cryptoHashNew(HASH_TYPE_SHA1_STR));
+            // Add sha1 filter
+            ioFilterGroupAdd(filterGroup, cryptoHashNew(HASH_TYPE_SHA1_STR));
 
-        // Add size filter
-        ioFilterGroupAdd(filterGroup, ioSizeNew());
+            // Add size filter
+            ioFilterGroupAdd(filterGroup, ioSizeNew());
 
-        // Add IoSink so the file data is not transmitted from the remote
-        ioFilterGroupAdd(filterGroup, ioSinkNew());
+            // Add IoSink so the file data is not transmitted from the remote
+            ioFilterGroupAdd(filterGroup, ioSinkNew());
 
-        // If the file exists check the checksum/size
-        if (ioReadDrain(read))
-        {
-            // Validate checksum
-            if (!strEq(fileChecksum, varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))))
+            // If the file exists check the checksum/size
+            if (ioReadDrain(read))
             {
-                result = verifyChecksumMismatch;
+                // Validate checksum
+                if (!strEq(fileChecksum, varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))))
+                {
+                    result = verifyChecksumMismatch;
+                }
+                // If the size can be checked, do so
+                else if (fileSize != varUInt64Force(ioFilterGroupResult(ioReadFilterGroup(read), SIZE_FILTER_TYPE_STR)))
+                    result = verifySizeInvalid;
             }
-            // If the size can be checked, do so
-            else if (fileSize != varUInt64Force(ioFilterGroupResult(ioReadFilterGroup(read), SIZE_FILTER_TYPE_STR)))
-                result = verifySizeInvalid;
+            else
+                result = verifyFileMissing;
         }
-        else
-            result = verifyFileMissing;
+        MEM_CONTEXT_TEMP_END();
     }
-    MEM_CONTEXT_TEMP_END();
 
     FUNCTION_LOG_RETURN_STRUCT(result);
 }
@@ -24,6 +24,7 @@ Functions
 ***********************************************************************************************************************************/
 // Verify a file in the pgBackRest repository
 VerifyResult verifyFile(
-    const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass);
+    const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass,
+    uint64_t blockIncrMapSize);
 
 #endif
@@ -35,7 +35,8 @@ verifyFileProtocol(const VariantList *paramList, ProtocolServer *server)
             varStr(varLstGet(paramList, 0)),                        // Full filename
             varStr(varLstGet(paramList, 1)),                        // Checksum
             varUInt64(varLstGet(paramList, 2)),                     // File size
-            varStr(varLstGet(paramList, 3)));                       // Cipher pass
+            varStr(varLstGet(paramList, 3)),                        // Cipher pass
+            varUInt64(varLstGet(paramList, 4)));                    // Block incremental map size
 
         protocolServerResponse(server, VARUINT(result));
     }
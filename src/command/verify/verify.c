@@ -166,8 +166,10 @@ verifyFileLoad(const String *pathFileName, const String *cipherPass)
 
     ASSERT(pathFileName != NULL);
 
-    // Read the file and error if missing
-    StorageRead *result = storageNewReadP(storageRepo(), pathFileName);
+    // Read the file and error if missing. WAL stored in a bundle is read from the part of the bundle that contains it.
+    StorageRead *result = strEndsWithZ(strPath(pathFileName), WAL_BUNDLE_EXT) ?
+        walSegmentReadNew(storageRepo(), strSub(pathFileName, sizeof(STORAGE_REPO_ARCHIVE)), false) :
+        storageNewReadP(storageRepo(), pathFileName);
 
     // *read points to a location within result so update result with contents based on necessary filters
     IoRead *read = storageReadIo(result);
@@ -522,6 +524,87 @@ verifyPgHistory(const InfoPg *archiveInfoPg, const InfoPg *backupInfoPg)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Get the sorted list of WAL files in a WAL path. Files stored in a bundle are listed as file/bundle so they sort and form ranges
+along with files that are stored individually.
+***********************************************************************************************************************************/
+static StringList *
+verifyWalFileList(const String *archiveId, const String *walPath)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, archiveId);                     // Archive id containing the WAL path
+        FUNCTION_TEST_PARAM(STRING, walPath);                       // WAL path to list
+    FUNCTION_TEST_END();
+
+    ASSERT(archiveId != NULL);
+    ASSERT(walPath != NULL);
+
+    StringList *result = strLstNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const StringList *fileList = storageListP(
+            storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(walPath)),
+            .expression = STRDEF("^([0-F]{24}-[0-f]{40}" COMPRESS_TYPE_REGEXP "{0,1}|" WAL_BUNDLE_REGEXP ")$"));
+
+        for (unsigned int fileIdx = 0; fileIdx < strLstSize(fileList); fileIdx++)
+        {
+            const String *file = strLstGet(fileList, fileIdx);
+
+            if (strEndsWithZ(file, WAL_BUNDLE_EXT))
+            {
+                const List *bundleFileList = walBundleHeaderRead(
+                    storageRepo(), strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(file)));
+
+                for (unsigned int bundleFileIdx = 0; bundleFileIdx < lstSize(bundleFileList); bundleFileIdx++)
+                {
+                    strLstAdd(
+                        result,
+                        strNewFmt("%s/%s", strZ(((const WalBundleFile *)lstGet(bundleFileList, bundleFileIdx))->file), strZ(file)));
+                }
+            }
+            else
+                strLstAdd(result, file);
+        }
+
+        strLstSort(result, sortOrderAsc);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Get the path of a WAL file in the repo, including the bundle if the file is stored in one
+***********************************************************************************************************************************/
+static String *
+verifyWalFilePath(const String *archiveId, const String *walPath, const String *walFile)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, archiveId);                     // Archive id containing the WAL path
+        FUNCTION_TEST_PARAM(STRING, walPath);                       // WAL path containing the file
+        FUNCTION_TEST_PARAM(STRING, walFile);                       // WAL file from verifyWalFileList()
+    FUNCTION_TEST_END();
+
+    ASSERT(archiveId != NULL);
+    ASSERT(walPath != NULL);
+    ASSERT(walFile != NULL);
+
+    String *result = NULL;
+    const int bundleIdx = strChr(walFile, '/');
+
+    if (bundleIdx != -1)
+    {
+        result = strNewFmt(
+            STORAGE_REPO_ARCHIVE "/%s/%s/%s/%s", strZ(archiveId), strZ(walPath), strZ(strSub(walFile, (size_t)bundleIdx + 1)),
+            strZ(strSubN(walFile, 0, (size_t)bundleIdx)));
+    }
+    else
+        result = strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s/%s", strZ(archiveId), strZ(walPath), strZ(walFile));
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 Populate the WAL ranges from the provided, sorted, WAL files list for a given archiveId
 ***********************************************************************************************************************************/
@@ -707,13 +790,9 @@ verifyArchive(void *data)
                     strLstFree(jobData->walFileList);
 
                     // Get WAL file list
-                    const String *walFilePath = strNewFmt(
-                        STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveResult->archiveId), strZ(walPath));
-
                     MEM_CONTEXT_BEGIN(jobData->memContext)
                     {
-                        jobData->walFileList = strLstSort(
-                            storageListP(storageRepo(), walFilePath, .expression = WAL_SEGMENT_FILE_REGEXP_STR), sortOrderAsc);
+                        jobData->walFileList = verifyWalFileList(archiveResult->archiveId, walPath);
                     }
                     MEM_CONTEXT_END();
 
@@ -723,9 +802,7 @@ verifyArchive(void *data)
                         {
                             // Initialize the WAL segment size from the first WAL
                             StorageRead *walRead = verifyFileLoad(
-                                strNewFmt(
-                                    STORAGE_REPO_ARCHIVE "/%s/%s/%s", strZ(archiveResult->archiveId), strZ(walPath),
-                                    strZ(strLstGet(jobData->walFileList, 0))),
+                                verifyWalFilePath(archiveResult->archiveId, walPath, strLstGet(jobData->walFileList, 0)),
                                 jobData->walCipherPass);
 
                             PgWal walInfo = pgWalFromBuffer(storageGetP(walRead, .exactSize = PG_WAL_HEADER_SIZE));
@@ -749,8 +826,7 @@ verifyArchive(void *data)
                     {
                         // Get the fully qualified file name and checksum
                         const String *fileName = strLstGet(jobData->walFileList, 0);
-                        const String *filePathName = strNewFmt(
-                            STORAGE_REPO_ARCHIVE "/%s/%s/%s", strZ(archiveResult->archiveId), strZ(walPath), strZ(fileName));
+                        const String *filePathName = verifyWalFilePath(archiveResult->archiveId, walPath, fileName);
                         String *checksum = strSubN(fileName, WAL_SEGMENT_NAME_SIZE + 1, HASH_TYPE_SHA1_SIZE_HEX);
 
                         // Set up the job
@@ -759,6 +835,7 @@ verifyArchive(void *data)
                         protocolCommandParamAdd(command, VARSTR(checksum));
                         protocolCommandParamAdd(command, VARUINT64(archiveResult->pgWalInfo.size));
                         protocolCommandParamAdd(command, VARSTR(jobData->walCipherPass));
+                        protocolCommandParamAdd(command, VARUINT64(0));
 
                         // Assign job to result, prepending the archiveId to the key for consistency with backup processing
                         result = protocolParallelJobNew(
@@ -984,6 +1061,7 @@ verifyBackup(void *data)
                     protocolCommandParamAdd(command, VARSTRZ(fileData->checksumSha1));
                     protocolCommandParamAdd(command, VARUINT64(fileData->size));
                     protocolCommandParamAdd(command, VARSTR(jobData->backupCipherPass));
+                    protocolCommandParamAdd(command, VARUINT64(fileData->blockIncrMapSize));
 
                     // Assign job to result (prepend backup label being processed to the key since some files are in a prior backup)
                     result = protocolParallelJobNew(
@@ -1485,7 +1563,7 @@ verifyProcess(unsigned int *errorTotal)
 
                 // Create the parallel executor
                 ProtocolParallel *parallelExec = protocolParallelNew(
-                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, verifyJobCallback, &jobData);
+                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, cfgOptionUInt(cfgOptJobQueueMax), verifyJobCallback, &jobData);
 
                 for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
                     protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
@@ -5,7 +5,7 @@ Compression Helper
 
 #include <string.h>
 
-#include "common/compress/helper.h"
+#include "common/compress/helper.intern.h"
 #include "common/compress/bz2/common.h"
 #include "common/compress/bz2/compress.h"
 #include "common/compress/bz2/decompress.h"
@@ -30,6 +30,29 @@ Compression type constants
 // Constants for currently unsupported compression types
 #define XZ_EXT                                                      "xz"
 
+/***********************************************************************************************************************************
+Zst worker threads and long distance matching used for new zst compression filters
+***********************************************************************************************************************************/
+static struct CompressHelperZst
+{
+    unsigned int workerMax;                                         // Worker threads
+    bool longMatch;                                                 // Long distance matching
+} compressHelperZst;
+
+#ifdef HAVE_LIBZST
+
+static IoFilter *
+compressZstNew(const int level)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, level);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(zstCompressNew(level, compressHelperZst.workerMax, compressHelperZst.longMatch));
+}
+
+#endif // HAVE_LIBZST
+
 /***********************************************************************************************************************************
 Configuration for supported and future compression types
 ***********************************************************************************************************************************/
@@ -82,7 +105,7 @@ static const struct CompressHelperLocal
         .ext = STRDEF("." ZST_EXT),
 #ifdef HAVE_LIBZST
         .compressType = ZST_COMPRESS_FILTER_TYPE,
-        .compressNew = zstCompressNew,
+        .compressNew = compressZstNew,
         .decompressType = ZST_DECOMPRESS_FILTER_TYPE,
         .decompressNew = zstDecompressNew,
         .levelDefault = 3,
@@ -176,6 +199,20 @@ compressTypeFromName(const String *name)
     FUNCTION_TEST_RETURN(result);
 }
 
+/**********************************************************************************************************************************/
+void
+compressZstSet(const unsigned int workerMax, const bool longMatch)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, workerMax);
+        FUNCTION_TEST_PARAM(BOOL, longMatch);
+    FUNCTION_TEST_END();
+
+    compressHelperZst = (struct CompressHelperZst){.workerMax = workerMax, .longMatch = longMatch};
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 int
 compressLevelDefault(CompressType type)
@@ -225,7 +262,18 @@ compressFilterVar(const String *filterType, const VariantList *filterParamList)
 
         if (compress->compressType != NULL && strEqZ(filterType, compress->compressType))
         {
-            result = compress->compressNew(varIntForce(varLstGet(filterParamList, 0)));
+#ifdef HAVE_LIBZST
+            // Zst filters also pass workers and long distance matching so the filter is the same wherever it is created
+            if (compressIdx == compressTypeZst && varLstSize(filterParamList) > 1)
+            {
+                result = zstCompressNew(
+                    varIntForce(varLstGet(filterParamList, 0)), varUIntForce(varLstGet(filterParamList, 1)),
+                    varBool(varLstGet(filterParamList, 2)));
+            }
+            else
+#endif
+                result = compress->compressNew(varIntForce(varLstGet(filterParamList, 0)));
+
             break;
         }
         else if (compress->decompressType != NULL && strEqZ(filterType, compress->decompressType))
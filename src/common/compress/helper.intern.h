@@ -12,4 +12,7 @@ Functions
 // Default compression level for a compression type, used while loading the configuration
 int compressLevelDefault(CompressType type);
 
+// Set zst worker threads and long distance matching for filters created by compressFilter(), used while loading the configuration
+void compressZstSet(unsigned int workerMax, bool longMatch);
+
 #endif
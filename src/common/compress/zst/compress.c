@@ -28,6 +28,8 @@ typedef struct ZstCompress
     MemContext *memContext;                                         // Context to store data
     ZSTD_CStream *context;                                          // Compression context
     int level;                                                      // Compression level
+    unsigned int workerMax;                                         // Worker threads (0 to compress in the calling thread)
+    bool longMatch;                                                 // Use long distance matching?
     IoFilter *filter;                                               // Filter interface
 
     bool inputSame;                                                 // Is the same input required on the next process call?
@@ -42,8 +44,8 @@ static String *
 zstCompressToLog(const ZstCompress *this)
 {
     return strNewFmt(
-        "{level: %d, inputSame: %s, inputOffset: %zu, flushing: %s}", this->level, cvtBoolToConstZ(this->inputSame),
-        this->inputOffset, cvtBoolToConstZ(this->flushing));
+        "{level: %d, workerMax: %u, longMatch: %s, inputSame: %s, inputOffset: %zu, flushing: %s}", this->level, this->workerMax,
+        cvtBoolToConstZ(this->longMatch), cvtBoolToConstZ(this->inputSame), this->inputOffset, cvtBoolToConstZ(this->flushing));
 }
 
 #define FUNCTION_LOG_ZST_COMPRESS_TYPE                                                                                             \
@@ -115,8 +117,8 @@ zstCompressProcess(THIS_VOID, const Buffer *uncompressed, Buffer *compressed)
         // If the input buffer was not entirely consumed then set inputSame and store the offset where processing will restart
         if (in.pos < in.size)
         {
-            // Output buffer should be completely full
-            ASSERT(out.pos == out.size);
+            // Output buffer should be completely full unless workers are busy and cannot accept more input yet
+            ASSERT(out.pos == out.size || this->workerMax > 0);
 
             this->inputSame = true;
             this->inputOffset += in.pos;
@@ -170,10 +172,12 @@ zstCompressInputSame(const THIS_VOID)
 
 /**********************************************************************************************************************************/
 IoFilter *
-zstCompressNew(int level)
+zstCompressNew(const int level, const unsigned int workerMax, const bool longMatch)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(INT, level);
+        FUNCTION_LOG_PARAM(UINT, workerMax);
+        FUNCTION_LOG_PARAM(BOOL, longMatch);
     FUNCTION_LOG_END();
 
     ASSERT(level >= 0);
@@ -189,6 +193,8 @@ zstCompressNew(int level)
             .memContext = MEM_CONTEXT_NEW(),
             .context = ZSTD_createCStream(),
             .level = level,
+            .workerMax = workerMax,
+            .longMatch = longMatch,
         };
 
         // Set callback to ensure zst context is freed
@@ -197,9 +203,27 @@ zstCompressNew(int level)
         // Initialize context
         zstError(ZSTD_initCStream(driver->context, driver->level));
 
+        // Compress with worker threads and/or long distance matching. These parameters are only stable in newer versions of zst.
+        if (workerMax > 0 || longMatch)
+        {
+#if ZSTD_VERSION_NUMBER >= 10400
+            if (workerMax > 0)
+                zstError(ZSTD_CCtx_setParameter(driver->context, ZSTD_c_nbWorkers, (int)workerMax));
+
+            if (longMatch)
+                zstError(ZSTD_CCtx_setParameter(driver->context, ZSTD_c_enableLongDistanceMatching, 1));
+#else
+            THROW_FMT(
+                OptionInvalidValueError, "zst workers and long distance matching require zst >= 10400 (found %u)",
+                ZSTD_versionNumber());
+#endif
+        }
+
         // Create param list
         VariantList *paramList = varLstNew();
         varLstAdd(paramList, varNewInt(level));
+        varLstAdd(paramList, varNewUInt(workerMax));
+        varLstAdd(paramList, varNewBool(longMatch));
 
         // Create filter interface
         this = ioFilterNewP(
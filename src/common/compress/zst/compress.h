@@ -19,7 +19,7 @@ Filter type constant
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-IoFilter *zstCompressNew(int level);
+IoFilter *zstCompressNew(int level, unsigned int workerMax, bool longMatch);
 
 #endif
 
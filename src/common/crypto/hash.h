@@ -2,6 +2,9 @@
 Cryptographic Hash
 
 Generate a hash (sha1, md5, etc.) from a string, Buffer, or using an IoFilter.
+
+CRC32C is also provided as a hash type. It is not a cryptographic hash but is much faster than the other hash types (especially when
+the CPU has a CRC32C instruction) so it is useful for detecting corruption when collision resistance is not required.
 ***********************************************************************************************************************************/
 #ifndef COMMON_CRYPTO_HASH_H
 #define COMMON_CRYPTO_HASH_H
@@ -18,6 +21,8 @@ Filter type constant
 /***********************************************************************************************************************************
 Hash types
 ***********************************************************************************************************************************/
+#define HASH_TYPE_CRC32C                                            "crc32c"
+    STRING_DECLARE(HASH_TYPE_CRC32C_STR);
 #define HASH_TYPE_MD5                                               "md5"
     STRING_DECLARE(HASH_TYPE_MD5_STR);
 #define HASH_TYPE_SHA1                                              "sha1"
@@ -28,6 +33,7 @@ Hash types
 /***********************************************************************************************************************************
 Hashes for zero-length files (i.e., starting hash)
 ***********************************************************************************************************************************/
+#define HASH_TYPE_CRC32C_ZERO                                       "00000000"
 #define HASH_TYPE_MD5_ZERO                                          "d41d8cd98f00b204e9800998ecf8427e"
 #define HASH_TYPE_SHA1_ZERO                                         "da39a3ee5e6b4b0d3255bfef95601890afd80709"
     STRING_DECLARE(HASH_TYPE_SHA1_ZERO_STR);
@@ -38,6 +44,9 @@ Hashes for zero-length files (i.e., starting hash)
 /***********************************************************************************************************************************
 Hash type sizes
 ***********************************************************************************************************************************/
+#define HASH_TYPE_CRC32C_SIZE                                       4
+#define HASH_TYPE_CRC32C_SIZE_HEX                                   (HASH_TYPE_CRC32C_SIZE * 2)
+
 #define HASH_TYPE_M5_SIZE                                           16
 #define HASH_TYPE_MD5_SIZE_HEX                                      (HASH_TYPE_M5_SIZE * 2)
 
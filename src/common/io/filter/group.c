@@ -155,6 +155,31 @@ ioFilterGroupClear(IoFilterGroup *this)
     FUNCTION_LOG_RETURN(IO_FILTER_GROUP, this);
 }
 
+/**********************************************************************************************************************************/
+bool
+ioFilterGroupOutput(const IoFilterGroup *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_FILTER_GROUP, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!this->pub.opened);
+
+    bool result = false;
+
+    for (unsigned int filterIdx = 0; filterIdx < ioFilterGroupSize(this); filterIdx++)
+    {
+        if (ioFilterOutput(ioFilterGroupGet(this, filterIdx)->filter))
+        {
+            result = true;
+            break;
+        }
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
 /***********************************************************************************************************************************
 Setup the filter group and allocate any required buffers
 ***********************************************************************************************************************************/
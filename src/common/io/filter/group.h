@@ -57,6 +57,10 @@ ioFilterGroupInputSame(const IoFilterGroup *const this)
     return THIS_PUB(IoFilterGroup)->inputSame;
 }
 
+// Do any filters produce output? Filters that do not produce output (e.g. size, hash) cannot change the data. Opening the group may
+// add an output filter so this must be called before the group is opened.
+bool ioFilterGroupOutput(const IoFilterGroup *this);
+
 // Get all filters and their parameters so they can be passed to a remote
 Variant *ioFilterGroupParamAll(const IoFilterGroup *this);
 
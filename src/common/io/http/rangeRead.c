@@ -0,0 +1,310 @@
+/***********************************************************************************************************************************
+HTTP Range Read
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <string.h>
+
+#include "common/debug.h"
+#include "common/io/http/rangeRead.h"
+#include "common/io/io.h"
+#include "common/log.h"
+#include "common/type/convert.h"
+#include "common/type/list.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct HttpRangeReadRange
+{
+    HttpRequest *request;                                           // Request (NULL for the first range)
+    HttpResponse *response;                                         // Response (NULL until the response has been received)
+    size_t size;                                                    // Size of the range
+    size_t sizeRead;                                                // Size of the range returned so far
+    Buffer *content;                                                // Prefetched content (NULL until content has been prefetched)
+    size_t contentOffset;                                           // Offset of prefetched content not yet returned
+} HttpRangeReadRange;
+
+struct HttpRangeRead
+{
+    MemContext *memContext;                                         // Object mem context
+    const String *name;                                             // Name of the content being read (for errors)
+    size_t rangeSize;                                               // Size of each range
+    unsigned int concurrency;                                       // Max ranges in flight
+    HttpRangeReadRequestCallback *requestCallback;                  // Callback to request a range
+    void *requestCallbackData;                                      // Data to pass to the request callback
+
+    List *rangeList;                                                // Ranges in flight in range order
+    uint64_t rangeNext;                                             // Start of the next range to request
+    uint64_t rangeEnd;                                              // End of the ranges to request (exclusive)
+};
+
+/***********************************************************************************************************************************
+Request the next range
+***********************************************************************************************************************************/
+static void
+httpRangeReadRequest(HttpRangeRead *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(HTTP_RANGE_READ, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->rangeNext < this->rangeEnd);
+
+    const size_t size =
+        this->rangeEnd - this->rangeNext < this->rangeSize ? (size_t)(this->rangeEnd - this->rangeNext) : this->rangeSize;
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        HttpRangeReadRange range =
+        {
+            .request = this->requestCallback(this->requestCallbackData, this->rangeNext, size),
+            .size = size,
+        };
+
+        lstAdd(this->rangeList, &range);
+    }
+    MEM_CONTEXT_END();
+
+    this->rangeNext += size;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get the response for a range if it has not already been received
+***********************************************************************************************************************************/
+static void
+httpRangeReadResponse(HttpRangeRead *this, HttpRangeReadRange *range)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(HTTP_RANGE_READ, this);
+        FUNCTION_LOG_PARAM_P(VOID, range);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(range != NULL);
+
+    if (range->response == NULL)
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            range->response = httpRequestResponse(range->request, false);
+        }
+        MEM_CONTEXT_END();
+
+        if (!httpResponseCodeOk(range->response))
+            httpRequestError(range->request, range->response);
+
+        // A full response would mean the range was ignored and the content will not be what is expected
+        if (httpResponseCode(range->response) != HTTP_RESPONSE_CODE_PARTIAL_CONTENT)
+        {
+            THROW_FMT(
+                FormatError, "expected range response for '%s' but got code %u", strZ(this->name),
+                httpResponseCode(range->response));
+        }
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Prefetch the next chunk of content for each range after the current range
+***********************************************************************************************************************************/
+static void
+httpRangeReadPrefetch(HttpRangeRead *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(HTTP_RANGE_READ, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    for (unsigned int rangeIdx = 1; rangeIdx < lstSize(this->rangeList); rangeIdx++)
+    {
+        HttpRangeReadRange *range = lstGet(this->rangeList, rangeIdx);
+        httpRangeReadResponse(this, range);
+
+        IoRead *read = httpResponseIoRead(range->response);
+
+        if (!ioReadEof(read))
+        {
+            // Allocate the entire range so the buffer does not need to be resized while prefetching
+            if (range->content == NULL)
+            {
+                MEM_CONTEXT_BEGIN(this->memContext)
+                {
+                    range->content = bufNew(range->size);
+                }
+                MEM_CONTEXT_END();
+            }
+
+            // Read one chunk so no range waits too long for the others
+            const size_t limit = bufUsed(range->content) + ioBufferSize();
+
+            bufLimitSet(range->content, limit < range->size ? limit : range->size);
+            ioRead(read, range->content);
+            bufLimitClear(range->content);
+        }
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+size_t
+httpRangeRead(HttpRangeRead *this, Buffer *buffer)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(HTTP_RANGE_READ, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(buffer != NULL && !bufFull(buffer));
+
+    size_t result = 0;
+
+    // Read until the buffer is full or there are no more ranges
+    do
+    {
+        HttpRangeReadRange *range = lstGet(this->rangeList, 0);
+        httpRangeReadResponse(this, range);
+
+        IoRead *read = httpResponseIoRead(range->response);
+
+        // Return prefetched content first and then read the remainder from the response
+        if (range->content != NULL && range->contentOffset < bufUsed(range->content))
+        {
+            const size_t size = bufUsed(range->content) - range->contentOffset < bufRemains(buffer) ?
+                bufUsed(range->content) - range->contentOffset : bufRemains(buffer);
+
+            bufCatSub(buffer, range->content, range->contentOffset, size);
+            range->contentOffset += size;
+            range->sizeRead += size;
+            result += size;
+        }
+        else if (!ioReadEof(read))
+        {
+            const size_t size = ioRead(read, buffer);
+
+            range->sizeRead += size;
+            result += size;
+        }
+
+        // The content ended before the end of the range
+        if (range->sizeRead < range->size && ioReadEof(read) &&
+            (range->content == NULL || range->contentOffset == bufUsed(range->content)))
+        {
+            THROW_FMT(
+                FormatError, "expected %zu bytes in range of '%s' but got %zu", range->size, strZ(this->name), range->sizeRead);
+        }
+
+        // When the range has been completely read free it and request another range if there are more. The response does not
+        // need to be read to eof since all the content it was expected to return has been read.
+        if (range->sizeRead == range->size)
+        {
+            httpResponseFree(range->response);
+            httpRequestFree(range->request);
+            bufFree(range->content);
+            lstRemoveIdx(this->rangeList, 0);
+
+            if (this->rangeNext < this->rangeEnd)
+                httpRangeReadRequest(this);
+        }
+    }
+    while (!bufFull(buffer) && !lstEmpty(this->rangeList));
+
+    // Prefetch content for the ranges that are not being read yet
+    httpRangeReadPrefetch(this);
+
+    FUNCTION_LOG_RETURN(SIZE, result);
+}
+
+/**********************************************************************************************************************************/
+bool
+httpRangeReadEof(const HttpRangeRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(HTTP_RANGE_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(lstEmpty(this->rangeList));
+}
+
+/**********************************************************************************************************************************/
+HttpRangeRead *
+httpRangeReadNew(
+    HttpResponse *response, const String *name, uint64_t offset, const Variant *limit, size_t rangeSize, unsigned int concurrency,
+    HttpRangeReadRequestCallback *requestCallback, void *requestCallbackData)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(HTTP_RESPONSE, response);
+        FUNCTION_LOG_PARAM(STRING, name);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(SIZE, rangeSize);
+        FUNCTION_LOG_PARAM(UINT, concurrency);
+        FUNCTION_LOG_PARAM(FUNCTIONP, requestCallback);
+        FUNCTION_LOG_PARAM_P(VOID, requestCallbackData);
+    FUNCTION_LOG_END();
+
+    ASSERT(response != NULL);
+    ASSERT(httpResponseCode(response) == HTTP_RESPONSE_CODE_PARTIAL_CONTENT);
+    ASSERT(name != NULL);
+    ASSERT(rangeSize > 0);
+    ASSERT(concurrency > 0);
+    ASSERT(requestCallback != NULL);
+
+    HttpRangeRead *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("HttpRangeRead")
+    {
+        this = memNew(sizeof(HttpRangeRead));
+
+        *this = (HttpRangeRead)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .name = strDup(name),
+            .rangeSize = rangeSize,
+            .concurrency = concurrency,
+            .requestCallback = requestCallback,
+            .requestCallbackData = requestCallbackData,
+            .rangeList = lstNewP(sizeof(HttpRangeReadRange)),
+        };
+
+        // Get the content size from the content range, e.g. bytes 0-15/40
+        const String *const contentRange = httpHeaderGet(httpResponseHeader(response), HTTP_HEADER_CONTENT_RANGE_STR);
+        const char *const sizeZ = contentRange == NULL ? NULL : strchr(strZ(contentRange), '/');
+
+        if (sizeZ == NULL)
+            THROW_FMT(FormatError, "missing or invalid " HTTP_HEADER_CONTENT_RANGE " for '%s'", strZ(name));
+
+        this->rangeEnd = cvtZToUInt64(sizeZ + 1);
+
+        // Do not read past the limit
+        if (limit != NULL && offset + varUInt64(limit) < this->rangeEnd)
+            this->rangeEnd = offset + varUInt64(limit);
+
+        // The first range has already been requested but may be smaller than the range size if the content is smaller
+        this->rangeNext = offset + rangeSize < this->rangeEnd ? offset + rangeSize : this->rangeEnd;
+
+        HttpRangeReadRange range =
+        {
+            .response = httpResponseMove(response, this->memContext),
+            .size = (size_t)(this->rangeNext - offset),
+        };
+
+        lstAdd(this->rangeList, &range);
+
+        // Request ranges up to the max concurrency
+        while (this->rangeNext < this->rangeEnd && lstSize(this->rangeList) < this->concurrency)
+            httpRangeReadRequest(this);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(HTTP_RANGE_READ, this);
+}
@@ -0,0 +1,64 @@
+/***********************************************************************************************************************************
+HTTP Range Read
+
+Read content with a series of range requests, each on a separate session. The caller requests the first range and passes the
+response, which must already have been checked, to httpRangeReadNew(). Further ranges are requested with a callback so the caller
+can build the request (e.g. authentication, conditions that ensure the content has not changed since the first range was read) and
+up to the specified number of ranges are kept in flight.
+
+Content is returned in range order. Content for ranges after the current range is prefetched into memory so the sessions keep
+transferring while the current range is read. Prefetching never goes past the end of a range so memory is bounded by the range size
+times the number of ranges in flight.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_HTTP_RANGEREAD_H
+#define COMMON_IO_HTTP_RANGEREAD_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct HttpRangeRead HttpRangeRead;
+
+#include "common/io/http/request.h"
+#include "common/type/object.h"
+#include "common/type/variant.h"
+
+/***********************************************************************************************************************************
+Callback to request a range. The request is freed by HttpRangeRead once the range has been read.
+***********************************************************************************************************************************/
+typedef HttpRequest *HttpRangeReadRequestCallback(void *data, uint64_t offset, uint64_t size);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+// The response is moved to the new object. The range size must match the size requested for the first range.
+HttpRangeRead *httpRangeReadNew(
+    HttpResponse *response, const String *name, uint64_t offset, const Variant *limit, size_t rangeSize, unsigned int concurrency,
+    HttpRangeReadRequestCallback *requestCallback, void *requestCallbackData);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Read content until the buffer is full or all ranges have been read
+size_t httpRangeRead(HttpRangeRead *this, Buffer *buffer);
+
+// Have all ranges been read?
+bool httpRangeReadEof(const HttpRangeRead *this);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+__attribute__((always_inline)) static inline void
+httpRangeReadFree(HttpRangeRead *this)
+{
+    objFree(this);
+}
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_HTTP_RANGE_READ_TYPE                                                                                          \
+    HttpRangeRead *
+#define FUNCTION_LOG_HTTP_RANGE_READ_FORMAT(value, buffer, bufferSize)                                                             \
+    objToLog(value, "HttpRangeRead", buffer, bufferSize)
+
+#endif
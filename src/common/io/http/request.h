@@ -56,8 +56,13 @@ HTTP Constants
     STRING_DECLARE(HTTP_HEADER_ETAG_STR);
 #define HTTP_HEADER_HOST                                            "host"
     STRING_DECLARE(HTTP_HEADER_HOST_STR);
+#define HTTP_HEADER_IF_MATCH                                        "if-match"
+    STRING_DECLARE(HTTP_HEADER_IF_MATCH_STR);
 #define HTTP_HEADER_LAST_MODIFIED                                   "last-modified"
     STRING_DECLARE(HTTP_HEADER_LAST_MODIFIED_STR);
+#define HTTP_HEADER_RANGE                                           "range"
+    STRING_DECLARE(HTTP_HEADER_RANGE_STR);
+#define HTTP_HEADER_RANGE_BYTES                                     "bytes"
 
 /***********************************************************************************************************************************
 Constructors
@@ -20,9 +20,11 @@ typedef struct HttpResponse HttpResponse;
 /***********************************************************************************************************************************
 HTTP Response Constants
 ***********************************************************************************************************************************/
+#define HTTP_RESPONSE_CODE_PARTIAL_CONTENT                          206
 #define HTTP_RESPONSE_CODE_PERMANENT_REDIRECT                       308
 #define HTTP_RESPONSE_CODE_FORBIDDEN                                403
 #define HTTP_RESPONSE_CODE_NOT_FOUND                                404
+#define HTTP_RESPONSE_CODE_RANGE_NOT_SATISFIABLE                    416
 
 /***********************************************************************************************************************************
 Constructors
@@ -263,7 +263,8 @@ ioReadSmall(IoRead *this, Buffer *buffer)
             }
         }
     }
-    while (!bufFull(buffer));
+    // Stop at EOF once the internal output buffer is empty, else the loop would never end
+    while (!bufFull(buffer) && (!ioReadEof(this) || bufUsed(this->output) > this->outputPos));
 
     FUNCTION_TEST_RETURN(outputRemains - bufRemains(buffer));
 }
@@ -412,3 +413,16 @@ ioReadFd(const IoRead *this)
 
     FUNCTION_LOG_RETURN(INT, this->pub.interface.fd == NULL ? -1 : this->pub.interface.fd(this->pub.driver));
 }
+
+/**********************************************************************************************************************************/
+bool
+ioReadBuffered(const IoRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->output != NULL && bufUsed(this->output) > this->outputPos);
+}
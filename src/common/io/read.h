@@ -47,6 +47,9 @@ ioReadFilterGroup(IoRead *const this)
 // File descriptor for the read object. Not all read objects have a file descriptor and -1 will be returned in that case.
 int ioReadFd(const IoRead *this);
 
+// Is there data in the internal buffer that has not been read? This data will not be detected by polling the file descriptor.
+bool ioReadBuffered(const IoRead *this);
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -56,7 +59,8 @@ bool ioReadOpen(IoRead *this);
 // Read data from IO and process filters
 size_t ioRead(IoRead *this, Buffer *buffer);
 
-// Same as ioRead() but optimized for small reads (intended for making repetitive reads that are smaller than ioBufferSize())
+// Same as ioRead() but optimized for small reads (intended for making repetitive reads that are smaller than ioBufferSize()). Fewer
+// bytes than requested are returned only at EOF.
 size_t ioReadSmall(IoRead *this, Buffer *buffer);
 
 // Read linefeed-terminated string and optionally error on eof
@@ -101,6 +101,7 @@ Array and object types:
 #include "common/io/read.h"
 #include "common/io/write.h"
 #include "common/type/convert.h"
+#include "common/type/keyValue.h"
 #include "common/type/pack.h"
 
 /***********************************************************************************************************************************
@@ -921,6 +922,96 @@ pckReadU64(PackRead *this, PckReadUInt64Param param)
     FUNCTION_TEST_RETURN(pckReadTag(this, &param.id, pckTypeU64, false));
 }
 
+/**********************************************************************************************************************************/
+Variant *
+pckReadVar(PackRead *this, PackIdParam param)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PACK_READ, this);
+        FUNCTION_TEST_PARAM(UINT, param.id);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    Variant *result = NULL;
+
+    if (!pckReadNullInternal(this, &param.id))
+    {
+        switch (pckReadType(this))
+        {
+            case pckTypeArray:
+            {
+                pckReadArrayBeginP(this, .id = param.id);
+
+                MEM_CONTEXT_TEMP_BEGIN()
+                {
+                    // Read the list size first since trailing NULLs would otherwise be lost
+                    const unsigned int listSize = pckReadU32P(this);
+                    VariantList *list = varLstNew();
+
+                    for (unsigned int listIdx = 0; listIdx < listSize; listIdx++)
+                        varLstAdd(list, pckReadVarP(this));
+
+                    MEM_CONTEXT_PRIOR_BEGIN()
+                    {
+                        result = varNewVarLst(list);
+                    }
+                    MEM_CONTEXT_PRIOR_END();
+                }
+                MEM_CONTEXT_TEMP_END();
+
+                pckReadArrayEndP(this);
+                break;
+            }
+
+            case pckTypeBool:
+                result = varNewBool(pckReadBoolP(this, .id = param.id));
+                break;
+
+            case pckTypeI64:
+                result = varNewInt64(pckReadI64P(this, .id = param.id));
+                break;
+
+            case pckTypeObj:
+            {
+                pckReadObjBeginP(this, .id = param.id);
+
+                KeyValue *kv = kvNew();
+
+                MEM_CONTEXT_TEMP_BEGIN()
+                {
+                    // Keys are never NULL so a NULL indicates the end of the object
+                    while (!pckReadNullP(this))
+                    {
+                        const Variant *key = pckReadVarP(this);
+                        kvPut(kv, key, pckReadVarP(this));
+                    }
+                }
+                MEM_CONTEXT_TEMP_END();
+
+                pckReadObjEndP(this);
+
+                result = varNewKv(kv);
+                break;
+            }
+
+            case pckTypeStr:
+                result = varNewStr(pckReadStrP(this, .id = param.id));
+                break;
+
+            case pckTypeU64:
+                result = varNewUInt64(pckReadU64P(this, .id = param.id));
+                break;
+
+            default:
+                THROW_FMT(
+                    FormatError, "field %u type '%s' cannot be read as a variant", param.id, strZ(pckTypeToStr(pckReadType(this))));
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /**********************************************************************************************************************************/
 void
 pckReadEnd(PackRead *this)
@@ -947,13 +1038,39 @@ pckReadEnd(PackRead *this)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+void
+pckReadReset(PackRead *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PACK_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->read != NULL);
+
+    // Discard anything left from the prior pack, e.g. when it was not read to the end due to an error
+    this->bufferPos = 0;
+    this->bufferUsed = 0;
+
+    while (!lstEmpty(this->tagStack))
+        lstRemoveLast(this->tagStack);
+
+    this->tagNextId = 0;
+    this->tagNextType = pckTypeUnknown;
+    this->tagNextValue = 0;
+    this->tagStackTop = lstAdd(this->tagStack, &(PackTagStack){.type = pckTypeObj});
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 String *
 pckReadToLog(const PackRead *this)
 {
     return strNewFmt(
         "{depth: %u, idLast: %u, tagNextId: %u, tagNextType: %u, tagNextValue %" PRIu64 "}", lstSize(this->tagStack),
-        this->tagStackTop->idLast, this->tagNextId, this->tagNextType, this->tagNextValue);
+        this->tagStackTop == NULL ? 0 : this->tagStackTop->idLast, this->tagNextId, this->tagNextType, this->tagNextValue);
 }
 
 /**********************************************************************************************************************************/
@@ -1540,6 +1657,99 @@ pckWriteU64(PackWrite *this, uint64_t value, PckWriteUInt64Param param)
     FUNCTION_TEST_RETURN(this);
 }
 
+/**********************************************************************************************************************************/
+PackWrite *
+pckWriteVar(PackWrite *this, const Variant *value, PackIdParam param)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PACK_WRITE, this);
+        FUNCTION_TEST_PARAM(VARIANT, value);
+        FUNCTION_TEST_PARAM(UINT, param.id);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    // Variants containing NULL data (e.g. a string variant created from a NULL string) are written the same as a NULL variant
+    if (value == NULL || (varType(value) == varTypeString && varStr(value) == NULL) ||
+        (varType(value) == varTypeKeyValue && varKv(value) == NULL) ||
+        (varType(value) == varTypeVariantList && varVarLst(value) == NULL))
+    {
+        // Explicit ids skip the NULL automatically
+        if (param.id == 0)
+            pckWriteNull(this);
+    }
+    else
+    {
+        switch (varType(value))
+        {
+            case varTypeBool:
+                pckWriteBoolP(this, varBool(value), .id = param.id, .defaultWrite = true);
+                break;
+
+            // Integers are written as signed only when negative to match the behavior of JSON. Callers expect uint64 variants for
+            // all non-negative integers since that is what was returned when the protocol used JSON.
+            case varTypeInt:
+            case varTypeInt64:
+            {
+                const int64_t valueInt = varInt64Force(value);
+
+                if (valueInt < 0)
+                    pckWriteI64P(this, valueInt, .id = param.id, .defaultWrite = true);
+                else
+                    pckWriteU64P(this, (uint64_t)valueInt, .id = param.id, .defaultWrite = true);
+
+                break;
+            }
+
+            case varTypeKeyValue:
+            {
+                const KeyValue *const kv = varKv(value);
+                const VariantList *const keyList = kvKeyList(kv);
+
+                pckWriteObjBeginP(this, .id = param.id);
+
+                for (unsigned int keyIdx = 0; keyIdx < varLstSize(keyList); keyIdx++)
+                {
+                    const Variant *const key = varLstGet(keyList, keyIdx);
+
+                    pckWriteVarP(this, key);
+                    pckWriteVarP(this, kvGet(kv, key));
+                }
+
+                pckWriteObjEndP(this);
+                break;
+            }
+
+            case varTypeString:
+                pckWriteStrP(this, varStr(value), .id = param.id, .defaultWrite = true);
+                break;
+
+            case varTypeUInt:
+            case varTypeUInt64:
+                pckWriteU64P(this, varUInt64Force(value), .id = param.id, .defaultWrite = true);
+                break;
+
+            default:
+            {
+                ASSERT(varType(value) == varTypeVariantList);
+
+                const VariantList *const list = varVarLst(value);
+
+                pckWriteArrayBeginP(this, .id = param.id);
+                pckWriteU32P(this, varLstSize(list), .defaultWrite = true);
+
+                for (unsigned int listIdx = 0; listIdx < varLstSize(list); listIdx++)
+                    pckWriteVarP(this, varLstGet(list, listIdx));
+
+                pckWriteArrayEndP(this);
+                break;
+            }
+        }
+    }
+
+    FUNCTION_TEST_RETURN(this);
+}
+
 /**********************************************************************************************************************************/
 PackWrite *
 pckWriteEnd(PackWrite *this)
@@ -99,6 +99,7 @@ typedef struct PackWrite PackWrite;
 #include "common/io/write.h"
 #include "common/type/object.h"
 #include "common/type/string.h"
+#include "common/type/variant.h"
 
 /***********************************************************************************************************************************
 Pack data type
@@ -288,12 +289,21 @@ typedef struct PckReadUInt64Param
 
 uint64_t pckReadU64(PackRead *this, PckReadUInt64Param param);
 
+// Read variant written with pckWriteVarP(). Integers are returned as int64 when negative and uint64 otherwise (the same as JSON).
+#define pckReadVarP(this, ...)                                                                                                     \
+    pckReadVar(this, (PackIdParam){VAR_PARAM_INIT, __VA_ARGS__})
+
+Variant *pckReadVar(PackRead *this, PackIdParam param);
+
 // Read end
 #define pckReadEndP(this)                                                                                                          \
     pckReadEnd(this)
 
 void pckReadEnd(PackRead *this);
 
+// Reset to read the next pack from the same IoRead so the read buffer is reused. The prior pack should have been read to the end.
+void pckReadReset(PackRead *this);
+
 /***********************************************************************************************************************************
 Read Destructor
 ***********************************************************************************************************************************/
@@ -463,6 +473,13 @@ typedef struct PckWriteUInt64Param
 
 PackWrite *pckWriteU64(PackWrite *this, uint64_t value, PckWriteUInt64Param param);
 
+// Write variant. Variant lists are written as an array with the list size followed by the values and key/values are written as an
+// object with each key followed by its value. NULL values are written as NULLs (i.e. gaps in the field IDs).
+#define pckWriteVarP(this, value, ...)                                                                                             \
+    pckWriteVar(this, value, (PackIdParam){VAR_PARAM_INIT, __VA_ARGS__})
+
+PackWrite *pckWriteVar(PackWrite *this, const Variant *value, PackIdParam param);
+
 // Write end
 #define pckWriteEndP(this)                                                                                                         \
     pckWriteEnd(this)
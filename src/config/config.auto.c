@@ -260,10 +260,15 @@ Option constants
 STRING_EXTERN(CFGOPT_ARCHIVE_ASYNC_STR,                             CFGOPT_ARCHIVE_ASYNC);
 STRING_EXTERN(CFGOPT_ARCHIVE_CHECK_STR,                             CFGOPT_ARCHIVE_CHECK);
 STRING_EXTERN(CFGOPT_ARCHIVE_COPY_STR,                              CFGOPT_ARCHIVE_COPY);
+STRING_EXTERN(CFGOPT_ARCHIVE_GET_CACHE_TTL_STR,                     CFGOPT_ARCHIVE_GET_CACHE_TTL);
+STRING_EXTERN(CFGOPT_ARCHIVE_GET_QUEUE_ADAPTIVE_STR,                CFGOPT_ARCHIVE_GET_QUEUE_ADAPTIVE);
 STRING_EXTERN(CFGOPT_ARCHIVE_GET_QUEUE_MAX_STR,                     CFGOPT_ARCHIVE_GET_QUEUE_MAX);
 STRING_EXTERN(CFGOPT_ARCHIVE_HEADER_CHECK_STR,                      CFGOPT_ARCHIVE_HEADER_CHECK);
 STRING_EXTERN(CFGOPT_ARCHIVE_MODE_STR,                              CFGOPT_ARCHIVE_MODE);
 STRING_EXTERN(CFGOPT_ARCHIVE_MODE_CHECK_STR,                        CFGOPT_ARCHIVE_MODE_CHECK);
+STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_BUNDLE_MAX_STR,                   CFGOPT_ARCHIVE_PUSH_BUNDLE_MAX);
+STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_DEFER_MAX_STR,                    CFGOPT_ARCHIVE_PUSH_DEFER_MAX);
+STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_LINGER_STR,                       CFGOPT_ARCHIVE_PUSH_LINGER);
 STRING_EXTERN(CFGOPT_ARCHIVE_PUSH_QUEUE_MAX_STR,                    CFGOPT_ARCHIVE_PUSH_QUEUE_MAX);
 STRING_EXTERN(CFGOPT_ARCHIVE_TIMEOUT_STR,                           CFGOPT_ARCHIVE_TIMEOUT);
 STRING_EXTERN(CFGOPT_BACKUP_STANDBY_STR,                            CFGOPT_BACKUP_STANDBY);
@@ -275,12 +280,15 @@ STRING_EXTERN(CFGOPT_COMPRESS_STR,                                  CFGOPT_COMPR
 STRING_EXTERN(CFGOPT_COMPRESS_LEVEL_STR,                            CFGOPT_COMPRESS_LEVEL);
 STRING_EXTERN(CFGOPT_COMPRESS_LEVEL_NETWORK_STR,                    CFGOPT_COMPRESS_LEVEL_NETWORK);
 STRING_EXTERN(CFGOPT_COMPRESS_TYPE_STR,                             CFGOPT_COMPRESS_TYPE);
+STRING_EXTERN(CFGOPT_COMPRESS_ZST_LONG_STR,                         CFGOPT_COMPRESS_ZST_LONG);
+STRING_EXTERN(CFGOPT_COMPRESS_ZST_WORKER_STR,                       CFGOPT_COMPRESS_ZST_WORKER);
 STRING_EXTERN(CFGOPT_CONFIG_STR,                                    CFGOPT_CONFIG);
 STRING_EXTERN(CFGOPT_CONFIG_INCLUDE_PATH_STR,                       CFGOPT_CONFIG_INCLUDE_PATH);
 STRING_EXTERN(CFGOPT_CONFIG_PATH_STR,                               CFGOPT_CONFIG_PATH);
 STRING_EXTERN(CFGOPT_DB_INCLUDE_STR,                                CFGOPT_DB_INCLUDE);
 STRING_EXTERN(CFGOPT_DB_TIMEOUT_STR,                                CFGOPT_DB_TIMEOUT);
 STRING_EXTERN(CFGOPT_DELTA_STR,                                     CFGOPT_DELTA);
+STRING_EXTERN(CFGOPT_DELTA_BLOCK_STR,                               CFGOPT_DELTA_BLOCK);
 STRING_EXTERN(CFGOPT_DRY_RUN_STR,                                   CFGOPT_DRY_RUN);
 STRING_EXTERN(CFGOPT_EXCLUDE_STR,                                   CFGOPT_EXCLUDE);
 STRING_EXTERN(CFGOPT_EXEC_ID_STR,                                   CFGOPT_EXEC_ID);
@@ -289,6 +297,8 @@ STRING_EXTERN(CFGOPT_FILTER_STR,                                    CFGOPT_FILTE
 STRING_EXTERN(CFGOPT_FORCE_STR,                                     CFGOPT_FORCE);
 STRING_EXTERN(CFGOPT_IGNORE_MISSING_STR,                            CFGOPT_IGNORE_MISSING);
 STRING_EXTERN(CFGOPT_IO_TIMEOUT_STR,                                CFGOPT_IO_TIMEOUT);
+STRING_EXTERN(CFGOPT_IO_URING_STR,                                  CFGOPT_IO_URING);
+STRING_EXTERN(CFGOPT_JOB_QUEUE_MAX_STR,                             CFGOPT_JOB_QUEUE_MAX);
 STRING_EXTERN(CFGOPT_JOB_RETRY_STR,                                 CFGOPT_JOB_RETRY);
 STRING_EXTERN(CFGOPT_JOB_RETRY_INTERVAL_STR,                        CFGOPT_JOB_RETRY_INTERVAL);
 STRING_EXTERN(CFGOPT_LINK_ALL_STR,                                  CFGOPT_LINK_ALL);
@@ -309,6 +319,8 @@ STRING_EXTERN(CFGOPT_PROCESS_STR,                                   CFGOPT_PROCE
 STRING_EXTERN(CFGOPT_PROCESS_MAX_STR,                               CFGOPT_PROCESS_MAX);
 STRING_EXTERN(CFGOPT_PROTOCOL_TIMEOUT_STR,                          CFGOPT_PROTOCOL_TIMEOUT);
 STRING_EXTERN(CFGOPT_RAW_STR,                                       CFGOPT_RAW);
+STRING_EXTERN(CFGOPT_READ_ADVISE_STR,                               CFGOPT_READ_ADVISE);
+STRING_EXTERN(CFGOPT_READ_PIPELINE_STR,                             CFGOPT_READ_PIPELINE);
 STRING_EXTERN(CFGOPT_RECOVERY_OPTION_STR,                           CFGOPT_RECOVERY_OPTION);
 STRING_EXTERN(CFGOPT_RECURSE_STR,                                   CFGOPT_RECURSE);
 STRING_EXTERN(CFGOPT_REMOTE_TYPE_STR,                               CFGOPT_REMOTE_TYPE);
@@ -318,6 +330,7 @@ STRING_EXTERN(CFGOPT_SCK_BLOCK_STR,                                 CFGOPT_SCK_B
 STRING_EXTERN(CFGOPT_SCK_KEEP_ALIVE_STR,                            CFGOPT_SCK_KEEP_ALIVE);
 STRING_EXTERN(CFGOPT_SET_STR,                                       CFGOPT_SET);
 STRING_EXTERN(CFGOPT_SORT_STR,                                      CFGOPT_SORT);
+STRING_EXTERN(CFGOPT_SPLIT_SIZE_STR,                                CFGOPT_SPLIT_SIZE);
 STRING_EXTERN(CFGOPT_SPOOL_PATH_STR,                                CFGOPT_SPOOL_PATH);
 STRING_EXTERN(CFGOPT_STANZA_STR,                                    CFGOPT_STANZA);
 STRING_EXTERN(CFGOPT_START_FAST_STR,                                CFGOPT_START_FAST);
@@ -332,3 +345,4 @@ STRING_EXTERN(CFGOPT_TCP_KEEP_ALIVE_COUNT_STR,                      CFGOPT_TCP_K
 STRING_EXTERN(CFGOPT_TCP_KEEP_ALIVE_IDLE_STR,                       CFGOPT_TCP_KEEP_ALIVE_IDLE);
 STRING_EXTERN(CFGOPT_TCP_KEEP_ALIVE_INTERVAL_STR,                   CFGOPT_TCP_KEEP_ALIVE_INTERVAL);
 STRING_EXTERN(CFGOPT_TYPE_STR,                                      CFGOPT_TYPE);
+STRING_EXTERN(CFGOPT_WRITE_FLUSH_STR,                               CFGOPT_WRITE_FLUSH);
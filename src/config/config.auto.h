@@ -66,6 +66,10 @@ Option constants
     STRING_DECLARE(CFGOPT_ARCHIVE_CHECK_STR);
 #define CFGOPT_ARCHIVE_COPY                                         "archive-copy"
     STRING_DECLARE(CFGOPT_ARCHIVE_COPY_STR);
+#define CFGOPT_ARCHIVE_GET_CACHE_TTL                                "archive-get-cache-ttl"
+    STRING_DECLARE(CFGOPT_ARCHIVE_GET_CACHE_TTL_STR);
+#define CFGOPT_ARCHIVE_GET_QUEUE_ADAPTIVE                           "archive-get-queue-adaptive"
+    STRING_DECLARE(CFGOPT_ARCHIVE_GET_QUEUE_ADAPTIVE_STR);
 #define CFGOPT_ARCHIVE_GET_QUEUE_MAX                                "archive-get-queue-max"
     STRING_DECLARE(CFGOPT_ARCHIVE_GET_QUEUE_MAX_STR);
 #define CFGOPT_ARCHIVE_HEADER_CHECK                                 "archive-header-check"
@@ -74,6 +78,12 @@ Option constants
     STRING_DECLARE(CFGOPT_ARCHIVE_MODE_STR);
 #define CFGOPT_ARCHIVE_MODE_CHECK                                   "archive-mode-check"
     STRING_DECLARE(CFGOPT_ARCHIVE_MODE_CHECK_STR);
+#define CFGOPT_ARCHIVE_PUSH_BUNDLE_MAX                              "archive-push-bundle-max"
+    STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_BUNDLE_MAX_STR);
+#define CFGOPT_ARCHIVE_PUSH_DEFER_MAX                               "archive-push-defer-max"
+    STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_DEFER_MAX_STR);
+#define CFGOPT_ARCHIVE_PUSH_LINGER                                  "archive-push-linger"
+    STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_LINGER_STR);
 #define CFGOPT_ARCHIVE_PUSH_QUEUE_MAX                               "archive-push-queue-max"
     STRING_DECLARE(CFGOPT_ARCHIVE_PUSH_QUEUE_MAX_STR);
 #define CFGOPT_ARCHIVE_TIMEOUT                                      "archive-timeout"
@@ -96,6 +106,10 @@ Option constants
     STRING_DECLARE(CFGOPT_COMPRESS_LEVEL_NETWORK_STR);
 #define CFGOPT_COMPRESS_TYPE                                        "compress-type"
     STRING_DECLARE(CFGOPT_COMPRESS_TYPE_STR);
+#define CFGOPT_COMPRESS_ZST_LONG                                    "compress-zst-long"
+    STRING_DECLARE(CFGOPT_COMPRESS_ZST_LONG_STR);
+#define CFGOPT_COMPRESS_ZST_WORKER                                  "compress-zst-worker"
+    STRING_DECLARE(CFGOPT_COMPRESS_ZST_WORKER_STR);
 #define CFGOPT_CONFIG                                               "config"
     STRING_DECLARE(CFGOPT_CONFIG_STR);
 #define CFGOPT_CONFIG_INCLUDE_PATH                                  "config-include-path"
@@ -108,6 +122,8 @@ Option constants
     STRING_DECLARE(CFGOPT_DB_TIMEOUT_STR);
 #define CFGOPT_DELTA                                                "delta"
     STRING_DECLARE(CFGOPT_DELTA_STR);
+#define CFGOPT_DELTA_BLOCK                                          "delta-block"
+    STRING_DECLARE(CFGOPT_DELTA_BLOCK_STR);
 #define CFGOPT_DRY_RUN                                              "dry-run"
     STRING_DECLARE(CFGOPT_DRY_RUN_STR);
 #define CFGOPT_EXCLUDE                                              "exclude"
@@ -124,6 +140,10 @@ Option constants
     STRING_DECLARE(CFGOPT_IGNORE_MISSING_STR);
 #define CFGOPT_IO_TIMEOUT                                           "io-timeout"
     STRING_DECLARE(CFGOPT_IO_TIMEOUT_STR);
+#define CFGOPT_IO_URING                                             "io-uring"
+    STRING_DECLARE(CFGOPT_IO_URING_STR);
+#define CFGOPT_JOB_QUEUE_MAX                                        "job-queue-max"
+    STRING_DECLARE(CFGOPT_JOB_QUEUE_MAX_STR);
 #define CFGOPT_JOB_RETRY                                            "job-retry"
     STRING_DECLARE(CFGOPT_JOB_RETRY_STR);
 #define CFGOPT_JOB_RETRY_INTERVAL                                   "job-retry-interval"
@@ -164,6 +184,10 @@ Option constants
     STRING_DECLARE(CFGOPT_PROTOCOL_TIMEOUT_STR);
 #define CFGOPT_RAW                                                  "raw"
     STRING_DECLARE(CFGOPT_RAW_STR);
+#define CFGOPT_READ_ADVISE                                          "read-advise"
+    STRING_DECLARE(CFGOPT_READ_ADVISE_STR);
+#define CFGOPT_READ_PIPELINE                                        "read-pipeline"
+    STRING_DECLARE(CFGOPT_READ_PIPELINE_STR);
 #define CFGOPT_RECOVERY_OPTION                                      "recovery-option"
     STRING_DECLARE(CFGOPT_RECOVERY_OPTION_STR);
 #define CFGOPT_RECURSE                                              "recurse"
@@ -182,6 +206,8 @@ Option constants
     STRING_DECLARE(CFGOPT_SET_STR);
 #define CFGOPT_SORT                                                 "sort"
     STRING_DECLARE(CFGOPT_SORT_STR);
+#define CFGOPT_SPLIT_SIZE                                           "split-size"
+    STRING_DECLARE(CFGOPT_SPLIT_SIZE_STR);
 #define CFGOPT_SPOOL_PATH                                           "spool-path"
     STRING_DECLARE(CFGOPT_SPOOL_PATH_STR);
 #define CFGOPT_STANZA                                               "stanza"
@@ -210,8 +236,10 @@ Option constants
     STRING_DECLARE(CFGOPT_TCP_KEEP_ALIVE_INTERVAL_STR);
 #define CFGOPT_TYPE                                                 "type"
     STRING_DECLARE(CFGOPT_TYPE_STR);
+#define CFGOPT_WRITE_FLUSH                                          "write-flush"
+    STRING_DECLARE(CFGOPT_WRITE_FLUSH_STR);
 
-#define CFG_OPTION_TOTAL                                            129
+#define CFG_OPTION_TOTAL                                            148
 
 /***********************************************************************************************************************************
 Command enum
@@ -258,10 +286,15 @@ typedef enum
     cfgOptArchiveAsync,
     cfgOptArchiveCheck,
     cfgOptArchiveCopy,
+    cfgOptArchiveGetCacheTtl,
+    cfgOptArchiveGetQueueAdaptive,
     cfgOptArchiveGetQueueMax,
     cfgOptArchiveHeaderCheck,
     cfgOptArchiveMode,
     cfgOptArchiveModeCheck,
+    cfgOptArchivePushBundleMax,
+    cfgOptArchivePushDeferMax,
+    cfgOptArchivePushLinger,
     cfgOptArchivePushQueueMax,
     cfgOptArchiveTimeout,
     cfgOptBackupStandby,
@@ -273,12 +306,15 @@ typedef enum
     cfgOptCompressLevel,
     cfgOptCompressLevelNetwork,
     cfgOptCompressType,
+    cfgOptCompressZstLong,
+    cfgOptCompressZstWorker,
     cfgOptConfig,
     cfgOptConfigIncludePath,
     cfgOptConfigPath,
     cfgOptDbInclude,
     cfgOptDbTimeout,
     cfgOptDelta,
+    cfgOptDeltaBlock,
     cfgOptDryRun,
     cfgOptExclude,
     cfgOptExecId,
@@ -287,6 +323,8 @@ typedef enum
     cfgOptForce,
     cfgOptIgnoreMissing,
     cfgOptIoTimeout,
+    cfgOptIoUring,
+    cfgOptJobQueueMax,
     cfgOptJobRetry,
     cfgOptJobRetryInterval,
     cfgOptLinkAll,
@@ -320,15 +358,20 @@ typedef enum
     cfgOptProcessMax,
     cfgOptProtocolTimeout,
     cfgOptRaw,
+    cfgOptReadAdvise,
+    cfgOptReadPipeline,
     cfgOptRecoveryOption,
     cfgOptRecurse,
     cfgOptRemoteType,
     cfgOptRepo,
+    cfgOptRepoArchivePushDefer,
     cfgOptRepoAzureAccount,
     cfgOptRepoAzureContainer,
     cfgOptRepoAzureEndpoint,
     cfgOptRepoAzureKey,
     cfgOptRepoAzureKeyType,
+    cfgOptRepoBlock,
+    cfgOptRepoBlockSize,
     cfgOptRepoCipherPass,
     cfgOptRepoCipherType,
     cfgOptRepoGcsBucket,
@@ -358,11 +401,13 @@ typedef enum
     cfgOptRepoS3Region,
     cfgOptRepoS3Role,
     cfgOptRepoS3Token,
+    cfgOptRepoS3UploadConcurrency,
     cfgOptRepoS3UriStyle,
     cfgOptRepoStorageCaFile,
     cfgOptRepoStorageCaPath,
     cfgOptRepoStorageHost,
     cfgOptRepoStoragePort,
+    cfgOptRepoStorageReadConcurrency,
     cfgOptRepoStorageVerifyTls,
     cfgOptRepoType,
     cfgOptResume,
@@ -370,6 +415,7 @@ typedef enum
     cfgOptSckKeepAlive,
     cfgOptSet,
     cfgOptSort,
+    cfgOptSplitSize,
     cfgOptSpoolPath,
     cfgOptStanza,
     cfgOptStartFast,
@@ -384,6 +430,7 @@ typedef enum
     cfgOptTcpKeepAliveIdle,
     cfgOptTcpKeepAliveInterval,
     cfgOptType,
+    cfgOptWriteFlush,
 } ConfigOption;
 
 #endif
@@ -405,6 +405,10 @@ cfgLoad(unsigned int argListSize, const char *argList[])
             if (cfgOptionValid(cfgOptIoTimeout))
                 ioTimeoutMsSet(cfgOptionUInt64(cfgOptIoTimeout));
 
+            // Set zst compression workers and long distance matching
+            if (cfgOptionValid(cfgOptCompressZstWorker))
+                compressZstSet(cfgOptionUInt(cfgOptCompressZstWorker), cfgOptionBool(cfgOptCompressZstLong));
+
             // Open the log file if this command logs to a file
             cfgLoadLogFile();
 
@@ -67,12 +67,20 @@ STRING_STATIC(MANIFEST_SECTION_TARGET_PATH_DEFAULT_STR,             "target:path
     STRING_STATIC(MANIFEST_KEY_BACKUP_TIMESTAMP_STOP_STR,           MANIFEST_KEY_BACKUP_TIMESTAMP_STOP);
 #define MANIFEST_KEY_BACKUP_TYPE                                    "backup-type"
     STRING_STATIC(MANIFEST_KEY_BACKUP_TYPE_STR,                     MANIFEST_KEY_BACKUP_TYPE);
+#define MANIFEST_KEY_BLOCK_INCR_MAP_SIZE                            "block-incr-map-size"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_BLOCK_INCR_MAP_SIZE_VAR,     MANIFEST_KEY_BLOCK_INCR_MAP_SIZE);
+#define MANIFEST_KEY_BLOCK_INCR_SIZE                                "block-incr-size"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_BLOCK_INCR_SIZE_VAR,         MANIFEST_KEY_BLOCK_INCR_SIZE);
 #define MANIFEST_KEY_CHECKSUM                                       "checksum"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_VAR,                MANIFEST_KEY_CHECKSUM);
 #define MANIFEST_KEY_CHECKSUM_PAGE                                  "checksum-page"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_PAGE_VAR,           MANIFEST_KEY_CHECKSUM_PAGE);
 #define MANIFEST_KEY_CHECKSUM_PAGE_ERROR                            "checksum-page-error"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_PAGE_ERROR_VAR,     MANIFEST_KEY_CHECKSUM_PAGE_ERROR);
+#define MANIFEST_KEY_CHECKSUM_RANGE                                 "checksum-range"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_RANGE_VAR,          MANIFEST_KEY_CHECKSUM_RANGE);
+#define MANIFEST_KEY_CHECKSUM_RANGE_SIZE                            "checksum-range-size"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_RANGE_SIZE_VAR,     MANIFEST_KEY_CHECKSUM_RANGE_SIZE);
 #define MANIFEST_KEY_DB_CATALOG_VERSION                             "db-catalog-version"
     STRING_STATIC(MANIFEST_KEY_DB_CATALOG_VERSION_STR,              MANIFEST_KEY_DB_CATALOG_VERSION);
 #define MANIFEST_KEY_DB_ID                                          "db-id"
@@ -218,9 +226,13 @@ manifestFileAdd(Manifest *this, const ManifestFile *file)
     {
         ManifestFile fileAdd =
         {
+            .blockIncrMapSize = file->blockIncrMapSize,
+            .blockIncrSize = file->blockIncrSize,
             .checksumPage = file->checksumPage,
             .checksumPageError = file->checksumPageError,
             .checksumPageErrorList = varLstDup(file->checksumPageErrorList),
+            .checksumRange = strDup(file->checksumRange),
+            .checksumRangeSize = file->checksumRangeSize,
             .group = manifestOwnerCache(this, file->group),
             .mode = file->mode,
             .name = strDup(file->name),
@@ -1210,7 +1222,8 @@ manifestBuildIncr(Manifest *this, const Manifest *manifestPrior, BackupType type
                 manifestFileUpdate(
                     this, file->name, file->size, filePrior->sizeRepo, filePrior->checksumSha1,
                     VARSTR(filePrior->reference != NULL ? filePrior->reference : manifestPrior->pub.data.backupLabel),
-                    filePrior->checksumPage, filePrior->checksumPageError, filePrior->checksumPageErrorList);
+                    filePrior->checksumPage, filePrior->checksumPageError, filePrior->checksumPageErrorList,
+                    filePrior->blockIncrSize, filePrior->blockIncrMapSize, filePrior->checksumRangeSize, filePrior->checksumRange);
             }
         }
     }
@@ -1425,6 +1438,13 @@ manifestLoadCallback(void *callbackData, const String *section, const String *ke
             // the repo-size is only stored in the manifest file if it is different than size.
             file.sizeRepo = varUInt64(kvGetDefault(fileKv, MANIFEST_KEY_SIZE_REPO_VAR, VARUINT64(file.size)));
 
+            // Block incremental info is only present when the file was stored with block incremental
+            if (kvKeyExists(fileKv, MANIFEST_KEY_BLOCK_INCR_SIZE_VAR))
+            {
+                file.blockIncrSize = varUInt64(kvGet(fileKv, MANIFEST_KEY_BLOCK_INCR_SIZE_VAR));
+                file.blockIncrMapSize = varUInt64(kvGet(fileKv, MANIFEST_KEY_BLOCK_INCR_MAP_SIZE_VAR));
+            }
+
             // If file size is zero then assign the static zero hash
             if (file.size == 0)
             {
@@ -1448,6 +1468,13 @@ manifestLoadCallback(void *callbackData, const String *section, const String *ke
                     file.checksumPageErrorList = varVarLst(checksumPageErrorList);
             }
 
+            // Range checksums are only present when the file was large enough to be split into ranges
+            if (kvKeyExists(fileKv, MANIFEST_KEY_CHECKSUM_RANGE_VAR))
+            {
+                file.checksumRange = varStr(kvGet(fileKv, MANIFEST_KEY_CHECKSUM_RANGE_VAR));
+                file.checksumRangeSize = varUInt64(kvGet(fileKv, MANIFEST_KEY_CHECKSUM_RANGE_SIZE_VAR));
+            }
+
             if (kvKeyExists(fileKv, MANIFEST_KEY_GROUP_VAR))
             {
                 valueFound.group = true;
@@ -2086,6 +2113,12 @@ manifestSaveCallback(void *callbackData, const String *sectionNext, InfoSave *in
                 const ManifestFile *file = manifestFile(manifest, fileIdx);
                 KeyValue *fileKv = kvNew();
 
+                if (file->blockIncrSize != 0)
+                {
+                    kvPut(fileKv, MANIFEST_KEY_BLOCK_INCR_MAP_SIZE_VAR, varNewUInt64(file->blockIncrMapSize));
+                    kvPut(fileKv, MANIFEST_KEY_BLOCK_INCR_SIZE_VAR, varNewUInt64(file->blockIncrSize));
+                }
+
                 // Save if the file size is not zero and the checksum exists.  The checksum might not exist if this is a partial
                 // save performed during a backup.
                 if (file->size != 0 && file->checksumSha1[0] != 0)
@@ -2099,6 +2132,12 @@ manifestSaveCallback(void *callbackData, const String *sectionNext, InfoSave *in
                         kvPut(fileKv, MANIFEST_KEY_CHECKSUM_PAGE_ERROR_VAR, varNewVarLst(file->checksumPageErrorList));
                 }
 
+                if (file->checksumRange != NULL)
+                {
+                    kvPut(fileKv, MANIFEST_KEY_CHECKSUM_RANGE_VAR, VARSTR(file->checksumRange));
+                    kvPut(fileKv, MANIFEST_KEY_CHECKSUM_RANGE_SIZE_VAR, varNewUInt64(file->checksumRangeSize));
+                }
+
                 if (!varEq(manifestOwnerVar(file->group), saveData->fileGroupDefault))
                     kvPut(fileKv, MANIFEST_KEY_GROUP_VAR, manifestOwnerVar(file->group));
 
@@ -2493,7 +2532,8 @@ manifestFileRemove(const Manifest *this, const String *name)
 void
 manifestFileUpdate(
     Manifest *this, const String *name, uint64_t size, uint64_t sizeRepo, const char *checksumSha1, const Variant *reference,
-    bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList)
+    bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList, uint64_t blockIncrSize,
+    uint64_t blockIncrMapSize, uint64_t checksumRangeSize, const String *checksumRange)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(MANIFEST, this);
@@ -2505,6 +2545,10 @@ manifestFileUpdate(
         FUNCTION_TEST_PARAM(BOOL, checksumPage);
         FUNCTION_TEST_PARAM(BOOL, checksumPageError);
         FUNCTION_TEST_PARAM(VARIANT_LIST, checksumPageErrorList);
+        FUNCTION_TEST_PARAM(UINT64, blockIncrSize);
+        FUNCTION_TEST_PARAM(UINT64, blockIncrMapSize);
+        FUNCTION_TEST_PARAM(UINT64, checksumRangeSize);
+        FUNCTION_TEST_PARAM(STRING, checksumRange);
     FUNCTION_TEST_END();
 
     ASSERT(this != NULL);
@@ -2512,6 +2556,8 @@ manifestFileUpdate(
     ASSERT(
         (!checksumPage && !checksumPageError && checksumPageErrorList == NULL) ||
         (checksumPage && !checksumPageError && checksumPageErrorList == NULL) || (checksumPage && checksumPageError));
+    ASSERT(blockIncrSize != 0 || blockIncrMapSize == 0);
+    ASSERT((checksumRangeSize == 0) == (checksumRange == NULL));
 
     ManifestFile *file = (ManifestFile *)manifestFileFind(this, name);
 
@@ -2538,6 +2584,14 @@ manifestFileUpdate(
         file->checksumPage = checksumPage;
         file->checksumPageError = checksumPageError;
         file->checksumPageErrorList = varLstDup(checksumPageErrorList);
+
+        // Update block incremental info
+        file->blockIncrSize = blockIncrSize;
+        file->blockIncrMapSize = blockIncrMapSize;
+
+        // Update range checksums
+        file->checksumRangeSize = checksumRangeSize;
+        file->checksumRange = strDup(checksumRange);
     }
     MEM_CONTEXT_END();
 
@@ -103,6 +103,10 @@ typedef struct ManifestFile
     const String *reference;                                        // Reference to a prior backup
     uint64_t size;                                                  // Original size
     uint64_t sizeRepo;                                              // Size in repo
+    uint64_t blockIncrSize;                                         // Block size when block incremental (0 if not block incremental)
+    uint64_t blockIncrMapSize;                                      // Size of block map at the end of the file in the repo
+    uint64_t checksumRangeSize;                                     // Size of ranges with a checksum (0 if no range checksums)
+    const String *checksumRange;                                    // SHA1 checksum of each range concatenated
     time_t timestamp;                                               // Original timestamp
 } ManifestFile;
 
@@ -287,7 +291,8 @@ manifestFileTotal(const Manifest *const this)
 // Update a file with new data
 void manifestFileUpdate(
     Manifest *this, const String *name, uint64_t size, uint64_t sizeRepo, const char *checksumSha1, const Variant *reference,
-    bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList);
+    bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList, uint64_t blockIncrSize,
+    uint64_t blockIncrMapSize, uint64_t checksumRangeSize, const String *checksumRange);
 
 /***********************************************************************************************************************************
 Link functions and getters/setters
@@ -5,6 +5,10 @@ PostgreSQL Page Interface
 
 #include <string.h>
 
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
 #include "postgres/interface/static.vendor.h"
 
 /***********************************************************************************************************************************
@@ -12,9 +16,110 @@ Include the page checksum code
 ***********************************************************************************************************************************/
 #include "postgres/interface/pageChecksum.vendor.c"
 
+/***********************************************************************************************************************************
+AVX2 page checksum
+
+The vendor code is written so the compiler can vectorize the inner loop but the baseline x86-64 target only allows 128-bit SSE2
+registers and SSE2 has no 32-bit multiply, so the loop ends up mostly scalar. AVX2 provides a 32-bit multiply and holds all 32
+partial checksums in four 256-bit registers. The algorithm is identical to pg_checksum_block() and pg_checksum_page() so the result
+is the same on every platform.
+***********************************************************************************************************************************/
+#if defined(__x86_64__)
+
+// Apply CHECKSUM_COMP() to eight partial checksums at once
+#define CHECKSUM_COMP_AVX2(checksum, value)                                                                                        \
+do {                                                                                                                               \
+    const __m256i tmp = _mm256_xor_si256(checksum, value);                                                                         \
+    checksum = _mm256_xor_si256(_mm256_mullo_epi32(tmp, _mm256_set1_epi32(FNV_PRIME)), _mm256_srli_epi32(tmp, 17));                \
+} while (0)
+
+__attribute__((target("avx2"))) static uint32_t
+pgPageChecksumBlockAvx2(const PGChecksummablePage *const page)
+{
+    // Initialize partial checksums to their corresponding offsets
+    __m256i sums0 = _mm256_loadu_si256((const __m256i *)(checksumBaseOffsets + 0));
+    __m256i sums1 = _mm256_loadu_si256((const __m256i *)(checksumBaseOffsets + 8));
+    __m256i sums2 = _mm256_loadu_si256((const __m256i *)(checksumBaseOffsets + 16));
+    __m256i sums3 = _mm256_loadu_si256((const __m256i *)(checksumBaseOffsets + 24));
+
+    // Main checksum calculation
+    for (unsigned int rowIdx = 0; rowIdx < BLCKSZ / (sizeof(uint32) * N_SUMS); rowIdx++)
+    {
+        const uint32 *const row = page->data[rowIdx];
+
+        CHECKSUM_COMP_AVX2(sums0, _mm256_loadu_si256((const __m256i *)(row + 0)));
+        CHECKSUM_COMP_AVX2(sums1, _mm256_loadu_si256((const __m256i *)(row + 8)));
+        CHECKSUM_COMP_AVX2(sums2, _mm256_loadu_si256((const __m256i *)(row + 16)));
+        CHECKSUM_COMP_AVX2(sums3, _mm256_loadu_si256((const __m256i *)(row + 24)));
+    }
+
+    // Add in two rounds of zeroes for additional mixing
+    const __m256i zero = _mm256_setzero_si256();
+
+    for (unsigned int roundIdx = 0; roundIdx < 2; roundIdx++)
+    {
+        CHECKSUM_COMP_AVX2(sums0, zero);
+        CHECKSUM_COMP_AVX2(sums1, zero);
+        CHECKSUM_COMP_AVX2(sums2, zero);
+        CHECKSUM_COMP_AVX2(sums3, zero);
+    }
+
+    // Xor fold partial checksums together
+    const __m256i fold256 = _mm256_xor_si256(_mm256_xor_si256(sums0, sums1), _mm256_xor_si256(sums2, sums3));
+    __m128i fold128 = _mm_xor_si128(_mm256_castsi256_si128(fold256), _mm256_extracti128_si256(fold256, 1));
+    fold128 = _mm_xor_si128(fold128, _mm_shuffle_epi32(fold128, _MM_SHUFFLE(1, 0, 3, 2)));
+    fold128 = _mm_xor_si128(fold128, _mm_shuffle_epi32(fold128, _MM_SHUFFLE(2, 3, 0, 1)));
+
+    return (uint32)_mm_cvtsi128_si32(fold128);
+}
+
+static uint16_t
+pgPageChecksumAvx2(unsigned char *const page, const uint32_t blockNo)
+{
+    PGChecksummablePage *const cpage = (PGChecksummablePage *)page;
+
+    // Zero pd_checksum during the calculation and restore it afterwards, the same as pg_checksum_page()
+    const uint16 checksumSave = cpage->phdr.pd_checksum;
+    cpage->phdr.pd_checksum = 0;
+    uint32 checksum = pgPageChecksumBlockAvx2(cpage);
+    cpage->phdr.pd_checksum = checksumSave;
+
+    // Mix in the block number and reduce to a uint16 with an offset of one
+    checksum ^= blockNo;
+
+    return (uint16_t)((checksum % 65535) + 1);
+}
+
+#endif
+
 /**********************************************************************************************************************************/
+// Select the fastest implementation supported by the CPU the first time a checksum is calculated
+static uint16_t pgPageChecksumPortable(unsigned char *page, uint32_t blockNo);
+static uint16_t pgPageChecksumInit(unsigned char *page, uint32_t blockNo);
+
+static uint16_t (*pgPageChecksumImpl)(unsigned char *page, uint32_t blockNo) = pgPageChecksumInit;
+
+static uint16_t
+pgPageChecksumPortable(unsigned char *const page, const uint32_t blockNo)
+{
+    return pg_checksum_page((char *)page, blockNo);
+}
+
+static uint16_t
+pgPageChecksumInit(unsigned char *const page, const uint32_t blockNo)
+{
+#if defined(__x86_64__)
+    pgPageChecksumImpl =
+        __builtin_cpu_supports("avx2") ? pgPageChecksumAvx2 : pgPageChecksumPortable;   // {uncovered_branch - CPU varies}
+#else
+    pgPageChecksumImpl = pgPageChecksumPortable;
+#endif
+
+    return pgPageChecksumImpl(page, blockNo);
+}
+
 uint16_t
 pgPageChecksum(unsigned char *page, uint32_t blockNo)
 {
-    return pg_checksum_page((char *)page, blockNo);
+    return pgPageChecksumImpl(page, blockNo);
 }
@@ -9,6 +9,7 @@ Protocol Client
 #include "common/time.h"
 #include "common/type/json.h"
 #include "common/type/keyValue.h"
+#include "common/type/pack.h"
 #include "protocol/client.h"
 #include "version.h"
 
@@ -18,6 +19,10 @@ Constants
 STRING_EXTERN(PROTOCOL_GREETING_NAME_STR,                           PROTOCOL_GREETING_NAME);
 STRING_EXTERN(PROTOCOL_GREETING_SERVICE_STR,                        PROTOCOL_GREETING_SERVICE);
 STRING_EXTERN(PROTOCOL_GREETING_VERSION_STR,                        PROTOCOL_GREETING_VERSION);
+STRING_EXTERN(PROTOCOL_GREETING_FORMAT_STR,                         PROTOCOL_GREETING_FORMAT);
+STRING_EXTERN(PROTOCOL_FORMAT_PACK_STR,                             PROTOCOL_FORMAT_PACK);
+
+BUFFER_STRDEF_EXTERN(PROTOCOL_MESSAGE_PACK_BUF,                     "\x01");
 
 STRING_EXTERN(PROTOCOL_COMMAND_NOOP_STR,                            PROTOCOL_COMMAND_NOOP);
 STRING_EXTERN(PROTOCOL_COMMAND_EXIT_STR,                            PROTOCOL_COMMAND_EXIT);
@@ -36,6 +41,8 @@ struct ProtocolClient
     const String *name;
     const String *errorPrefix;
     TimeMSec keepAliveTime;
+    bool pack;                                                      // Use pack format for commands and responses?
+    PackRead *packRead;                                             // Pack read reused for each response
 };
 
 /***********************************************************************************************************************************
@@ -131,6 +138,10 @@ protocolClientNew(const String *name, const String *service, IoRead *read, IoWri
                         strZ(expectedValue), strZ(expectedKey), strZ(varStr(actualValue)));
                 }
             }
+
+            // Use the pack format if the server supports it, else fall back to JSON
+            const Variant *format = kvGet(greetingKv, VARSTR(PROTOCOL_GREETING_FORMAT_STR));
+            this->pack = format != NULL && varType(format) == varTypeString && strEq(varStr(format), PROTOCOL_FORMAT_PACK_STR);
         }
         MEM_CONTEXT_TEMP_END();
 
@@ -146,7 +157,41 @@ protocolClientNew(const String *name, const String *service, IoRead *read, IoWri
 }
 
 /**********************************************************************************************************************************/
-// Helper to process errors
+// Helper to process errors. A code of 0 indicates that no error occurred.
+static void
+protocolClientError(ProtocolClient *this, int code, const String *message, const String *stack)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_CLIENT, this);
+        FUNCTION_LOG_PARAM(INT, code);
+        FUNCTION_LOG_PARAM(STRING, message);
+        FUNCTION_LOG_PARAM(STRING, stack);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    if (code != 0)
+    {
+        const ErrorType *type = errorTypeFromCode(code);
+
+        // Required part of the message
+        String *throwMessage = strNewFmt(
+            "%s: %s", strZ(this->errorPrefix), message == NULL ? "no details available" : strZ(message));
+
+        // Add stack trace if the error is an assertion or debug-level logging is enabled
+        if (type == &AssertError || logAny(logLevelDebug))
+        {
+            strCat(throwMessage, LF_STR);
+            strCat(throwMessage, stack == NULL ? STRDEF("no stack trace available") : stack);
+        }
+
+        THROWP(type, strZ(throwMessage));
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Helper to process JSON errors
 static void
 protocolClientProcessError(ProtocolClient *this, KeyValue *errorKv)
 {
@@ -158,35 +203,85 @@ protocolClientProcessError(ProtocolClient *this, KeyValue *errorKv)
     ASSERT(this != NULL);
     ASSERT(errorKv != NULL);
 
-    MEM_CONTEXT_TEMP_BEGIN()
+    // Process error if any
+    const Variant *error = kvGet(errorKv, VARSTR(PROTOCOL_ERROR_STR));
+
+    if (error != NULL)
     {
-        // Process error if any
-        const Variant *error = kvGet(errorKv, VARSTR(PROTOCOL_ERROR_STR));
+        protocolClientError(
+            this, varIntForce(error), varStr(kvGet(errorKv, VARSTR(PROTOCOL_OUTPUT_STR))),
+            varStr(kvGet(errorKv, VARSTR(PROTOCOL_ERROR_STACK_STR))));
+    }
 
-        if (error != NULL)
-        {
-            const ErrorType *type = errorTypeFromCode(varIntForce(error));
-            const String *message = varStr(kvGet(errorKv, VARSTR(PROTOCOL_OUTPUT_STR)));
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Helper to read a pack response (the prefix has already been read) and process errors. Returns the output, if any.
+static Variant *
+protocolClientReadPack(ProtocolClient *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_CLIENT, this);
+    FUNCTION_LOG_END();
 
-            // Required part of the message
-            String *throwMessage = strNewFmt(
-                "%s: %s", strZ(this->errorPrefix), message == NULL ? "no details available" : strZ(message));
+    ASSERT(this != NULL);
 
-            // Add stack trace if the error is an assertion or debug-level logging is enabled
-            if (type == &AssertError || logAny(logLevelDebug))
-            {
-                const String *stack = varStr(kvGet(errorKv, VARSTR(PROTOCOL_ERROR_STACK_STR)));
+    Variant *result = NULL;
 
-                strCat(throwMessage, LF_STR);
-                strCat(throwMessage, stack == NULL ? STRDEF("no stack trace available") : stack);
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Create the pack read once since each new pack read allocates a buffer
+        if (this->packRead == NULL)
+        {
+            MEM_CONTEXT_BEGIN(this->pub.memContext)
+            {
+                this->packRead = pckReadNew(protocolClientIoRead(this));
             }
+            MEM_CONTEXT_END();
+        }
+        else
+            pckReadReset(this->packRead);
 
-            THROWP(type, strZ(throwMessage));
+        PackRead *const response = this->packRead;
+
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            result = pckReadVarP(response);
         }
+        MEM_CONTEXT_PRIOR_END();
+
+        // Process error if any (after reading to the end so the next response is not affected)
+        const int code = pckReadI32P(response);
+        const String *const message = pckReadStrP(response);
+        const String *const stack = pckReadStrP(response);
+
+        pckReadEndP(response);
+        protocolClientError(this, code, message, stack);
     }
     MEM_CONTEXT_TEMP_END();
 
-    FUNCTION_LOG_RETURN_VOID();
+    FUNCTION_LOG_RETURN(VARIANT, result);
+}
+
+// Helper to read the first byte of a response when using the pack format
+static unsigned char
+protocolClientReadPrefix(ProtocolClient *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_CLIENT, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    Buffer *prefix = bufNew(1);
+
+    if (ioReadSmall(protocolClientIoRead(this), prefix) == 0)
+        THROW(FileReadError, "unexpected eof while reading response");
+
+    const unsigned char result = *bufPtr(prefix);
+    bufFree(prefix);
+
+    FUNCTION_TEST_RETURN(result);
 }
 
 const Variant *
@@ -203,24 +298,43 @@ protocolClientReadOutput(ProtocolClient *this, bool outputRequired)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Read the response
-        String *response = ioReadLine(protocolClientIoRead(this));
-        KeyValue *responseKv = varKv(jsonToVar(response));
-
-        // Process error if any
-        protocolClientProcessError(this, responseKv);
+        if (this->pack)
+        {
+            // Read the response
+            if (protocolClientReadPrefix(this) != PROTOCOL_MESSAGE_PACK)
+                THROW(FormatError, "expected pack response");
 
-        // Get output
-        result = kvGet(responseKv, VARSTR(PROTOCOL_OUTPUT_STR));
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result = protocolClientReadPack(this);
+            }
+            MEM_CONTEXT_PRIOR_END();
 
-        if (outputRequired)
+            // If no output is required then there should not be any
+            if (!outputRequired && result != NULL)
+                THROW(AssertError, "no output required by command");
+        }
+        else
         {
-            // Just move the entire response kv since the output is the largest part if it
-            kvMove(responseKv, memContextPrior());
+            // Read the response
+            String *response = ioReadLine(protocolClientIoRead(this));
+            KeyValue *responseKv = varKv(jsonToVar(response));
+
+            // Process error if any
+            protocolClientProcessError(this, responseKv);
+
+            // Get output
+            result = kvGet(responseKv, VARSTR(PROTOCOL_OUTPUT_STR));
+
+            if (outputRequired)
+            {
+                // Just move the entire response kv since the output is the largest part if it
+                kvMove(responseKv, memContextPrior());
+            }
+            // Else if no output is required then there should not be any
+            else if (result != NULL)
+                THROW(AssertError, "no output required by command");
         }
-        // Else if no output is required then there should not be any
-        else if (result != NULL)
-            THROW(AssertError, "no output required by command");
 
         // Reset the keep alive time
         this->keepAliveTime = timeMSec();
@@ -243,8 +357,19 @@ protocolClientWriteCommand(ProtocolClient *this, const ProtocolCommand *command)
     ASSERT(command != NULL);
 
     // Write out the command
-    ioWriteStrLine(protocolClientIoWrite(this), protocolCommandJson(command));
-    ioWriteFlush(protocolClientIoWrite(this));
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        if (this->pack)
+        {
+            ioWrite(protocolClientIoWrite(this), PROTOCOL_MESSAGE_PACK_BUF);
+            ioWrite(protocolClientIoWrite(this), protocolCommandPack(command));
+        }
+        else
+            ioWriteStrLine(protocolClientIoWrite(this), protocolCommandJson(command));
+
+        ioWriteFlush(protocolClientIoWrite(this));
+    }
+    MEM_CONTEXT_TEMP_END();
 
     // Reset the keep alive time
     this->keepAliveTime = timeMSec();
@@ -303,30 +428,58 @@ protocolClientReadLine(ProtocolClient *this)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        result = ioReadLine(protocolClientIoRead(this));
-
-        if (strSize(result) == 0)
+        // When using the pack format the prefix must be read first to determine if the response is a line or a pack
+        if (this->pack)
         {
-            THROW(FormatError, "unexpected empty line");
+            const unsigned char prefix = protocolClientReadPrefix(this);
+
+            if (prefix == PROTOCOL_MESSAGE_PACK)
+            {
+                // Process expected error
+                protocolClientReadPack(this);
+
+                // If not an error then there is probably a protocol bug
+                THROW(FormatError, "expected error but got output");
+            }
+            else if (prefix == '\n')
+                THROW(FormatError, "unexpected empty line");
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result = ioReadLine(protocolClientIoRead(this));
+            }
+            MEM_CONTEXT_PRIOR_END();
+
+            if (prefix != '.')
+                THROW_FMT(FormatError, "invalid prefix in '%c%s'", prefix, strZ(result));
         }
-        else if (strZ(result)[0] == '{')
+        else
         {
-            KeyValue *responseKv = varKv(jsonToVar(result));
+            result = ioReadLine(protocolClientIoRead(this));
 
-            // Process expected error
-            protocolClientProcessError(this, responseKv);
+            if (strSize(result) == 0)
+            {
+                THROW(FormatError, "unexpected empty line");
+            }
+            else if (strZ(result)[0] == '{')
+            {
+                KeyValue *responseKv = varKv(jsonToVar(result));
 
-            // If not an error then there is probably a protocol bug
-            THROW(FormatError, "expected error but got output");
-        }
-        else if (strZ(result)[0] != '.')
-            THROW_FMT(FormatError, "invalid prefix in '%s'", strZ(result));
+                // Process expected error
+                protocolClientProcessError(this, responseKv);
 
-        MEM_CONTEXT_PRIOR_BEGIN()
-        {
-            result = strSub(result, 1);
+                // If not an error then there is probably a protocol bug
+                THROW(FormatError, "expected error but got output");
+            }
+            else if (strZ(result)[0] != '.')
+                THROW_FMT(FormatError, "invalid prefix in '%s'", strZ(result));
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result = strSub(result, 1);
+            }
+            MEM_CONTEXT_PRIOR_END();
         }
-        MEM_CONTEXT_PRIOR_END();
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -24,6 +24,19 @@ Constants
 #define PROTOCOL_GREETING_VERSION                                   "version"
     STRING_DECLARE(PROTOCOL_GREETING_VERSION_STR);
 
+// The server advertises the pack format in the greeting. When the greeting does not include the format key the client falls back to
+// JSON for commands and the server replies in the format of each command it receives.
+#define PROTOCOL_GREETING_FORMAT                                    "format"
+    STRING_DECLARE(PROTOCOL_GREETING_FORMAT_STR);
+#define PROTOCOL_FORMAT_PACK                                        "pack"
+    STRING_DECLARE(PROTOCOL_FORMAT_PACK_STR);
+
+// Prefix for messages in pack format. Must not conflict with '{' (JSON) or '.' (line). A command pack contains the command name
+// followed by the parameter list. A response pack contains the output or, on error, the error code, message, and stack trace in
+// fields 2-4.
+#define PROTOCOL_MESSAGE_PACK                                       0x01
+    BUFFER_DECLARE(PROTOCOL_MESSAGE_PACK_BUF);
+
 #define PROTOCOL_COMMAND_EXIT                                       "exit"
     STRING_DECLARE(PROTOCOL_COMMAND_EXIT_STR);
 #define PROTOCOL_COMMAND_NOOP                                       "noop"
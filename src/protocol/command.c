@@ -8,6 +8,7 @@ Protocol Command
 #include "common/memContext.h"
 #include "common/type/json.h"
 #include "common/type/keyValue.h"
+#include "common/type/pack.h"
 #include "protocol/command.h"
 
 /***********************************************************************************************************************************
@@ -108,6 +109,31 @@ protocolCommandJson(const ProtocolCommand *this)
     FUNCTION_TEST_RETURN(result);
 }
 
+/**********************************************************************************************************************************/
+Buffer *
+protocolCommandPack(const ProtocolCommand *this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_COMMAND, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    Buffer *result = bufNew(PACK_EXTRA_MIN);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        PackWrite *command = pckWriteNewBuf(result);
+
+        pckWriteStrP(command, this->command);
+        pckWriteVarP(command, this->parameterList);
+        pckWriteEndP(command);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /**********************************************************************************************************************************/
 String *
 protocolCommandToLog(const ProtocolCommand *this)
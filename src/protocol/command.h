@@ -9,6 +9,7 @@ Object type
 ***********************************************************************************************************************************/
 typedef struct ProtocolCommand ProtocolCommand;
 
+#include "common/type/buffer.h"
 #include "common/type/object.h"
 #include "common/type/variant.h"
 
@@ -31,6 +32,9 @@ Getters/Setters
 // Command JSON
 String *protocolCommandJson(const ProtocolCommand *this);
 
+// Command pack. The command name is followed by the parameter list (if any).
+Buffer *protocolCommandPack(const ProtocolCommand *this);
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
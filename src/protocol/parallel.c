@@ -3,8 +3,8 @@ Protocol Parallel Executor
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <poll.h>
 #include <string.h>
-#include <sys/select.h>
 
 #include "common/debug.h"
 #include "common/log.h"
@@ -24,27 +24,33 @@ struct ProtocolParallel
 {
     MemContext *memContext;
     TimeMSec timeout;                                               // Max time to wait for jobs before returning
+    unsigned int jobQueueMax;                                       // Max jobs sent to each client before results are read
     ParallelJobCallback *callbackFunction;                          // Function to get new jobs
     void *callbackData;                                             // Data to pass to callback function
+    bool clientKeep;                                                // Keep clients when there are no jobs for them?
 
     List *clientList;                                               // List of clients to process jobs
     List *jobList;                                                  // List of jobs to be processed
 
-    ProtocolParallelJob **clientJobList;                            // Jobs being processing by each client
+    List **clientJobList;                                           // Jobs sent to each client in the order they were sent
+    struct pollfd *clientPollList;                                  // Poll list with an fd for each client running a job
+    unsigned int clientRunningTotal;                                // Total clients running jobs
 
     ProtocolParallelJobState state;                                 // Overall state of job processing
 };
 
 /**********************************************************************************************************************************/
 ProtocolParallel *
-protocolParallelNew(TimeMSec timeout, ParallelJobCallback *callbackFunction, void *callbackData)
+protocolParallelNew(TimeMSec timeout, unsigned int jobQueueMax, ParallelJobCallback *callbackFunction, void *callbackData)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(UINT64, timeout);
+        FUNCTION_LOG_PARAM(UINT, jobQueueMax);
         FUNCTION_LOG_PARAM(FUNCTIONP, callbackFunction);
         FUNCTION_LOG_PARAM_P(VOID, callbackData);
     FUNCTION_LOG_END();
 
+    ASSERT(jobQueueMax > 0);
     ASSERT(callbackFunction != NULL);
     ASSERT(callbackData != NULL);
 
@@ -58,6 +64,7 @@ protocolParallelNew(TimeMSec timeout, ParallelJobCallback *callbackFunction, voi
         {
             .memContext = MEM_CONTEXT_NEW(),
             .timeout = timeout,
+            .jobQueueMax = jobQueueMax,
             .callbackFunction = callbackFunction,
             .callbackData = callbackData,
             .clientList = lstNewP(sizeof(ProtocolClient *)),
@@ -91,6 +98,106 @@ protocolParallelClientAdd(ProtocolParallel *this, ProtocolClient *client)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+void
+protocolParallelClientKeepSet(ProtocolParallel *const this, const bool clientKeep)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL, this);
+        FUNCTION_LOG_PARAM(BOOL, clientKeep);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->state == protocolParallelJobStatePending);
+
+    this->clientKeep = clientKeep;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+protocolParallelKeepAlive(ProtocolParallel *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->clientKeep);
+
+    // Clients running jobs do not need a keep alive and a noop cannot be sent to them until their results have been read
+    for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+    {
+        if (this->clientJobList == NULL || lstEmpty(this->clientJobList[clientIdx]))
+            protocolClientNoOp(*(ProtocolClient **)lstGet(this->clientList, clientIdx));
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get new jobs for a client and send them until the client queue is full or there are no more jobs. Sending more than one job allows
+the client to start on the next job without waiting for a round trip after the prior result.
+***********************************************************************************************************************************/
+static void
+protocolParallelDispatch(ProtocolParallel *const this, const unsigned int clientIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL, this);
+        FUNCTION_LOG_PARAM(UINT, clientIdx);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    List *const clientJobList = this->clientJobList[clientIdx];
+
+    while (lstSize(clientJobList) < this->jobQueueMax)
+    {
+        // Get a new job
+        ProtocolParallelJob *job = NULL;
+
+        MEM_CONTEXT_BEGIN(lstMemContext(this->jobList))
+        {
+            job = this->callbackFunction(this->callbackData, clientIdx);
+        }
+        MEM_CONTEXT_END();
+
+        // If no more jobs for this client then free it once the jobs already sent have completed, unless clients are being kept for
+        // jobs that may be available later
+        if (job == NULL)
+        {
+            if (lstEmpty(clientJobList) && !this->clientKeep)
+                protocolLocalFree(clientIdx + 1);
+
+            break;
+        }
+
+        ProtocolClient *const client = *(ProtocolClient **)lstGet(this->clientList, clientIdx);
+
+        // Add to the job list
+        lstAdd(this->jobList, &job);
+
+        // Send the job to the client
+        protocolClientWriteCommand(client, protocolParallelJobCommand(job));
+
+        // Set client id and running state
+        protocolParallelJobProcessIdSet(job, clientIdx + 1);
+        protocolParallelJobStateSet(job, protocolParallelJobStateRunning);
+
+        // Poll the client for results when the first job is sent
+        if (lstEmpty(clientJobList))
+        {
+            this->clientPollList[clientIdx].fd = ioReadFd(protocolClientIoRead(client));
+            this->clientRunningTotal++;
+        }
+
+        lstAdd(clientJobList, &job);
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 unsigned int
 protocolParallelProcess(ProtocolParallel *this)
@@ -110,116 +217,99 @@ protocolParallelProcess(ProtocolParallel *this)
         MEM_CONTEXT_BEGIN(this->memContext)
         {
             this->clientJobList = memNewPtrArray(lstSize(this->clientList));
+            this->clientPollList = memNew(sizeof(struct pollfd) * lstSize(this->clientList));
+
+            // Clients are not polled until they are running a job. A negative fd is ignored by poll().
+            for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+            {
+                this->clientJobList[clientIdx] = lstNewP(sizeof(ProtocolParallelJob *));
+                this->clientPollList[clientIdx] = (struct pollfd){.fd = -1, .events = POLLIN};
+            }
         }
         MEM_CONTEXT_END();
 
         this->state = protocolParallelJobStateRunning;
     }
 
-    // Initialize the file descriptor set used for select
-    fd_set selectSet;
-    FD_ZERO(&selectSet);
-    int fdMax = -1;
-
-    // Find clients that are running jobs
-    unsigned int clientRunningTotal = 0;
-
-    for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+    // If clients are running then wait for one to finish. Unlike select() there is no limit on the fd values that can be polled.
+    if (this->clientRunningTotal > 0)
     {
-        if (this->clientJobList[clientIdx] != NULL)
+        // When more than one job is sent to a client the results may already be buffered. Polling will not detect buffered results
+        // so do not wait in that case.
+        TimeMSec timeout = this->timeout;
+
+        if (this->jobQueueMax > 1)
         {
-            int fd = ioReadFd(protocolClientIoRead(*(ProtocolClient **)lstGet(this->clientList, clientIdx)));
-            FD_SET((unsigned int)fd, &selectSet);
+            for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+            {
+                if (!lstEmpty(this->clientJobList[clientIdx]) &&
+                    ioReadBuffered(protocolClientIoRead(*(ProtocolClient **)lstGet(this->clientList, clientIdx))))
+                {
+                    timeout = 0;
+                    break;
+                }
+            }
+        }
 
-            // Find the max file descriptor needed for select()
-            MAX_ASSIGN(fdMax, fd);
+        int ready = poll(this->clientPollList, lstSize(this->clientList), (int)timeout);
+        THROW_ON_SYS_ERROR(ready == -1, AssertError, "unable to poll parallel client(s)");
 
-            clientRunningTotal++;
-        }
-    }
+        // Get results from clients with completed jobs
+        for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+        {
+            List *const clientJobList = this->clientJobList[clientIdx];
 
-    // If clients are running then wait for one to finish
-    if (clientRunningTotal > 0)
-    {
-        // Initialize timeout struct used for select.  Recreate this structure each time since Linux (at least) will modify it.
-        struct timeval timeoutSelect;
-        timeoutSelect.tv_sec = (time_t)(this->timeout / MSEC_PER_SEC);
-        timeoutSelect.tv_usec = (suseconds_t)(this->timeout % MSEC_PER_SEC * 1000);
+            if (lstEmpty(clientJobList))
+                continue;
 
-        // Determine if there is data to be read
-        int completed = select(fdMax + 1, &selectSet, NULL, NULL, &timeoutSelect);
-        THROW_ON_SYS_ERROR(completed == -1, AssertError, "unable to select from parallel client(s)");
+            ProtocolClient *const client = *(ProtocolClient **)lstGet(this->clientList, clientIdx);
 
-        // If any jobs have completed then get the results
-        if (completed > 0)
-        {
-            for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+            if (this->clientPollList[clientIdx].revents == 0 && !ioReadBuffered(protocolClientIoRead(client)))
+                continue;
+
+            // Results are returned in the order the jobs were sent. Read results until no more are buffered.
+            do
             {
-                ProtocolParallelJob *job = this->clientJobList[clientIdx];
+                ProtocolParallelJob *const job = *(ProtocolParallelJob **)lstGet(clientJobList, 0);
 
-                if (job != NULL &&
-                    FD_ISSET(
-                        (unsigned int)ioReadFd(protocolClientIoRead(*(ProtocolClient **)lstGet(this->clientList, clientIdx))),
-                        &selectSet))
+                MEM_CONTEXT_TEMP_BEGIN()
                 {
-                    MEM_CONTEXT_TEMP_BEGIN()
+                    TRY_BEGIN()
                     {
-                        TRY_BEGIN()
-                        {
-                            protocolParallelJobResultSet(
-                                job, protocolClientReadOutput(*(ProtocolClient **)lstGet(this->clientList, clientIdx), true));
-                        }
-                        CATCH_ANY()
-                        {
-                            protocolParallelJobErrorSet(job, errorCode(), STR(errorMessage()));
-                        }
-                        TRY_END();
-
-                        protocolParallelJobStateSet(job, protocolParallelJobStateDone);
-                        this->clientJobList[clientIdx] = NULL;
+                        protocolParallelJobResultSet(job, protocolClientReadOutput(client, true));
                     }
-                    MEM_CONTEXT_TEMP_END();
+                    CATCH_ANY()
+                    {
+                        protocolParallelJobErrorSet(job, errorCode(), STR(errorMessage()));
+                    }
+                    TRY_END();
+
+                    protocolParallelJobStateSet(job, protocolParallelJobStateDone);
+                    lstRemoveIdx(clientJobList, 0);
                 }
+                MEM_CONTEXT_TEMP_END();
+
+                result++;
+            }
+            while (!lstEmpty(clientJobList) && ioReadBuffered(protocolClientIoRead(client)));
+
+            // Stop polling the client when no jobs are running
+            if (lstEmpty(clientJobList))
+            {
+                this->clientPollList[clientIdx].fd = -1;
+                this->clientRunningTotal--;
             }
 
-            result = (unsigned int)completed;
+            // Send more jobs to the client right away so it does not wait for the other results to be processed
+            protocolParallelDispatch(this, clientIdx);
         }
     }
 
-    // Find new jobs to be run
+    // Find new jobs for clients that are not running
     for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
     {
-        // If nothing is running for this client
-        if (this->clientJobList[clientIdx] == NULL)
-        {
-            // Get a new job
-            ProtocolParallelJob *job = NULL;
-
-            MEM_CONTEXT_BEGIN(lstMemContext(this->jobList))
-            {
-                job = this->callbackFunction(this->callbackData, clientIdx);
-            }
-            MEM_CONTEXT_END();
-
-            // If a new job was found
-            if (job != NULL)
-            {
-                // Add to the job list
-                lstAdd(this->jobList, &job);
-
-                // Send the job to the client
-                protocolClientWriteCommand(
-                    *(ProtocolClient **)lstGet(this->clientList, clientIdx), protocolParallelJobCommand(job));
-
-                // Set client id and running state
-                protocolParallelJobProcessIdSet(job, clientIdx + 1);
-                protocolParallelJobStateSet(job, protocolParallelJobStateRunning);
-                this->clientJobList[clientIdx] = job;
-            }
-            // Else no more jobs for this client so free it
-            else
-                protocolLocalFree(clientIdx + 1);
-        }
+        if (lstEmpty(this->clientJobList[clientIdx]))
+            protocolParallelDispatch(this, clientIdx);
     }
 
     FUNCTION_LOG_RETURN(UINT, result);
@@ -265,11 +355,18 @@ protocolParallelDone(ProtocolParallel *this)
     ASSERT(this != NULL);
     ASSERT(this->state != protocolParallelJobStatePending);
 
-    // If there are no jobs left then we are done
-    if (this->state != protocolParallelJobStateDone && lstEmpty(this->jobList))
-        this->state = protocolParallelJobStateDone;
+    bool result = this->state == protocolParallelJobStateDone;
+
+    // If there are no jobs left then we are done. When clients are kept the state does not change since more jobs may be processed.
+    if (!result && lstEmpty(this->jobList))
+    {
+        result = true;
+
+        if (!this->clientKeep)
+            this->state = protocolParallelJobStateDone;
+    }
 
-    FUNCTION_LOG_RETURN(BOOL, this->state == protocolParallelJobStateDone);
+    FUNCTION_LOG_RETURN(BOOL, result);
 }
 
 /**********************************************************************************************************************************/
@@ -25,7 +25,8 @@ typedef ProtocolParallelJob *ParallelJobCallback(void *data, unsigned int client
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-ProtocolParallel *protocolParallelNew(TimeMSec timeout, ParallelJobCallback *callbackFunction, void *callbackData);
+ProtocolParallel *protocolParallelNew(
+    TimeMSec timeout, unsigned int jobQueueMax, ParallelJobCallback *callbackFunction, void *callbackData);
 
 /***********************************************************************************************************************************
 Getters/Setters
@@ -36,12 +37,20 @@ bool protocolParallelDone(ProtocolParallel *this);
 // Completed job result
 ProtocolParallelJob *protocolParallelResult(ProtocolParallel *this);
 
+// Keep clients when there are no jobs for them. By default a client is freed as soon as there are no more jobs for it. When clients
+// are kept, protocolParallelProcess() may be called again after protocolParallelDone() returns true to process jobs that became
+// available later.
+void protocolParallelClientKeepSet(ProtocolParallel *this, bool clientKeep);
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
 // Add client
 void protocolParallelClientAdd(ProtocolParallel *this, ProtocolClient *client);
 
+// Send a keep alive to kept clients that are not running jobs
+void protocolParallelKeepAlive(ProtocolParallel *this);
+
 // Process jobs
 unsigned int protocolParallelProcess(ProtocolParallel *this);
 
@@ -12,6 +12,7 @@ Protocol Server
 #include "common/type/json.h"
 #include "common/type/keyValue.h"
 #include "common/type/list.h"
+#include "common/type/pack.h"
 #include "protocol/client.h"
 #include "protocol/helper.h"
 #include "protocol/server.h"
@@ -24,6 +25,8 @@ struct ProtocolServer
 {
     ProtocolServerPub pub;                                          // Publicly accessible variables
     const String *name;
+    bool pack;                                                      // Was the last command in pack format?
+    PackRead *packRead;                                             // Pack read reused for each command
 };
 
 /**********************************************************************************************************************************/
@@ -65,6 +68,7 @@ protocolServerNew(const String *name, const String *service, IoRead *read, IoWri
             kvPut(greetingKv, VARSTR(PROTOCOL_GREETING_NAME_STR), VARSTRZ(PROJECT_NAME));
             kvPut(greetingKv, VARSTR(PROTOCOL_GREETING_SERVICE_STR), VARSTR(service));
             kvPut(greetingKv, VARSTR(PROTOCOL_GREETING_VERSION_STR), VARSTRZ(PROJECT_VERSION));
+            kvPut(greetingKv, VARSTR(PROTOCOL_GREETING_FORMAT_STR), VARSTR(PROTOCOL_FORMAT_PACK_STR));
 
             ioWriteStrLine(protocolServerIoWrite(this), jsonFromKv(greetingKv));
             ioWriteFlush(protocolServerIoWrite(this));
@@ -76,6 +80,70 @@ protocolServerNew(const String *name, const String *service, IoRead *read, IoWri
     FUNCTION_LOG_RETURN(PROTOCOL_SERVER, this);
 }
 
+/**********************************************************************************************************************************/
+ProtocolServerCommandGetResult
+protocolServerCommandGet(ProtocolServer *this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_SERVER, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    ProtocolServerCommandGetResult result = {0};
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Read the prefix to determine the format of the command
+        Buffer *prefix = bufNew(1);
+
+        if (ioReadSmall(protocolServerIoRead(this), prefix) == 0)
+            THROW(FileReadError, "unexpected eof while reading command");
+
+        this->pack = *bufPtr(prefix) == PROTOCOL_MESSAGE_PACK;
+
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            if (this->pack)
+            {
+                // Create the pack read once since each new pack read allocates a buffer
+                if (this->packRead == NULL)
+                {
+                    MEM_CONTEXT_BEGIN(this->pub.memContext)
+                    {
+                        this->packRead = pckReadNew(protocolServerIoRead(this));
+                    }
+                    MEM_CONTEXT_END();
+                }
+                else
+                    pckReadReset(this->packRead);
+
+                result.command = pckReadStrP(this->packRead);
+                result.paramList = varVarLst(pckReadVarP(this->packRead));
+
+                pckReadEndP(this->packRead);
+            }
+            // Else fall back to JSON. The prefix is the first character of the command.
+            else
+            {
+                String *commandJson = strCatChr(strNew(""), (char)*bufPtr(prefix));
+
+                if (!strEq(commandJson, LF_STR))
+                    strCat(commandJson, ioReadLine(protocolServerIoRead(this)));
+
+                const KeyValue *commandKv = jsonToKv(commandJson);
+
+                result.command = varStr(kvGet(commandKv, VARSTR(PROTOCOL_KEY_COMMAND_STR)));
+                result.paramList = varVarLst(kvGet(commandKv, VARSTR(PROTOCOL_KEY_PARAMETER_STR)));
+            }
+        }
+        MEM_CONTEXT_PRIOR_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_STRUCT(result);
+}
+
 /**********************************************************************************************************************************/
 void
 protocolServerError(ProtocolServer *this, int code, const String *message, const String *stack)
@@ -92,13 +160,34 @@ protocolServerError(ProtocolServer *this, int code, const String *message, const
     ASSERT(message != NULL);
     ASSERT(stack != NULL);
 
-    KeyValue *error = kvNew();
-    kvPut(error, VARSTR(PROTOCOL_ERROR_STR), VARINT(code));
-    kvPut(error, VARSTR(PROTOCOL_OUTPUT_STR), VARSTR(message));
-    kvPut(error, VARSTR(PROTOCOL_ERROR_STACK_STR), VARSTR(stack));
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        if (this->pack)
+        {
+            Buffer *error = bufNew(PACK_EXTRA_MIN);
+            PackWrite *pack = pckWriteNewBuf(error);
 
-    ioWriteStrLine(protocolServerIoWrite(this), jsonFromKv(error));
-    ioWriteFlush(protocolServerIoWrite(this));
+            pckWriteI32P(pack, code, .id = 2);
+            pckWriteStrP(pack, message);
+            pckWriteStrP(pack, stack);
+            pckWriteEndP(pack);
+
+            ioWrite(protocolServerIoWrite(this), PROTOCOL_MESSAGE_PACK_BUF);
+            ioWrite(protocolServerIoWrite(this), error);
+        }
+        else
+        {
+            KeyValue *error = kvNew();
+            kvPut(error, VARSTR(PROTOCOL_ERROR_STR), VARINT(code));
+            kvPut(error, VARSTR(PROTOCOL_OUTPUT_STR), VARSTR(message));
+            kvPut(error, VARSTR(PROTOCOL_ERROR_STACK_STR), VARSTR(stack));
+
+            ioWriteStrLine(protocolServerIoWrite(this), jsonFromKv(error));
+        }
+
+        ioWriteFlush(protocolServerIoWrite(this));
+    }
+    MEM_CONTEXT_TEMP_END();
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -130,9 +219,9 @@ protocolServerProcess(
             MEM_CONTEXT_TEMP_BEGIN()
             {
                 // Read command
-                KeyValue *commandKv = jsonToKv(ioReadLine(protocolServerIoRead(this)));
-                const String *command = varStr(kvGet(commandKv, VARSTR(PROTOCOL_KEY_COMMAND_STR)));
-                VariantList *paramList = varVarLst(kvGet(commandKv, VARSTR(PROTOCOL_KEY_PARAMETER_STR)));
+                const ProtocolServerCommandGetResult commandGet = protocolServerCommandGet(this);
+                const String *command = commandGet.command;
+                const VariantList *paramList = commandGet.paramList;
 
                 // Find the handler
                 ProtocolServerCommandHandler handler = NULL;
@@ -240,13 +329,34 @@ protocolServerResponse(ProtocolServer *this, const Variant *output)
         FUNCTION_LOG_PARAM(VARIANT, output);
     FUNCTION_LOG_END();
 
-    KeyValue *result = kvNew();
+    ASSERT(this != NULL);
 
-    if (output != NULL)
-        kvAdd(result, VARSTR(PROTOCOL_OUTPUT_STR), output);
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        if (this->pack)
+        {
+            Buffer *result = bufNew(PACK_EXTRA_MIN);
+            PackWrite *pack = pckWriteNewBuf(result);
+
+            pckWriteVarP(pack, output);
+            pckWriteEndP(pack);
 
-    ioWriteStrLine(protocolServerIoWrite(this), jsonFromKv(result));
-    ioWriteFlush(protocolServerIoWrite(this));
+            ioWrite(protocolServerIoWrite(this), PROTOCOL_MESSAGE_PACK_BUF);
+            ioWrite(protocolServerIoWrite(this), result);
+        }
+        else
+        {
+            KeyValue *result = kvNew();
+
+            if (output != NULL)
+                kvAdd(result, VARSTR(PROTOCOL_OUTPUT_STR), output);
+
+            ioWriteStrLine(protocolServerIoWrite(this), jsonFromKv(result));
+        }
+
+        ioWriteFlush(protocolServerIoWrite(this));
+    }
+    MEM_CONTEXT_TEMP_END();
 
     FUNCTION_LOG_RETURN_VOID();
 }
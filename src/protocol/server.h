@@ -61,6 +61,15 @@ protocolServerIoWrite(ProtocolServer *this)
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
+// Read the next command. The command may be in JSON or pack format and the response will be written in the same format.
+typedef struct ProtocolServerCommandGetResult
+{
+    const String *command;                                          // Command name
+    VariantList *paramList;                                         // Parameter list (NULL if no parameters)
+} ProtocolServerCommandGetResult;
+
+ProtocolServerCommandGetResult protocolServerCommandGet(ProtocolServer *this);
+
 // Return an error
 void protocolServerError(ProtocolServer *this, int code, const String *message, const String *stack);
 
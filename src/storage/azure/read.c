@@ -1,10 +1,14 @@
 /***********************************************************************************************************************************
 Azure Storage Read
+
+When range concurrency is greater than one, files larger than the range size are read with multiple range requests (see
+HttpRangeRead).
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
 #include "common/debug.h"
 #include "common/io/http/client.h"
+#include "common/io/http/rangeRead.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/type/object.h"
@@ -20,7 +24,12 @@ typedef struct StorageReadAzure
     StorageReadInterface interface;                                 // Interface
     StorageAzure *storage;                                          // Storage that created this object
 
-    HttpResponse *httpResponse;                                     // HTTP response
+    HttpResponse *httpResponse;                                     // HTTP response (when not ranged)
+
+    size_t rangeSize;                                               // Size of each range request
+    unsigned int rangeConcurrency;                                  // Max range requests in flight
+    const String *etag;                                             // ETag of the first range
+    HttpRangeRead *rangeRead;                                       // Range read (when ranged)
 } StorageReadAzure;
 
 /***********************************************************************************************************************************
@@ -31,6 +40,31 @@ Macros for function logging
 #define FUNCTION_LOG_STORAGE_READ_AZURE_FORMAT(value, buffer, bufferSize)                                                          \
     objToLog(value, "StorageReadAzure", buffer, bufferSize)
 
+/***********************************************************************************************************************************
+Request a range after the first range. The request is conditional on the ETag of the first range so an object that was replaced
+while it was being read will result in an error rather than mixed content.
+***********************************************************************************************************************************/
+static HttpRequest *
+storageReadAzureRangeRequest(void *data, uint64_t offset, uint64_t size)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM_P(VOID, data);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(UINT64, size);
+    FUNCTION_LOG_END();
+
+    ASSERT(data != NULL);
+
+    StorageReadAzure *this = data;
+    HttpHeader *header = httpHeaderPutRange(httpHeaderNew(NULL), offset, VARUINT64(size));
+
+    if (this->etag != NULL)
+        httpHeaderPut(header, HTTP_HEADER_IF_MATCH_STR, this->etag);
+
+    FUNCTION_LOG_RETURN(
+        HTTP_REQUEST, storageAzureRequestAsyncP(this->storage, HTTP_VERB_GET_STR, .path = this->interface.name, .header = header));
+}
+
 /***********************************************************************************************************************************
 Open the file
 ***********************************************************************************************************************************/
@@ -48,18 +82,50 @@ storageReadAzureOpen(THIS_VOID)
 
     bool result = false;
 
-    // Request the file
+    // Use range requests when concurrency is allowed and the read could be larger than a single range
+    const bool ranged =
+        this->rangeConcurrency > 1 && (this->interface.limit == NULL || varUInt64(this->interface.limit) > this->rangeSize);
+
+    // Request the file (or the first range)
     MEM_CONTEXT_BEGIN(this->memContext)
     {
-        this->httpResponse = storageAzureRequestP(
-            this->storage, HTTP_VERB_GET_STR, .path = this->interface.name, .allowMissing = true, .contentIo = true);
+        this->httpResponse = storageAzureResponseP(
+            storageAzureRequestAsyncP(
+                this->storage, HTTP_VERB_GET_STR, .path = this->interface.name,
+                .header = httpHeaderPutRange(
+                    httpHeaderNew(NULL), this->interface.offset, ranged ? VARUINT64(this->rangeSize) : this->interface.limit)),
+            .allowMissing = true, .allowRangeNotSatisfiable = ranged && this->interface.offset == 0, .contentIo = true);
     }
     MEM_CONTEXT_END();
 
-    if (httpResponseCodeOk(this->httpResponse))
+    // An unsatisfiable range at offset zero means the file is empty so there is no content to read
+    if (httpResponseCode(this->httpResponse) == HTTP_RESPONSE_CODE_RANGE_NOT_SATISFIABLE)
     {
+        httpResponseFree(this->httpResponse);
+        this->httpResponse = NULL;
+
         result = true;
     }
+    else if (httpResponseCodeOk(this->httpResponse))
+    {
+        result = true;
+
+        // If the first range was returned then request the remaining ranges. If the range was ignored then the entire file has been
+        // returned so no more ranges are needed.
+        if (ranged && httpResponseCode(this->httpResponse) == HTTP_RESPONSE_CODE_PARTIAL_CONTENT)
+        {
+            MEM_CONTEXT_BEGIN(this->memContext)
+            {
+                this->etag = strDup(httpHeaderGet(httpResponseHeader(this->httpResponse), HTTP_HEADER_ETAG_STR));
+                this->rangeRead = httpRangeReadNew(
+                    this->httpResponse, this->interface.name, this->interface.offset, this->interface.limit, this->rangeSize,
+                    this->rangeConcurrency, storageReadAzureRangeRequest, this);
+            }
+            MEM_CONTEXT_END();
+
+            this->httpResponse = NULL;
+        }
+    }
     // Else error unless ignore missing
     else if (!this->interface.ignoreMissing)
         THROW_FMT(FileMissingError, STORAGE_ERROR_READ_MISSING, strZ(this->interface.name));
@@ -81,11 +147,13 @@ storageReadAzure(THIS_VOID, Buffer *buffer, bool block)
         FUNCTION_LOG_PARAM(BOOL, block);
     FUNCTION_LOG_END();
 
-    ASSERT(this != NULL && this->httpResponse != NULL);
-    ASSERT(httpResponseIoRead(this->httpResponse) != NULL);
+    ASSERT(this != NULL && (this->httpResponse != NULL || this->rangeRead != NULL));
     ASSERT(buffer != NULL && !bufFull(buffer));
 
-    FUNCTION_LOG_RETURN(SIZE, ioRead(httpResponseIoRead(this->httpResponse), buffer));
+    FUNCTION_LOG_RETURN(
+        SIZE,
+        this->rangeRead != NULL ?
+            httpRangeRead(this->rangeRead, buffer) : ioRead(httpResponseIoRead(this->httpResponse), buffer));
 }
 
 /***********************************************************************************************************************************
@@ -100,24 +168,34 @@ storageReadAzureEof(THIS_VOID)
         FUNCTION_TEST_PARAM(STORAGE_READ_AZURE, this);
     FUNCTION_TEST_END();
 
-    ASSERT(this != NULL && this->httpResponse != NULL);
-    ASSERT(httpResponseIoRead(this->httpResponse) != NULL);
+    ASSERT(this != NULL);
+
+    if (this->rangeRead != NULL)
+        FUNCTION_TEST_RETURN(httpRangeReadEof(this->rangeRead));
 
-    FUNCTION_TEST_RETURN(ioReadEof(httpResponseIoRead(this->httpResponse)));
+    FUNCTION_TEST_RETURN(this->httpResponse == NULL || ioReadEof(httpResponseIoRead(this->httpResponse)));
 }
 
 /**********************************************************************************************************************************/
 StorageRead *
-storageReadAzureNew(StorageAzure *storage, const String *name, bool ignoreMissing)
+storageReadAzureNew(
+    StorageAzure *storage, const String *name, bool ignoreMissing, uint64_t offset, const Variant *limit, size_t rangeSize,
+    unsigned int rangeConcurrency)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_AZURE, storage);
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(SIZE, rangeSize);
+        FUNCTION_LOG_PARAM(UINT, rangeConcurrency);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
+    ASSERT(rangeSize != 0);
+    ASSERT(rangeConcurrency != 0);
 
     StorageRead *this = NULL;
 
@@ -129,12 +207,16 @@ storageReadAzureNew(StorageAzure *storage, const String *name, bool ignoreMissin
         {
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
+            .rangeSize = rangeSize,
+            .rangeConcurrency = rangeConcurrency,
 
             .interface = (StorageReadInterface)
             {
                 .type = STORAGE_AZURE_TYPE_STR,
                 .name = strDup(name),
                 .ignoreMissing = ignoreMissing,
+                .offset = offset,
+                .limit = varDup(limit),
 
                 .ioInterface = (IoReadInterface)
                 {
@@ -10,6 +10,8 @@ Azure Storage Read
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-StorageRead *storageReadAzureNew(StorageAzure *storage, const String *name, bool ignoreMissing);
+StorageRead *storageReadAzureNew(
+    StorageAzure *storage, const String *name, bool ignoreMissing, uint64_t offset, const Variant *limit, size_t rangeSize,
+    unsigned int rangeConcurrency);
 
 #endif
@@ -74,6 +74,7 @@ struct StorageAzure
     const HttpQuery *sasKey;                                        // SAS key
     const String *host;                                             // Host name
     size_t blockSize;                                               // Block size for multi-block upload
+    unsigned int downloadConcurrency;                               // Max ranges to download concurrently
     const String *pathPrefix;                                       // Account/container prefix
 
     uint64_t fileId;                                                // Id to used to make file block identifiers unique
@@ -149,6 +150,8 @@ storageAzureAuth(
             // Generate string to sign
             const String *contentLength = httpHeaderGet(httpHeader, HTTP_HEADER_CONTENT_LENGTH_STR);
             const String *contentMd5 = httpHeaderGet(httpHeader, HTTP_HEADER_CONTENT_MD5_STR);
+            const String *ifMatch = httpHeaderGet(httpHeader, HTTP_HEADER_IF_MATCH_STR);
+            const String *range = httpHeaderGet(httpHeader, HTTP_HEADER_RANGE_STR);
 
             const String *stringToSign = strNewFmt(
                 "%s\n"                                                  // verb
@@ -159,15 +162,16 @@ storageAzureAuth(
                 "\n"                                                    // content-type
                 "%s\n"                                                  // date
                 "\n"                                                    // If-Modified-Since
-                "\n"                                                    // If-Match
+                "%s\n"                                                  // If-Match
                 "\n"                                                    // If-None-Match
                 "\n"                                                    // If-Unmodified-Since
-                "\n"                                                    // range
+                "%s\n"                                                  // range
                 "%s"                                                    // Canonicalized headers
                 "/%s%s"                                                 // Canonicalized account/path
                 "%s",                                                   // Canonicalized query
                 strZ(verb), strEq(contentLength, ZERO_STR) ? "" : strZ(contentLength), contentMd5 == NULL ? "" : strZ(contentMd5),
-                strZ(dateTime), strZ(headerCanonical), strZ(this->account), strZ(path), strZ(queryCanonical));
+                strZ(dateTime), ifMatch == NULL ? "" : strZ(ifMatch), range == NULL ? "" : strZ(range), strZ(headerCanonical),
+                strZ(this->account), strZ(path), strZ(queryCanonical));
 
             // Generate authorization header
             httpHeaderPut(
@@ -256,6 +260,7 @@ storageAzureResponse(HttpRequest *request, StorageAzureResponseParam param)
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(HTTP_REQUEST, request);
         FUNCTION_LOG_PARAM(BOOL, param.allowMissing);
+        FUNCTION_LOG_PARAM(BOOL, param.allowRangeNotSatisfiable);
         FUNCTION_LOG_PARAM(BOOL, param.contentIo);
     FUNCTION_LOG_END();
 
@@ -269,8 +274,12 @@ storageAzureResponse(HttpRequest *request, StorageAzureResponseParam param)
         result = httpRequestResponse(request, !param.contentIo);
 
         // Error if the request was not successful
-        if (!httpResponseCodeOk(result) && (!param.allowMissing || httpResponseCode(result) != HTTP_RESPONSE_CODE_NOT_FOUND))
+        if (!httpResponseCodeOk(result) &&
+            (!param.allowMissing || httpResponseCode(result) != HTTP_RESPONSE_CODE_NOT_FOUND) &&
+            (!param.allowRangeNotSatisfiable || httpResponseCode(result) != HTTP_RESPONSE_CODE_RANGE_NOT_SATISFIABLE))
+        {
             httpRequestError(request, result);
+        }
 
         // Move response to the prior context
         httpResponseMove(result, memContextPrior());
@@ -544,13 +553,16 @@ storageAzureNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageIn
         FUNCTION_LOG_PARAM(STORAGE_AZURE, this);
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
-        (void)param;                                                // No parameters are used
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
+        FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(file != NULL);
 
-    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadAzureNew(this, file, ignoreMissing));
+    FUNCTION_LOG_RETURN(
+        STORAGE_READ,
+        storageReadAzureNew(this, file, ignoreMissing, param.offset, param.limit, this->blockSize, this->downloadConcurrency));
 }
 
 /**********************************************************************************************************************************/
@@ -679,6 +691,8 @@ storageAzureRemove(THIS_VOID, const String *file, StorageInterfaceRemoveParam pa
 /**********************************************************************************************************************************/
 static const StorageInterface storageInterfaceAzure =
 {
+    .feature = 1 << storageFeatureLimitRead,
+
     .info = storageAzureInfo,
     .infoList = storageAzureInfoList,
     .newRead = storageAzureNewRead,
@@ -690,8 +704,9 @@ static const StorageInterface storageInterfaceAzure =
 Storage *
 storageAzureNew(
     const String *path, bool write, StoragePathExpressionCallback pathExpressionFunction, const String *container,
-    const String *account, StorageAzureKeyType keyType, const String *key, size_t blockSize, const String *host,
-    const String *endpoint, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
+    const String *account, StorageAzureKeyType keyType, const String *key, size_t blockSize, unsigned int downloadConcurrency,
+    const String *host, const String *endpoint, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile,
+    const String *caPath)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, path);
@@ -702,6 +717,7 @@ storageAzureNew(
         FUNCTION_LOG_PARAM(ENUM, keyType);
         FUNCTION_TEST_PARAM(STRING, key);
         FUNCTION_LOG_PARAM(SIZE, blockSize);
+        FUNCTION_LOG_PARAM(UINT, downloadConcurrency);
         FUNCTION_LOG_PARAM(STRING, host);
         FUNCTION_LOG_PARAM(STRING, endpoint);
         FUNCTION_LOG_PARAM(UINT, port);
@@ -716,6 +732,7 @@ storageAzureNew(
     ASSERT(account != NULL);
     ASSERT(key != NULL);
     ASSERT(blockSize != 0);
+    ASSERT(downloadConcurrency != 0);
 
     Storage *this = NULL;
 
@@ -730,6 +747,7 @@ storageAzureNew(
             .container = strDup(container),
             .account = strDup(account),
             .blockSize = blockSize,
+            .downloadConcurrency = downloadConcurrency,
             .host = host == NULL ? strNewFmt("%s.%s", strZ(account), strZ(endpoint)) : host,
             .pathPrefix = host == NULL ? strNewFmt("/%s", strZ(container)) : strNewFmt("/%s/%s", strZ(account), strZ(container)),
         };
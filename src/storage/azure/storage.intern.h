@@ -45,6 +45,7 @@ typedef struct StorageAzureResponseParam
 {
     VAR_PARAM_HEADER;
     bool allowMissing;                                              // Allow missing files (caller can check response code)
+    bool allowRangeNotSatisfiable;                                  // Allow range not satisfiable (caller can check response code)
     bool contentIo;                                                 // Is IoRead interface required to read content?
 } StorageAzureResponseParam;
 
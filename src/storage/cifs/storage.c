@@ -29,5 +29,7 @@ storageCifsNew(
     FUNCTION_LOG_END();
 
     FUNCTION_LOG_RETURN(
-        STORAGE, storagePosixNewInternal(STORAGE_CIFS_TYPE_STR, path, modeFile, modePath, write, pathExpressionFunction, false));
+        STORAGE,
+        storagePosixNewInternal(
+            STORAGE_CIFS_TYPE_STR, path, modeFile, modePath, write, pathExpressionFunction, false, false, false, false, 0));
 }
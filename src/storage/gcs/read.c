@@ -1,10 +1,14 @@
 /***********************************************************************************************************************************
 GCS Storage Read
+
+When range concurrency is greater than one, files larger than the range size are read with multiple range requests (see
+HttpRangeRead).
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
 #include "common/debug.h"
 #include "common/io/http/client.h"
+#include "common/io/http/rangeRead.h"
 #include "common/io/read.h"
 #include "common/log.h"
 #include "common/memContext.h"
@@ -13,9 +17,12 @@ GCS Storage Read
 #include "storage/read.intern.h"
 
 /***********************************************************************************************************************************
-GCS query tokens
+GCS headers and query tokens
 ***********************************************************************************************************************************/
+STRING_STATIC(GCS_HEADER_GENERATION_STR,                            "x-goog-generation");
+
 STRING_STATIC(GCS_QUERY_ALT_STR,                                    "alt");
+STRING_STATIC(GCS_QUERY_IF_GENERATION_MATCH_STR,                    "ifGenerationMatch");
 
 /***********************************************************************************************************************************
 Object type
@@ -26,7 +33,12 @@ typedef struct StorageReadGcs
     StorageReadInterface interface;                                 // Interface
     StorageGcs *storage;                                            // Storage that created this object
 
-    HttpResponse *httpResponse;                                     // HTTP response
+    HttpResponse *httpResponse;                                     // HTTP response (when not ranged)
+
+    size_t rangeSize;                                               // Size of each range request
+    unsigned int rangeConcurrency;                                  // Max range requests in flight
+    const String *generation;                                       // Generation of the object read by the first range
+    HttpRangeRead *rangeRead;                                       // Range read (when ranged)
 } StorageReadGcs;
 
 /***********************************************************************************************************************************
@@ -37,6 +49,34 @@ Macros for function logging
 #define FUNCTION_LOG_STORAGE_READ_GCS_FORMAT(value, buffer, bufferSize)                                                            \
     objToLog(value, "StorageReadGcs", buffer, bufferSize)
 
+/***********************************************************************************************************************************
+Request a range after the first range. The request is conditional on the generation of the first range so an object that was
+replaced while it was being read will result in an error rather than mixed content.
+***********************************************************************************************************************************/
+static HttpRequest *
+storageReadGcsRangeRequest(void *data, uint64_t offset, uint64_t size)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM_P(VOID, data);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(UINT64, size);
+    FUNCTION_LOG_END();
+
+    ASSERT(data != NULL);
+
+    StorageReadGcs *this = data;
+    HttpQuery *query = httpQueryAdd(httpQueryNewP(), GCS_QUERY_ALT_STR, GCS_QUERY_MEDIA_STR);
+
+    if (this->generation != NULL)
+        httpQueryAdd(query, GCS_QUERY_IF_GENERATION_MATCH_STR, this->generation);
+
+    FUNCTION_LOG_RETURN(
+        HTTP_REQUEST,
+        storageGcsRequestAsyncP(
+            this->storage, HTTP_VERB_GET_STR, .object = this->interface.name,
+            .header = httpHeaderPutRange(httpHeaderNew(NULL), offset, VARUINT64(size)), .query = query));
+}
+
 /***********************************************************************************************************************************
 Open the file
 ***********************************************************************************************************************************/
@@ -54,18 +94,50 @@ storageReadGcsOpen(THIS_VOID)
 
     bool result = false;
 
-    // Request the file
+    // Use range requests when concurrency is allowed and the read could be larger than a single range
+    const bool ranged =
+        this->rangeConcurrency > 1 && (this->interface.limit == NULL || varUInt64(this->interface.limit) > this->rangeSize);
+
+    // Request the file (or the first range)
     MEM_CONTEXT_BEGIN(this->memContext)
     {
-        this->httpResponse = storageGcsRequestP(
-            this->storage, HTTP_VERB_GET_STR, .object = this->interface.name, .allowMissing = true, .contentIo = true,
-            .query = httpQueryAdd(httpQueryNewP(), GCS_QUERY_ALT_STR, GCS_QUERY_MEDIA_STR));
+        this->httpResponse = storageGcsResponseP(
+            storageGcsRequestAsyncP(
+                this->storage, HTTP_VERB_GET_STR, .object = this->interface.name,
+                .header = httpHeaderPutRange(
+                    httpHeaderNew(NULL), this->interface.offset, ranged ? VARUINT64(this->rangeSize) : this->interface.limit),
+                .query = httpQueryAdd(httpQueryNewP(), GCS_QUERY_ALT_STR, GCS_QUERY_MEDIA_STR)),
+            .allowMissing = true, .allowRangeNotSatisfiable = ranged && this->interface.offset == 0, .contentIo = true);
     }
     MEM_CONTEXT_END();
 
-    if (httpResponseCodeOk(this->httpResponse))
+    // An unsatisfiable range at offset zero means the file is empty so there is no content to read
+    if (httpResponseCode(this->httpResponse) == HTTP_RESPONSE_CODE_RANGE_NOT_SATISFIABLE)
+    {
+        httpResponseFree(this->httpResponse);
+        this->httpResponse = NULL;
+
+        result = true;
+    }
+    else if (httpResponseCodeOk(this->httpResponse))
     {
         result = true;
+
+        // If the first range was returned then request the remaining ranges. If the range was ignored then the entire file has been
+        // returned so no more ranges are needed.
+        if (ranged && httpResponseCode(this->httpResponse) == HTTP_RESPONSE_CODE_PARTIAL_CONTENT)
+        {
+            MEM_CONTEXT_BEGIN(this->memContext)
+            {
+                this->generation = strDup(httpHeaderGet(httpResponseHeader(this->httpResponse), GCS_HEADER_GENERATION_STR));
+                this->rangeRead = httpRangeReadNew(
+                    this->httpResponse, this->interface.name, this->interface.offset, this->interface.limit, this->rangeSize,
+                    this->rangeConcurrency, storageReadGcsRangeRequest, this);
+            }
+            MEM_CONTEXT_END();
+
+            this->httpResponse = NULL;
+        }
     }
     // Else error unless ignore missing
     else if (!this->interface.ignoreMissing)
@@ -88,11 +160,13 @@ storageReadGcs(THIS_VOID, Buffer *buffer, bool block)
         FUNCTION_LOG_PARAM(BOOL, block);
     FUNCTION_LOG_END();
 
-    ASSERT(this != NULL && this->httpResponse != NULL);
-    ASSERT(httpResponseIoRead(this->httpResponse) != NULL);
+    ASSERT(this != NULL && (this->httpResponse != NULL || this->rangeRead != NULL));
     ASSERT(buffer != NULL && !bufFull(buffer));
 
-    FUNCTION_LOG_RETURN(SIZE, ioRead(httpResponseIoRead(this->httpResponse), buffer));
+    FUNCTION_LOG_RETURN(
+        SIZE,
+        this->rangeRead != NULL ?
+            httpRangeRead(this->rangeRead, buffer) : ioRead(httpResponseIoRead(this->httpResponse), buffer));
 }
 
 /***********************************************************************************************************************************
@@ -107,24 +181,34 @@ storageReadGcsEof(THIS_VOID)
         FUNCTION_TEST_PARAM(STORAGE_READ_GCS, this);
     FUNCTION_TEST_END();
 
-    ASSERT(this != NULL && this->httpResponse != NULL);
-    ASSERT(httpResponseIoRead(this->httpResponse) != NULL);
+    ASSERT(this != NULL);
+
+    if (this->rangeRead != NULL)
+        FUNCTION_TEST_RETURN(httpRangeReadEof(this->rangeRead));
 
-    FUNCTION_TEST_RETURN(ioReadEof(httpResponseIoRead(this->httpResponse)));
+    FUNCTION_TEST_RETURN(this->httpResponse == NULL || ioReadEof(httpResponseIoRead(this->httpResponse)));
 }
 
 /**********************************************************************************************************************************/
 StorageRead *
-storageReadGcsNew(StorageGcs *storage, const String *name, bool ignoreMissing)
+storageReadGcsNew(
+    StorageGcs *storage, const String *name, bool ignoreMissing, uint64_t offset, const Variant *limit, size_t rangeSize,
+    unsigned int rangeConcurrency)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_GCS, storage);
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(SIZE, rangeSize);
+        FUNCTION_LOG_PARAM(UINT, rangeConcurrency);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
+    ASSERT(rangeSize != 0);
+    ASSERT(rangeConcurrency != 0);
 
     StorageRead *this = NULL;
 
@@ -136,12 +220,16 @@ storageReadGcsNew(StorageGcs *storage, const String *name, bool ignoreMissing)
         {
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
+            .rangeSize = rangeSize,
+            .rangeConcurrency = rangeConcurrency,
 
             .interface = (StorageReadInterface)
             {
                 .type = STORAGE_GCS_TYPE_STR,
                 .name = strDup(name),
                 .ignoreMissing = ignoreMissing,
+                .offset = offset,
+                .limit = varDup(limit),
 
                 .ioInterface = (IoReadInterface)
                 {
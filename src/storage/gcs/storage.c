@@ -58,7 +58,7 @@ VARIANT_STRDEF_STATIC(GCS_JSON_ERROR_DESCRIPTION_VAR,               "error_descr
 VARIANT_STRDEF_STATIC(GCS_JSON_EXPIRES_IN_VAR,                      "expires_in");
 #define GCS_JSON_ITEMS                                              "items"
     VARIANT_STRDEF_STATIC(GCS_JSON_ITEMS_VAR,                       GCS_JSON_ITEMS);
-VARIANT_STRDEF_EXTERN(GCS_JSON_MD5_HASH_VAR,                        GCS_JSON_MD5_HASH);
+VARIANT_STRDEF_EXTERN(GCS_JSON_CRC32C_VAR,                          GCS_JSON_CRC32C);
 VARIANT_STRDEF_EXTERN(GCS_JSON_NAME_VAR,                            GCS_JSON_NAME);
 #define GCS_JSON_NEXT_PAGE_TOKEN                                    "nextPageToken"
     VARIANT_STRDEF_STATIC(GCS_JSON_NEXT_PAGE_TOKEN_VAR,             GCS_JSON_NEXT_PAGE_TOKEN);
@@ -93,6 +93,7 @@ struct StorageGcs
     const String *bucket;                                           // Bucket to store data in
     const String *endpoint;                                         // Endpoint
     size_t chunkSize;                                               // Block size for resumable upload
+    unsigned int downloadConcurrency;                               // Max ranges to download concurrently
 
     StorageGcsKeyType keyType;                                      // Auth key type
     const String *credential;                                       // Credential (client email)
@@ -381,6 +382,7 @@ storageGcsResponse(HttpRequest *request, StorageGcsResponseParam param)
         FUNCTION_LOG_PARAM(HTTP_REQUEST, request);
         FUNCTION_LOG_PARAM(BOOL, param.allowMissing);
         FUNCTION_LOG_PARAM(BOOL, param.allowIncomplete);
+        FUNCTION_LOG_PARAM(BOOL, param.allowRangeNotSatisfiable);
         FUNCTION_LOG_PARAM(BOOL, param.contentIo);
     FUNCTION_LOG_END();
 
@@ -396,8 +398,11 @@ storageGcsResponse(HttpRequest *request, StorageGcsResponseParam param)
 
         // Error if the request was not successful
         if (!httpResponseCodeOk(result) && (!param.allowMissing || httpResponseCode(result) != HTTP_RESPONSE_CODE_NOT_FOUND) &&
-            (!param.allowIncomplete || httpResponseCode(result) != HTTP_RESPONSE_CODE_PERMANENT_REDIRECT))
+            (!param.allowIncomplete || httpResponseCode(result) != HTTP_RESPONSE_CODE_PERMANENT_REDIRECT) &&
+            (!param.allowRangeNotSatisfiable || httpResponseCode(result) != HTTP_RESPONSE_CODE_RANGE_NOT_SATISFIABLE))
+        {
             httpRequestError(request, result);
+        }
 
         // Move response to the prior context
         httpResponseMove(result, memContextPrior());
@@ -713,13 +718,16 @@ storageGcsNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageInte
         FUNCTION_LOG_PARAM(STORAGE_GCS, this);
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
-        (void)param;                                                // No parameters are used
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
+        FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(file != NULL);
 
-    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadGcsNew(this, file, ignoreMissing));
+    FUNCTION_LOG_RETURN(
+        STORAGE_READ,
+        storageReadGcsNew(this, file, ignoreMissing, param.offset, param.limit, this->chunkSize, this->downloadConcurrency));
 }
 
 /**********************************************************************************************************************************/
@@ -848,6 +856,8 @@ storageGcsRemove(THIS_VOID, const String *file, StorageInterfaceRemoveParam para
 /**********************************************************************************************************************************/
 static const StorageInterface storageInterfaceGcs =
 {
+    .feature = 1 << storageFeatureLimitRead,
+
     .info = storageGcsInfo,
     .infoList = storageGcsInfoList,
     .newRead = storageGcsNewRead,
@@ -859,8 +869,8 @@ static const StorageInterface storageInterfaceGcs =
 Storage *
 storageGcsNew(
     const String *path, bool write, StoragePathExpressionCallback pathExpressionFunction, const String *bucket,
-    StorageGcsKeyType keyType, const String *key, size_t chunkSize, const String *endpoint, TimeMSec timeout, bool verifyPeer,
-    const String *caFile, const String *caPath)
+    StorageGcsKeyType keyType, const String *key, size_t chunkSize, unsigned int downloadConcurrency, const String *endpoint,
+    TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, path);
@@ -870,6 +880,7 @@ storageGcsNew(
         FUNCTION_LOG_PARAM(ENUM, keyType);
         FUNCTION_TEST_PARAM(STRING, key);
         FUNCTION_LOG_PARAM(SIZE, chunkSize);
+        FUNCTION_LOG_PARAM(UINT, downloadConcurrency);
         FUNCTION_LOG_PARAM(STRING, endpoint);
         FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
         FUNCTION_LOG_PARAM(BOOL, verifyPeer);
@@ -881,6 +892,7 @@ storageGcsNew(
     ASSERT(bucket != NULL);
     ASSERT(key != NULL);
     ASSERT(chunkSize != 0);
+    ASSERT(downloadConcurrency != 0);
 
     Storage *this = NULL;
 
@@ -896,6 +908,7 @@ storageGcsNew(
             .bucket = strDup(bucket),
             .keyType = keyType,
             .chunkSize = chunkSize,
+            .downloadConcurrency = downloadConcurrency,
         };
 
         // Handle auth key types
@@ -33,8 +33,8 @@ Query tokens
 /***********************************************************************************************************************************
 JSON tokens
 ***********************************************************************************************************************************/
-#define GCS_JSON_MD5_HASH                                           "md5Hash"
-    VARIANT_DECLARE(GCS_JSON_MD5_HASH_VAR);
+#define GCS_JSON_CRC32C                                             "crc32c"
+    VARIANT_DECLARE(GCS_JSON_CRC32C_VAR);
 #define GCS_JSON_NAME                                               "name"
     VARIANT_DECLARE(GCS_JSON_NAME_VAR);
 #define GCS_JSON_SIZE                                               "size"
@@ -67,6 +67,7 @@ typedef struct StorageGcsResponseParam
     VAR_PARAM_HEADER;
     bool allowMissing;                                              // Allow missing files (caller can check response code)
     bool allowIncomplete;                                           // Allow incomplete resume (used for resumable upload)
+    bool allowRangeNotSatisfiable;                                  // Allow range not satisfiable (caller can check response code)
     bool contentIo;                                                 // Is IoRead interface required to read content?
 } StorageGcsResponseParam;
 
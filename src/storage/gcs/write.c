@@ -19,7 +19,7 @@ GCS query tokens
 ***********************************************************************************************************************************/
 STRING_STATIC(GCS_QUERY_UPLOAD_TYPE_STR,                            "uploadType");
 STRING_STATIC(GCS_QUERY_RESUMABLE_STR,                              "resumable");
-STRING_STATIC(GCS_QUERY_FIELDS_VALUE_STR,                           GCS_JSON_MD5_HASH "," GCS_JSON_SIZE);
+STRING_STATIC(GCS_QUERY_FIELDS_VALUE_STR,                           GCS_JSON_CRC32C "," GCS_JSON_SIZE);
 
 /***********************************************************************************************************************************
 Object type
@@ -35,7 +35,7 @@ typedef struct StorageWriteGcs
     Buffer *chunkBuffer;                                            // Block buffer (stores data until chunkSize is reached)
     const String *uploadId;                                         // Id for resumable upload
     uint64_t uploadTotal;                                           // Total bytes uploaded
-    IoFilter *md5hash;                                              // MD5 hash of file
+    IoFilter *crc32c;                                               // CRC32C checksum of file
 } StorageWriteGcs;
 
 /***********************************************************************************************************************************
@@ -65,7 +65,7 @@ storageWriteGcsOpen(THIS_VOID)
     MEM_CONTEXT_BEGIN(this->memContext)
     {
         this->chunkBuffer = bufNew(this->chunkSize);
-        this->md5hash = cryptoHashNew(HASH_TYPE_MD5_STR);
+        this->crc32c = cryptoHashNew(HASH_TYPE_CRC32C_STR);
     }
     MEM_CONTEXT_END();
 
@@ -85,18 +85,18 @@ storageWriteGcsVerify(StorageWriteGcs *this, HttpResponse *response)
 
     KeyValue *content = jsonToKv(strNewBuf(httpResponseContent(response)));
 
-    // Check the md5 hash
-    const String *md5base64 = varStr(kvGet(content, GCS_JSON_MD5_HASH_VAR));
-    CHECK(md5base64 != NULL);
+    // Check the crc32c checksum (GCS returns it big-endian in base64, which matches the hex representation of the filter result)
+    const String *crc32cBase64 = varStr(kvGet(content, GCS_JSON_CRC32C_VAR));
+    CHECK(crc32cBase64 != NULL);
 
-    const String *md5actual = bufHex(bufNewDecode(encodeBase64, md5base64));
-    const String *md5expected = varStr(ioFilterResult(this->md5hash));
+    const String *crc32cActual = bufHex(bufNewDecode(encodeBase64, crc32cBase64));
+    const String *crc32cExpected = varStr(ioFilterResult(this->crc32c));
 
-    if (!strEq(md5actual, md5expected))
+    if (!strEq(crc32cActual, crc32cExpected))
     {
         THROW_FMT(
-            FormatError, "expected md5 '%s' for '%s' but actual is '%s'", strZ(md5expected), strZ(this->interface.name),
-            strZ(md5actual));
+            FormatError, "expected crc32c '%s' for '%s' but actual is '%s'", strZ(crc32cExpected), strZ(this->interface.name),
+            strZ(crc32cActual));
     }
 
     // Check the size when available
@@ -135,7 +135,7 @@ storageWriteGcsBlock(StorageWriteGcs *this, bool done)
     {
         HttpResponse *response = storageGcsResponseP(this->request, .allowIncomplete = !done);
 
-        // If done then verify the md5 checksum
+        // If done then verify the crc32c checksum
         if (done)
             storageWriteGcsVerify(this, response);
 
@@ -182,8 +182,8 @@ storageWriteGcsBlockAsync(StorageWriteGcs *this, bool done)
             MEM_CONTEXT_END();
         }
 
-        // Add data to md5 hash
-        ioFilterProcessIn(this->md5hash, this->chunkBuffer);
+        // Add data to crc32c checksum
+        ioFilterProcessIn(this->crc32c, this->chunkBuffer);
 
         // Upload the chunk. If this is the last chunk then add the total bytes in the file to the range rather than the * added to
         // prior chunks. This indicates that the resumable upload is complete.
@@ -288,9 +288,9 @@ storageWriteGcsClose(THIS_VOID)
             // Else upload all the data in a single chunk
             else
             {
-                // Add data to md5 hash
+                // Add data to crc32c checksum
                 if (bufUsed(this->chunkBuffer))
-                    ioFilterProcessIn(this->md5hash, this->chunkBuffer);
+                    ioFilterProcessIn(this->crc32c, this->chunkBuffer);
 
                 // Upload file
                 HttpQuery *query = httpQueryNewP();
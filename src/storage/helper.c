@@ -183,7 +183,12 @@ storagePgGet(unsigned int pgIdx, bool write)
     // Use Posix storage
     else
     {
-        result = storagePosixNewP(cfgOptionIdxStr(cfgOptPgPath, pgIdx), .write = write);
+        result = storagePosixNewP(
+            cfgOptionIdxStr(cfgOptPgPath, pgIdx), .write = write,
+            .readPipeline = cfgOptionValid(cfgOptReadPipeline) && cfgOptionBool(cfgOptReadPipeline),
+            .uring = cfgOptionValid(cfgOptIoUring) && cfgOptionBool(cfgOptIoUring),
+            .readAdvise = cfgOptionValid(cfgOptReadAdvise) && cfgOptionBool(cfgOptReadAdvise),
+            .writeFlush = cfgOptionValid(cfgOptWriteFlush) ? cfgOptionUInt64(cfgOptWriteFlush) : 0);
     }
 
     FUNCTION_TEST_RETURN(result);
@@ -363,8 +368,8 @@ storageRepoGet(unsigned int repoIdx, bool write)
                 strEqZ(cfgOptionIdxStr(cfgOptRepoAzureKeyType, repoIdx), STORAGE_AZURE_KEY_TYPE_SHARED) ?
                     storageAzureKeyTypeShared : storageAzureKeyTypeSas,
                 cfgOptionIdxStr(cfgOptRepoAzureKey, repoIdx), STORAGE_AZURE_BLOCKSIZE_MIN,
-                cfgOptionIdxStrNull(cfgOptRepoStorageHost, repoIdx), cfgOptionIdxStr(cfgOptRepoAzureEndpoint, repoIdx),
-                cfgOptionIdxUInt(cfgOptRepoStoragePort, repoIdx), ioTimeoutMs(),
+                cfgOptionIdxUInt(cfgOptRepoStorageReadConcurrency, repoIdx), cfgOptionIdxStrNull(cfgOptRepoStorageHost, repoIdx),
+                cfgOptionIdxStr(cfgOptRepoAzureEndpoint, repoIdx), cfgOptionIdxUInt(cfgOptRepoStoragePort, repoIdx), ioTimeoutMs(),
                 cfgOptionIdxBool(cfgOptRepoStorageVerifyTls, repoIdx), cfgOptionIdxStrNull(cfgOptRepoStorageCaFile, repoIdx),
                 cfgOptionIdxStrNull(cfgOptRepoStorageCaPath, repoIdx));
         }
@@ -384,15 +389,16 @@ storageRepoGet(unsigned int repoIdx, bool write)
                 strEqZ(cfgOptionIdxStr(cfgOptRepoGcsKeyType, repoIdx), STORAGE_GCS_KEY_TYPE_SERVICE) ?
                     storageGcsKeyTypeService : storageGcsKeyTypeToken,
                 cfgOptionIdxStr(cfgOptRepoGcsKey, repoIdx), STORAGE_GCS_CHUNKSIZE_DEFAULT,
-                cfgOptionIdxStr(cfgOptRepoGcsEndpoint, repoIdx), ioTimeoutMs(),
-                cfgOptionIdxBool(cfgOptRepoStorageVerifyTls, repoIdx),
+                cfgOptionIdxUInt(cfgOptRepoStorageReadConcurrency, repoIdx), cfgOptionIdxStr(cfgOptRepoGcsEndpoint, repoIdx),
+                ioTimeoutMs(), cfgOptionIdxBool(cfgOptRepoStorageVerifyTls, repoIdx),
                 cfgOptionIdxStrNull(cfgOptRepoStorageCaFile, repoIdx), cfgOptionIdxStrNull(cfgOptRepoStorageCaPath, repoIdx));
         }
         // Use Posix storage
         else if (strEqZ(type, STORAGE_POSIX_TYPE))
         {
             result = storagePosixNewP(
-                cfgOptionIdxStr(cfgOptRepoPath, repoIdx), .write = write, .pathExpressionFunction = storageRepoPathExpression);
+                cfgOptionIdxStr(cfgOptRepoPath, repoIdx), .write = write, .pathExpressionFunction = storageRepoPathExpression,
+                .uring = cfgOptionValid(cfgOptIoUring) && cfgOptionBool(cfgOptIoUring));
         }
         // Use S3 storage
         else
@@ -421,8 +427,10 @@ storageRepoGet(unsigned int repoIdx, bool write)
                     storageS3KeyTypeShared : storageS3KeyTypeAuto,
                 cfgOptionIdxStrNull(cfgOptRepoS3Key, repoIdx), cfgOptionIdxStrNull(cfgOptRepoS3KeySecret, repoIdx),
                 cfgOptionIdxStrNull(cfgOptRepoS3Token, repoIdx), cfgOptionIdxStrNull(cfgOptRepoS3Role, repoIdx),
-                STORAGE_S3_PARTSIZE_MIN, host, port, ioTimeoutMs(), cfgOptionIdxBool(cfgOptRepoStorageVerifyTls, repoIdx),
-                cfgOptionIdxStrNull(cfgOptRepoStorageCaFile, repoIdx), cfgOptionIdxStrNull(cfgOptRepoStorageCaPath, repoIdx));
+                STORAGE_S3_PARTSIZE_MIN, cfgOptionIdxUInt(cfgOptRepoS3UploadConcurrency, repoIdx),
+                cfgOptionIdxUInt(cfgOptRepoStorageReadConcurrency, repoIdx), host, port, ioTimeoutMs(),
+                cfgOptionIdxBool(cfgOptRepoStorageVerifyTls, repoIdx), cfgOptionIdxStrNull(cfgOptRepoStorageCaFile, repoIdx),
+                cfgOptionIdxStrNull(cfgOptRepoStorageCaPath, repoIdx));
         }
     }
 
@@ -4,27 +4,83 @@ Posix Storage Read
 #include "build.auto.h"
 
 #include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
 #include "common/debug.h"
+#include "common/fork.h"
+#include "common/io/io.h"
 #include "common/io/read.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/type/object.h"
 #include "storage/posix/read.h"
 #include "storage/posix/storage.intern.h"
+#include "storage/posix/uring.h"
 #include "storage/read.intern.h"
 
+/***********************************************************************************************************************************
+copy_file_range() is not declared when only POSIX features are enabled. configure checks that off_t is 64-bit so the declaration
+matches the library.
+***********************************************************************************************************************************/
+#ifdef HAVE_COPY_FILE_RANGE
+
+ssize_t copy_file_range(int fdIn, off_t *offsetIn, int fdOut, off_t *offsetOut, size_t size, unsigned int flags);
+
+#endif // HAVE_COPY_FILE_RANGE
+
+/***********************************************************************************************************************************
+mincore() is not declared when only POSIX features are enabled. configure checks that the library matches this declaration.
+***********************************************************************************************************************************/
+#ifdef HAVE_MINCORE
+
+int mincore(void *addr, size_t length, unsigned char *vec);
+
+#endif // HAVE_MINCORE
+
+/***********************************************************************************************************************************
+Minimum buffers a file must span to be read in a separate process. Forking costs about as much as reading a few buffers so smaller
+files are read faster directly.
+***********************************************************************************************************************************/
+#define STORAGE_READ_POSIX_PIPELINE_BUFFER_MIN                      16
+
 /***********************************************************************************************************************************
 Object types
 ***********************************************************************************************************************************/
+typedef struct StorageReadPosixAhead
+{
+    StoragePosixUringRequest request;                               // Read request
+    unsigned char *data;                                            // Data read
+    size_t size;                                                    // Bytes requested (0 when nothing was requested)
+    size_t used;                                                    // Bytes already copied to the caller
+} StorageReadPosixAhead;
+
 typedef struct StorageReadPosix
 {
     MemContext *memContext;                                         // Object mem context
     StorageReadInterface interface;                                 // Interface
     StoragePosix *storage;                                          // Storage that created this object
 
-    int fd;                                                         // File descriptor
+    int fd;                                                         // File descriptor (pipe when pipelined)
+    bool advise;                                                    // Drop pages that have been read from the page cache?
+    uint64_t adviseDrop;                                            // Bytes dropped from the page cache so far
+    uint64_t adviseBegin;                                           // Offset of the first page in the resident list
+    size_t advisePageSize;                                          // Size of a page in the resident list
+    size_t adviseResidentSize;                                      // Pages in the resident list
+    unsigned char *adviseResident;                                  // Pages in the page cache before the read (bit 0 set)
+    bool pipeline;                                                  // Read the file in a separate process?
+    pid_t processId;                                                // Pipeline process id (0 when not pipelined)
+    bool uring;                                                     // Read ahead with io_uring?
+    StoragePosixUring *ring;                                        // io_uring (NULL when not reading ahead)
+    StorageReadPosixAhead ahead[STORAGE_POSIX_URING_DEPTH];         // Read-ahead buffers
+    unsigned int aheadIdx;                                          // Read-ahead buffer to be copied next
+    uint64_t aheadRequested;                                        // Bytes requested from the file so far
+    int copyFd;                                                     // Copy data into this file (-1 when not copying)
+    bool copyKernel;                                                // Copy in the kernel with copy_file_range()?
+    unsigned char *copyVerify;                                      // Buffer to verify the source did not change during a copy
     uint64_t current;                                               // Current bytes read from file
     uint64_t limit;                                                 // Limit bytes to be read from file (UINT64_MAX for no limit)
     bool eof;
@@ -55,6 +111,533 @@ storageReadPosixFreeResource(THIS_VOID)
     if (this->fd != -1)
         THROW_ON_SYS_ERROR_FMT(close(this->fd) == -1, FileCloseError, STORAGE_ERROR_READ_CLOSE, strZ(this->interface.name));
 
+    // Wait for the pipeline process to exit. If the read was not complete the process exits on a broken pipe as soon as the pipe
+    // is closed above so the exit status is not checked.
+    if (this->processId != 0)
+    {
+        THROW_ON_SYS_ERROR(waitpid(this->processId, NULL, 0) == -1, ExecuteError, "unable to wait on pipeline process");
+        this->processId = 0;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Find the pages in the range to be read that are already in the page cache, since they may belong to the working set of other
+processes and should not be dropped after the read. mincore() only reports the page cache for files the process owns or can write
+(otherwise pages are reported as not present) so the check is limited to files owned by the process, which is the case for the
+cluster. Returns false when the pages in the page cache cannot be determined.
+***********************************************************************************************************************************/
+#ifdef HAVE_MINCORE
+
+static bool
+storageReadPosixAdviseResident(StorageReadPosix *const this, const uid_t owner, const uint64_t size)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+        FUNCTION_LOG_PARAM(UINT, owner);
+        FUNCTION_LOG_PARAM(UINT64, size);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->fd != -1);
+
+    bool result = false;
+
+    if (size > 0 && owner == geteuid())
+    {
+        this->advisePageSize = (size_t)sysconf(_SC_PAGESIZE);
+        this->adviseBegin = this->interface.offset / this->advisePageSize * this->advisePageSize;
+
+        // Map the range to check which pages are in the page cache. Mapping does not read the file.
+        const size_t mapSize = (size_t)(this->interface.offset + size - this->adviseBegin);
+        void *const map = mmap(NULL, mapSize, PROT_READ, MAP_SHARED, this->fd, (off_t)this->adviseBegin);
+
+        if (map != MAP_FAILED)                                                                       // {uncovered_branch - no fail}
+        {
+            MEM_CONTEXT_BEGIN(this->memContext)
+            {
+                this->adviseResidentSize = (mapSize + this->advisePageSize - 1) / this->advisePageSize;
+                this->adviseResident = memNew(this->adviseResidentSize);
+            }
+            MEM_CONTEXT_END();
+
+            result = mincore(map, mapSize, this->adviseResident) == 0;
+            munmap(map, mapSize);
+        }
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+#endif // HAVE_MINCORE
+
+/***********************************************************************************************************************************
+Drop pages in a range that has been read from the page cache, except pages that were in the page cache before the read. Pages past
+the end of the resident list are not dropped since it is not known if they were in the page cache. Only system calls are used since
+this is also called from the pipeline process. The advice is only a hint so errors are ignored.
+***********************************************************************************************************************************/
+static void
+storageReadPosixAdviseDropRange(const StorageReadPosix *const this, const uint64_t offset, const uint64_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, this);
+        FUNCTION_TEST_PARAM(UINT64, offset);
+        FUNCTION_TEST_PARAM(UINT64, size);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->adviseResident != NULL);
+    ASSERT(offset >= this->adviseBegin);
+
+    const uint64_t end = offset + size;
+    uint64_t pageIdx = (offset - this->adviseBegin) / this->advisePageSize;
+    uint64_t pageEnd = (end - this->adviseBegin + this->advisePageSize - 1) / this->advisePageSize;
+
+    if (pageEnd > this->adviseResidentSize)
+        pageEnd = this->adviseResidentSize;
+
+    while (pageIdx < pageEnd)
+    {
+        // Skip pages that were in the page cache before the read
+        if (this->adviseResident[pageIdx] & 1)
+            pageIdx++;
+        // Else drop pages up to the next page that was in the page cache before the read
+        else
+        {
+            uint64_t dropBegin = this->adviseBegin + pageIdx * this->advisePageSize;
+
+            while (pageIdx < pageEnd && !(this->adviseResident[pageIdx] & 1))
+                pageIdx++;
+
+            uint64_t dropEnd = this->adviseBegin + pageIdx * this->advisePageSize;
+
+            if (dropBegin < offset)
+                dropBegin = offset;
+
+            if (dropEnd > end)
+                dropEnd = end;
+
+            posix_fadvise(this->fd, (off_t)dropBegin, (off_t)(dropEnd - dropBegin), POSIX_FADV_DONTNEED);
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Read the file in a separate process that writes to a pipe
+
+The process reads the next buffer from disk while the filters (e.g. checksum, compression, encryption) are processing the prior
+buffer, so the I/O and CPU time overlap. The pipe provides back pressure so no more than about one buffer is read ahead. Only
+system calls are used in the child process since it must not run any cleanup belonging to the parent, so the buffer is allocated
+before the fork.
+***********************************************************************************************************************************/
+static void
+storageReadPosixPipeline(StorageReadPosix *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->fd != -1);
+    ASSERT(this->processId == 0);
+
+    // Close the pipe on exec so it is not inherited by commands run while the file is being read, which would keep the pipe open
+    int pipeFd[2];
+    THROW_ON_SYS_ERROR_FMT(pipe(pipeFd) == -1, KernelError, "unable to create pipeline for '%s'", strZ(this->interface.name));
+
+    for (unsigned int pipeIdx = 0; pipeIdx < 2; pipeIdx++)
+    {
+        THROW_ON_SYS_ERROR_FMT(
+            fcntl(pipeFd[pipeIdx], F_SETFD, FD_CLOEXEC) == -1, KernelError, "unable to set FD_CLOEXEC on pipeline for '%s'",
+            strZ(this->interface.name));
+    }
+
+    pid_t processId;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const size_t bufferSize = ioBufferSize();
+        unsigned char *const buffer = memNew(bufferSize);
+
+        processId = forkSafe();
+
+        if (processId == 0)
+        {
+            close(pipeFd[0]);
+
+            uint64_t remains = this->limit - this->current;
+            off_t offset = (off_t)(this->interface.offset + this->current);
+
+            while (remains > 0)
+            {
+                const ssize_t readSize = read(this->fd, buffer, remains < bufferSize ? (size_t)remains : bufferSize);
+
+                if (readSize == -1)
+                    _exit(errno);
+
+                if (readSize == 0)
+                    break;
+
+                // Drop pages that have been read from the page cache
+                if (this->advise)
+                    storageReadPosixAdviseDropRange(this, (uint64_t)offset, (uint64_t)readSize);
+
+                offset += readSize;
+
+                for (ssize_t writeTotal = 0; writeTotal < readSize;)
+                {
+                    const ssize_t writeSize = write(pipeFd[1], buffer + writeTotal, (size_t)(readSize - writeTotal));
+
+                    if (writeSize == -1)
+                        _exit(errno);
+
+                    writeTotal += writeSize;
+                }
+
+                remains -= (uint64_t)readSize;
+            }
+
+            _exit(0);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    // Replace the file descriptor with the read end of the pipe
+    close(pipeFd[1]);
+    close(this->fd);
+
+    this->fd = pipeFd[0];
+    this->processId = processId;
+
+    // The pipeline process drops pages from the page cache itself
+    this->advise = false;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Wait for the pipeline process to exit after all data has been read and report any error it encountered
+***********************************************************************************************************************************/
+static void
+storageReadPosixPipelineEnd(StorageReadPosix *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->processId != 0);
+
+    int processStatus;
+
+    THROW_ON_SYS_ERROR(waitpid(this->processId, &processStatus, 0) == -1, ExecuteError, "unable to wait on pipeline process");
+    this->processId = 0;
+
+    // The process exits with errno on error. The process is not expected to be signaled here since the pipe is still open.
+    const int errNo = WIFEXITED(processStatus) ? WEXITSTATUS(processStatus) : EIO;  // {uncovered_branch - not signaled}
+
+    if (errNo != 0)
+        THROW_SYS_ERROR_CODE_FMT(errNo, FileReadError, "unable to read '%s'", strZ(this->interface.name));
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Drop pages that have been read from the page cache so a full scan of the cluster does not evict the working set of other processes.
+Pages are dropped a buffer at a time rather than after each read.
+***********************************************************************************************************************************/
+static void
+storageReadPosixAdviseDrop(StorageReadPosix *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->advise);
+
+    if (this->current - this->adviseDrop >= ioBufferSize() || (this->eof && this->current > this->adviseDrop))
+    {
+        storageReadPosixAdviseDropRange(this, this->interface.offset + this->adviseDrop, this->current - this->adviseDrop);
+        this->adviseDrop = this->current;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Request the next buffer of the file into a read-ahead buffer. Nothing is requested once the limit has been reached.
+***********************************************************************************************************************************/
+static void
+storageReadPosixAheadRequest(StorageReadPosix *const this, StorageReadPosixAhead *const ahead)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+        FUNCTION_LOG_PARAM_P(VOID, ahead);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->ring != NULL);
+    ASSERT(ahead != NULL);
+
+    const uint64_t remains = this->limit - this->aheadRequested;
+
+    ahead->size = remains < ioBufferSize() ? (size_t)remains : ioBufferSize();
+    ahead->used = 0;
+
+    if (ahead->size > 0)
+    {
+        storagePosixUringRead(
+            this->ring, &ahead->request, this->fd, ahead->data, ahead->size, this->interface.offset + this->aheadRequested);
+        this->aheadRequested += ahead->size;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Read ahead with io_uring
+
+Several buffers are requested from the kernel at once so the next reads are already in progress (or complete) while the filters are
+processing the current buffer. If io_uring is not available then the file is read normally.
+***********************************************************************************************************************************/
+static bool
+storageReadPosixAhead(StorageReadPosix *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->fd != -1);
+    ASSERT(this->ring == NULL);
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        this->ring = storagePosixUringNew();
+
+        if (this->ring != NULL)
+        {
+            for (unsigned int aheadIdx = 0; aheadIdx < STORAGE_POSIX_URING_DEPTH; aheadIdx++)
+            {
+                StorageReadPosixAhead *const ahead = &this->ahead[aheadIdx];
+
+                if (ahead->data == NULL)
+                    ahead->data = memNew(ioBufferSize());
+
+                storageReadPosixAheadRequest(this, ahead);
+            }
+
+            storagePosixUringSubmit(this->ring);
+        }
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_LOG_RETURN(BOOL, this->ring != NULL);
+}
+
+/***********************************************************************************************************************************
+Copy read-ahead buffers into the caller's buffer, requesting more as each buffer is emptied
+***********************************************************************************************************************************/
+static size_t
+storageReadPosixAheadCopy(StorageReadPosix *const this, Buffer *const buffer)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->ring != NULL);
+    ASSERT(buffer != NULL);
+
+    size_t result = 0;
+
+    while (!this->eof && !bufFull(buffer))
+    {
+        StorageReadPosixAhead *const ahead = &this->ahead[this->aheadIdx];
+        ASSERT(ahead->size > 0);
+
+        storagePosixUringWait(this->ring, &ahead->request);
+
+        if (ahead->request.result < 0)
+            THROW_SYS_ERROR_CODE_FMT(-ahead->request.result, FileReadError, "unable to read '%s'", strZ(this->interface.name));
+
+        // Copy as much as will fit
+        const size_t available = (size_t)ahead->request.result - ahead->used;
+        const size_t copySize = available < bufRemains(buffer) ? available : bufRemains(buffer);
+
+        memcpy(bufRemainsPtr(buffer), ahead->data + ahead->used, copySize);
+        bufUsedInc(buffer, copySize);
+        ahead->used += copySize;
+        this->current += copySize;
+        result += copySize;
+
+        // When the read-ahead buffer is empty, EOF if the read was short or the limit has been reached, else reuse the buffer for
+        // the next request and move to the following buffer. Any reads past EOF are still in progress but their results are
+        // ignored.
+        if (ahead->used == (size_t)ahead->request.result)
+        {
+            if (ahead->used != ahead->size || this->current == this->limit)
+                this->eof = true;
+            else
+            {
+                storageReadPosixAheadRequest(this, ahead);
+                storagePosixUringSubmit(this->ring);
+
+                this->aheadIdx = (this->aheadIdx + 1) % STORAGE_POSIX_URING_DEPTH;
+            }
+        }
+    }
+
+    FUNCTION_LOG_RETURN(SIZE, result);
+}
+
+/***********************************************************************************************************************************
+Copy data into a file as it is read
+
+Data is copied in the kernel with copy_file_range() when possible so it is not written from user space, and filesystems that support
+it (e.g. XFS, btrfs) may share extents rather than copying. This is only requested when no filters produce output, i.e. filters such
+as size and hash only need to see the data. The filters process the data read from the source as usual and the copy is made from the
+same range of the source, so the destination is never read. When the file is being read ahead or the kernel cannot copy between the
+files then data is written to the destination after it is read.
+***********************************************************************************************************************************/
+static void
+storageReadPosixCopyTo(THIS_VOID, const int fd)
+{
+    THIS(StorageReadPosix);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+        FUNCTION_LOG_PARAM(INT, fd);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->fd != -1);
+    ASSERT(this->current == 0);
+    ASSERT(fd != -1);
+
+    this->copyFd = fd;
+
+#ifdef HAVE_COPY_FILE_RANGE
+    this->copyKernel = this->ring == NULL && this->processId == 0;
+
+    if (this->copyKernel)
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            this->copyVerify = memNew(ioBufferSize());
+        }
+        MEM_CONTEXT_END();
+    }
+#endif
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Copy a range that has been read in the kernel and return the size copied. The range is then read from the source again (it was just
+read so it is in the page cache) and compared with the data that was read, since the source may have changed between the read and
+the copy, e.g. a cluster file being written during backup. Nothing is reported as copied when the data does not match so the data
+that was read, which is what the filters processed, is written over the copy.
+***********************************************************************************************************************************/
+#ifdef HAVE_COPY_FILE_RANGE
+
+static size_t
+storageReadPosixCopy(StorageReadPosix *const this, const unsigned char *const data, const size_t size, const uint64_t offset)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, data);
+        FUNCTION_LOG_PARAM(SIZE, size);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->copyKernel);
+    ASSERT(data != NULL);
+
+    size_t result = 0;
+
+    // Less than requested may be copied so continue until the range has been copied or the source is shorter than it was
+    while (result < size)
+    {
+        off_t offsetIn = (off_t)(this->interface.offset + offset + result);
+        off_t offsetOut = (off_t)(offset + result);
+        const ssize_t copyBytes = copy_file_range(this->fd, &offsetIn, this->copyFd, &offsetOut, size - result, 0);
+
+        if (copyBytes == -1)
+        {
+            // If the kernel cannot copy between the files (e.g. they are on different filesystems) then write instead
+            if (errno != EXDEV && errno != EINVAL && errno != EOPNOTSUPP && errno != ENOSYS)
+                THROW_SYS_ERROR_FMT(FileReadError, "unable to copy '%s'", strZ(this->interface.name));
+
+            this->copyKernel = false;
+            break;
+        }
+
+        if (copyBytes == 0)
+            break;
+
+        result += (size_t)copyBytes;
+    }
+
+    // Make sure the source has not changed since it was read
+    for (size_t verified = 0; verified < result;)
+    {
+        const size_t verifySize = result - verified < ioBufferSize() ? result - verified : ioBufferSize();
+        const ssize_t verifyBytes = pread(
+            this->fd, this->copyVerify, verifySize, (off_t)(this->interface.offset + offset + verified));
+
+        if (verifyBytes == -1)
+            THROW_SYS_ERROR_FMT(FileReadError, "unable to read '%s'", strZ(this->interface.name));
+
+        if ((size_t)verifyBytes != verifySize || memcmp(this->copyVerify, data + verified, verifySize) != 0)
+        {
+            result = 0;
+            break;
+        }
+
+        verified += verifySize;
+    }
+
+    FUNCTION_LOG_RETURN(SIZE, result);
+}
+
+#endif // HAVE_COPY_FILE_RANGE
+
+/***********************************************************************************************************************************
+Write data that was read to the copy destination
+***********************************************************************************************************************************/
+static void
+storageReadPosixCopyWrite(StorageReadPosix *const this, const unsigned char *const data, const size_t size, const uint64_t offset)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, data);
+        FUNCTION_LOG_PARAM(SIZE, size);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->copyFd != -1);
+    ASSERT(data != NULL);
+
+    size_t written = 0;
+
+    while (written < size)
+    {
+        const ssize_t writeBytes = pwrite(this->copyFd, data + written, size - written, (off_t)(offset + written));
+
+        if (writeBytes == -1)
+            THROW_SYS_ERROR_FMT(FileWriteError, "unable to write copy of '%s'", strZ(this->interface.name));
+
+        written += (size_t)writeBytes;
+    }
+
     FUNCTION_LOG_RETURN_VOID();
 }
 
@@ -76,7 +659,7 @@ storageReadPosixOpen(THIS_VOID)
     bool result = false;
 
     // Open the file
-    this->fd = open(strZ(this->interface.name), O_RDONLY, 0);
+    this->fd = open(strZ(this->interface.name), O_RDONLY | O_CLOEXEC, 0);
 
     // Handle errors
     if (this->fd == -1)
@@ -94,6 +677,55 @@ storageReadPosixOpen(THIS_VOID)
     if (this->fd != -1)
     {
         memContextCallbackSet(this->memContext, storageReadPosixFreeResource, this);
+
+        // Seek to offset
+        if (this->interface.offset != 0)
+        {
+            THROW_ON_SYS_ERROR_FMT(
+                lseek(this->fd, (off_t)this->interface.offset, SEEK_SET) == -1, FileOpenError, STORAGE_ERROR_READ_SEEK,
+                this->interface.offset, strZ(this->interface.name));
+        }
+
+        // Get the size to be read when needed to decide how to read the file
+        if (this->advise || this->uring || this->pipeline)
+        {
+            struct stat statFile;
+
+            THROW_ON_SYS_ERROR_FMT(
+                fstat(this->fd, &statFile) == -1, FileOpenError, STORAGE_ERROR_READ_OPEN, strZ(this->interface.name));
+
+            uint64_t size = (uint64_t)statFile.st_size > this->interface.offset ?
+                (uint64_t)statFile.st_size - this->interface.offset : 0;
+
+            if (size > this->limit)
+                size = this->limit;
+
+            // Advise the kernel that the file will be read sequentially (so read-ahead is more aggressive) and only once. Pages are
+            // only dropped after they are read when it is known which pages were in the page cache before the read, otherwise the
+            // advice is left to limit page cache use. The advice is only a hint so errors are ignored.
+            if (this->advise)
+            {
+                const off_t adviseSize = this->limit == UINT64_MAX ? 0 : (off_t)this->limit;
+
+                posix_fadvise(this->fd, (off_t)this->interface.offset, adviseSize, POSIX_FADV_SEQUENTIAL);
+                posix_fadvise(this->fd, (off_t)this->interface.offset, adviseSize, POSIX_FADV_NOREUSE);
+
+#ifdef HAVE_MINCORE
+                this->advise = storageReadPosixAdviseResident(this, statFile.st_uid, size);
+#else
+                this->advise = false;
+#endif
+            }
+
+            // Read ahead when there is more than one buffer to read, otherwise there is nothing to overlap. Use a separate process
+            // when io_uring is not available and the file is large enough to be worth the cost of forking.
+            if (size > ioBufferSize() && !(this->uring && storageReadPosixAhead(this)) && this->pipeline &&
+                size >= (uint64_t)ioBufferSize() * STORAGE_READ_POSIX_PIPELINE_BUFFER_MIN)
+            {
+                storageReadPosixPipeline(this);
+            }
+        }
+
         result = true;
     }
 
@@ -120,7 +752,9 @@ storageReadPosix(THIS_VOID, Buffer *buffer, bool block)
     // Read if EOF has not been reached
     ssize_t actualBytes = 0;
 
-    if (!this->eof)
+    if (this->ring != NULL)
+        actualBytes = (ssize_t)storageReadPosixAheadCopy(this, buffer);
+    else if (!this->eof)
     {
         // Determine expected bytes to read. If remaining size in the buffer would exceed the limit then reduce the expected read.
         size_t expectedBytes = bufRemains(buffer);
@@ -128,23 +762,56 @@ storageReadPosix(THIS_VOID, Buffer *buffer, bool block)
         if (this->current + expectedBytes > this->limit)
             expectedBytes = (size_t)(this->limit - this->current);
 
-        // Read from file
-        actualBytes = read(this->fd, bufRemainsPtr(buffer), expectedBytes);
+        // Read from file. A pipe may return less than requested before the end so keep reading until the pipe is empty and closed.
+        ssize_t readBytes;
 
-        // Error occurred during read
-        if (actualBytes == -1)
-            THROW_SYS_ERROR_FMT(FileReadError, "unable to read '%s'", strZ(this->interface.name));
+        do
+        {
+            readBytes = read(this->fd, bufRemainsPtr(buffer), expectedBytes - (size_t)actualBytes);
+
+            // Error occurred during read
+            if (readBytes == -1)
+                THROW_SYS_ERROR_FMT(FileReadError, "unable to read '%s'", strZ(this->interface.name));
+
+            // Update amount of buffer used
+            bufUsedInc(buffer, (size_t)readBytes);
+            actualBytes += readBytes;
+        }
+        while (this->processId != 0 && readBytes != 0 && (size_t)actualBytes != expectedBytes);
 
-        // Update amount of buffer used
-        bufUsedInc(buffer, (size_t)actualBytes);
         this->current += (uint64_t)actualBytes;
 
         // If less data than expected was read or the limit has been reached then EOF.  The file may not actually be EOF but we are
         // not concerned with files that are growing.  Just read up to the point where the file is being extended.
         if ((size_t)actualBytes != expectedBytes || this->current == this->limit)
+        {
             this->eof = true;
+
+            // Make sure the pipeline process did not stop early because of an error
+            if (this->processId != 0)
+                storageReadPosixPipelineEnd(this);
+        }
     }
 
+    // Copy data that was read to the destination, in the kernel when possible
+    if (this->copyFd != -1 && actualBytes > 0)
+    {
+        const unsigned char *const data = bufPtr(buffer) + bufUsed(buffer) - (size_t)actualBytes;
+        const uint64_t offset = this->current - (uint64_t)actualBytes;
+        size_t copyBytes = 0;
+
+#ifdef HAVE_COPY_FILE_RANGE
+        if (this->copyKernel)
+            copyBytes = storageReadPosixCopy(this, data, (size_t)actualBytes, offset);
+#endif
+
+        if ((size_t)actualBytes > copyBytes)
+            storageReadPosixCopyWrite(this, data + copyBytes, (size_t)actualBytes - copyBytes, offset + copyBytes);
+    }
+
+    if (this->advise)
+        storageReadPosixAdviseDrop(this);
+
     FUNCTION_LOG_RETURN(SIZE, (size_t)actualBytes);
 }
 
@@ -162,6 +829,14 @@ storageReadPosixClose(THIS_VOID)
 
     ASSERT(this != NULL);
 
+    // Free the ring first since it waits for outstanding reads, which must not outlive the file descriptor or buffers. When the
+    // object is freed instead the ring is freed before the callback runs since it is a child context.
+    if (this->ring != NULL)
+    {
+        storagePosixUringFree(this->ring);
+        this->ring = NULL;
+    }
+
     memContextCallbackClear(this->memContext);
     storageReadPosixFreeResource(this);
     this->fd = -1;
@@ -205,12 +880,18 @@ storageReadPosixFd(const THIS_VOID)
 
 /**********************************************************************************************************************************/
 StorageRead *
-storageReadPosixNew(StoragePosix *storage, const String *name, bool ignoreMissing, const Variant *limit)
+storageReadPosixNew(
+    StoragePosix *storage, const String *name, bool ignoreMissing, uint64_t offset, const Variant *limit, bool pipeline,
+    bool uring, bool advise)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, offset);
         FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(BOOL, pipeline);
+        FUNCTION_LOG_PARAM(BOOL, uring);
+        FUNCTION_LOG_PARAM(BOOL, advise);
     FUNCTION_LOG_END();
 
     ASSERT(name != NULL);
@@ -226,6 +907,10 @@ storageReadPosixNew(StoragePosix *storage, const String *name, bool ignoreMissin
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
             .fd = -1,
+            .copyFd = -1,
+            .pipeline = pipeline,
+            .uring = uring,
+            .advise = advise,
 
             // Rather than enable/disable limit checking just use a big number when there is no limit.  We can feel pretty confident
             // that no files will be > UINT64_MAX in size. This is a copy of the interface limit but it simplifies the code during
@@ -237,7 +922,9 @@ storageReadPosixNew(StoragePosix *storage, const String *name, bool ignoreMissin
                 .type = STORAGE_POSIX_TYPE_STR,
                 .name = strDup(name),
                 .ignoreMissing = ignoreMissing,
+                .offset = offset,
                 .limit = varDup(limit),
+                .copyTo = storageReadPosixCopyTo,
 
                 .ioInterface = (IoReadInterface)
                 {
@@ -26,6 +26,21 @@ Storage type
 ***********************************************************************************************************************************/
 STRING_EXTERN(STORAGE_POSIX_TYPE_STR,                               STORAGE_POSIX_TYPE);
 
+/***********************************************************************************************************************************
+The directory entry types are not defined when only POSIX features are enabled even though glibc returns the type with each entry.
+The values are the same on all platforms that return the type.
+***********************************************************************************************************************************/
+#ifdef _DIRENT_HAVE_D_TYPE
+
+#ifndef DT_UNKNOWN
+    #define DT_UNKNOWN                                              0
+    #define DT_DIR                                                  4
+    #define DT_REG                                                  8
+    #define DT_LNK                                                  10
+#endif
+
+#endif // _DIRENT_HAVE_D_TYPE
+
 /***********************************************************************************************************************************
 Define PATH_MAX if it is not defined
 ***********************************************************************************************************************************/
@@ -40,6 +55,10 @@ struct StoragePosix
 {
     STORAGE_COMMON_MEMBER;
     MemContext *memContext;                                         // Object memory context
+    bool readPipeline;                                              // Read files in a separate process?
+    bool uring;                                                     // Queue reads/writes with io_uring?
+    bool readAdvise;                                                // Advise the kernel that files are read once sequentially?
+    uint64_t writeFlush;                                            // Bytes to write before flushing (0 to disable)
 };
 
 /**********************************************************************************************************************************/
@@ -154,6 +173,51 @@ storagePosixInfoListEntry(
     FUNCTION_TEST_RETURN_VOID();
 }
 
+// Helper to get the type of a directory entry without calling stat(). Returns false when the type is not known, e.g. the filesystem
+// does not return the type with directory entries.
+static bool
+storagePosixInfoListType(const struct dirent *const dirEntry, StorageType *const type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, dirEntry);
+        FUNCTION_TEST_PARAM_P(VOID, type);
+    FUNCTION_TEST_END();
+
+    ASSERT(dirEntry != NULL);
+    ASSERT(type != NULL);
+
+    bool result = true;
+
+#ifdef _DIRENT_HAVE_D_TYPE
+    switch (dirEntry->d_type)
+    {
+        case DT_REG:
+            *type = storageTypeFile;
+            break;
+
+        case DT_DIR:
+            *type = storageTypePath;
+            break;
+
+        case DT_LNK:
+            *type = storageTypeLink;
+            break;
+
+        case DT_UNKNOWN:
+            result = false;
+            break;
+
+        default:
+            *type = storageTypeSpecial;
+            break;
+    }
+#else
+    result = false;
+#endif // _DIRENT_HAVE_D_TYPE
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 static bool
 storagePosixInfoList(
     THIS_VOID, const String *path, StorageInfoLevel level, StorageInfoListCallback callback, void *callbackData,
@@ -206,10 +270,20 @@ storagePosixInfoList(
                     {
                         // If only making a list of files that exist then no need to go get detailed info which requires calling
                         // stat() and is therefore relatively slow
+                        StorageType type;
+
                         if (level == storageInfoLevelExists)
                         {
                             callback(callbackData, &(StorageInfo){.name = name, .level = storageInfoLevelExists, .exists = true});
                         }
+                        // Else if only the type is required then use the type returned with the entry when available, which avoids
+                        // calling stat() for every entry in large directories
+                        else if (level == storageInfoLevelType && storagePosixInfoListType(dirEntry, &type))
+                        {
+                            callback(
+                                callbackData,
+                                &(StorageInfo){.name = name, .level = storageInfoLevelType, .exists = true, .type = type});
+                        }
                         // Else more info is required which requires a call to stat()
                         else
                             storagePosixInfoListEntry(this, path, name, level, callback, callbackData);
@@ -317,13 +391,17 @@ storagePosixNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageIn
         FUNCTION_LOG_PARAM(STORAGE_POSIX, this);
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
         FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(file != NULL);
 
-    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadPosixNew(this, file, ignoreMissing, param.limit));
+    FUNCTION_LOG_RETURN(
+        STORAGE_READ,
+        storageReadPosixNew(
+            this, file, ignoreMissing, param.offset, param.limit, this->readPipeline, this->uring, this->readAdvise));
 }
 
 /**********************************************************************************************************************************/
@@ -353,7 +431,8 @@ storagePosixNewWrite(THIS_VOID, const String *file, StorageInterfaceNewWritePara
         STORAGE_WRITE,
         storageWritePosixNew(
             this, file, param.modeFile, param.modePath, param.user, param.group, param.timeModified, param.createPath,
-            param.syncFile, this->interface.pathSync != NULL ? param.syncPath : false, param.atomic));
+            param.syncFile, this->interface.pathSync != NULL ? param.syncPath : false, param.atomic, this->uring,
+            this->writeFlush));
 }
 
 /**********************************************************************************************************************************/
@@ -568,7 +647,8 @@ static const StorageInterface storageInterfacePosix =
 Storage *
 storagePosixNewInternal(
     const String *type, const String *path, mode_t modeFile, mode_t modePath, bool write,
-    StoragePathExpressionCallback pathExpressionFunction, bool pathSync)
+    StoragePathExpressionCallback pathExpressionFunction, bool pathSync, bool readPipeline, bool uring, bool readAdvise,
+    uint64_t writeFlush)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, type);
@@ -578,6 +658,10 @@ storagePosixNewInternal(
         FUNCTION_LOG_PARAM(BOOL, write);
         FUNCTION_LOG_PARAM(FUNCTIONP, pathExpressionFunction);
         FUNCTION_LOG_PARAM(BOOL, pathSync);
+        FUNCTION_LOG_PARAM(BOOL, readPipeline);
+        FUNCTION_LOG_PARAM(BOOL, uring);
+        FUNCTION_LOG_PARAM(BOOL, readAdvise);
+        FUNCTION_LOG_PARAM(UINT64, writeFlush);
     FUNCTION_LOG_END();
 
     ASSERT(type != NULL);
@@ -599,6 +683,10 @@ storagePosixNewInternal(
         {
             .memContext = MEM_CONTEXT_NEW(),
             .interface = storageInterfacePosix,
+            .readPipeline = readPipeline,
+            .uring = uring,
+            .readAdvise = readAdvise,
+            .writeFlush = writeFlush,
         };
 
         // Disable path sync when not supported
@@ -627,11 +715,16 @@ storagePosixNew(const String *path, StoragePosixNewParam param)
         FUNCTION_LOG_PARAM(MODE, param.modePath);
         FUNCTION_LOG_PARAM(BOOL, param.write);
         FUNCTION_LOG_PARAM(FUNCTIONP, param.pathExpressionFunction);
+        FUNCTION_LOG_PARAM(BOOL, param.readPipeline);
+        FUNCTION_LOG_PARAM(BOOL, param.uring);
+        FUNCTION_LOG_PARAM(BOOL, param.readAdvise);
+        FUNCTION_LOG_PARAM(UINT64, param.writeFlush);
     FUNCTION_LOG_END();
 
     FUNCTION_LOG_RETURN(
         STORAGE,
         storagePosixNewInternal(
             STORAGE_POSIX_TYPE_STR, path, param.modeFile == 0 ? STORAGE_MODE_FILE_DEFAULT : param.modeFile,
-            param.modePath == 0 ? STORAGE_MODE_PATH_DEFAULT : param.modePath, param.write, param.pathExpressionFunction, true));
+            param.modePath == 0 ? STORAGE_MODE_PATH_DEFAULT : param.modePath, param.write, param.pathExpressionFunction, true,
+            param.readPipeline, param.uring, param.readAdvise, param.writeFlush));
 }
@@ -27,6 +27,10 @@ typedef struct StoragePosixNewParam
     mode_t modeFile;
     mode_t modePath;
     StoragePathExpressionCallback *pathExpressionFunction;
+    bool readPipeline;
+    bool uring;
+    bool readAdvise;
+    uint64_t writeFlush;
 } StoragePosixNewParam;
 
 #define storagePosixNewP(path, ...)                                                                                                \
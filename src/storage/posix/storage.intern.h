@@ -12,7 +12,8 @@ Constructors
 ***********************************************************************************************************************************/
 Storage *storagePosixNewInternal(
     const String *type, const String *path, mode_t modeFile, mode_t modePath, bool write,
-    StoragePathExpressionCallback pathExpressionFunction, bool pathSync);
+    StoragePathExpressionCallback pathExpressionFunction, bool pathSync, bool readPipeline, bool uring, bool readAdvise,
+    uint64_t writeFlush);
 
 /***********************************************************************************************************************************
 Functions
@@ -0,0 +1,433 @@
+/***********************************************************************************************************************************
+Posix Storage io_uring
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "storage/posix/uring.h"
+
+#ifdef HAVE_IO_URING
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// syscall() is not declared when only POSIX features are enabled
+long syscall(long number, ...);
+
+/***********************************************************************************************************************************
+Ring size. Allow for a full set of buffers plus the sync request that follows them.
+***********************************************************************************************************************************/
+#define STORAGE_POSIX_URING_ENTRIES                                 (STORAGE_POSIX_URING_DEPTH * 2)
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct StoragePosixUring
+{
+    MemContext *memContext;                                         // Mem context
+    int fd;                                                         // Ring file descriptor
+    unsigned int queued;                                            // Requests queued but not yet submitted
+    unsigned int inFlight;                                          // Requests submitted but not yet complete
+
+    void *sqRing;                                                   // Submission ring mapping
+    size_t sqRingSize;                                              // Submission ring mapping size
+    unsigned int *sqHead;                                           // Submission ring head (updated by the kernel)
+    unsigned int *sqTail;                                           // Submission ring tail
+    unsigned int sqMask;                                            // Submission ring index mask
+    unsigned int sqEntries;                                         // Submission ring entries
+    unsigned int *sqArray;                                          // Submission ring index array
+    struct io_uring_sqe *sqe;                                       // Submission entries
+    size_t sqeSize;                                                 // Submission entries mapping size
+
+    void *cqRing;                                                   // Completion ring mapping (may be the same as sqRing)
+    size_t cqRingSize;                                              // Completion ring mapping size
+    unsigned int *cqHead;                                           // Completion ring head
+    unsigned int *cqTail;                                           // Completion ring tail (updated by the kernel)
+    unsigned int cqMask;                                            // Completion ring index mask
+    struct io_uring_cqe *cqe;                                       // Completion entries
+};
+
+/***********************************************************************************************************************************
+Unmap the rings and close the ring file descriptor
+***********************************************************************************************************************************/
+static void
+storagePosixUringRelease(StoragePosixUring *const this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, this);
+    FUNCTION_TEST_END();
+
+    if (this->sqe != NULL)
+        munmap(this->sqe, this->sqeSize);
+
+    if (this->cqRing != NULL && this->cqRing != this->sqRing)
+        munmap(this->cqRing, this->cqRingSize);
+
+    if (this->sqRing != NULL)
+        munmap(this->sqRing, this->sqRingSize);
+
+    close(this->fd);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Submit queued requests and optionally wait for at least one completion, then collect all completions
+***********************************************************************************************************************************/
+static void
+storagePosixUringEnter(StoragePosixUring *const this, const bool wait)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM(BOOL, wait);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!wait || this->queued + this->inFlight > 0);
+
+    // Submit requests and wait. Retry when interrupted by a signal.
+    const long result = syscall(
+        __NR_io_uring_enter, this->fd, this->queued, wait ? 1 : 0, wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+
+    if (result == -1)
+    {
+        if (errno != EINTR)                                                                   // {uncovered - no way to force error}
+            THROW_SYS_ERROR(KernelError, "unable to submit io_uring requests");                                      // {+uncovered}
+    }
+    else
+    {
+        this->queued -= (unsigned int)result;
+        this->inFlight += (unsigned int)result;
+    }
+
+    // Collect completions
+    unsigned int head = *this->cqHead;
+
+    while (head != __atomic_load_n(this->cqTail, __ATOMIC_ACQUIRE))
+    {
+        const struct io_uring_cqe *const cqe = &this->cqe[head & this->cqMask];
+        StoragePosixUringRequest *const request = (StoragePosixUringRequest *)(uintptr_t)cqe->user_data;
+
+        request->result = cqe->res;
+        request->pending = false;
+
+        this->inFlight--;
+        head++;
+    }
+
+    __atomic_store_n(this->cqHead, head, __ATOMIC_RELEASE);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Wait for all submitted requests to complete before releasing the ring so the kernel does not write into memory that has been freed
+***********************************************************************************************************************************/
+static void
+storagePosixUringFreeResource(THIS_VOID)
+{
+    THIS(StoragePosixUring);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    while (this->queued + this->inFlight > 0)
+        storagePosixUringEnter(this, true);
+
+    storagePosixUringRelease(this);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+StoragePosixUring *
+storagePosixUringNew(void)
+{
+    FUNCTION_LOG_VOID(logLevelTrace);
+
+    StoragePosixUring *this = NULL;
+
+    // Create the ring. Any failure means that io_uring cannot be used, e.g. not supported by the kernel or disabled by policy.
+    struct io_uring_params param = {0};
+    StoragePosixUring ring = {.fd = (int)syscall(__NR_io_uring_setup, STORAGE_POSIX_URING_ENTRIES, &param)};
+
+    if (ring.fd == -1)                                                                        // {uncovered - io_uring is available}
+        LOG_DEBUG_FMT("io_uring is not available: %s", strerror(errno));                                             // {+uncovered}
+    // Read/write with a buffer and offset were added in the same kernel release as IORING_FEAT_RW_CUR_POS
+    else if (!(param.features & IORING_FEAT_RW_CUR_POS))                                        // {uncovered - io_uring is current}
+    {
+        LOG_DEBUG("io_uring does not support read/write");                                                           // {+uncovered}
+        close(ring.fd);                                                                                              // {+uncovered}
+    }
+    else
+    {
+        // Map the rings
+        ring.sqRingSize = param.sq_off.array + param.sq_entries * sizeof(unsigned int);
+        ring.cqRingSize = param.cq_off.cqes + param.cq_entries * sizeof(struct io_uring_cqe);
+
+        if (param.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            if (ring.cqRingSize > ring.sqRingSize)
+                ring.sqRingSize = ring.cqRingSize;
+
+            ring.cqRingSize = ring.sqRingSize;
+        }
+
+        ring.sqRing = mmap(NULL, ring.sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED, ring.fd, IORING_OFF_SQ_RING);
+        ring.sqRing = ring.sqRing == MAP_FAILED ? NULL : ring.sqRing;
+
+        if (param.features & IORING_FEAT_SINGLE_MMAP)
+            ring.cqRing = ring.sqRing;
+        else                                                                                    // {uncovered - io_uring is current}
+        {
+            ring.cqRing = mmap(                                                                                      // {+uncovered}
+                NULL, ring.cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED, ring.fd, IORING_OFF_CQ_RING);
+            ring.cqRing = ring.cqRing == MAP_FAILED ? NULL : ring.cqRing;                                            // {+uncovered}
+        }
+
+        ring.sqeSize = param.sq_entries * sizeof(struct io_uring_sqe);
+        ring.sqe = mmap(NULL, ring.sqeSize, PROT_READ | PROT_WRITE, MAP_SHARED, ring.fd, IORING_OFF_SQES);
+        ring.sqe = ring.sqe == MAP_FAILED ? NULL : ring.sqe;
+
+        if (ring.sqRing == NULL || ring.cqRing == NULL || ring.sqe == NULL)                   // {uncovered - no way to force error}
+        {
+            LOG_DEBUG_FMT("unable to map io_uring: %s", strerror(errno));                                            // {+uncovered}
+            storagePosixUringRelease(&ring);                                                                         // {+uncovered}
+        }
+        else
+        {
+            unsigned char *const sqRing = ring.sqRing;
+            unsigned char *const cqRing = ring.cqRing;
+
+            ring.sqHead = (unsigned int *)(sqRing + param.sq_off.head);
+            ring.sqTail = (unsigned int *)(sqRing + param.sq_off.tail);
+            ring.sqMask = *(unsigned int *)(sqRing + param.sq_off.ring_mask);
+            ring.sqEntries = *(unsigned int *)(sqRing + param.sq_off.ring_entries);
+            ring.sqArray = (unsigned int *)(sqRing + param.sq_off.array);
+
+            ring.cqHead = (unsigned int *)(cqRing + param.cq_off.head);
+            ring.cqTail = (unsigned int *)(cqRing + param.cq_off.tail);
+            ring.cqMask = *(unsigned int *)(cqRing + param.cq_off.ring_mask);
+            ring.cqe = (struct io_uring_cqe *)(cqRing + param.cq_off.cqes);
+
+            MEM_CONTEXT_NEW_BEGIN("StoragePosixUring")
+            {
+                this = memNew(sizeof(StoragePosixUring));
+                *this = ring;
+                this->memContext = MEM_CONTEXT_NEW();
+
+                memContextCallbackSet(this->memContext, storagePosixUringFreeResource, this);
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+    }
+
+    FUNCTION_LOG_RETURN(STORAGE_POSIX_URING, this);
+}
+
+/***********************************************************************************************************************************
+Get the next submission entry and initialize it with the request
+***********************************************************************************************************************************/
+static struct io_uring_sqe *
+storagePosixUringSqe(StoragePosixUring *const this, StoragePosixUringRequest *const request, const uint8_t opcode, const int fd)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM_P(VOID, request);
+        FUNCTION_TEST_PARAM(UINT, opcode);
+        FUNCTION_TEST_PARAM(INT, fd);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(request != NULL);
+    ASSERT(!request->pending);
+
+    // Submit queued requests when the ring is full. This should not happen since callers queue at most one set of buffers.
+    const unsigned int tail = *this->sqTail;
+
+    if (tail - __atomic_load_n(this->sqHead, __ATOMIC_ACQUIRE) == this->sqEntries)               // {uncovered - ring is never full}
+        storagePosixUringEnter(this, false);                                                                         // {+uncovered}
+
+    const unsigned int index = tail & this->sqMask;
+    struct io_uring_sqe *const result = &this->sqe[index];
+
+    memset(result, 0, sizeof(struct io_uring_sqe));
+    result->opcode = opcode;
+    result->fd = fd;
+    result->user_data = (uint64_t)(uintptr_t)request;
+
+    this->sqArray[index] = index;
+    __atomic_store_n(this->sqTail, tail + 1, __ATOMIC_RELEASE);
+    this->queued++;
+
+    *request = (StoragePosixUringRequest){.pending = true};
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+void
+storagePosixUringRead(
+    StoragePosixUring *const this, StoragePosixUringRequest *const request, const int fd, void *const buffer, const size_t size,
+    const uint64_t offset)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM_P(VOID, request);
+        FUNCTION_TEST_PARAM(INT, fd);
+        FUNCTION_TEST_PARAM_P(VOID, buffer);
+        FUNCTION_TEST_PARAM(SIZE, size);
+        FUNCTION_TEST_PARAM(UINT64, offset);
+    FUNCTION_TEST_END();
+
+    ASSERT(buffer != NULL);
+    ASSERT(size > 0 && size <= UINT32_MAX);
+
+    struct io_uring_sqe *const sqe = storagePosixUringSqe(this, request, IORING_OP_READ, fd);
+
+    sqe->addr = (uint64_t)(uintptr_t)buffer;
+    sqe->len = (uint32_t)size;
+    sqe->off = offset;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+storagePosixUringWrite(
+    StoragePosixUring *const this, StoragePosixUringRequest *const request, const int fd, const void *const buffer,
+    const size_t size, const uint64_t offset)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM_P(VOID, request);
+        FUNCTION_TEST_PARAM(INT, fd);
+        FUNCTION_TEST_PARAM_P(VOID, buffer);
+        FUNCTION_TEST_PARAM(SIZE, size);
+        FUNCTION_TEST_PARAM(UINT64, offset);
+    FUNCTION_TEST_END();
+
+    ASSERT(buffer != NULL);
+    ASSERT(size > 0 && size <= UINT32_MAX);
+
+    struct io_uring_sqe *const sqe = storagePosixUringSqe(this, request, IORING_OP_WRITE, fd);
+
+    sqe->addr = (uint64_t)(uintptr_t)buffer;
+    sqe->len = (uint32_t)size;
+    sqe->off = offset;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+storagePosixUringSync(StoragePosixUring *const this, StoragePosixUringRequest *const request, const int fd)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM_P(VOID, request);
+        FUNCTION_TEST_PARAM(INT, fd);
+    FUNCTION_TEST_END();
+
+    struct io_uring_sqe *const sqe = storagePosixUringSqe(this, request, IORING_OP_FSYNC, fd);
+
+    sqe->flags = IOSQE_IO_DRAIN;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+storagePosixUringSubmit(StoragePosixUring *const this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    if (this->queued > 0)
+        storagePosixUringEnter(this, false);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+storagePosixUringWait(StoragePosixUring *const this, StoragePosixUringRequest *const request)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM_P(VOID, request);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(request != NULL);
+
+    while (request->pending)
+        storagePosixUringEnter(this, true);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+#else
+
+/***********************************************************************************************************************************
+Without io_uring support the ring can never be created so the remaining functions will never be called
+***********************************************************************************************************************************/
+StoragePosixUring *
+storagePosixUringNew(void)
+{
+    FUNCTION_TEST_VOID();
+    FUNCTION_TEST_RETURN(NULL);
+}
+
+void
+storagePosixUringRead(
+    StoragePosixUring *const this, StoragePosixUringRequest *const request, const int fd, void *const buffer, const size_t size,
+    const uint64_t offset)
+{
+    (void)this; (void)request; (void)fd; (void)buffer; (void)size; (void)offset;
+    THROW(AssertError, "io_uring is not available");
+}
+
+void
+storagePosixUringWrite(
+    StoragePosixUring *const this, StoragePosixUringRequest *const request, const int fd, const void *const buffer,
+    const size_t size, const uint64_t offset)
+{
+    (void)this; (void)request; (void)fd; (void)buffer; (void)size; (void)offset;
+    THROW(AssertError, "io_uring is not available");
+}
+
+void
+storagePosixUringSync(StoragePosixUring *const this, StoragePosixUringRequest *const request, const int fd)
+{
+    (void)this; (void)request; (void)fd;
+    THROW(AssertError, "io_uring is not available");
+}
+
+void
+storagePosixUringSubmit(StoragePosixUring *const this)
+{
+    (void)this;
+    THROW(AssertError, "io_uring is not available");
+}
+
+void
+storagePosixUringWait(StoragePosixUring *const this, StoragePosixUringRequest *const request)
+{
+    (void)this; (void)request;
+    THROW(AssertError, "io_uring is not available");
+}
+
+#endif
@@ -0,0 +1,77 @@
+/***********************************************************************************************************************************
+Posix Storage io_uring
+
+Minimal wrapper for a Linux io_uring used by the posix storage driver to queue several reads or writes on a file so disk I/O can
+overlap with processing. The ring is driven with system calls directly so there is no dependency on liburing. When io_uring is not
+available at build time or is not supported/permitted by the running kernel, storagePosixUringNew() returns NULL and the caller
+should fall back to blocking I/O.
+***********************************************************************************************************************************/
+#ifndef STORAGE_POSIX_URING_H
+#define STORAGE_POSIX_URING_H
+
+#include <stdint.h>
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct StoragePosixUring StoragePosixUring;
+
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Number of buffers queued for each file
+***********************************************************************************************************************************/
+#define STORAGE_POSIX_URING_DEPTH                                   4
+
+/***********************************************************************************************************************************
+Request status. The request must remain valid until it is complete or the ring has been freed, since the ring writes the result.
+***********************************************************************************************************************************/
+typedef struct StoragePosixUringRequest
+{
+    bool pending;                                                   // Submitted and not yet complete?
+    int result;                                                     // Bytes read/written or -errno on error
+} StoragePosixUringRequest;
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+// Returns NULL when io_uring is not available
+StoragePosixUring *storagePosixUringNew(void);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Queue a read/write at the specified offset. Requests are not started until storagePosixUringSubmit() or storagePosixUringWait().
+void storagePosixUringRead(
+    StoragePosixUring *this, StoragePosixUringRequest *request, int fd, void *buffer, size_t size, uint64_t offset);
+void storagePosixUringWrite(
+    StoragePosixUring *this, StoragePosixUringRequest *request, int fd, const void *buffer, size_t size, uint64_t offset);
+
+// Queue an fsync that will not start until all previously submitted requests are complete
+void storagePosixUringSync(StoragePosixUring *this, StoragePosixUringRequest *request, int fd);
+
+// Start queued requests without waiting
+void storagePosixUringSubmit(StoragePosixUring *this);
+
+// Start queued requests and wait for the request to complete
+void storagePosixUringWait(StoragePosixUring *this, StoragePosixUringRequest *request);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+// Waits for all submitted requests to complete before releasing the ring
+__attribute__((always_inline)) static inline void
+storagePosixUringFree(StoragePosixUring *const this)
+{
+    objFree(this);
+}
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_STORAGE_POSIX_URING_TYPE                                                                                      \
+    StoragePosixUring *
+#define FUNCTION_LOG_STORAGE_POSIX_URING_FORMAT(value, buffer, bufferSize)                                                         \
+    objToLog(value, "StoragePosixUring", buffer, bufferSize)
+
+#endif
@@ -5,6 +5,7 @@ Posix Storage File write
 
 #include <fcntl.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <utime.h>
 
@@ -15,12 +16,39 @@ Posix Storage File write
 #include "common/type/object.h"
 #include "common/user.h"
 #include "storage/posix/storage.intern.h"
+#include "storage/posix/uring.h"
 #include "storage/posix/write.h"
 #include "storage/write.intern.h"
 
+/***********************************************************************************************************************************
+sync_file_range() is not declared when only POSIX features are enabled. configure checks that off_t is 64-bit so the declaration
+matches the library.
+***********************************************************************************************************************************/
+#ifdef HAVE_SYNC_FILE_RANGE
+
+#ifndef SYNC_FILE_RANGE_WRITE
+    #define SYNC_FILE_RANGE_WAIT_BEFORE                             1
+    #define SYNC_FILE_RANGE_WRITE                                   2
+    #define SYNC_FILE_RANGE_WAIT_AFTER                              4
+#endif
+
+int sync_file_range(int fd, off_t offset, off_t count, unsigned int flags);
+
+#endif // HAVE_SYNC_FILE_RANGE
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
+typedef struct StorageWritePosixBehind
+{
+    StoragePosixUringRequest request;                               // Write request
+    unsigned char *data;                                            // Data to write
+    size_t dataSize;                                                // Allocated size of data
+    size_t size;                                                    // Bytes to write (0 when nothing was requested)
+    size_t written;                                                 // Bytes written by completed requests
+    uint64_t offset;                                                // Offset of data in the file
+} StorageWritePosixBehind;
+
 typedef struct StorageWritePosix
 {
     MemContext *memContext;                                         // Object mem context
@@ -30,6 +58,19 @@ typedef struct StorageWritePosix
     const String *nameTmp;
     const String *path;
     int fd;                                                         // File descriptor
+    bool copied;                                                    // Is data copied into the file by the source?
+
+    bool uring;                                                     // Write behind with io_uring?
+    StoragePosixUring *ring;                                        // io_uring (NULL when not writing behind)
+    StorageWritePosixBehind behind[STORAGE_POSIX_URING_DEPTH];      // Write-behind buffers
+    unsigned int behindIdx;                                         // Write-behind buffer to be used next
+    bool behindRetry;                                               // Was a short write retried?
+    StoragePosixUringRequest syncRequest;                           // Sync request
+    uint64_t offset;                                                // Bytes written to the file so far
+
+    uint64_t flushSize;                                             // Bytes to write before flushing (0 to disable)
+    uint64_t flushOffset;                                           // Start of the range written but not flushed
+    uint64_t flushDrop;                                             // Start of the range flushed but not dropped from page cache
 } StorageWritePosix;
 
 /***********************************************************************************************************************************
@@ -128,6 +169,179 @@ storageWritePosixOpen(THIS_VOID)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Wait for a write-behind buffer to be written. Short writes are retried for the remainder, which will return the error (e.g. out of
+space) when the write cannot be completed.
+***********************************************************************************************************************************/
+static void
+storageWritePosixBehindWait(StorageWritePosix *const this, StorageWritePosixBehind *const behind)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+        FUNCTION_LOG_PARAM_P(VOID, behind);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->ring != NULL);
+    ASSERT(behind != NULL);
+
+    while (behind->written < behind->size)
+    {
+        storagePosixUringWait(this->ring, &behind->request);
+
+        if (behind->request.result < 0)
+            THROW_SYS_ERROR_CODE_FMT(-behind->request.result, FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
+
+        behind->written += (size_t)behind->request.result;
+
+        if (behind->written < behind->size)
+        {
+            storagePosixUringWrite(
+                this->ring, &behind->request, this->fd, behind->data + behind->written, behind->size - behind->written,
+                behind->offset + behind->written);
+            this->behindRetry = true;
+        }
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write behind with io_uring
+
+The data is copied to a write-behind buffer and queued so the caller can continue processing while the kernel writes the data. The
+oldest buffer is waited on only when all buffers are in use.
+***********************************************************************************************************************************/
+static void
+storageWritePosixBehind(StorageWritePosix *const this, const Buffer *const buffer)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->ring != NULL);
+    ASSERT(buffer != NULL);
+
+    StorageWritePosixBehind *const behind = &this->behind[this->behindIdx];
+
+    storageWritePosixBehindWait(this, behind);
+
+    // Make sure the buffer is large enough for the data
+    if (behind->dataSize < bufUsed(buffer))
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            behind->data = behind->data == NULL ? memNew(bufUsed(buffer)) : memResize(behind->data, bufUsed(buffer));
+            behind->dataSize = bufUsed(buffer);
+        }
+        MEM_CONTEXT_END();
+    }
+
+    // Queue the write
+    memcpy(behind->data, bufPtrConst(buffer), bufUsed(buffer));
+    behind->size = bufUsed(buffer);
+    behind->written = 0;
+    behind->offset = this->offset;
+
+    storagePosixUringWrite(this->ring, &behind->request, this->fd, behind->data, behind->size, behind->offset);
+    storagePosixUringSubmit(this->ring);
+
+    this->offset += behind->size;
+    this->behindIdx = (this->behindIdx + 1) % STORAGE_POSIX_URING_DEPTH;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Wait for all write-behind buffers to be written. When requested, the sync is queued first so it runs as soon as the writes are
+complete without another round trip.
+***********************************************************************************************************************************/
+static void
+storageWritePosixBehindEnd(StorageWritePosix *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->ring != NULL);
+
+    if (this->interface.syncFile)
+        storagePosixUringSync(this->ring, &this->syncRequest, this->fd);
+
+    for (unsigned int behindIdx = 0; behindIdx < STORAGE_POSIX_URING_DEPTH; behindIdx++)
+        storageWritePosixBehindWait(this, &this->behind[behindIdx]);
+
+    if (this->interface.syncFile)
+    {
+        storagePosixUringWait(this->ring, &this->syncRequest);
+
+        if (this->syncRequest.result < 0)
+            THROW_SYS_ERROR_CODE_FMT(-this->syncRequest.result, FileSyncError, STORAGE_ERROR_WRITE_SYNC, strZ(this->nameTmp));
+
+        // The sync may have completed before a retried write so sync again
+        if (this->behindRetry)
+            THROW_ON_SYS_ERROR_FMT(fsync(this->fd) == -1, FileSyncError, STORAGE_ERROR_WRITE_SYNC, strZ(this->nameTmp));
+    }
+
+    // Free the ring before the file is closed since it waits for outstanding writes. When the object is freed instead the ring is
+    // freed before the callback runs since it is a child context.
+    storagePosixUringFree(this->ring);
+    this->ring = NULL;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Flush written data in the background and drop it from the page cache
+
+Each time flushSize bytes have been written, writeback is started for those bytes and the prior range is waited on and then dropped
+from the page cache. This keeps the amount of dirty data for the file bounded, so a large restore does not fill memory with dirty
+pages that are then written all at once, and the restored data does not evict the working set of other processes. When
+sync_file_range() is not available the prior range is only dropped, which on Linux also starts writeback.
+***********************************************************************************************************************************/
+static void
+storageWritePosixFlush(StorageWritePosix *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->flushSize > 0);
+
+    if (this->offset - this->flushOffset >= this->flushSize)
+    {
+#ifdef HAVE_SYNC_FILE_RANGE
+        THROW_ON_SYS_ERROR_FMT(
+            sync_file_range(
+                this->fd, (off_t)this->flushOffset, (off_t)(this->offset - this->flushOffset), SYNC_FILE_RANGE_WRITE) == -1,
+            FileSyncError, STORAGE_ERROR_WRITE_SYNC, strZ(this->nameTmp));
+#endif
+
+        if (this->flushOffset > this->flushDrop)
+        {
+#ifdef HAVE_SYNC_FILE_RANGE
+            THROW_ON_SYS_ERROR_FMT(
+                sync_file_range(
+                    this->fd, (off_t)this->flushDrop, (off_t)(this->flushOffset - this->flushDrop),
+                    SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER) == -1,
+                FileSyncError, STORAGE_ERROR_WRITE_SYNC, strZ(this->nameTmp));
+#endif
+
+            // The advice is only a hint so errors are ignored
+            posix_fadvise(this->fd, (off_t)this->flushDrop, (off_t)(this->flushOffset - this->flushDrop), POSIX_FADV_DONTNEED);
+        }
+
+        this->flushDrop = this->flushOffset;
+        this->flushOffset = this->offset;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Write to the file
 ***********************************************************************************************************************************/
@@ -145,9 +359,35 @@ storageWritePosix(THIS_VOID, const Buffer *buffer)
     ASSERT(buffer != NULL);
     ASSERT(this->fd != -1);
 
+    // Write behind with io_uring once there is more than one buffer to write, otherwise there is nothing to overlap. If io_uring
+    // is not available then write normally.
+    if (this->uring && this->ring == NULL && this->offset > 0)
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            this->ring = storagePosixUringNew();
+        }
+        MEM_CONTEXT_END();
+
+        this->uring = this->ring != NULL;
+    }
+
+    // The data is already in the file when it is copied by the source
+    if (this->copied)
+        this->offset += bufUsed(buffer);
+    else if (this->ring != NULL)
+        storageWritePosixBehind(this, buffer);
     // Write the data
-    if (write(this->fd, bufPtrConst(buffer), bufUsed(buffer)) != (ssize_t)bufUsed(buffer))
-        THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
+    else
+    {
+        if (write(this->fd, bufPtrConst(buffer), bufUsed(buffer)) != (ssize_t)bufUsed(buffer))
+            THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
+
+        this->offset += bufUsed(buffer);
+    }
+
+    if (this->flushSize > 0)
+        storageWritePosixFlush(this);
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -169,10 +409,17 @@ storageWritePosixClose(THIS_VOID)
     // Close if the file has not already been closed
     if (this->fd != -1)
     {
+        // Complete queued writes and sync
+        if (this->ring != NULL)
+            storageWritePosixBehindEnd(this);
         // Sync the file
-        if (this->interface.syncFile)
+        else if (this->interface.syncFile)
             THROW_ON_SYS_ERROR_FMT(fsync(this->fd) == -1, FileSyncError, STORAGE_ERROR_WRITE_SYNC, strZ(this->nameTmp));
 
+        // Drop the remainder of the file from the page cache once it has been synced
+        if (this->flushSize > 0 && this->interface.syncFile)
+            posix_fadvise(this->fd, (off_t)this->flushDrop, 0, POSIX_FADV_DONTNEED);
+
         // Close the file
         memContextCallbackClear(this->memContext);
         THROW_ON_SYS_ERROR_FMT(close(this->fd) == -1, FileCloseError, STORAGE_ERROR_WRITE_CLOSE, strZ(this->nameTmp));
@@ -203,6 +450,28 @@ storageWritePosixClose(THIS_VOID)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Prepare the file to have data copied into it by the source
+***********************************************************************************************************************************/
+static int
+storageWritePosixCopyFrom(THIS_VOID)
+{
+    THIS(StorageWritePosix);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->fd != -1);
+    ASSERT(this->offset == 0);
+
+    this->copied = true;
+    this->uring = false;
+
+    FUNCTION_LOG_RETURN(INT, this->fd);
+}
+
 /***********************************************************************************************************************************
 Get file descriptor
 ***********************************************************************************************************************************/
@@ -224,7 +493,7 @@ storageWritePosixFd(const THIS_VOID)
 StorageWrite *
 storageWritePosixNew(
     StoragePosix *storage, const String *name, mode_t modeFile, mode_t modePath, const String *user, const String *group,
-    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic)
+    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic, bool uring, uint64_t flushSize)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_POSIX, storage);
@@ -238,6 +507,8 @@ storageWritePosixNew(
         FUNCTION_LOG_PARAM(BOOL, syncFile);
         FUNCTION_LOG_PARAM(BOOL, syncPath);
         FUNCTION_LOG_PARAM(BOOL, atomic);
+        FUNCTION_LOG_PARAM(BOOL, uring);
+        FUNCTION_LOG_PARAM(UINT64, flushSize);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
@@ -257,6 +528,8 @@ storageWritePosixNew(
             .storage = storage,
             .path = strPath(name),
             .fd = -1,
+            .uring = uring,
+            .flushSize = flushSize,
 
             .interface = (StorageWriteInterface)
             {
@@ -271,6 +544,7 @@ storageWritePosixNew(
                 .syncPath = syncPath,
                 .user = strDup(user),
                 .timeModified = timeModified,
+                .copyFrom = storageWritePosixCopyFrom,
 
                 .ioInterface = (IoWriteInterface)
                 {
@@ -55,6 +55,34 @@ storageReadNew(void *driver, const StorageReadInterface *interface)
     FUNCTION_LOG_RETURN(STORAGE_READ, this);
 }
 
+/**********************************************************************************************************************************/
+bool
+storageReadCopyTo(StorageRead *const this, StorageWrite *const destination)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ, this);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE, destination);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(destination != NULL);
+
+    bool result = false;
+
+    if (this->pub.interface->copyTo != NULL)
+    {
+        const int fd = storageWriteCopyFrom(destination);
+
+        if (fd != -1)
+        {
+            this->pub.interface->copyTo(this->driver, fd);
+            result = true;
+        }
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
 /**********************************************************************************************************************************/
 String *
 storageReadToLog(const StorageRead *this)
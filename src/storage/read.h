@@ -12,10 +12,15 @@ typedef struct StorageRead StorageRead;
 #include "common/io/read.h"
 #include "common/type/object.h"
 #include "storage/read.intern.h"
+#include "storage/write.h"
 
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
+// Copy data directly into the destination as it is read. Both files must be open and both drivers must support copying, otherwise
+// false is returned and the data must be written to the destination as usual.
+bool storageReadCopyTo(StorageRead *this, StorageWrite *destination);
+
 __attribute__((always_inline)) static inline StorageRead *
 storageReadMove(StorageRead *this, MemContext *parentNew)
 {
@@ -46,6 +51,13 @@ storageReadIo(const StorageRead *this)
     return THIS_PUB(StorageRead)->io;
 }
 
+// Where to start reading in the file
+__attribute__((always_inline)) static inline uint64_t
+storageReadOffset(const StorageRead *this)
+{
+    return THIS_PUB(StorageRead)->interface->offset;
+}
+
 // Is there a read limit? NULL for no limit.
 __attribute__((always_inline)) static inline const Variant *
 storageReadLimit(const StorageRead *this)
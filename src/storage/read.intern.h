@@ -16,7 +16,13 @@ typedef struct StorageReadInterface
     bool compressible;                                              // Is this file compressible?
     unsigned int compressLevel;                                     // Level to use for compression
     bool ignoreMissing;
+    uint64_t offset;                                                // Where to start reading in the file
     const Variant *limit;                                           // Limit how many bytes are read (NULL for no limit)
+
+    // Copy data directly into a file as it is read (optional). The driver must make sure the destination matches the data returned
+    // by the read, which is what the filters process.
+    void (*copyTo)(void *driver, int fd);
+
     IoReadInterface ioInterface;
 } StorageReadInterface;
 
@@ -4,6 +4,7 @@ Remote Storage Protocol Handler
 #include "build.auto.h"
 
 #include "command/backup/pageChecksum.h"
+#include "command/backup/rangeChecksum.h"
 #include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
@@ -78,6 +79,8 @@ storageRemoteFilterGroup(IoFilterGroup *filterGroup, const Variant *filterList)
             ioFilterGroupAdd(filterGroup, cryptoHashNewVar(filterParam));
         else if (strEq(filterKey, PAGE_CHECKSUM_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, pageChecksumNewVar(filterParam));
+        else if (strEq(filterKey, RANGE_CHECKSUM_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, rangeChecksumNewVar(filterParam));
         else if (strEq(filterKey, SINK_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, ioSinkNew());
         else if (strEq(filterKey, SIZE_FILTER_TYPE_STR))
@@ -260,10 +263,10 @@ storageRemoteOpenReadProtocol(const VariantList *paramList, ProtocolServer *serv
         IoRead *fileRead = storageReadIo(
             storageInterfaceNewReadP(
                 storageRemoteProtocolLocal.driver, varStr(varLstGet(paramList, 0)), varBool(varLstGet(paramList, 1)),
-                .limit = varLstGet(paramList, 2)));
+                .offset = varUInt64(varLstGet(paramList, 2)), .limit = varLstGet(paramList, 3)));
 
         // Set filter group based on passed filters
-        storageRemoteFilterGroup(ioReadFilterGroup(fileRead), varLstGet(paramList, 3));
+        storageRemoteFilterGroup(ioReadFilterGroup(fileRead), varLstGet(paramList, 4));
 
         // Check if the file exists
         bool exists = ioReadOpen(fileRead);
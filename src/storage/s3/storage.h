@@ -47,7 +47,8 @@ Constructors
 Storage *storageS3New(
     const String *path, bool write, StoragePathExpressionCallback pathExpressionFunction, const String *bucket,
     const String *endPoint, StorageS3UriStyle uriStyle, const String *region, StorageS3KeyType keyType, const String *accessKey,
-    const String *secretAccessKey, const String *securityToken, const String *credRole, size_t partSize, const String *host,
-    unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath);
+    const String *secretAccessKey, const String *securityToken, const String *credRole, size_t partSize,
+    unsigned int uploadConcurrency, unsigned int downloadConcurrency, const String *host, unsigned int port, TimeMSec timeout,
+    bool verifyPeer, const String *caFile, const String *caPath);
 
 #endif
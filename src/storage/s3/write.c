@@ -36,8 +36,9 @@ typedef struct StorageWriteS3
     StorageWriteInterface interface;                                // Interface
     StorageS3 *storage;                                             // Storage that created this object
 
-    HttpRequest *request;                                           // Async request
+    List *requestList;                                              // Async part requests in part order
     size_t partSize;
+    unsigned int uploadConcurrency;                                 // Max parts to upload concurrently
     Buffer *partBuffer;
     const String *uploadId;
     StringList *uploadPartList;
@@ -78,6 +79,9 @@ storageWriteS3Open(THIS_VOID)
 
 /***********************************************************************************************************************************
 Flush bytes to upload part
+
+Up to uploadConcurrency parts may be in flight at once, each on a separate HTTP session. Responses are always processed oldest first
+so the part ids are stored in part order.
 ***********************************************************************************************************************************/
 static void
 storageWriteS3Part(StorageWriteS3 *this)
@@ -87,17 +91,16 @@ storageWriteS3Part(StorageWriteS3 *this)
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
+    ASSERT(!lstEmpty(this->requestList));
 
-    // If there is an outstanding async request then wait for the response and store the part id
-    if (this->request != NULL)
-    {
-        strLstAdd(
-            this->uploadPartList, httpHeaderGet(httpResponseHeader(storageS3ResponseP(this->request)), HTTP_HEADER_ETAG_STR));
-        ASSERT(strLstGet(this->uploadPartList, strLstSize(this->uploadPartList) - 1) != NULL);
+    // Wait for the response to the oldest outstanding async request and store the part id
+    HttpRequest *request = *(HttpRequest **)lstGet(this->requestList, 0);
 
-        httpRequestFree(this->request);
-        this->request = NULL;
-    }
+    strLstAdd(this->uploadPartList, httpHeaderGet(httpResponseHeader(storageS3ResponseP(request)), HTTP_HEADER_ETAG_STR));
+    ASSERT(strLstGet(this->uploadPartList, strLstSize(this->uploadPartList) - 1) != NULL);
+
+    httpRequestFree(request);
+    lstRemoveIdx(this->requestList, 0);
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -115,8 +118,9 @@ storageWriteS3PartAsync(StorageWriteS3 *this)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Complete prior async request, if any
-        storageWriteS3Part(this);
+        // If the max number of parts are in flight then complete the oldest to make room for a new one
+        if (lstSize(this->requestList) >= this->uploadConcurrency)
+            storageWriteS3Part(this);
 
         // Get the upload id if we have not already
         if (this->uploadId == NULL)
@@ -141,12 +145,15 @@ storageWriteS3PartAsync(StorageWriteS3 *this)
         // Upload the part async
         HttpQuery *query = httpQueryNewP();
         httpQueryAdd(query, S3_QUERY_UPLOAD_ID_STR, this->uploadId);
-        httpQueryAdd(query, S3_QUERY_PART_NUMBER_STR, strNewFmt("%u", strLstSize(this->uploadPartList) + 1));
+        httpQueryAdd(
+            query, S3_QUERY_PART_NUMBER_STR, strNewFmt("%u", strLstSize(this->uploadPartList) + lstSize(this->requestList) + 1));
 
-        MEM_CONTEXT_BEGIN(this->memContext)
+        MEM_CONTEXT_BEGIN(lstMemContext(this->requestList))
         {
-            this->request = storageS3RequestAsyncP(
+            HttpRequest *request = storageS3RequestAsyncP(
                 this->storage, HTTP_VERB_PUT_STR, this->interface.name, .query = query, .content = this->partBuffer);
+
+            lstAdd(this->requestList, &request);
         }
         MEM_CONTEXT_END();
     }
@@ -221,8 +228,9 @@ storageWriteS3Close(THIS_VOID)
                 if (!bufEmpty(this->partBuffer))
                     storageWriteS3PartAsync(this);
 
-                // Complete prior async request, if any
-                storageWriteS3Part(this);
+                // Complete outstanding async requests, if any
+                while (!lstEmpty(this->requestList))
+                    storageWriteS3Part(this);
 
                 // Generate the xml part list
                 XmlDocument *partList = xmlDocumentNew(S3_XML_TAG_COMPLETE_MULTIPART_UPLOAD_STR);
@@ -255,15 +263,18 @@ storageWriteS3Close(THIS_VOID)
 
 /**********************************************************************************************************************************/
 StorageWrite *
-storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize)
+storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize, unsigned int uploadConcurrency)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_S3, storage);
         FUNCTION_LOG_PARAM(STRING, name);
+        FUNCTION_LOG_PARAM(SIZE, partSize);
+        FUNCTION_LOG_PARAM(UINT, uploadConcurrency);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
+    ASSERT(uploadConcurrency != 0);
 
     StorageWrite *this = NULL;
 
@@ -275,7 +286,9 @@ storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize)
         {
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
+            .requestList = lstNewP(sizeof(HttpRequest *)),
             .partSize = partSize,
+            .uploadConcurrency = uploadConcurrency,
 
             .interface = (StorageWriteInterface)
             {
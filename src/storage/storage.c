@@ -102,12 +102,23 @@ storageCopy(StorageRead *source, StorageWrite *destination)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
+        // The source may copy directly into the destination when no filters produce output, i.e. the data is not changed. Filters
+        // such as size and hash still see the data that was read. This must be checked before the filter groups are opened since
+        // opening may add filters.
+        const bool copyDirect =
+            !ioFilterGroupOutput(ioReadFilterGroup(storageReadIo(source))) &&
+            !ioFilterGroupOutput(ioWriteFilterGroup(storageWriteIo(destination)));
+
         // Open source file
         if (ioReadOpen(storageReadIo(source)))
         {
             // Open the destination file now that we know the source file exists and is readable
             ioWriteOpen(storageWriteIo(destination));
 
+            // Copy directly when possible. The data still passes through the loop below but it is not written again.
+            if (copyDirect)
+                storageReadCopyTo(source, destination);
+
             // Copy data from source to destination
             Buffer *read = bufNew(ioBufferSize());
 
@@ -610,11 +621,12 @@ storageNewRead(const Storage *this, const String *fileExp, StorageNewReadParam p
         FUNCTION_LOG_PARAM(STRING, fileExp);
         FUNCTION_LOG_PARAM(BOOL, param.ignoreMissing);
         FUNCTION_LOG_PARAM(BOOL, param.compressible);
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
         FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(storageFeature(this, storageFeatureLimitRead) || param.limit == NULL);
+    ASSERT(storageFeature(this, storageFeatureLimitRead) || (param.offset == 0 && param.limit == NULL));
     ASSERT(param.limit == NULL || varType(param.limit) == varTypeUInt64);
 
     StorageRead *result = NULL;
@@ -624,7 +636,7 @@ storageNewRead(const Storage *this, const String *fileExp, StorageNewReadParam p
         result = storageReadMove(
             storageInterfaceNewReadP(
                 this->pub.driver, storagePathP(this, fileExp), param.ignoreMissing, .compressible = param.compressible,
-                .limit = param.limit),
+                .offset = param.offset, .limit = param.limit),
             memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
@@ -43,7 +43,7 @@ typedef enum
     // Does the storage support hardlinks?  Hardlinks allow the same file to be linked into multiple paths to save space.
     storageFeatureHardLink,
 
-    // Can the storage limit the amount of data read from a file?
+    // Can the storage limit the amount of data read from a file and start reading at an offset?
     storageFeatureLimitRead,
 
     // Does the storage support symlinks?  Symlinks allow paths/files/links to be accessed from another path.
@@ -147,6 +147,9 @@ typedef struct StorageNewReadParam
     bool ignoreMissing;
     bool compressible;
 
+    // Where to start reading in the file
+    uint64_t offset;
+
     // Limit bytes to read from the file (must be varTypeUInt64). NULL for no limit.
     const Variant *limit;
 } StorageNewReadParam;
@@ -56,6 +56,19 @@ storageWriteNew(void *driver, const StorageWriteInterface *interface)
     FUNCTION_LOG_RETURN(STORAGE_WRITE, this);
 }
 
+/**********************************************************************************************************************************/
+int
+storageWriteCopyFrom(StorageWrite *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_LOG_RETURN(INT, this->pub.interface->copyFrom == NULL ? -1 : this->pub.interface->copyFrom(this->driver));
+}
+
 /**********************************************************************************************************************************/
 String *
 storageWriteToLog(const StorageWrite *this)
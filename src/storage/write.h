@@ -25,6 +25,10 @@ storageWriteMove(StorageWrite *this, MemContext *parentNew)
     return objMove(this, parentNew);
 }
 
+// Prepare the file to have data copied directly into it by the source. Returns the file descriptor to copy into or -1 when the
+// driver does not support this. Only storageReadCopyTo() should call this function.
+int storageWriteCopyFrom(StorageWrite *this);
+
 /***********************************************************************************************************************************
 Getters/Setters
 ***********************************************************************************************************************************/
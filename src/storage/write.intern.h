@@ -32,6 +32,10 @@ typedef struct StorageWriteInterface
     time_t timeModified;                                            // Time file was last modified
     const String *user;                                             // User that owns the file
 
+    // Prepare the file to have data copied directly into it by the source (optional). Returns a file descriptor that can be written
+    // or -1 when this is not possible. Once prepared, data passed to write() is already in the file and is not written.
+    int (*copyFrom)(void *driver);
+
     IoWriteInterface ioInterface;
 } StorageWriteInterface;
 
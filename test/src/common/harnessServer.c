@@ -38,6 +38,7 @@ typedef enum
     hrnServerCmdExpect,
     hrnServerCmdReply,
     hrnServerCmdSleep,
+    hrnServerCmdSwap,
 } HrnServerCmd;
 
 /***********************************************************************************************************************************
@@ -208,6 +209,18 @@ hrnServerScriptSleep(IoWrite *write, TimeMSec sleepMs)
     FUNCTION_HARNESS_RETURN_VOID();
 }
 
+void
+hrnServerScriptSwap(IoWrite *write)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(IO_WRITE, write);
+    FUNCTION_HARNESS_END();
+
+    hrnServerScriptCommand(write, hrnServerCmdSwap, NULL);
+
+    FUNCTION_HARNESS_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 void hrnServerRun(IoRead *read, HrnServerProtocol protocol, HrnServerRunParam param)
 {
@@ -312,6 +325,7 @@ void hrnServerRun(IoRead *read, HrnServerProtocol protocol, HrnServerRunParam pa
 
     // Loop until no more commands
     IoSession *serverSession = NULL;
+    IoSession *serverSessionPrior = NULL;
     bool done = false;
 
     do
@@ -343,6 +357,9 @@ void hrnServerRun(IoRead *read, HrnServerProtocol protocol, HrnServerRunParam pa
                 if (testClientSocket < 0)
                     THROW_SYS_ERROR(AssertError, "unable to accept socket");
 
+                // Keep the current session so it can be swapped back
+                serverSessionPrior = serverSession;
+
                 // Create socket session
                 sckOptionSet(testClientSocket);
                 serverSession = sckSessionNew(ioSessionRoleServer, testClientSocket, STRDEF("localhost"), param.port, 5000);
@@ -416,6 +433,18 @@ void hrnServerRun(IoRead *read, HrnServerProtocol protocol, HrnServerRunParam pa
             case hrnServerCmdSleep:
                 sleepMSec(varUInt64Force(data));
                 break;
+
+            case hrnServerCmdSwap:
+            {
+                if (serverSessionPrior == NULL)
+                    THROW(AssertError, "no prior session to swap");
+
+                IoSession *session = serverSession;
+                serverSession = serverSessionPrior;
+                serverSessionPrior = session;
+
+                break;
+            }
         }
     }
     while (!done);
@@ -70,6 +70,10 @@ void hrnServerScriptReplyZ(IoWrite *write, const char *data);
 // Sleep specfified milliseconds
 void hrnServerScriptSleep(IoWrite *write, TimeMSec sleepMs);
 
+// Swap the current session with the session that was current before the last accept. This allows a client with more than one
+// connection open to be scripted.
+void hrnServerScriptSwap(IoWrite *write);
+
 /***********************************************************************************************************************************
 Getters/Setters
 ***********************************************************************************************************************************/
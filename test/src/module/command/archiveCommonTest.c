@@ -5,9 +5,45 @@ Test Archive Common
 
 #include "storage/helper.h"
 #include "storage/posix/storage.h"
+#include "storage/storage.intern.h"
 
 #include "common/harnessConfig.h"
 #include "common/harnessFork.h"
+#include "common/harnessStorage.h"
+
+/***********************************************************************************************************************************
+Count requests made by a storage driver
+***********************************************************************************************************************************/
+static struct
+{
+    StorageInterface interface;                                     // Interface of the driver being counted
+    unsigned int infoTotal;                                         // Files checked
+    unsigned int listTotal;                                         // Paths listed
+    unsigned int readTotal;                                         // Files read
+} testRequest;
+
+static StorageInfo
+testRequestInfo(void *thisVoid, const String *file, StorageInfoLevel level, StorageInterfaceInfoParam param)
+{
+    testRequest.infoTotal++;
+    return testRequest.interface.info(thisVoid, file, level, param);
+}
+
+static bool
+testRequestInfoList(
+    void *thisVoid, const String *path, StorageInfoLevel level, void (*callback)(void *callbackData, const StorageInfo *info),
+    void *callbackData, StorageInterfaceInfoListParam param)
+{
+    testRequest.listTotal++;
+    return testRequest.interface.infoList(thisVoid, path, level, callback, callbackData, param);
+}
+
+static StorageRead *
+testRequestNewRead(void *thisVoid, const String *file, bool ignoreMissing, StorageInterfaceNewReadParam param)
+{
+    testRequest.readTotal++;
+    return testRequest.interface.newRead(thisVoid, file, ignoreMissing, param);
+}
 
 /***********************************************************************************************************************************
 Test Run
@@ -284,6 +320,235 @@ testRun(void)
         TEST_RESULT_STR(
             walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("123456781234567812345678.partial"), 0), NULL,
             "did not find partial segment");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("find segment in bundle");
+
+        List *bundleFileList = lstNewP(sizeof(WalBundleFile));
+        lstAdd(
+            bundleFileList,
+            &(WalBundleFile){
+                .file = STRDEF("000000010000000100000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"),
+                .offset = WAL_BUNDLE_HEADER_SIZE, .size = 3});
+        lstAdd(
+            bundleFileList,
+            &(WalBundleFile){
+                .file = STRDEF("000000010000000100000003-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz"),
+                .offset = WAL_BUNDLE_HEADER_SIZE + 3, .size = 2});
+
+        Buffer *bundle = walBundleHeader(bundleFileList);
+        bufCat(bundle, BUFSTRDEF("ABCDE"));
+
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew("archive/db/9.6-2/0000000100000001/000000010000000100000001-000000010000000100000003" WAL_BUNDLE_EXT)),
+            bundle);
+
+        TEST_RESULT_STR_Z(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000100000001"), 0),
+            "000000010000000100000001-000000010000000100000003.bundle/"
+                "000000010000000100000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+            "found first segment in bundle");
+        TEST_RESULT_STR_Z(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000100000003"), 0),
+            "000000010000000100000001-000000010000000100000003.bundle/"
+                "000000010000000100000003-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz",
+            "found last segment in bundle");
+        TEST_RESULT_STR(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000100000002"), 0), NULL,
+            "segment in range is not in bundle");
+        TEST_RESULT_STR(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000100000004"), 0), NULL,
+            "segment is not in bundle range");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read segment from bundle");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(
+                storageGetP(
+                    walSegmentReadNew(
+                        storageRepo(),
+                        strNew(
+                            "9.6-2/000000010000000100000001-000000010000000100000003.bundle/"
+                            "000000010000000100000003-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz"),
+                        false))),
+            "DE", "read segment from bundle");
+        TEST_ERROR(
+            walSegmentReadNew(
+                storageRepo(),
+                strNew(
+                    "9.6-2/000000010000000100000001-000000010000000100000003.bundle/"
+                    "000000010000000100000002-cccccccccccccccccccccccccccccccccccccccc"),
+                false),
+            FileMissingError,
+            "unable to find '000000010000000100000002-cccccccccccccccccccccccccccccccccccccccc' in WAL bundle"
+                " '9.6-2/000000010000000100000001-000000010000000100000003.bundle'");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(
+                storageGetP(
+                    walSegmentReadNew(
+                        storageRepo(), strNew("9.6-2/123456781234567812345678-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"),
+                        true))),
+            "", "read segment not in bundle");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("find segment in index");
+
+        TEST_RESULT_PTR(walIndexRead(storageRepo(), STRDEF("9.6-2"), STRDEF("0000000100000002")), NULL, "no index");
+
+        StringList *indexList = strLstNew();
+        strLstAddZ(indexList, "000000010000000200000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+        strLstAddZ(
+            indexList,
+            "000000010000000200000002-000000010000000200000003.bundle/"
+                "000000010000000200000002-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz");
+
+        TEST_RESULT_VOID(walIndexAdd(storageRepoWrite(), STRDEF("9.6-2"), STRDEF("0000000100000002"), indexList), "add to index");
+        TEST_RESULT_VOID(walIndexAdd(storageRepoWrite(), STRDEF("9.6-2"), STRDEF("0000000100000002"), indexList), "add again");
+
+        indexList = strLstNew();
+        strLstAddZ(indexList, "000000010000000200000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+        strLstAddZ(indexList, "000000010000000200000004.partial-cccccccccccccccccccccccccccccccccccccccc");
+
+        TEST_RESULT_VOID(walIndexAdd(storageRepoWrite(), STRDEF("9.6-2"), STRDEF("0000000100000002"), indexList), "append");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageTest, STRDEF("archive/db/9.6-2/0000000100000002/" WAL_INDEX_FILE)))),
+            "000000010000000200000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\n"
+            "000000010000000200000002-000000010000000200000003.bundle/"
+                "000000010000000200000002-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz\n"
+            "000000010000000200000004.partial-cccccccccccccccccccccccccccccccccccccccc\n",
+            "check index");
+
+        TEST_RESULT_STR_Z(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000200000001"), 0),
+            "000000010000000200000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", "found segment in index");
+        TEST_RESULT_STR_Z(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000200000002"), 0),
+            "000000010000000200000002-000000010000000200000003.bundle/"
+                "000000010000000200000002-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz",
+            "found bundled segment in index");
+        TEST_RESULT_STR_Z(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000200000004.partial"), 0),
+            "000000010000000200000004.partial-cccccccccccccccccccccccccccccccccccccccc", "found partial segment in index");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("segment not in the index is not found");
+
+        HRN_STORAGE_PUT_EMPTY(
+            storageTest, "archive/db/9.6-2/0000000100000002/000000010000000200000005-dddddddddddddddddddddddddddddddddddddddd");
+
+        TEST_RESULT_STR(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000200000005"), 0), NULL,
+            "segment not in index not found");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("duplicates in the index");
+
+        indexList = strLstNew();
+        strLstAddZ(indexList, "000000010000000200000001-eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee");
+
+        TEST_RESULT_VOID(walIndexAdd(storageRepoWrite(), STRDEF("9.6-2"), STRDEF("0000000100000002"), indexList), "add duplicate");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageTest, STRDEF("archive/db/9.6-2/0000000100000002/" WAL_INDEX_FILE)))),
+            "000000010000000200000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\n"
+            "000000010000000200000002-000000010000000200000003.bundle/"
+                "000000010000000200000002-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz\n"
+            "000000010000000200000004.partial-cccccccccccccccccccccccccccccccccccccccc\n"
+            "000000010000000200000001-eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee\n",
+            "check index");
+
+        TEST_ERROR(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000200000001"), 0),
+            ArchiveDuplicateError,
+            "duplicates found in archive for WAL segment 000000010000000200000001:"
+                " 000000010000000200000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+                ", 000000010000000200000001-eeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeeee"
+                "\nHINT: are multiple primaries archiving to this stanza?");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("index finds segment with fewer requests than listing");
+
+        // Count the requests made by the repo storage
+        StorageInterface *const interface = &((StorageCommon *)storageDriver(storageRepo()))->interface;
+        testRequest.interface = *interface;
+        interface->info = testRequestInfo;
+        interface->infoList = testRequestInfoList;
+        interface->newRead = testRequestNewRead;
+
+        TEST_RESULT_STR_Z(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000100000003"), 0),
+            "000000010000000100000001-000000010000000100000003.bundle/"
+                "000000010000000100000003-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz",
+            "found segment by listing");
+        TEST_RESULT_UINT(testRequest.listTotal, 1, "path listed");
+        TEST_RESULT_UINT(testRequest.readTotal, 2, "index and bundle header read");
+        TEST_RESULT_UINT(testRequest.infoTotal, 0, "no info");
+
+        indexList = strLstNew();
+        strLstAddZ(indexList, "000000010000000100000004-4444444444444444444444444444444444444444");
+
+        TEST_RESULT_VOID(
+            walIndexAdd(storageRepoWrite(), STRDEF("9.6-2"), STRDEF("0000000100000001"), indexList),
+            "create index with files already in path");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageTest, STRDEF("archive/db/9.6-2/0000000100000001/" WAL_INDEX_FILE)))),
+            "000000010000000100000001-000000010000000100000003.bundle/"
+                "000000010000000100000001-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\n"
+            "000000010000000100000001-000000010000000100000003.bundle/"
+                "000000010000000100000003-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz\n"
+            "000000010000000100000004-4444444444444444444444444444444444444444\n",
+            "check index");
+
+        testRequest.listTotal = 0;
+        testRequest.readTotal = 0;
+
+        TEST_RESULT_STR_Z(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000100000003"), 0),
+            "000000010000000100000001-000000010000000100000003.bundle/"
+                "000000010000000100000003-bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb.gz",
+            "found segment in index");
+        TEST_RESULT_UINT(testRequest.listTotal, 0, "path not listed");
+        TEST_RESULT_UINT(testRequest.readTotal, 1, "index read");
+        TEST_RESULT_UINT(testRequest.infoTotal, 0, "no info");
+
+        *interface = testRequest.interface;
+
+        TEST_STORAGE_REMOVE(storageTest, "archive/db/9.6-2/0000000100000001/" WAL_INDEX_FILE);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("invalid bundle header");
+
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew("archive/db/9.6-2/0000000100000001/000000010000000100000005-000000010000000100000006" WAL_BUNDLE_EXT)),
+            BUFSTRDEF("BOGUS"));
+
+        TEST_ERROR_FMT(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000100000005"), 0), FormatError,
+            "invalid header in WAL bundle '%s/archive/db/9.6-2/0000000100000001/000000010000000100000005-000000010000000100000006"
+                ".bundle'",
+            testPath());
+
+        Buffer *header = bufNew(WAL_BUNDLE_HEADER_SIZE);
+        memset(bufPtr(header), 0, WAL_BUNDLE_HEADER_SIZE);
+        memcpy(bufPtr(header), "PGBRWALB\377\377\377\377", 12);
+        bufUsedSet(header, WAL_BUNDLE_HEADER_SIZE);
+
+        storagePutP(
+            storageNewWriteP(
+                storageTest,
+                strNew("archive/db/9.6-2/0000000100000001/000000010000000100000005-000000010000000100000006" WAL_BUNDLE_EXT)),
+            header);
+
+        TEST_ERROR_FMT(
+            walSegmentFind(storageRepo(), strNew("9.6-2"), strNew("000000010000000100000006"), 0), FormatError,
+            "invalid header in WAL bundle '%s/archive/db/9.6-2/0000000100000001/000000010000000100000005-000000010000000100000006"
+                ".bundle'",
+            testPath());
     }
 
     // *****************************************************************************************************************************
@@ -99,6 +99,93 @@ testRun(void)
         TEST_STORAGE_LIST(
             storageSpool(), STORAGE_SPOOL_ARCHIVE_IN,
             "000000010000000A00000FFE\n000000010000000A00000FFF\n000000010000000A00000FFF.ok\n");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("stat files are removed when adaptive queue is disabled");
+
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_FETCH, "{\"latency\":1}");
+
+        TEST_RESULT_UINT(archiveGetQueueTotal(queueSize, walSegmentSize), 5, "queue total from queue max");
+
+        TEST_RESULT_STRLST_Z(
+            queueNeed(strNew("000000010000000A00000FFD"), true, queueSize, walSegmentSize, PG_VERSION_11),
+            "000000010000000B00000000\n000000010000000B00000001\n000000010000000B00000002\n", "queue unchanged");
+
+        TEST_STORAGE_LIST(
+            storageSpool(), STORAGE_SPOOL_ARCHIVE_IN,
+            "000000010000000A00000FFE\n000000010000000A00000FFF\n000000010000000A00000FFF.ok\n");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("adaptive queue");
+
+        hrnCfgArgRawBool(argList, cfgOptArchiveGetQueueAdaptive, true);
+        harnessCfgLoad(cfgCmdArchiveGet, argList);
+
+        queueSize = walSegmentSize * 20;
+
+        TEST_RESULT_UINT(archiveGetQueueTotal(queueSize, walSegmentSize), 20, "no stats");
+
+        TEST_RESULT_VOID(archiveGetQueueFetch(1000, 1100, 1400, 1), "record fetch latency");
+        TEST_STORAGE_GET(storageSpool(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_FETCH, "{\"latency\":101}");
+
+        TEST_RESULT_UINT(archiveGetQueueTotal(queueSize, walSegmentSize), 20, "no consume stat");
+
+        TEST_RESULT_VOID(archiveGetQueueFetch(1000, 1100, 1400, 4), "record fetch latency and interval");
+        TEST_STORAGE_GET(
+            storageSpool(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_FETCH, "{\"interval\":101,\"latency\":101}");
+
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_CONSUME, "{\"interval\":50}");
+        TEST_RESULT_UINT(archiveGetQueueTotal(queueSize, walSegmentSize), 20, "fetch cannot keep up with consume");
+
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_CONSUME, "{\"interval\":60}");
+        TEST_RESULT_UINT(archiveGetQueueTotal(queueSize, walSegmentSize), 10, "fetch slower than consume");
+
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_CONSUME, "{\"interval\":1000}");
+        TEST_RESULT_UINT(archiveGetQueueTotal(queueSize, walSegmentSize), 4, "fetch faster than consume");
+
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_CONSUME, "{\"interval\":1}");
+        HRN_STORAGE_PUT_Z(
+            storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_FETCH, "{\"interval\":1,\"latency\":100}");
+        TEST_RESULT_UINT(archiveGetQueueTotal(queueSize, walSegmentSize), 20, "limited by queue max");
+
+        HRN_STORAGE_PUT_Z(
+            storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_FETCH, "{\"interval\":150,\"latency\":10}");
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_CONSUME, "{\"interval\":100}");
+        TEST_RESULT_UINT(archiveGetQueueTotal(queueSize, walSegmentSize), 4, "fetch interval larger than latency");
+
+        TEST_RESULT_STRLST_Z(
+            queueNeed(strNew("000000010000000A00000FFD"), true, queueSize, walSegmentSize, PG_VERSION_11),
+            "000000010000000B00000000\n000000010000000B00000001\n", "queue sized from stats");
+
+        TEST_STORAGE_LIST(
+            storageSpool(), STORAGE_SPOOL_ARCHIVE_IN,
+            "000000010000000A00000FFE\n000000010000000A00000FFF\n000000010000000A00000FFF.ok\n" ARCHIVE_GET_QUEUE_STAT_CONSUME "\n"
+                ARCHIVE_GET_QUEUE_STAT_FETCH "\n");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("record consumption");
+
+        TEST_STORAGE_REMOVE(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_CONSUME);
+
+        TEST_RESULT_VOID(archiveGetQueueConsume(false), "first consume records time only");
+        TEST_RESULT_UINT(
+            archiveGetQueueStat(archiveGetQueueStatLoad(ARCHIVE_GET_QUEUE_STAT_CONSUME), ARCHIVE_GET_QUEUE_STAT_INTERVAL_STR), 0,
+            "no interval");
+
+        sleepMSec(2);
+
+        TEST_RESULT_VOID(archiveGetQueueConsume(true), "consume after wait records time only");
+        TEST_RESULT_UINT(
+            archiveGetQueueStat(archiveGetQueueStatLoad(ARCHIVE_GET_QUEUE_STAT_CONSUME), ARCHIVE_GET_QUEUE_STAT_INTERVAL_STR), 0,
+            "no interval");
+
+        sleepMSec(2);
+
+        TEST_RESULT_VOID(archiveGetQueueConsume(false), "consume records interval");
+        TEST_RESULT_BOOL(
+            archiveGetQueueStat(
+                archiveGetQueueStatLoad(ARCHIVE_GET_QUEUE_STAT_CONSUME), ARCHIVE_GET_QUEUE_STAT_INTERVAL_STR) >= 2, true,
+            "interval recorded");
     }
 
     // *****************************************************************************************************************************
@@ -177,16 +264,16 @@ testRun(void)
 
         harnessLogResult(
             "P00   INFO: get 1 WAL file(s) from archive: 000000010000000100000001\n"
-            "P00   WARN: repo1: [PathOpenError] unable to list file info for path '" TEST_PATH_REPO "/archive/test2/10-1"
-                "/0000000100000001': [13] Permission denied\n"
+            "P00   WARN: repo1: [FileOpenError] unable to open file '" TEST_PATH_REPO "/archive/test2/10-1"
+                "/0000000100000001/" WAL_INDEX_FILE "' for read: [13] Permission denied\n"
             "P00   WARN: [RepoInvalidError] unable to find a valid repository");
 
         TEST_STORAGE_GET(
             storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001.error",
             "103\n"
             "unable to find a valid repository\n"
-            "repo1: [PathOpenError] unable to list file info for path '" TEST_PATH_REPO "/archive/test2/10-1/0000000100000001':"
-                " [13] Permission denied",
+            "repo1: [FileOpenError] unable to open file '" TEST_PATH_REPO "/archive/test2/10-1/0000000100000001/" WAL_INDEX_FILE
+                "' for read: [13] Permission denied",
             .remove = true);
         TEST_STORAGE_LIST_EMPTY(storageSpool(), STORAGE_SPOOL_ARCHIVE_IN);
 
@@ -236,6 +323,72 @@ testRun(void)
         TEST_STORAGE_GET_EMPTY(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001", .remove = true);
         TEST_STORAGE_LIST_EMPTY(storageSpool(), STORAGE_SPOOL_ARCHIVE_IN);
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("single segment with check cache");
+
+        StringList *argCacheList = strLstDup(argBaseList);
+        hrnCfgArgRawZ(argCacheList, cfgOptArchiveGetCacheTtl, "60");
+        strLstAddZ(argCacheList, "000000010000000100000001");
+        harnessCfgLoadRole(cfgCmdArchiveGet, cfgCmdRoleAsync, argCacheList);
+
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_CHECK_CACHE_FILE, "BOGUS");
+
+        TEST_RESULT_VOID(cmdArchiveGetAsync(), "archive async with invalid cache");
+
+        harnessLogResult(
+            "P00   INFO: get 1 WAL file(s) from archive: 000000010000000100000001\n"
+            "P00 DETAIL: unable to load archive-get check cache: [FormatError] key/value found outside of section at line 1:"
+                " BOGUS\n"
+            "P01 DETAIL: found 000000010000000100000001 in the repo1: 10-1 archive");
+
+        TEST_STORAGE_GET_EMPTY(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001", .remove = true);
+        TEST_STORAGE_LIST(storageSpool(), STORAGE_SPOOL_ARCHIVE_IN, ARCHIVE_GET_CHECK_CACHE_FILE "\n");
+        TEST_RESULT_UINT(
+            storageInfoP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_CHECK_CACHE_FILE)).mode, 0600,
+            "cache is only readable by the owner");
+
+        TEST_TITLE("get using check cache without archive.info");
+
+        TEST_STORAGE_REMOVE(storageRepoWrite(), INFO_ARCHIVE_PATH_FILE);
+
+        TEST_RESULT_VOID(cmdArchiveGetAsync(), "archive async");
+
+        harnessLogResult(
+            "P00   INFO: get 1 WAL file(s) from archive: 000000010000000100000001\n"
+            "P01 DETAIL: found 000000010000000100000001 in the repo1: 10-1 archive");
+
+        TEST_STORAGE_GET_EMPTY(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001", .remove = true);
+
+        TEST_TITLE("check cache is stale when segment is missing");
+
+        argCacheList = strLstDup(argBaseList);
+        hrnCfgArgRawZ(argCacheList, cfgOptArchiveGetCacheTtl, "60");
+        strLstAddZ(argCacheList, "000000010000000100000002");
+        harnessCfgLoadRole(cfgCmdArchiveGet, cfgCmdRoleAsync, argCacheList);
+
+        TEST_RESULT_VOID(cmdArchiveGetAsync(), "archive async");
+
+        harnessLogResult(
+            "P00   INFO: get 1 WAL file(s) from archive: 000000010000000100000002\n"
+            "P00 DETAIL: archive-get check cache is stale, checking repos\n"
+            "P00   WARN: repo1: [FileMissingError] unable to load info file '" TEST_PATH_REPO "/archive/test2/archive.info' or '"
+                TEST_PATH_REPO "/archive/test2/archive.info.copy':\n"
+            "            FileMissingError: unable to open missing file '" TEST_PATH_REPO "/archive/test2/archive.info' for read\n"
+            "            FileMissingError: unable to open missing file '" TEST_PATH_REPO "/archive/test2/archive.info.copy' for"
+                " read\n"
+            "            HINT: archive.info cannot be opened but is required to push/get WAL segments.\n"
+            "            HINT: is archive_command configured correctly in postgresql.conf?\n"
+            "            HINT: has a stanza-create been performed?\n"
+            "            HINT: use --no-archive-check to disable archive checks during backup if you have an alternate archiving"
+                " scheme.\n"
+            "P00   WARN: [RepoInvalidError] unable to find a valid repository");
+
+        TEST_STORAGE_REMOVE(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/global.error");
+        TEST_STORAGE_REMOVE(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_CHECK_CACHE_FILE);
+        TEST_STORAGE_LIST_EMPTY(storageSpool(), STORAGE_SPOOL_ARCHIVE_IN);
+
+        harnessCfgLoadRole(cfgCmdArchiveGet, cfgCmdRoleAsync, argList);
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("single segment with one invalid file");
 
@@ -379,11 +532,11 @@ testRun(void)
         TEST_RESULT_VOID(cmdArchiveGetAsync(), "archive async");
 
         #define TEST_WARN1                                                                                                         \
-            "repo2: [PathOpenError] unable to list file info for path '" TEST_PATH_REPO "2/archive/test2/10-1"                     \
-                "/0000000100000001': [13] Permission denied"
+            "repo2: [FileOpenError] unable to open file '" TEST_PATH_REPO "2/archive/test2/10-1"                                   \
+                "/0000000100000001/" WAL_INDEX_FILE "' for read: [13] Permission denied"
         #define TEST_WARN2                                                                                                         \
-            "repo2: [PathOpenError] unable to list file info for path '" TEST_PATH_REPO "2/archive/test2/10-1"                     \
-                "/0000000100000002': [13] Permission denied"
+            "repo2: [FileOpenError] unable to open file '" TEST_PATH_REPO "2/archive/test2/10-1"                                   \
+                "/0000000100000002/" WAL_INDEX_FILE "' for read: [13] Permission denied"
 
         harnessLogResult(
             "P00   INFO: get 3 WAL file(s) from archive: 0000000100000001000000FE...000000010000000200000000\n"
@@ -701,6 +854,41 @@ testRun(void)
 
         TEST_STORAGE_LIST(storageTest, TEST_PATH_PG "/pg_wal", "RECOVERYXLOG\n", .remove = true);
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("adaptive queue records consumption and is full");
+
+        StringList *argAdaptiveList = strLstDup(argList);
+        hrnCfgArgRawBool(argAdaptiveList, cfgOptArchiveGetQueueAdaptive, true);
+        harnessCfgLoadRaw(strLstSize(argAdaptiveList), strLstPtr(argAdaptiveList));
+
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000001", "SHOULD-BE-A-REAL-WAL-FILE");
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000002", "SHOULD-BE-A-REAL-WAL-FILE");
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/000000010000000100000003", "SHOULD-BE-A-REAL-WAL-FILE");
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_CONSUME, "{\"interval\":1000}");
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN "/" ARCHIVE_GET_QUEUE_STAT_FETCH, "{\"latency\":1}");
+
+        TEST_RESULT_INT(cmdArchiveGet(), 0, "successful get");
+
+        TEST_RESULT_VOID(
+            harnessLogResult("P00   INFO: found 000000010000000100000001 in the archive asynchronously"), "check log");
+
+        TEST_RESULT_UINT(
+            archiveGetQueueStat(archiveGetQueueStatLoad(ARCHIVE_GET_QUEUE_STAT_CONSUME), ARCHIVE_GET_QUEUE_STAT_INTERVAL_STR), 1000,
+            "interval unchanged");
+        TEST_RESULT_BOOL(
+            archiveGetQueueStat(
+                archiveGetQueueStatLoad(ARCHIVE_GET_QUEUE_STAT_CONSUME), ARCHIVE_GET_QUEUE_STAT_TIME_STR) != 0, true,
+            "time recorded");
+
+        TEST_STORAGE_LIST(
+            storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_IN,
+            "000000010000000100000002\n000000010000000100000003\n" ARCHIVE_GET_QUEUE_STAT_CONSUME "\n"
+                ARCHIVE_GET_QUEUE_STAT_FETCH "\n",
+            .remove = true);
+        TEST_STORAGE_LIST(storageTest, TEST_PATH_PG "/pg_wal", "RECOVERYXLOG\n", .remove = true);
+
+        harnessCfgLoadRaw(strLstSize(argList), strLstPtr(argList));
+
         // Make sure the process times out when it can't get a lock
         // -------------------------------------------------------------------------------------------------------------------------
         HARNESS_FORK_BEGIN()
@@ -831,6 +1019,51 @@ testRun(void)
             storageInfoP(storageTest, STRDEF(TEST_PATH_PG "/pg_wal/RECOVERYXLOG")).size, 16 * 1024 * 1024, "check size");
         TEST_STORAGE_LIST(storageTest, TEST_PATH_PG "/pg_wal", "RECOVERYXLOG\n", .remove = true);
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("get WAL segment from bundle in index");
+
+        List *bundleFileList = lstNewP(sizeof(WalBundleFile));
+        lstAdd(
+            bundleFileList,
+            &(WalBundleFile){
+                .file = STRDEF("01ABCDEF01ABCDEF01ABCDEF-cccccccccccccccccccccccccccccccccccccccc"),
+                .offset = WAL_BUNDLE_HEADER_SIZE, .size = bufUsed(buffer)});
+
+        Buffer *bundle = walBundleHeader(bundleFileList);
+        bufCat(bundle, buffer);
+
+        HRN_STORAGE_PUT(
+            storageRepoWrite(),
+            STORAGE_REPO_ARCHIVE "/10-1/01ABCDEF01ABCDEF/01ABCDEF01ABCDEF01ABCDEF-01ABCDEF01ABCDEF01ABCDF0" WAL_BUNDLE_EXT, bundle);
+        HRN_STORAGE_PUT_Z(
+            storageRepoWrite(), STORAGE_REPO_ARCHIVE "/10-1/01ABCDEF01ABCDEF/" WAL_INDEX_FILE,
+            "01ABCDEF01ABCDEF01ABCDEF-01ABCDEF01ABCDEF01ABCDF0.bundle/"
+                "01ABCDEF01ABCDEF01ABCDEF-cccccccccccccccccccccccccccccccccccccccc\n");
+
+        TEST_RESULT_INT(cmdArchiveGet(), 0, "get");
+
+        harnessLogResult("P00   INFO: found 01ABCDEF01ABCDEF01ABCDEF in the repo1: 10-1 archive");
+
+        TEST_RESULT_UINT(
+            storageInfoP(storageTest, STRDEF(TEST_PATH_PG "/pg_wal/RECOVERYXLOG")).size, 16 * 1024 * 1024, "check size");
+        TEST_STORAGE_LIST(storageTest, TEST_PATH_PG "/pg_wal", "RECOVERYXLOG\n", .remove = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("error when the index entry is stale since the index is not checked against the path");
+
+        TEST_STORAGE_REMOVE(
+            storageRepoWrite(),
+            STORAGE_REPO_ARCHIVE "/10-1/01ABCDEF01ABCDEF/01ABCDEF01ABCDEF01ABCDEF-01ABCDEF01ABCDEF01ABCDF0" WAL_BUNDLE_EXT);
+
+        TEST_ERROR(
+            cmdArchiveGet(), FileReadError,
+            "unable to get 01ABCDEF01ABCDEF01ABCDEF:\n"
+            "repo1: 10-1/01ABCDEF01ABCDEF/01ABCDEF01ABCDEF01ABCDEF-01ABCDEF01ABCDEF01ABCDF0.bundle/01ABCDEF01ABCDEF01ABCDEF-"
+                "cccccccccccccccccccccccccccccccccccccccc [FileMissingError] unable to open missing file '" TEST_PATH_REPO
+                "/archive/test1/10-1/01ABCDEF01ABCDEF/01ABCDEF01ABCDEF01ABCDEF-01ABCDEF01ABCDEF01ABCDF0.bundle' for read");
+
+        TEST_STORAGE_REMOVE(storageRepoWrite(), STORAGE_REPO_ARCHIVE "/10-1/01ABCDEF01ABCDEF/" WAL_INDEX_FILE);
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("error on duplicate WAL segment");
 
@@ -1004,8 +1237,8 @@ testRun(void)
         TEST_RESULT_INT(cmdArchiveGet(), 0, "get");
 
         harnessLogResult(
-            "P00   WARN: repo1: [PathOpenError] unable to list file info for path '" TEST_PATH_REPO "-bogus/archive/test1/10-2"
-                "/01ABCDEF01ABCDEF': [13] Permission denied\n"
+            "P00   WARN: repo1: [FileOpenError] unable to open file '" TEST_PATH_REPO "-bogus/archive/test1/10-2"
+                "/01ABCDEF01ABCDEF/" WAL_INDEX_FILE "' for read: [13] Permission denied\n"
             "P00   INFO: found 01ABCDEF01ABCDEF01ABCDEF in the repo2: 10-1 archive");
 
         TEST_STORAGE_LIST(storageTest, TEST_PATH_PG "/pg_wal", "RECOVERYXLOG\n", .remove = true);
@@ -1018,10 +1251,10 @@ testRun(void)
         TEST_ERROR(cmdArchiveGet(), RepoInvalidError, "unable to find a valid repository");
 
         harnessLogResult(
-            "P00   WARN: repo1: [PathOpenError] unable to list file info for path '" TEST_PATH_REPO "-bogus/archive/test1/10-2"
-                "/01ABCDEF01ABCDEF': [13] Permission denied\n"
-            "P00   WARN: repo2: [PathOpenError] unable to list file info for path '" TEST_PATH_REPO "/archive/test1/10-1"
-                "/01ABCDEF01ABCDEF': [13] Permission denied");
+            "P00   WARN: repo1: [FileOpenError] unable to open file '" TEST_PATH_REPO "-bogus/archive/test1/10-2"
+                "/01ABCDEF01ABCDEF/" WAL_INDEX_FILE "' for read: [13] Permission denied\n"
+            "P00   WARN: repo2: [FileOpenError] unable to open file '" TEST_PATH_REPO "/archive/test1/10-1"
+                "/01ABCDEF01ABCDEF/" WAL_INDEX_FILE "' for read: [13] Permission denied");
 
         HRN_STORAGE_MODE(storageRepoIdxWrite(0), STORAGE_REPO_ARCHIVE "/10-2");
         HRN_STORAGE_MODE(storageRepoIdxWrite(1), STORAGE_REPO_ARCHIVE "/10-1");
@@ -354,6 +354,7 @@ testRun(void)
             true, "check repo for WAL file");
         TEST_STORAGE_REMOVE(
             storageRepoIdxWrite(0), strZ(strNewFmt(STORAGE_REPO_ARCHIVE "/11-1/000000010000000100000001-%s.gz", walBuffer1Sha1)));
+        TEST_STORAGE_REMOVE(storageRepoIdxWrite(0), STORAGE_REPO_ARCHIVE "/11-1/0000000100000001/" WAL_INDEX_FILE);
 
         // Generate valid WAL and push them
         // -------------------------------------------------------------------------------------------------------------------------
@@ -488,12 +489,13 @@ testRun(void)
         varLstAdd(paramList, varNewStrZ("11-1"));
         varLstAdd(paramList, varNewUInt64(cipherTypeNone));
         varLstAdd(paramList, NULL);
+        varLstAdd(paramList, varNewUInt(0));
 
         TEST_RESULT_VOID(archivePushFileProtocol(paramList, server), "protocol archive put");
         TEST_RESULT_STR_Z(
             strNewBuf(serverWrite),
-            "{\"out\":[[\"WAL file '000000010000000100000002' already exists in the repo1 archive with the same checksum"
-                "\\nHINT: this is valid in some recovery scenarios but may also indicate a problem.\"]]}\n",
+            "{\"out\":[[[\"WAL file '000000010000000100000002' already exists in the repo1 archive with the same checksum"
+                "\\nHINT: this is valid in some recovery scenarios but may also indicate a problem.\"],[],[]]]}\n",
             "check result");
 
         bufUsedSet(serverWrite, 0);
@@ -568,6 +570,8 @@ testRun(void)
         storageRemoveP(
             storageTest, strNewFmt("repo3/archive/test/11-1/0000000100000001/000000010000000100000002-%s", walBuffer2Sha1),
             .errorOnMissing = true);
+        TEST_STORAGE_REMOVE(storageTest, "repo2/archive/test/11-1/0000000100000001/" WAL_INDEX_FILE);
+        TEST_STORAGE_REMOVE(storageTest, "repo3/archive/test/11-1/0000000100000001/" WAL_INDEX_FILE);
 
         HRN_STORAGE_MODE(storageTest, "repo2/archive/test/11-1/0000000100000001", .mode = 0500);
 
@@ -615,6 +619,62 @@ testRun(void)
             "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
             "P00   INFO: pushed WAL file '000000010000000100000002' to the archive");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("queue segment for deferred repos and push to repo3 when the queue copy fails");
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_wal/000000010000000100000004")), walBuffer2);
+
+        List *repoListCipher = lstNewP(sizeof(ArchivePushFileRepoData));
+
+        for (unsigned int repoIdx = 0; repoIdx < 2; repoIdx++)
+        {
+            lstAdd(
+                repoListCipher,
+                &(ArchivePushFileRepoData){
+                    .repoIdx = repoIdx, .archiveId = STRDEF("11-1"), .cipherType = cipherTypeAes256Cbc,
+                    .cipherPass = STRDEF("badsubpassphrase")});
+        }
+
+        List *repoListDefer = lstNewP(sizeof(ArchivePushFileRepoData));
+        lstAdd(repoListDefer, lstGet(repoListCipher, 0));
+
+        List *queueList = lstNewP(sizeof(ArchivePushFileQueue));
+        lstAdd(
+            queueList,
+            &(ArchivePushFileQueue){
+                .path = strNewFmt("%s/queue", testPath()), .error = STRDEF("repo4: [RepoInvalidError] invalid"),
+                .repoData = {.repoIdx = 2}});
+        lstAdd(
+            queueList,
+            &(ArchivePushFileQueue){
+                .path = strNewFmt("%s/pg/pg_wal/000000010000000100000004/queue", testPath()),
+                .repoData = *(ArchivePushFileRepoData *)lstGet(repoListCipher, 1)});
+
+        ArchivePushFileResult fileResult = {0};
+
+        TEST_ASSIGN(
+            fileResult,
+            archivePushFile(
+                strNewFmt("%s/pg/pg_wal/000000010000000100000004", testPath()), true, PG_VERSION_11, 0xFACEFACEFACEFACE,
+                STRDEF("000000010000000100000004"), compressTypeNone, 0, repoListDefer, queueList, strLstNew()),
+            "push the WAL segment");
+        TEST_RESULT_STRLST_Z(
+            fileResult.warnList,
+            strZ(
+                strNewFmt(
+                    "unable to queue WAL for deferred repo3: [FileOpenError] unable to open file"
+                        " '%s/pg/pg_wal/000000010000000100000004/queue/000000010000000100000004' for write: [20] Not a directory\n",
+                    testPath())),
+            "check warnings");
+        TEST_RESULT_STRLST_Z(fileResult.queueList, strZ(strNewFmt("%s/queue\n", testPath())), "check queues");
+
+        TEST_RESULT_BOOL(
+            storageExistsP(storageTest, STRDEF("queue/000000010000000100000004")), true, "check queue for WAL file");
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest, strNewFmt("repo3/archive/test/11-1/0000000100000001/000000010000000100000004-%s", walBuffer2Sha1)),
+            true, "check repo3 for WAL file");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("push succeeds on one repo when other repo fails to load archive.info");
 
@@ -622,6 +682,7 @@ testRun(void)
             storageTest, strZ(strNewFmt("repo2/archive/test/11-1/0000000100000001/000000010000000100000002-%s", walBuffer2Sha1)));
         TEST_STORAGE_REMOVE(
             storageTest, strZ(strNewFmt("repo3/archive/test/11-1/0000000100000001/000000010000000100000002-%s", walBuffer2Sha1)));
+        TEST_STORAGE_REMOVE(storageTest, "repo2/archive/test/11-1/0000000100000001/" WAL_INDEX_FILE);
         HRN_STORAGE_MODE(storageTest, "repo2", .mode = 0200);
 
         TEST_ERROR(
@@ -650,8 +711,8 @@ testRun(void)
         TEST_ERROR(
             cmdArchivePush(), CommandError,
             "archive-push command encountered error(s):\n"
-            "repo2: [PathOpenError] unable to list file info for path '{[path]}/repo2/archive/test/11-1/0000000100000001': [13]"
-                " Permission denied");
+            "repo2: [FileOpenError] unable to open file '{[path]}/repo2/archive/test/11-1/0000000100000001/" WAL_INDEX_FILE "' for"
+                " read: [13] Permission denied");
 
         // Make sure WAL got pushed to repo3
         TEST_STORAGE_REMOVE(
@@ -994,6 +1055,359 @@ testRun(void)
                 storageTest, strNewFmt("repo3/archive/test/9.4-1/0000000100000001/000000010000000100000003-%s", walBuffer3Sha1)),
             true, "check repo3 for WAL 3 file");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("linger and push WAL that becomes ready while waiting");
+
+        // Create WAL 4 and 5 segments
+        Buffer *walBuffer4 = bufNew((size_t)16 * 1024 * 1024);
+        bufUsedSet(walBuffer4, bufSize(walBuffer4));
+        memset(bufPtr(walBuffer4), 0x55, bufSize(walBuffer4));
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}, walBuffer4);
+        const char *walBuffer4Sha1 = strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer4)));
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/000000010000000100000004")), walBuffer4);
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000004.ready")), NULL);
+
+        Buffer *walBuffer5 = bufNew((size_t)16 * 1024 * 1024);
+        bufUsedSet(walBuffer5, bufSize(walBuffer5));
+        memset(bufPtr(walBuffer5), 0x66, bufSize(walBuffer5));
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}, walBuffer5);
+        const char *walBuffer5Sha1 = strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer5)));
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/000000010000000100000005")), walBuffer5);
+
+        argListTemp = strLstDup(argList);
+        hrnCfgArgRawZ(argListTemp, cfgOptArchivePushLinger, "1");
+        harnessCfgLoadRole(cfgCmdArchivePush, cfgCmdRoleAsync, argListTemp);
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                // Wait for WAL 4 to be pushed and then mark WAL 5 ready while the async process is lingering
+                Wait *wait = waitNew(5000);
+
+                while (!storageExistsP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000004.ok")) &&
+                       waitMore(wait));
+
+                storagePutP(
+                    storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000005.ready")), NULL);
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+
+        harnessLogResult(
+            "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000004\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000004' to the archive\n"
+            "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000005\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000005' to the archive");
+
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest, strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000004-%s", walBuffer4Sha1)),
+            true, "check repo1 for WAL 4 file");
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest, strNewFmt("repo3/archive/test/9.4-1/0000000100000001/000000010000000100000005-%s", walBuffer5Sha1)),
+            true, "check repo3 for WAL 5 file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push WAL 6 and 7 in a bundle");
+
+        // Create WAL 6 and 7 segments
+        Buffer *walBuffer6 = bufNew((size_t)16 * 1024 * 1024);
+        bufUsedSet(walBuffer6, bufSize(walBuffer6));
+        memset(bufPtr(walBuffer6), 0x77, bufSize(walBuffer6));
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}, walBuffer6);
+        const char *walBuffer6Sha1 = strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer6)));
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/000000010000000100000006")), walBuffer6);
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000006.ready")), NULL);
+
+        Buffer *walBuffer7 = bufNew((size_t)16 * 1024 * 1024);
+        bufUsedSet(walBuffer7, bufSize(walBuffer7));
+        memset(bufPtr(walBuffer7), 0x88, bufSize(walBuffer7));
+        pgWalTestToBuffer((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}, walBuffer7);
+        const char *walBuffer7Sha1 = strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer7)));
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/000000010000000100000007")), walBuffer7);
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000007.ready")), NULL);
+
+        argListTemp = strLstDup(argList);
+        hrnCfgArgRawZ(argListTemp, cfgOptArchivePushBundleMax, "4");
+        harnessCfgLoadRole(cfgCmdArchivePush, cfgCmdRoleAsync, argListTemp);
+
+        // Make the repo3 index unreadable so the index cannot be updated and is removed instead
+        HRN_STORAGE_MODE(storageTest, "repo3/archive/test/9.4-1/0000000100000001/" WAL_INDEX_FILE, .mode = 0200);
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
+        harnessLogResult(
+            strZ(
+                strNewFmt(
+                    "P00   INFO: push 2 WAL file(s) to archive: 000000010000000100000006...000000010000000100000007\n"
+                    "P01 DETAIL: pushed WAL file '000000010000000100000006' to the archive\n"
+                    "P01 DETAIL: pushed WAL file '000000010000000100000007' to the archive\n"
+                    "P00   WARN: unable to update WAL index in the repo3 archive: [FileOpenError] unable to open file"
+                        " '%s/repo3/archive/test/9.4-1/0000000100000001/" WAL_INDEX_FILE "' for read: [13] Permission denied",
+                    testPath())));
+
+        TEST_RESULT_BOOL(
+            storageExistsP(storageTest, STRDEF("repo3/archive/test/9.4-1/0000000100000001/" WAL_INDEX_FILE)), false,
+            "repo3 index removed");
+
+        TEST_RESULT_STR(
+            strNewBuf(
+                storageGetP(storageNewReadP(storageTest, STRDEF("repo/archive/test/9.4-1/0000000100000001/" WAL_INDEX_FILE)))),
+            strNewFmt(
+                "000000010000000100000001-%s\n"
+                "000000010000000100000002-%s\n"
+                "000000010000000100000003-%s\n"
+                "000000010000000100000004-%s\n"
+                "000000010000000100000005-%s\n"
+                "000000010000000100000006-000000010000000100000007.bundle/000000010000000100000006-%s\n"
+                "000000010000000100000006-000000010000000100000007.bundle/000000010000000100000007-%s\n",
+                walBuffer1Sha1, walBuffer2Sha1, walBuffer3Sha1, walBuffer4Sha1, walBuffer5Sha1, walBuffer6Sha1, walBuffer7Sha1),
+            "check repo1 index");
+
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest,
+                STRDEF("repo/archive/test/9.4-1/0000000100000001/000000010000000100000006-000000010000000100000007.bundle")),
+            true, "check repo1 for bundle");
+        TEST_RESULT_STR(
+            walSegmentFind(storageRepoIdx(1), STRDEF("9.4-1"), STRDEF("000000010000000100000007"), 0),
+            strNewFmt("000000010000000100000006-000000010000000100000007.bundle/000000010000000100000007-%s", walBuffer7Sha1),
+            "find WAL 7 in repo3 bundle");
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(
+                    walSegmentReadNew(
+                        storageRepoIdx(1),
+                        strNewFmt(
+                            "9.4-1/000000010000000100000006-000000010000000100000007.bundle/000000010000000100000006-%s",
+                            walBuffer6Sha1),
+                        false)),
+                walBuffer6),
+            true, "check WAL 6 in repo3 bundle");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push bundle with WAL already in repos to get warnings");
+
+        storageRemoveP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000005.ok"));
+        storageRemoveP(storageSpoolWrite(), STRDEF(STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000006.ok"));
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
+        harnessLogResult(
+            "P00   INFO: push 2 WAL file(s) to archive: 000000010000000100000005...000000010000000100000006\n"
+            "P01   WARN: WAL file '000000010000000100000005' already exists in the repo1 archive with the same checksum\n"
+            "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
+            "P01   WARN: WAL file '000000010000000100000005' already exists in the repo3 archive with the same checksum\n"
+            "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000005' to the archive\n"
+            "P01   WARN: WAL file '000000010000000100000006' already exists in the repo1 archive with the same checksum\n"
+            "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
+            "P01   WARN: WAL file '000000010000000100000006' already exists in the repo3 archive with the same checksum\n"
+            "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000006' to the archive");
+
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest,
+                STRDEF("repo/archive/test/9.4-1/0000000100000001/000000010000000100000005-000000010000000100000006.bundle")),
+            false, "no bundle written");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("segments that are not consecutive are not bundled");
+
+        const char *walFileGap[] = {"000000010000000200000001", "000000010000000200000003"};
+        const char *walBufferGapSha1[2];
+
+        for (unsigned int walIdx = 0; walIdx < 2; walIdx++)
+        {
+            Buffer *walBuffer = bufNew((size_t)16 * 1024 * 1024);
+            bufUsedSet(walBuffer, bufSize(walBuffer));
+            memset(bufPtr(walBuffer), 0xA0 + (int)walIdx, bufSize(walBuffer));
+            pgWalTestToBuffer((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}, walBuffer);
+            walBufferGapSha1[walIdx] = strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer)));
+
+            storagePutP(storageNewWriteP(storagePgWrite(), strNewFmt("pg_xlog/%s", walFileGap[walIdx])), walBuffer);
+            storagePutP(
+                storageNewWriteP(storagePgWrite(), strNewFmt("pg_xlog/archive_status/%s.ready", walFileGap[walIdx])), NULL);
+        }
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
+        harnessLogResult(
+            "P00   INFO: push 2 WAL file(s) to archive: 000000010000000200000001...000000010000000200000003\n"
+            "P01 DETAIL: pushed WAL file '000000010000000200000001' to the archive\n"
+            "P01 DETAIL: pushed WAL file '000000010000000200000003' to the archive");
+
+        for (unsigned int walIdx = 0; walIdx < 2; walIdx++)
+        {
+            TEST_RESULT_BOOL(
+                storageExistsP(
+                    storageTest,
+                    strNewFmt(
+                        "repo/archive/test/9.4-1/0000000100000002/%s-%s", walFileGap[walIdx], walBufferGapSha1[walIdx])),
+                true, "check repo1 for segment");
+
+            storageRemoveP(
+                storagePgWrite(), strNewFmt("pg_xlog/archive_status/%s.ready", walFileGap[walIdx]), .errorOnMissing = true);
+        }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("defer push to repo3");
+
+        // Create WAL 8, 9, and 10 segments
+        const char *walFileDefer[] = {"000000010000000100000008", "000000010000000100000009", "00000001000000010000000A"};
+        const char *walBufferDeferSha1[3];
+
+        for (unsigned int walIdx = 0; walIdx < 3; walIdx++)
+        {
+            Buffer *walBuffer = bufNew((size_t)16 * 1024 * 1024);
+            bufUsedSet(walBuffer, bufSize(walBuffer));
+            memset(bufPtr(walBuffer), 0x90 + (int)walIdx, bufSize(walBuffer));
+            pgWalTestToBuffer((PgWal){.version = PG_VERSION_94, .systemId = 0xAAAABBBBCCCCDDDD}, walBuffer);
+            walBufferDeferSha1[walIdx] = strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer)));
+
+            storagePutP(storageNewWriteP(storagePgWrite(), strNewFmt("pg_xlog/%s", walFileDefer[walIdx])), walBuffer);
+        }
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000008.ready")), NULL);
+
+        argListTemp = strLstDup(argList);
+        hrnCfgArgKeyRawBool(argListTemp, cfgOptRepoArchivePushDefer, 3, true);
+        harnessCfgLoadRole(cfgCmdArchivePush, cfgCmdRoleAsync, argListTemp);
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segment");
+        harnessLogResult(
+            "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000008\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000008' to the archive\n"
+            "P02 DETAIL: pushed WAL file '000000010000000100000008' to the repo3 archive (deferred)");
+
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest,
+                strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000008-%s", walBufferDeferSha1[0])),
+            true, "check repo1 for WAL 8 file");
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest,
+                strNewFmt("repo3/archive/test/9.4-1/0000000100000001/000000010000000100000008-%s", walBufferDeferSha1[0])),
+            true, "check repo3 for WAL 8 file");
+        TEST_RESULT_STRLST_Z(
+            storageListP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_OUT "/defer/repo3")), NULL, "deferred queue is empty");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("queue WAL for invalid deferred repo3");
+
+        storageMoveP(
+            storageTest, storageNewReadP(storageTest, STRDEF("repo3/archive/test/archive.info")),
+            storageNewWriteP(storageTest, STRDEF("repo3/archive/test/archive.info.bak")));
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000009.ready")), NULL);
+
+        const char *const repo3Error =
+            "[FileMissingError] unable to load info file '{[path]}/repo3/archive/test/archive.info' or"
+                " '{[path]}/repo3/archive/test/archive.info.copy':\n"
+            "            FileMissingError: unable to open missing file '{[path]}/repo3/archive/test/archive.info' for read\n"
+            "            FileMissingError: unable to open missing file '{[path]}/repo3/archive/test/archive.info.copy' for read\n"
+            "            HINT: archive.info cannot be opened but is required to push/get WAL segments.\n"
+            "            HINT: is archive_command configured correctly in postgresql.conf?\n"
+            "            HINT: has a stanza-create been performed?\n"
+            "            HINT: use --no-archive-check to disable archive checks during backup if you have an alternate archiving"
+                " scheme.";
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segment");
+        harnessLogResult(
+            strZ(
+                strNewFmt(
+                    "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000009\n"
+                    "P00   WARN: WAL will be queued but not pushed for deferred repo3: %s\n"
+                    "P01 DETAIL: pushed WAL file '000000010000000100000009' to the archive",
+                    repo3Error)));
+
+        TEST_RESULT_STRLST_Z(
+            storageListP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_OUT "/defer/repo3")), "000000010000000100000009\n",
+            "WAL 9 is queued");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("error when queue for invalid deferred repo3 is full");
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("pg_xlog/archive_status/00000001000000010000000A.ready")), NULL);
+
+        StringList *argListDefer = strLstDup(argListTemp);
+        hrnCfgArgRawZ(argListDefer, cfgOptArchivePushDeferMax, "16MB");
+        harnessCfgLoadRole(cfgCmdArchivePush, cfgCmdRoleAsync, argListDefer);
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segment");
+        harnessLogResult(
+            strZ(
+                strNewFmt(
+                    "P00   INFO: push 1 WAL file(s) to archive: 00000001000000010000000A\n"
+                    "P00   WARN: WAL will be queued but not pushed for deferred repo3: %s\n"
+                    "P01   WARN: could not push WAL file '00000001000000010000000A' to the archive (will be retried): [104] raised"
+                        " from local-1 protocol: archive-push command encountered error(s):\n"
+                    "            repo3: %s",
+                    repo3Error, repo3Error)));
+
+        TEST_RESULT_STRLST_Z(
+            strLstSort(storageListP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_OUT), .expression = STRDEF("0A")), sortOrderAsc),
+            "00000001000000010000000A.error\n", "check status files");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("deferred repo3 catches up when valid and WAL pushed again is not queued twice");
+
+        TEST_STORAGE_REMOVE(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000009.ok");
+        storageMoveP(
+            storageTest, storageNewReadP(storageTest, STRDEF("repo3/archive/test/archive.info.bak")),
+            storageNewWriteP(storageTest, STRDEF("repo3/archive/test/archive.info")));
+        HRN_STORAGE_PUT_Z(
+            storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE_OUT "/defer/repo3/00000001000000010000000A.pgbackrest.tmp", "X");
+
+        harnessCfgLoadRole(cfgCmdArchivePush, cfgCmdRoleAsync, argListTemp);
+
+        // WAL 10 was stored in repo1 by the job that failed but was not added to the index, so it is stored again without a warning
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segment");
+        harnessLogResult(
+            "P00   INFO: push 2 WAL file(s) to archive: 000000010000000100000009...00000001000000010000000A\n"
+            "P00   INFO: push 1 deferred WAL file(s) to the repo3 archive\n"
+            "P01   WARN: WAL file '000000010000000100000009' already exists in the repo1 archive with the same checksum\n"
+            "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000009' to the archive\n"
+            "P01 DETAIL: pushed WAL file '00000001000000010000000A' to the archive\n"
+            "P02 DETAIL: pushed WAL file '000000010000000100000009' to the repo3 archive (deferred)\n"
+            "P02 DETAIL: pushed WAL file '00000001000000010000000A' to the repo3 archive (deferred)");
+
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest,
+                strNewFmt("repo3/archive/test/9.4-1/0000000100000001/000000010000000100000009-%s", walBufferDeferSha1[1])),
+            true, "check repo3 for WAL 9 file");
+        TEST_RESULT_BOOL(
+            storageExistsP(
+                storageTest,
+                strNewFmt("repo3/archive/test/9.4-1/0000000100000001/00000001000000010000000A-%s", walBufferDeferSha1[2])),
+            true, "check repo3 for WAL 10 file");
+        TEST_RESULT_STRLST_Z(
+            storageListP(storageSpool(), STRDEF(STORAGE_SPOOL_ARCHIVE_OUT "/defer/repo3")), NULL, "deferred queue is empty");
+
+        // Remove the ready files to prevent WAL 8-10 from being considered for the next test
+        storageRemoveP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000008.ready"), .errorOnMissing = true);
+        storageRemoveP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000009.ready"), .errorOnMissing = true);
+        storageRemoveP(storagePgWrite(), strNew("pg_xlog/archive_status/00000001000000010000000A.ready"), .errorOnMissing = true);
+
+        // Remove the ready files to prevent WAL 4-7 from being considered for the next test
+        storageRemoveP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000004.ready"), .errorOnMissing = true);
+        storageRemoveP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000005.ready"), .errorOnMissing = true);
+        storageRemoveP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000006.ready"), .errorOnMissing = true);
+        storageRemoveP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000007.ready"), .errorOnMissing = true);
+
         // Remove the ready file to prevent WAL 3 from being considered for the next test
         storageRemoveP(storagePgWrite(), strNew("pg_xlog/archive_status/000000010000000100000003.ready"), .errorOnMissing = true);
 
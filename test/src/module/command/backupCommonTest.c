@@ -6,8 +6,11 @@ Test Common Functions and Definitions for Backup and Expire Commands
 #include "common/type/json.h"
 #include "postgres/interface.h"
 #include "postgres/interface/static.vendor.h"
+#include "storage/helper.h"
 #include "storage/posix/storage.h"
 
+#include "common/harnessConfig.h"
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -311,6 +314,45 @@ testRun(void)
         TEST_ERROR(ioWrite(write, buffer), AssertError, "should not be possible to see two misaligned pages in a row");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("RangeChecksum"))
+    {
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("ranges split across writes with a partial last range");
+
+        IoWrite *write = ioBufferWriteNew(bufNew(0));
+        IoFilter *filter = rangeChecksumNew(4);
+        ioFilterGroupAdd(ioWriteFilterGroup(write), rangeChecksumNewVar(ioFilterParamList(filter)));
+        ioWriteOpen(write);
+        ioWrite(write, BUFSTRDEF("012345"));
+        ioWrite(write, BUFSTRDEF("6789"));
+        ioWriteClose(write);
+
+        TEST_RESULT_STR(
+            varStr(ioFilterGroupResult(ioWriteFilterGroup(write), RANGE_CHECKSUM_FILTER_TYPE_STR)),
+            strNewFmt(
+                "%s%s%s", strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("0123")))),
+                strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("4567")))),
+                strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("89"))))),
+            "range checksums");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("size is a multiple of the range size");
+
+        write = ioBufferWriteNew(bufNew(0));
+        ioFilterGroupAdd(ioWriteFilterGroup(write), rangeChecksumNew(5));
+        ioWriteOpen(write);
+        ioWrite(write, BUFSTRDEF("0123456789"));
+        ioWriteClose(write);
+
+        TEST_RESULT_STR(
+            varStr(ioFilterGroupResult(ioWriteFilterGroup(write), RANGE_CHECKSUM_FILTER_TYPE_STR)),
+            strNewFmt(
+                "%s%s", strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("01234")))),
+                strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("56789"))))),
+            "range checksums");
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("backupType() and backupTypeStr()"))
     {
@@ -324,5 +366,199 @@ testRun(void)
         TEST_RESULT_STR_Z(backupTypeStr(backupTypeIncr), "incr", "backup type str incr");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("BlockMap and blockIncrRead()"))
+    {
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block map render and load");
+
+        BlockMap *blockMap = NULL;
+        TEST_ASSIGN(blockMap, blockMapNew(), "new block map");
+
+        BlockMapItem blockItem = {.reference = STRDEF("20191002-070640F"), .offset = 0, .size = 11};
+        memcpy(blockItem.checksum, bufPtrConst(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("block0"))), HASH_TYPE_SHA1_SIZE);
+        TEST_RESULT_VOID(blockMapAdd(blockMap, &blockItem), "add block");
+
+        blockItem = (BlockMapItem){.reference = STRDEF("20191002-070640F_20191003-070640I"), .offset = 0, .size = 22};
+        memcpy(blockItem.checksum, bufPtrConst(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("block1"))), HASH_TYPE_SHA1_SIZE);
+        TEST_RESULT_VOID(blockMapAdd(blockMap, &blockItem), "add block");
+
+        blockItem = (BlockMapItem){.reference = STRDEF("20191002-070640F"), .offset = 11, .size = 33};
+        memcpy(blockItem.checksum, bufPtrConst(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("block2"))), HASH_TYPE_SHA1_SIZE);
+        TEST_RESULT_VOID(blockMapAdd(blockMap, &blockItem), "add block");
+
+        BlockMap *blockMapLoad = NULL;
+        TEST_ASSIGN(blockMapLoad, blockMapNewBuf(blockMapBuf(blockMap)), "load block map");
+        TEST_RESULT_UINT(blockMapSize(blockMapLoad), 3, "block total");
+        TEST_RESULT_STR_Z(blockMapGet(blockMapLoad, 0)->reference, "20191002-070640F", "block 0 reference");
+        TEST_RESULT_STR_Z(blockMapGet(blockMapLoad, 1)->reference, "20191002-070640F_20191003-070640I", "block 1 reference");
+        TEST_RESULT_PTR(blockMapGet(blockMapLoad, 2)->reference, blockMapGet(blockMapLoad, 0)->reference, "block 2 reference");
+        TEST_RESULT_UINT(blockMapGet(blockMapLoad, 2)->offset, 11, "block 2 offset");
+        TEST_RESULT_UINT(blockMapGet(blockMapLoad, 2)->size, 33, "block 2 size");
+        TEST_RESULT_BOOL(
+            bufEq(
+                BUF(blockMapGet(blockMapLoad, 1)->checksum, HASH_TYPE_SHA1_SIZE),
+                cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("block1"))),
+            true, "block 1 checksum");
+
+        TEST_RESULT_VOID(blockMapFree(blockMapLoad), "free block map");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("invalid block map");
+
+        Buffer *buffer = bufNew(0);
+        PackWrite *pack = pckWriteNewBuf(buffer);
+        pckWriteArrayBeginP(pack);
+        pckWriteStrP(pack, STRDEF("20191002-070640F"));
+        pckWriteArrayEndP(pack);
+        pckWriteU64P(pack, 1);
+        pckWriteArrayBeginP(pack);
+        pckWriteU32P(pack, 1);
+        pckWriteArrayEndP(pack);
+        pckWriteEndP(pack);
+
+        TEST_ERROR(blockMapNewBuf(buffer), FormatError, "block map reference 1 is out of range");
+
+        buffer = bufNew(0);
+        pack = pckWriteNewBuf(buffer);
+        pckWriteArrayBeginP(pack);
+        pckWriteStrP(pack, STRDEF("20191002-070640F"));
+        pckWriteArrayEndP(pack);
+        pckWriteU64P(pack, 1);
+        pckWriteArrayBeginP(pack);
+        pckWriteU32P(pack, 0);
+        pckWriteU64P(pack, 0);
+        pckWriteU64P(pack, 1);
+        pckWriteBinP(pack, BUFSTRDEF("X"));
+        pckWriteArrayEndP(pack);
+        pckWriteEndP(pack);
+
+        TEST_ERROR(blockMapNewBuf(buffer), FormatError, "block map checksum size 1 is invalid");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("encode and decode block");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(
+                blockIncrDecode(
+                    blockIncrEncode(BUFSTRDEF("BLOCK"), compressTypeGz, 3, cipherTypeAes256Cbc, STRDEF("pass")), compressTypeGz,
+                    STRDEF("pass"))),
+            "BLOCK", "compressed and encrypted block");
+        TEST_RESULT_STR_Z(
+            strNewBuf(
+                blockIncrDecode(
+                    blockIncrEncode(BUFSTRDEF("BLOCK"), compressTypeNone, 0, cipherTypeNone, NULL), compressTypeNone, NULL)),
+            "BLOCK", "plain block");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("reassemble file from blocks in multiple backups");
+
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "--stanza=test1");
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAdd(argList, strNewFmt("--pg1-path=%s/pg", testPath()));
+        strLstAddZ(argList, "--repo1-retention-full=1");
+        harnessCfgLoad(cfgCmdBackup, argList);
+
+        const String *const labelFull = STRDEF("20191002-070640F");
+        const String *const labelIncr = STRDEF("20191002-070640F_20191003-070640I");
+
+        // Full backup stores all blocks contiguously followed by the map
+        Buffer *block0 = blockIncrEncode(BUFSTRDEF("block0"), compressTypeGz, 3, cipherTypeNone, NULL);
+        Buffer *block1 = blockIncrEncode(BUFSTRDEF("block1"), compressTypeGz, 3, cipherTypeNone, NULL);
+        Buffer *block1Incr = blockIncrEncode(BUFSTRDEF("BLOCK1"), compressTypeGz, 3, cipherTypeNone, NULL);
+
+        blockMap = blockMapNew();
+        blockItem = (BlockMapItem){.reference = labelFull, .offset = 0, .size = bufUsed(block0)};
+        memcpy(blockItem.checksum, bufPtrConst(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("block0"))), HASH_TYPE_SHA1_SIZE);
+        blockMapAdd(blockMap, &blockItem);
+        blockItem = (BlockMapItem){.reference = labelFull, .offset = bufUsed(block0), .size = bufUsed(block1)};
+        memcpy(blockItem.checksum, bufPtrConst(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("block1"))), HASH_TYPE_SHA1_SIZE);
+        blockMapAdd(blockMap, &blockItem);
+
+        Buffer *map = blockIncrEncode(blockMapBuf(blockMap), compressTypeGz, 3, cipherTypeNone, NULL);
+        Buffer *file = bufNew(0);
+        bufCat(file, block0);
+        bufCat(file, block1);
+        bufCat(file, map);
+
+        storagePutP(storageNewWriteP(storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191002-070640F/pg_data/1.gz")), file);
+
+        Buffer *result = bufNew(0);
+        IoWrite *write = ioBufferWriteNew(result);
+        ioWriteOpen(write);
+
+        TEST_RESULT_VOID(
+            blockIncrRead(
+                storageRepo(), STRDEF("pg_data/1"), labelFull, bufUsed(file) - bufUsed(map), bufUsed(map), compressTypeGz, NULL,
+                write),
+            "read full");
+        ioWriteClose(write);
+        TEST_RESULT_STR_Z(strNewBuf(result), "block0block1", "check file");
+
+        // Incremental backup stores only the changed block and references the unchanged block in the full backup
+        blockMap = blockMapNew();
+        blockItem = (BlockMapItem){.reference = labelFull, .offset = 0, .size = bufUsed(block0)};
+        memcpy(blockItem.checksum, bufPtrConst(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("block0"))), HASH_TYPE_SHA1_SIZE);
+        blockMapAdd(blockMap, &blockItem);
+        blockItem = (BlockMapItem){.reference = labelIncr, .offset = 0, .size = bufUsed(block1Incr)};
+        memcpy(blockItem.checksum, bufPtrConst(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("BLOCK1"))), HASH_TYPE_SHA1_SIZE);
+        blockMapAdd(blockMap, &blockItem);
+
+        map = blockIncrEncode(blockMapBuf(blockMap), compressTypeGz, 3, cipherTypeNone, NULL);
+        file = bufNew(0);
+        bufCat(file, block1Incr);
+        bufCat(file, map);
+
+        storagePutP(
+            storageNewWriteP(storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191002-070640F_20191003-070640I/pg_data/1.gz")),
+            file);
+
+        result = bufNew(0);
+        write = ioBufferWriteNew(result);
+        ioWriteOpen(write);
+
+        TEST_RESULT_VOID(
+            blockIncrRead(
+                storageRepo(), STRDEF("pg_data/1"), labelIncr, bufUsed(file) - bufUsed(map), bufUsed(map), compressTypeGz, NULL,
+                write),
+            "read incr");
+        ioWriteClose(write);
+        TEST_RESULT_STR_Z(strNewBuf(result), "block0BLOCK1", "check file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block checksum mismatch and short read");
+
+        blockMap = blockMapNew();
+        blockItem = (BlockMapItem){.reference = labelFull, .offset = 0, .size = bufUsed(block0)};
+        blockMapAdd(blockMap, &blockItem);
+
+        map = blockIncrEncode(blockMapBuf(blockMap), compressTypeGz, 3, cipherTypeNone, NULL);
+        file = bufNew(0);
+        bufCat(file, block0);
+        bufCat(file, map);
+
+        storagePutP(storageNewWriteP(storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191002-070640F/pg_data/2.gz")), file);
+
+        write = ioBufferWriteNew(bufNew(0));
+        ioWriteOpen(write);
+
+        TEST_ERROR(
+            blockIncrRead(
+                storageRepo(), STRDEF("pg_data/2"), labelFull, bufUsed(block0), bufUsed(map), compressTypeGz, NULL, write),
+            ChecksumError, "invalid checksum for block 0 of 'pg_data/2' from backup '20191002-070640F'");
+
+        blockMap = blockMapNew();
+        blockItem = (BlockMapItem){.reference = labelFull, .offset = 0, .size = 999};
+        blockMapAdd(blockMap, &blockItem);
+
+        map = blockIncrEncode(blockMapBuf(blockMap), compressTypeGz, 3, cipherTypeNone, NULL);
+        storagePutP(storageNewWriteP(storageRepoWrite(), STRDEF(STORAGE_REPO_BACKUP "/20191002-070640F/pg_data/2.gz")), map);
+
+        TEST_ERROR(
+            blockIncrRead(storageRepo(), STRDEF("pg_data/2"), labelFull, 0, bufUsed(map), compressTypeGz, NULL, write),
+            FileReadError, "unexpected eof reading block 0 of 'pg_data/2' from backup '20191002-070640F'");
+    }
+
     FUNCTION_HARNESS_RETURN_VOID();
 }
@@ -489,7 +489,7 @@ testRun(void)
             result,
             backupFile(
                 missingFile, true, 0, true, NULL, false, 0, missingFile, false, compressTypeNone, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+                cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             "pg file missing, ignoreMissing=true, no delta");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy/repo size 0");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultSkip, "    skip file");
@@ -512,9 +512,14 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));            // delta
         varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrSize
+        varLstAdd(paramList, NULL);                         // blockIncrMapPriorReference
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrMapPriorOffset
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrMapPriorSize
+        varLstAdd(paramList, varNewUInt64(0));              // checksumRangeSize
 
         TEST_RESULT_VOID(backupFileProtocol(paramList, server), "protocol backup file - skip");
-        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":[3,0,0,null,null]}\n", "    check result");
+        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":[3,0,0,null,null,0,0,0,null]}\n", "    check result");
         bufUsedSet(serverWrite, 0);
 
         // Pg file missing - ignoreMissing=false
@@ -522,7 +527,7 @@ testRun(void)
         TEST_ERROR_FMT(
             backupFile(
                 missingFile, false, 0, true, NULL, false, 0, missingFile, false, compressTypeNone, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+                cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             FileMissingError, "unable to open missing file '%s/pg/missing' for read", testPath());
 
         // Create a pg file to backup
@@ -544,7 +549,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9999999, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+                cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             "pg file exists and shrunk, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
         ((Storage *)storageRepo())->pub.interface.feature = feature;
@@ -572,7 +577,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, compressTypeNone, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+                cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             "file checksummed with pageChecksum enabled");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -604,11 +609,16 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));            // delta
         varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrSize
+        varLstAdd(paramList, NULL);                         // blockIncrMapPriorReference
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrMapPriorOffset
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrMapPriorSize
+        varLstAdd(paramList, varNewUInt64(0));              // checksumRangeSize
 
         TEST_RESULT_VOID(backupFileProtocol(paramList, server), "protocol backup file - pageChecksum");
         TEST_RESULT_STR_Z(
             strNewBuf(serverWrite),
-            "{\"out\":[1,12,12,\"c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9\",{\"align\":false,\"valid\":false}]}\n",
+            "{\"out\":[1,12,12,\"c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9\",{\"align\":false,\"valid\":false},0,0,0,null]}\n",
             "    check result");
         bufUsedSet(serverWrite, 0);
 
@@ -618,7 +628,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             "file in db and repo, checksum equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 0, "    repo size not set since already exists in repo");
@@ -647,10 +657,16 @@ testRun(void)
         varLstAdd(paramList, varNewBool(true));             // delta
         varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrSize
+        varLstAdd(paramList, NULL);                         // blockIncrMapPriorReference
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrMapPriorOffset
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrMapPriorSize
+        varLstAdd(paramList, varNewUInt64(0));              // checksumRangeSize
 
         TEST_RESULT_VOID(backupFileProtocol(paramList, server), "protocol backup file - noop");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite), "{\"out\":[4,12,0,\"c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9\",null]}\n", "    check result");
+            strNewBuf(serverWrite), "{\"out\":[4,12,0,\"c3ae4687ea8ccd47bfdb190dbe7fd3b37545fdb9\",null,0,0,0,null]}\n",
+            "    check result");
         bufUsedSet(serverWrite, 0);
 
         // -------------------------------------------------------------------------------------------------------------------------
@@ -659,7 +675,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("1234567890123456789012345678901234567890"), false, 0, pgFile, true,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             "file in db and repo, pg checksum not equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -674,7 +690,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9999999, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             "db & repo file, pg checksum same, pg size different, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 24, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -691,7 +707,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, STRDEF(BOGUS_STR), false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             "backup file");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultReCopy, "    check copy result");
@@ -709,7 +725,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             "    db & repo file, pgFileMatch, repo checksum no match, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultReCopy, "    recopy file");
@@ -727,7 +743,7 @@ testRun(void)
             result,
             backupFile(
                 missingFile, true, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             "    file in repo only, checksum in repo equal, ignoreMissing=true, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=0 size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultSkip, "    skip file");
@@ -740,7 +756,8 @@ testRun(void)
         TEST_ASSIGN(
             result,
             backupFile(
-                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeGz, 3, backupLabel, false, cipherTypeNone, NULL),
+                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeGz, 3, backupLabel, false, cipherTypeNone, NULL,
+                0, NULL, 0, 0, 0),
             "pg file exists, no checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -758,7 +775,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, compressTypeGz,
-                3, backupLabel, false, cipherTypeNone, NULL),
+                3, backupLabel, false, cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             "pg file & repo exists, match, checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -789,10 +806,16 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));            // delta
         varLstAdd(paramList, varNewUInt(cipherTypeNone));   // cipherType
         varLstAdd(paramList, NULL);                         // cipherSubPass
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrSize
+        varLstAdd(paramList, NULL);                         // blockIncrMapPriorReference
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrMapPriorOffset
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrMapPriorSize
+        varLstAdd(paramList, varNewUInt64(0));              // checksumRangeSize
 
         TEST_RESULT_VOID(backupFileProtocol(paramList, server), "protocol backup file - copy, compress");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite), "{\"out\":[0,9,29,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n", "    check result");
+            strNewBuf(serverWrite), "{\"out\":[0,9,29,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null,0,0,0,null]}\n",
+            "    check result");
         bufUsedSet(serverWrite, 0);
 
         // -------------------------------------------------------------------------------------------------------------------------
@@ -804,7 +827,7 @@ testRun(void)
             result,
             backupFile(
                 strNew("zerofile"), false, 0, true, NULL, false, 0, strNew("zerofile"), false, compressTypeNone, 1, backupLabel,
-                false, cipherTypeNone, NULL),
+                false, cipherTypeNone, NULL, 0, NULL, 0, 0, 0),
             "zero-sized pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=pgFile size 0");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -813,6 +836,33 @@ testRun(void)
             (storageExistsP(storageRepo(), strNewFmt(STORAGE_REPO_BACKUP "/%s/zerofile", strZ(backupLabel))) &&
                 result.pageChecksumResult == NULL),
             true, "    copy zero file to repo success");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("range checksums");
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, true, NULL, false, 0, STRDEF("rangefile"), false, compressTypeNone, 1, backupLabel, false,
+                cipherTypeNone, NULL, 0, NULL, 0, 0, 4),
+            "copy with range checksums");
+        TEST_RESULT_UINT(result.checksumRangeSize, 4, "    range size");
+        TEST_RESULT_STR(
+            result.checksumRange,
+            strNewFmt(
+                "%s%s%s", strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("ates")))),
+                strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("tfil")))),
+                strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("e"))))),
+            "    range checksums");
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, true, NULL, false, 0, STRDEF("rangefile"), false, compressTypeNone, 1, backupLabel, false,
+                cipherTypeNone, NULL, 0, NULL, 0, 0, 9),
+            "copy smaller than range size");
+        TEST_RESULT_UINT(result.checksumRangeSize, 0, "    no range size");
+        TEST_RESULT_STR(result.checksumRange, NULL, "    no range checksums");
     }
 
     // *****************************************************************************************************************************
@@ -841,7 +891,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, backupLabel, false, cipherTypeAes256Cbc,
-                strNew("12345678")),
+                strNew("12345678"), 0, NULL, 0, 0, 0),
             "pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
@@ -858,7 +908,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 8, true, strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeAes256Cbc, strNew("12345678")),
+                compressTypeNone, 1, backupLabel, true, cipherTypeAes256Cbc, strNew("12345678"), 0, NULL, 0, 0, 0),
             "pg and repo file exists, pgFileMatch false, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 8, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 32, "    repo size set");
@@ -875,7 +925,7 @@ testRun(void)
             result,
             backupFile(
                 pgFile, false, 9, true, strNew("1234567890123456789012345678901234567890"), false, 0, pgFile, false,
-                compressTypeNone, 0, backupLabel, false, cipherTypeAes256Cbc, strNew("12345678")),
+                compressTypeNone, 0, backupLabel, false, cipherTypeAes256Cbc, strNew("12345678"), 0, NULL, 0, 0, 0),
             "pg and repo file exists, repo checksum no match, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
         TEST_RESULT_UINT(result.repoSize, 32, "    repo size set");
@@ -904,13 +954,129 @@ testRun(void)
         varLstAdd(paramList, varNewBool(false));                // delta
         varLstAdd(paramList, varNewUInt(cipherTypeAes256Cbc));  // cipherType
         varLstAdd(paramList, varNewStrZ("12345678"));           // cipherPass
+        varLstAdd(paramList, varNewUInt64(0));                  // blockIncrSize
+        varLstAdd(paramList, NULL);                             // blockIncrMapPriorReference
+        varLstAdd(paramList, varNewUInt64(0));                  // blockIncrMapPriorOffset
+        varLstAdd(paramList, varNewUInt64(0));                  // blockIncrMapPriorSize
+        varLstAdd(paramList, varNewUInt64(0));                  // checksumRangeSize
 
         TEST_RESULT_VOID(backupFileProtocol(paramList, server), "protocol backup file - recopy, encrypt");
         TEST_RESULT_STR_Z(
-            strNewBuf(serverWrite), "{\"out\":[2,9,32,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null]}\n", "    check result");
+            strNewBuf(serverWrite), "{\"out\":[2,9,32,\"9bc8ab2dda60ef4beed07d1e19ce0676d5edde67\",null,0,0,0,null]}\n",
+            "    check result");
         bufUsedSet(serverWrite, 0);
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("backupFile() - block incremental"))
+    {
+        // Load Parameters
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "--stanza=test1");
+        strLstAdd(argList, strNewFmt("--repo1-path=%s/repo", testPath()));
+        strLstAdd(argList, strNewFmt("--pg1-path=%s/pg", testPath()));
+        strLstAddZ(argList, "--repo1-retention-full=1");
+        strLstAddZ(argList, "--repo1-cipher-type=aes-256-cbc");
+        setenv("PGBACKREST_REPO1_CIPHER_PASS", "12345678", true);
+        harnessCfgLoad(cfgCmdBackup, argList);
+        unsetenv("PGBACKREST_REPO1_CIPHER_PASS");
+
+        // Create the pg path
+        storagePathCreateP(storagePgWrite(), NULL, .mode = 0700);
+
+        // Create a pg file to backup
+        storagePutP(storageNewWriteP(storagePgWrite(), pgFile), BUFSTRDEF("atestfile"));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("missing pg file is skipped");
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                strNew("missing"), true, 9, true, NULL, false, 0, strNew("missing"), false, compressTypeGz, 3, backupLabel, false,
+                cipherTypeAes256Cbc, strNew("12345678"), 4, NULL, 0, 0, 0),
+            "backup missing file");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultSkip, "    skip file");
+        TEST_RESULT_UINT(result.blockIncrMapSize, 0, "    no block map");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("full backup stores all blocks");
+
+        TEST_ASSIGN(
+            result,
+            backupFile(
+                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeGz, 3, backupLabel, false, cipherTypeAes256Cbc,
+                strNew("12345678"), 4, NULL, 0, 0, 0),
+            "backup file");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_UINT(result.copySize, 9, "    copy size");
+        TEST_RESULT_STR_Z(result.copyChecksum, "9bc8ab2dda60ef4beed07d1e19ce0676d5edde67", "    copy checksum");
+        TEST_RESULT_UINT(result.blockIncrSize, 4, "    block incr size");
+        TEST_RESULT_BOOL(result.blockIncrMapSize > 0, true, "    block map size");
+        TEST_RESULT_UINT(
+            result.repoSize, storageInfoP(storageRepo(), strNewFmt("%s.gz", strZ(backupPathFile))).size, "    repo size");
+
+        Buffer *fileBuffer = bufNew(0);
+        IoWrite *write = ioBufferWriteNew(fileBuffer);
+        ioWriteOpen(write);
+
+        TEST_RESULT_VOID(
+            blockIncrRead(
+                storageRepo(), pgFile, backupLabel, result.repoSize - result.blockIncrMapSize, result.blockIncrMapSize,
+                compressTypeGz, strNew("12345678"), write),
+            "read file");
+        ioWriteClose(write);
+        TEST_RESULT_STR_Z(strNewBuf(fileBuffer), "atestfile", "    check file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("incremental backup stores only changed blocks");
+
+        const String *backupLabelIncr = strNew("20190718-155825F_20190719-155825I");
+        storagePutP(storageNewWriteP(storagePgWrite(), pgFile), BUFSTRDEF("atestFILE"));
+
+        BackupFileResult resultIncr = {0};
+
+        TEST_ASSIGN(
+            resultIncr,
+            backupFile(
+                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeGz, 3, backupLabelIncr, false,
+                cipherTypeAes256Cbc, strNew("12345678"), 4, backupLabel, result.repoSize - result.blockIncrMapSize,
+                result.blockIncrMapSize, 0),
+            "backup file");
+        TEST_RESULT_UINT(resultIncr.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_STR_Z(resultIncr.copyChecksum, "a03e7ed2587ac16f3097909da6b13db022a018cd", "    copy checksum");
+
+        BlockMap *blockMap = NULL;
+
+        TEST_ASSIGN(
+            blockMap,
+            blockMapNewBuf(
+                blockIncrDecode(
+                    storageGetP(
+                        storageNewReadP(
+                            storageRepo(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.gz", strZ(backupLabelIncr), strZ(pgFile)),
+                            .offset = resultIncr.repoSize - resultIncr.blockIncrMapSize,
+                            .limit = VARUINT64(resultIncr.blockIncrMapSize))),
+                    compressTypeGz, strNew("12345678"))),
+            "load block map");
+        TEST_RESULT_UINT(blockMapSize(blockMap), 3, "    block total");
+        TEST_RESULT_STR(blockMapGet(blockMap, 0)->reference, backupLabel, "    block 0 unchanged");
+        TEST_RESULT_STR(blockMapGet(blockMap, 1)->reference, backupLabelIncr, "    block 1 changed");
+        TEST_RESULT_STR(blockMapGet(blockMap, 2)->reference, backupLabelIncr, "    block 2 changed");
+
+        fileBuffer = bufNew(0);
+        write = ioBufferWriteNew(fileBuffer);
+        ioWriteOpen(write);
+
+        TEST_RESULT_VOID(
+            blockIncrRead(
+                storageRepo(), pgFile, backupLabelIncr, resultIncr.repoSize - resultIncr.blockIncrMapSize,
+                resultIncr.blockIncrMapSize, compressTypeGz, strNew("12345678"), write),
+            "read file");
+        ioWriteClose(write);
+        TEST_RESULT_STR_Z(strNewBuf(fileBuffer), "atestFILE", "    check file");
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("backupLabelCreate()"))
     {
@@ -1413,6 +1579,10 @@ testRun(void)
         varLstAdd(result, varNewUInt64(0));
         varLstAdd(result, NULL);
         varLstAdd(result, NULL);
+        varLstAdd(result, varNewUInt64(0));
+        varLstAdd(result, varNewUInt64(0));
+        varLstAdd(result, varNewUInt64(0));
+        varLstAdd(result, NULL);
 
         protocolParallelJobResultSet(job, varNewVarLst(result));
 
@@ -2333,6 +2503,8 @@ testRun(void)
             strLstAddZ(argList, "--" CFGOPT_TYPE "=" BACKUP_TYPE_FULL);
             hrnCfgArgRawBool(argList, cfgOptRepoHardlink, true);
             strLstAddZ(argList, "--" CFGOPT_MANIFEST_SAVE_THRESHOLD "=1");
+            hrnCfgArgRawBool(argList, cfgOptReadPipeline, true);
+            hrnCfgArgRawBool(argList, cfgOptIoUring, true);
             strLstAddZ(argList, "--" CFGOPT_ARCHIVE_COPY);
             harnessCfgLoad(cfgCmdBackup, argList);
 
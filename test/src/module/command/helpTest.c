@@ -160,6 +160,8 @@ testRun(void)
             "                                   cluster [default=preserve]\n"
             "  --db-include                     restore only specified databases\n"
             "                                   [current=db1, db2]\n"
+            "  --delta-block                    delta restore only blocks that differ\n"
+            "                                   [default=n]\n"
             "  --force                          force a restore [default=n]\n"
             "  --link-all                       restore all symlinks [default=n]\n"
             "  --link-map                       modify the destination of a symlink\n"
@@ -177,6 +179,8 @@ testRun(void)
             "                                   reached [default=n]\n"
             "  --target-timeline                recover along a timeline\n"
             "  --type                           recovery type [default=default]\n"
+            "  --write-flush                    flush restored files in the background\n"
+            "                                   [default=0]\n"
             "\n"
             "General Options:\n"
             "\n"
@@ -192,6 +196,10 @@ testRun(void)
             "                                   [default=/etc/pgbackrest]\n"
             "  --delta                          restore or backup using checksums [default=n]\n"
             "  --io-timeout                     i/O timeout [default=60]\n"
+            "  --io-uring                       queue file reads and writes with io_uring\n"
+            "                                   [default=n]\n"
+            "  --job-queue-max                  max jobs to queue for each process\n"
+            "                                   [default=1]\n"
             "  --lock-path                      path where lock files are stored\n"
             "                                   [default=/tmp/pgbackrest]\n"
             "  --neutral-umask                  use a neutral umask [default=y]\n"
@@ -199,6 +207,7 @@ testRun(void)
             "                                   [default=1]\n"
             "  --protocol-timeout               protocol timeout [default=1830]\n"
             "  --sck-keep-alive                 keep-alive enable [default=y]\n"
+            "  --split-size                     copy large files in ranges [default=0]\n"
             "  --stanza                         defines the stanza\n"
             "  --tcp-keep-alive-count           keep-alive count\n"
             "  --tcp-keep-alive-idle            keep-alive idle time\n"
@@ -256,11 +265,14 @@ testRun(void)
             "  --repo-s3-region                 S3 repository region\n"
             "  --repo-s3-role                   S3 repository role\n"
             "  --repo-s3-token                  S3 repository security token\n"
+            "  --repo-s3-upload-concurrency     S3 repository upload concurrency [default=1]\n"
             "  --repo-s3-uri-style              S3 URI Style [default=host]\n"
             "  --repo-storage-ca-file           repository storage CA file\n"
             "  --repo-storage-ca-path           repository storage CA path\n"
             "  --repo-storage-host              repository storage host\n"
             "  --repo-storage-port              repository storage port [default=443]\n"
+            "  --repo-storage-read-concurrency  repository storage read concurrency\n"
+            "                                   [default=1]\n"
             "  --repo-storage-verify-tls        repository storage certificate verify\n"
             "                                   [default=y]\n"
             "  --repo-type                      type of storage used for the repository\n"
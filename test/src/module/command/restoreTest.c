@@ -3,6 +3,7 @@ Test Restore Command
 ***********************************************************************************************************************************/
 #include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
+#include "common/crypto/hash.h"
 #include "common/io/io.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
@@ -179,17 +180,17 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("sparse-zero"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("sparse-zero"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), true, 0x10000000000UL, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, false, NULL),
             false, "zero sparse 1TB file");
         TEST_RESULT_UINT(storageInfoP(storagePg(), strNew("sparse-zero")).size, 0x10000000000UL, "    check size");
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("normal-zero"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("normal-zero"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, false, false, NULL),
+                strNew(testGroup()), 0, false, false, false, NULL),
             true, "zero-length file");
         TEST_RESULT_UINT(storageInfoP(storagePg(), strNew("normal-zero")).size, 0, "    check size");
 
@@ -205,9 +206,9 @@ testRun(void)
 
         TEST_ERROR(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeGz, strNew("normal"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeGz, 0, 0, strNew("normal"),
                 strNew("ffffffffffffffffffffffffffffffffffffffff"), false, 7, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, false, false, strNew("badpass")),
+                strNew(testGroup()), 0, false, false, false, strNew("badpass")),
             ChecksumError,
             "error restoring 'normal': actual checksum 'd1cd8a7d11daa26814b93eb604e1d49ab4b43770' does not match expected checksum"
                 " 'ffffffffffffffffffffffffffffffffffffffff'");
@@ -220,9 +221,9 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeGz, strNew("normal"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeGz, 0, 0, strNew("normal"),
                 strNew("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), false, 7, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, false, false, strNew("badpass")),
+                strNew(testGroup()), 0, false, false, false, strNew("badpass")),
             true, "copy file");
 
         StorageInfo info = storageInfoP(storagePg(), strNew("normal"));
@@ -243,9 +244,9 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, false, NULL),
             true, "sha1 delta missing");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -255,18 +256,62 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, false, NULL),
             false, "sha1 delta existing");
 
         ioBufferSizeSet(oldBufferSize);
 
+        // Change the mode of the existing file so it is updated before the delta check
+        THROW_ON_SYS_ERROR(
+            chmod(strZ(storagePathP(storagePg(), strNew("delta"))), 0640) == -1, FileModeError, "unable to set mode");
+
+        harnessLogLevelSet(logLevelDetail);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, false, NULL),
+            false, "sha1 delta existing, mode differs");
+        TEST_RESULT_LOG("P00 DETAIL: update mode for '{[path]}/pg/delta' to 0600");
+        TEST_RESULT_INT(storageInfoP(storagePg(), strNew("delta")).mode, 0600, "    check mode");
+
+        // Mode is also updated when the existing file is overwritten by a force restore
+        THROW_ON_SYS_ERROR(
+            chmod(strZ(storagePathP(storagePg(), strNew("delta"))), 0640) == -1, FileModeError, "unable to set mode");
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, false, true, false, NULL),
+            true, "force existing, mode differs");
+        TEST_RESULT_LOG("P00 DETAIL: update mode for '{[path]}/pg/delta' to 0600");
+        TEST_RESULT_INT(storageInfoP(storagePg(), strNew("delta")).mode, 0600, "    check mode");
+
+        // The mode of a linked file is not updated since the clean checks links
+        THROW_ON_SYS_ERROR(
+            symlink("delta", strZ(storagePathP(storagePg(), strNew("delta-link")))) == -1, FileOpenError, "unable to create link");
+
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta-link"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0640, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, false, NULL),
+            false, "sha1 delta existing linked file");
+        TEST_RESULT_INT(storageInfoP(storagePg(), strNew("delta")).mode, 0600, "    check mode");
+
+        storageRemoveP(storagePgWrite(), strNew("delta-link"), .errorOnMissing = true);
+
+        harnessLogLevelReset();
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432155, true, true, NULL),
+                strNew(testGroup()), 1557432155, true, true, false, NULL),
             false, "sha1 delta force existing");
 
         // Change the existing file so it no longer matches by size
@@ -274,9 +319,9 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, false, NULL),
             true, "sha1 delta existing, size differs");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -285,9 +330,9 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432155, true, true, NULL),
+                strNew(testGroup()), 1557432155, true, true, false, NULL),
             true, "delta force existing, size differs");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -297,9 +342,9 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, false, NULL),
             true, "sha1 delta existing, content differs");
         TEST_RESULT_STR_Z(
             strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
@@ -308,16 +353,16 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432155, true, true, NULL),
+                strNew(testGroup()), 1557432155, true, true, false, NULL),
             true, "delta force existing, timestamp differs");
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 1557432153, true, true, NULL),
+                strNew(testGroup()), 1557432153, true, true, false, NULL),
             true, "delta force existing, timestamp after copy time");
 
         // Change the existing file to zero-length
@@ -325,11 +370,139 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, strNew("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
                 strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, 1557432154, 0600, strNew(testUser()),
-                strNew(testGroup()), 0, true, false, NULL),
+                strNew(testGroup()), 0, true, false, false, NULL),
             false, "sha1 delta existing, content differs");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block delta");
+
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("delta")), BUFSTRDEF("btestfile"));
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, true, NULL),
+            true, "block delta existing, content differs");
+
+        info = storageInfoP(storagePg(), strNew("delta"));
+        TEST_RESULT_INT(info.timeModified, 1557432154, "    check time");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
+
+        // The file is not checksummed first so it is restored by block delta even when it matches
+        HRN_STORAGE_TIME(storagePg(), "delta", 1557432100);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("delta"),
+                strNew("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, strNew(testUser()),
+                strNew(testGroup()), 0, true, false, true, NULL),
+            true, "block delta existing, content matches");
+
+        info = storageInfoP(storagePg(), strNew("delta"));
+        TEST_RESULT_INT(info.timeModified, 1557432154, "    check time");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storagePg(), strNew("delta")))), "atestfile", "    check contents");
+
+        // Create a repo file with three blocks and a partial block
+        const String *const repoFileBlock = STRDEF("pg_data/block");
+        Buffer *const blockData = bufNew(DELTA_WRITE_BLOCK_SIZE * 3 + 10);
+
+        for (unsigned int blockIdx = 0; blockIdx < 4; blockIdx++)
+        {
+            memset(
+                bufPtr(blockData) + DELTA_WRITE_BLOCK_SIZE * blockIdx, 'a' + (int)blockIdx,
+                blockIdx < 3 ? DELTA_WRITE_BLOCK_SIZE : 10);
+        }
+
+        bufUsedSet(blockData, bufSize(blockData));
+
+        storagePutP(
+            storageNewWriteP(
+                storageRepoWrite(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s", strZ(repoFileReferenceFull), strZ(repoFileBlock))),
+            blockData);
+
+        const String *const blockChecksum = bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, blockData));
+
+        // Change the second block and add data past the end of the file
+        Buffer *pgData = bufDup(blockData);
+        memset(bufPtr(pgData) + DELTA_WRITE_BLOCK_SIZE + 1, 'x', 1);
+        bufCat(pgData, BUFSTRDEF("extra"));
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("block")), pgData);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileBlock, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("block"), blockChecksum, false,
+                bufUsed(blockData), 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, true, NULL),
+            true, "block delta, block differs and file is longer");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storagePg(), strNew("block"))), blockData), true, "    check contents");
+
+        // Change the first block and make the file shorter
+        pgData = bufDup(blockData);
+        memset(bufPtr(pgData), 'x', 1);
+        bufUsedSet(pgData, DELTA_WRITE_BLOCK_SIZE * 2 + 1);
+        storagePutP(storageNewWriteP(storagePgWrite(), strNew("block")), pgData);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFileBlock, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, strNew("block"), blockChecksum, false,
+                bufUsed(blockData), 1557432154, 0600, strNew(testUser()), strNew(testGroup()), 0, true, false, true, NULL),
+            true, "block delta, block differs and file is shorter");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storagePg(), strNew("block"))), blockData), true, "    check contents");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block delta errors");
+
+        const String *const blockPath = storagePathP(storagePg(), STRDEF("block"));
+        IoWrite *write = deltaWriteNew(storagePathP(storagePg(), STRDEF("missing")));
+
+        TEST_ERROR_FMT(
+            ioWriteOpen(write), FileOpenError, "unable to open file '%s/pg/missing' for write: [2] No such file or directory",
+            testPath());
+
+        // Replace the file descriptor with a write-only descriptor so the read will fail
+        write = deltaWriteNew(blockPath);
+        TEST_RESULT_VOID(ioWriteOpen(write), "open");
+
+        int fd = open("/dev/null", O_WRONLY);
+        dup2(fd, ioWriteFd(write));
+        close(fd);
+
+        TEST_RESULT_VOID(ioWrite(write, blockData), "write");
+        TEST_ERROR_FMT(ioWriteClose(write), FileReadError, "unable to read '%s': [9] Bad file descriptor", strZ(blockPath));
+        TEST_RESULT_VOID(ioWriteFree(write), "free");
+
+        // Replace the file descriptor with a read-only descriptor so the write will fail
+        write = deltaWriteNew(blockPath);
+        TEST_RESULT_VOID(ioWriteOpen(write), "open");
+
+        fd = open(strZ(blockPath), O_RDONLY);
+        dup2(fd, ioWriteFd(write));
+        close(fd);
+
+        TEST_RESULT_VOID(ioWrite(write, BUFSTRDEF("x")), "write");
+        TEST_ERROR_FMT(ioWriteClose(write), FileWriteError, "unable to write '%s': [9] Bad file descriptor", strZ(blockPath));
+        TEST_RESULT_VOID(ioWriteFree(write), "free");
+
+        // The read-only descriptor will also cause the truncate to fail
+        write = deltaWriteNew(blockPath);
+        TEST_RESULT_VOID(ioWriteOpen(write), "open");
+
+        fd = open(strZ(blockPath), O_RDONLY);
+        dup2(fd, ioWriteFd(write));
+        close(fd);
+
+        TEST_ERROR_FMT(ioWriteClose(write), FileWriteError, "unable to truncate '%s': [22] Invalid argument", strZ(blockPath));
+        TEST_RESULT_VOID(ioWriteFree(write), "free");
+
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storagePg(), strNew("block"))), blockData), true, "    check contents");
+
         // Check protocol function directly
         // -------------------------------------------------------------------------------------------------------------------------
         VariantList *paramList = varLstNew();
@@ -337,6 +510,8 @@ testRun(void)
         varLstAdd(paramList, varNewUInt(repoIdx));
         varLstAdd(paramList, varNewStr(repoFileReferenceFull));
         varLstAdd(paramList, varNewUInt(compressTypeNone));
+        varLstAdd(paramList, varNewUInt64(0));
+        varLstAdd(paramList, varNewUInt64(0));
         varLstAdd(paramList, varNewStrZ("protocol"));
         varLstAdd(paramList, varNewStrZ("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"));
         varLstAdd(paramList, varNewBool(false));
@@ -348,6 +523,7 @@ testRun(void)
         varLstAdd(paramList, varNewUInt64(1557432200));
         varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, NULL);
 
         TEST_RESULT_VOID(restoreFileProtocol(paramList, server), "protocol restore file");
@@ -369,6 +545,8 @@ testRun(void)
         varLstAdd(paramList, varNewUInt(repoIdx));
         varLstAdd(paramList, varNewStr(repoFileReferenceFull));
         varLstAdd(paramList, varNewUInt(compressTypeNone));
+        varLstAdd(paramList, varNewUInt64(0));
+        varLstAdd(paramList, varNewUInt64(0));
         varLstAdd(paramList, varNewStrZ("protocol"));
         varLstAdd(paramList, varNewStrZ("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"));
         varLstAdd(paramList, varNewBool(false));
@@ -380,11 +558,61 @@ testRun(void)
         varLstAdd(paramList, varNewUInt64(1557432200));
         varLstAdd(paramList, varNewBool(true));
         varLstAdd(paramList, varNewBool(false));
+        varLstAdd(paramList, varNewBool(false));
         varLstAdd(paramList, NULL);
 
         TEST_RESULT_VOID(restoreFileProtocol(paramList, server), "protocol restore file");
         TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":false}\n", "    check result");
         bufUsedSet(serverWrite, 0);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy ranges");
+
+        storagePutP(storageNewWriteP(storagePgWrite(), STRDEF("range")), NULL);
+
+        TEST_RESULT_UINT(
+            restoreFileRange(
+                repoFile1, repoIdx, repoFileReferenceFull, STRDEF("range"), 5, 4,
+                STRDEF("971c419dd609331343dee105fffd0f4608dc0bf2")),
+            4, "copy last range");
+        TEST_RESULT_UINT(
+            restoreFileRange(
+                repoFile1, repoIdx, repoFileReferenceFull, STRDEF("range"), 0, 5,
+                STRDEF("a5239517e4715c74276e4b4c8e6bcc7c637a0f27")),
+            5, "copy first range");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storagePg(), STRDEF("range")))), "atestfile", "    check contents");
+
+        TEST_ERROR(
+            restoreFileRange(
+                repoFile1, repoIdx, repoFileReferenceFull, STRDEF("range"), 5, 5,
+                STRDEF("971c419dd609331343dee105fffd0f4608dc0bf2")),
+            FileReadError, "error restoring 'range': expected 5 bytes at offset 5 but read 4");
+        TEST_ERROR(
+            restoreFileRange(
+                repoFile1, repoIdx, repoFileReferenceFull, STRDEF("range"), 0, 5,
+                STRDEF("971c419dd609331343dee105fffd0f4608dc0bf2")),
+            ChecksumError,
+            "error restoring 'range': actual checksum 'a5239517e4715c74276e4b4c8e6bcc7c637a0f27' does not match expected checksum"
+                " '971c419dd609331343dee105fffd0f4608dc0bf2' for range at offset 0");
+        TEST_ERROR_FMT(
+            restoreFileRange(
+                repoFile1, repoIdx, repoFileReferenceFull, STRDEF("missing"), 0, 5,
+                STRDEF("a5239517e4715c74276e4b4c8e6bcc7c637a0f27")),
+            FileOpenError, "unable to open file '%s/pg/missing' for write: [2] No such file or directory", testPath());
+
+        paramList = varLstNew();
+        varLstAdd(paramList, varNewStr(repoFile1));
+        varLstAdd(paramList, varNewUInt(repoIdx));
+        varLstAdd(paramList, varNewStr(repoFileReferenceFull));
+        varLstAdd(paramList, varNewStrZ("range"));
+        varLstAdd(paramList, varNewUInt64(1));
+        varLstAdd(paramList, varNewUInt64(8));
+        varLstAdd(paramList, varNewStrZ("e05fcb614ab36fdee72ee1f2754ed85e2bd0e8d0"));
+
+        TEST_RESULT_VOID(restoreFileRangeProtocol(paramList, server), "protocol restore file range");
+        TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":8}\n", "    check result");
+        bufUsedSet(serverWrite, 0);
     }
 
     // *****************************************************************************************************************************
@@ -1811,13 +2039,30 @@ testRun(void)
         harnessLogLevelSet(logLevelDetail);
 
         // -------------------------------------------------------------------------------------------------------------------------
-        TEST_TITLE("verify next queue calculations");
+        TEST_TITLE("verify queue to steal from");
 
-        TEST_RESULT_INT(restoreJobQueueNext(0, 0, 1), 0, "client idx 0, queue idx 0, 1 queue");
-        TEST_RESULT_INT(restoreJobQueueNext(0, 0, 2), 1, "client idx 0, queue idx 0, 2 queues");
-        TEST_RESULT_INT(restoreJobQueueNext(1, 1, 2), 0, "client idx 1, queue idx 1, 2 queues");
-        TEST_RESULT_INT(restoreJobQueueNext(0, 1, 2), 0, "client idx 0, queue idx 1, 2 queues");
-        TEST_RESULT_INT(restoreJobQueueNext(1, 0, 2), 1, "client idx 1, queue idx 0, 2 queues");
+        List *queueList = lstNewP(sizeof(List *));
+        List *queueSizeList = lstNewP(sizeof(uint64_t));
+        const ManifestFile *queueFile = NULL;
+
+        for (unsigned int queueIdx = 0; queueIdx < 3; queueIdx++)
+        {
+            List *queue = lstNewP(sizeof(ManifestFile *));
+            lstAdd(queueList, &queue);
+            lstAdd(queueSizeList, &(uint64_t){0});
+        }
+
+        TEST_RESULT_INT(restoreJobQueueSteal(queueList, queueSizeList), -1, "all queues empty");
+
+        lstAdd(*(List **)lstGet(queueList, 2), &queueFile);
+        TEST_RESULT_INT(restoreJobQueueSteal(queueList, queueSizeList), 2, "only queue with files");
+
+        lstAdd(*(List **)lstGet(queueList, 1), &queueFile);
+        TEST_RESULT_INT(restoreJobQueueSteal(queueList, queueSizeList), 1, "first queue when sizes are equal");
+
+        *(uint64_t *)lstGet(queueSizeList, 0) = 16384;
+        *(uint64_t *)lstGet(queueSizeList, 2) = 8192;
+        TEST_RESULT_INT(restoreJobQueueSteal(queueList, queueSizeList), 2, "queue with most bytes remaining");
 
         // Locality error
         // -------------------------------------------------------------------------------------------------------------------------
@@ -2176,6 +2421,72 @@ testRun(void)
             strNewBuf(storageGetP(storageNewReadP(storagePg(), STRDEF(PG_FILE_PGVERSION)))), PG_VERSION_84_STR "\n",
             "check PG_VERSION was restored");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("full restore with force and files copied in ranges");
+
+        // Add range checksums to the manifest as a backup with split-size=3 would have
+        #define TEST_CHECKSUM_RANGE                                 "532cb5b70a3f71ce180c165205647e8909d4e8a0"                     \
+                                                                    "adc83b19e793491b1c6ea0fd8b46cd9f32e592fc"
+
+        manifestFileUpdate(
+            manifest, STRDEF(MANIFEST_TARGET_PGDATA "/" PG_FILE_PGVERSION), 4, 4, NULL, NULL, false, false, NULL, 0, 0, 3,
+            STRDEF(TEST_CHECKSUM_RANGE));
+        manifestFileUpdate(
+            manifest, STRDEF(MANIFEST_TARGET_PGTBLSPC "/1/16384/" PG_FILE_PGVERSION), 4, 4, NULL, NULL, false, false, NULL, 0, 0,
+            3, STRDEF(TEST_CHECKSUM_RANGE));
+
+        manifestSave(
+            manifest,
+            storageWriteIo(
+                storageNewWriteP(storageRepoWrite(),
+                strNew(STORAGE_REPO_BACKUP "/20161219-212741F/" BACKUP_MANIFEST_FILE))));
+
+        argList = strLstNew();
+        strLstAddZ(argList, "--" CFGOPT_STANZA "=test1");
+        hrnCfgArgRaw(argList, cfgOptRepoPath, repoPath);
+        hrnCfgArgRaw(argList, cfgOptPgPath, pgPath);
+        hrnCfgArgRawZ(argList, cfgOptProcessMax, "2");
+        hrnCfgArgRawZ(argList, cfgOptSplitSize, "3");
+        strLstAddZ(argList, "--" CFGOPT_TYPE "=" RECOVERY_TYPE_PRESERVE);
+        strLstAddZ(argList, "--" CFGOPT_SET "=20161219-212741F");
+        strLstAddZ(argList, "--" CFGOPT_FORCE);
+        harnessCfgLoad(cfgCmdRestore, argList);
+
+        // Overwrite PG_VERSION with bogus content that is longer than the file in the backup
+        storagePutP(storageNewWriteP(storagePgWrite(), STRDEF(PG_FILE_PGVERSION)), BUFSTRDEF("BOGUS\n"));
+
+        // Set log level to warn because multiple processes are used so the log order will not be deterministic
+        harnessLogLevelSet(logLevelWarn);
+
+        TEST_RESULT_VOID(cmdRestore(), "successful restore");
+
+        harnessLogLevelSet(logLevelDetail);
+
+        TEST_RESULT_LOG(
+            "P00   WARN: recovery type is preserve but recovery file does not exist at '{[path]}/pg/recovery.conf'\n"
+            "P00   WARN: backup does not contain 'global/pg_control' -- cluster will not start");
+
+        testRestoreCompare(
+            storagePg(), NULL, manifest,
+            ". {path}\n"
+            "PG_VERSION {file, s=4, t=1482182860}\n"
+            "global {path}\n"
+            "pg_tblspc {path}\n"
+            "pg_tblspc/1 {link, d={[path]}/ts/1}\n"
+            "tablespace_map {file, s=0, t=1482182860}\n");
+
+        testRestoreCompare(
+            storagePg(), STRDEF("pg_tblspc/1"), manifest,
+            ". {link, d={[path]}/ts/1}\n"
+            "16384 {path}\n"
+            "16384/PG_VERSION {file, s=4, t=1482182860}\n");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storagePg(), STRDEF(PG_FILE_PGVERSION)))), PG_VERSION_84_STR "\n",
+            "check PG_VERSION was restored");
+
+        #undef TEST_CHECKSUM_RANGE
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("incremental delta selective restore");
 
@@ -2613,6 +2924,28 @@ testRun(void)
             "P00   INFO: restore global/pg_control (performed last to ensure aborted restores cannot be started)\n"
             "P00 DETAIL: sync path '{[path]}/pg/global'");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("incremental delta restore with multiple processes");
+
+        argList = strLstNew();
+        strLstAddZ(argList, "--stanza=test1");
+        hrnCfgArgRaw(argList, cfgOptRepoPath, repoPath);
+        hrnCfgArgRaw(argList, cfgOptPgPath, pgPath);
+        hrnCfgArgRawZ(argList, cfgOptProcessMax, "2");
+        strLstAddZ(argList, "--delta");
+        strLstAddZ(argList, "--type=preserve");
+        strLstAddZ(argList, "--link-map=pg_wal=../wal");
+        strLstAddZ(argList, "--link-map=postgresql.conf=../config/postgresql.conf");
+        strLstAddZ(argList, "--link-map=pg_hba.conf=../config/pg_hba.conf");
+        harnessCfgLoad(cfgCmdRestore, argList);
+
+        // Set log level to warn because multiple processes are used so the log order will not be deterministic
+        harnessLogLevelSet(logLevelWarn);
+
+        TEST_RESULT_VOID(cmdRestore(), "successful restore");
+
+        harnessLogLevelSet(logLevelDetail);
+
         // -------------------------------------------------------------------------------------------------------------------------
         // Keep this test at the end since is corrupts the repo
         TEST_TITLE("remove a repo file so a restore job errors");
@@ -887,14 +887,14 @@ testRun(void)
 
         String *filePathName =  strNewFmt(STORAGE_REPO_ARCHIVE "/testfile");
         TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageRepoWrite(), filePathName), BUFSTRDEF("")), "put zero-sized file");
-        TEST_RESULT_UINT(verifyFile(filePathName, STRDEF(HASH_TYPE_SHA1_ZERO), 0, NULL), verifyOk, "file ok");
+        TEST_RESULT_UINT(verifyFile(filePathName, STRDEF(HASH_TYPE_SHA1_ZERO), 0, NULL, 0), verifyOk, "file ok");
 
         TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageRepoWrite(), filePathName), BUFSTRZ(fileContents)), "put file");
 
-        TEST_RESULT_UINT(verifyFile(filePathName, fileChecksum, 0, NULL), verifySizeInvalid, "file size invalid");
+        TEST_RESULT_UINT(verifyFile(filePathName, fileChecksum, 0, NULL, 0), verifySizeInvalid, "file size invalid");
         TEST_RESULT_UINT(
             verifyFile(
-                strNewFmt(STORAGE_REPO_ARCHIVE "/missingFile"), fileChecksum, 0, NULL), verifyFileMissing, "file missing");
+                strNewFmt(STORAGE_REPO_ARCHIVE "/missingFile"), fileChecksum, 0, NULL, 0), verifyFileMissing, "file missing");
 
         // Create a compressed encrypted repo file
         filePathName = strNew(STORAGE_REPO_BACKUP "/testfile.gz");
@@ -905,10 +905,10 @@ testRun(void)
         TEST_RESULT_VOID(storagePutP(write, BUFSTRZ(fileContents)), "write encrypted, compressed file");
 
         TEST_RESULT_UINT(
-            verifyFile(filePathName, fileChecksum, fileSize, strNew("pass")), verifyOk, "file encrypted compressed ok");
+            verifyFile(filePathName, fileChecksum, fileSize, strNew("pass"), 0), verifyOk, "file encrypted compressed ok");
         TEST_RESULT_UINT(
             verifyFile(
-                filePathName, strNew("badchecksum"), fileSize, strNew("pass")), verifyChecksumMismatch,
+                filePathName, strNew("badchecksum"), fileSize, strNew("pass"), 0), verifyChecksumMismatch,
                 "file encrypted compressed checksum mismatch");
 
         //--------------------------------------------------------------------------------------------------------------------------
@@ -926,6 +926,7 @@ testRun(void)
         varLstAdd(paramList, varNewStr(fileChecksum));
         varLstAdd(paramList, varNewUInt64(fileSize));
         varLstAdd(paramList, varNewStrZ("pass"));
+        varLstAdd(paramList, varNewUInt64(0));
 
         TEST_RESULT_VOID(verifyFileProtocol(paramList, server), "protocol verify file");
         TEST_RESULT_STR_Z(strNewBuf(serverWrite), "{\"out\":0}\n", "check result");
@@ -306,14 +306,15 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("zstDecompressToLog() and zstCompressToLog()");
 
-        ZstCompress *compress = (ZstCompress *)ioFilterDriver(zstCompressNew(14));
+        ZstCompress *compress = (ZstCompress *)ioFilterDriver(zstCompressNew(14, 0, false));
 
         compress->inputSame = true;
         compress->inputOffset = 49;
         compress->flushing = true;
 
         TEST_RESULT_STR_Z(
-            zstCompressToLog(compress), "{level: 14, inputSame: true, inputOffset: 49, flushing: true}", "format object");
+            zstCompressToLog(compress),
+            "{level: 14, workerMax: 0, longMatch: false, inputSame: true, inputOffset: 49, flushing: true}", "format object");
 
         ZstDecompress *decompress = (ZstDecompress *)ioFilterDriver(zstDecompressNew());
 
@@ -324,6 +325,35 @@ testRun(void)
         TEST_RESULT_STR_Z(
             zstDecompressToLog(decompress), "{inputSame: true, inputOffset: 999, frameDone false, done: true}",
             "format object");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compress with workers and long distance matching");
+
+        Buffer *decompressed = bufNew(4 * 1024 * 1024);
+
+        for (size_t dataIdx = 0; dataIdx < bufSize(decompressed); dataIdx++)
+            bufPtr(decompressed)[dataIdx] = (unsigned char)(dataIdx % 1021 + dataIdx / 4099);
+
+        bufUsedSet(decompressed, bufSize(decompressed));
+
+        compressZstSet(2, true);
+
+        IoFilter *filter = NULL;
+        TEST_ASSIGN(filter, compressFilter(compressTypeZst, 3), "new filter");
+        TEST_RESULT_UINT(((ZstCompress *)ioFilterDriver(filter))->workerMax, 2, "check workers");
+        TEST_RESULT_BOOL(((ZstCompress *)ioFilterDriver(filter))->longMatch, true, "check long match");
+
+        TEST_ASSIGN(
+            filter, compressFilterVar(STRDEF(ZST_COMPRESS_FILTER_TYPE), ioFilterParamList(filter)), "new filter from params");
+        TEST_RESULT_UINT(((ZstCompress *)ioFilterDriver(filter))->workerMax, 2, "check workers");
+        TEST_RESULT_BOOL(((ZstCompress *)ioFilterDriver(filter))->longMatch, true, "check long match");
+
+        compressZstSet(0, false);
+
+        Buffer *compressed = NULL;
+        TEST_ASSIGN(compressed, testCompress(filter, decompressed, 65536, 1024), "compress");
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(decompressFilter(compressTypeZst), compressed, 65536, 65536)), true, "decompress");
 #else
         TEST_ERROR(compressTypePresent(compressTypeZst), OptionInvalidValueError, "pgBackRest not compiled with zst support");
 #endif // HAVE_LIBZST
@@ -381,6 +411,15 @@ testRun(void)
 
         TEST_RESULT_INT(compressLevelDefault(compressTypeNone), 0, "none level=0");
         TEST_RESULT_INT(compressLevelDefault(compressTypeGz), 6, "gz level=6");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compressZstSet()");
+
+        TEST_RESULT_VOID(compressZstSet(4, true), "set zst workers and long match");
+        TEST_RESULT_UINT(compressHelperZst.workerMax, 4, "check workers");
+        TEST_RESULT_BOOL(compressHelperZst.longMatch, true, "check long match");
+
+        compressZstSet(0, false);
     }
 
     FUNCTION_HARNESS_RETURN_VOID();
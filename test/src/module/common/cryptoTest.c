@@ -369,6 +369,47 @@ testRun(void)
         TEST_ASSIGN(hash, cryptoHashNew(strNew(HASH_TYPE_SHA256)), "create sha256 hash");
         TEST_RESULT_STR_Z(varStr(ioFilterResult(hash)), HASH_TYPE_SHA256_ZERO, "    check empty hash");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("crc32c hash");
+
+        TEST_ASSIGN(hash, cryptoHashNew(HASH_TYPE_CRC32C_STR), "create crc32c hash");
+        TEST_RESULT_STR_Z(varStr(ioFilterResult(hash)), HASH_TYPE_CRC32C_ZERO, "check empty hash");
+
+        TEST_ASSIGN(hash, cryptoHashNew(HASH_TYPE_CRC32C_STR), "create crc32c hash");
+        TEST_RESULT_VOID(ioFilterProcessIn(hash, BUFSTRDEF("1234")), "add 4 bytes");
+        TEST_RESULT_VOID(ioFilterProcessIn(hash, BUFSTRDEF("56789")), "add 5 bytes");
+        TEST_RESULT_STR_Z(varStr(ioFilterResult(hash)), "e3069283", "check hash");
+
+        TEST_RESULT_STR_Z(
+            bufHex(cryptoHashOne(HASH_TYPE_CRC32C_STR, BUFSTRDEF("The quick brown fox jumps over the lazy dog"))), "22620404",
+            "check hash");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("crc32c portable implementation matches cpu implementation");
+
+        TEST_RESULT_UINT(~crc32cUpdateTable(0xFFFFFFFF, (const unsigned char *)"123456789", 9), 0xE3069283, "portable check value");
+
+        unsigned char crcData[128];
+
+        for (unsigned int crcIdx = 0; crcIdx < sizeof(crcData); crcIdx++)
+            crcData[crcIdx] = (unsigned char)(crcIdx * 7 + 3);
+
+        bool crcMatch = true;
+
+        for (unsigned int crcOffset = 0; crcOffset < 8; crcOffset++)
+        {
+            for (size_t crcSize = 0; crcSize <= sizeof(crcData) - crcOffset; crcSize++)
+            {
+                if (crc32cUpdateTable(0xFFFFFFFF, crcData + crcOffset, crcSize) !=
+                    crc32cUpdate(0xFFFFFFFF, crcData + crcOffset, crcSize))
+                {
+                    crcMatch = false;
+                }
+            }
+        }
+
+        TEST_RESULT_BOOL(crcMatch, true, "all offsets and sizes match");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_STR_Z(
             bufHex(cryptoHashOne(strNew(HASH_TYPE_SHA1), BUFSTRDEF("12345"))), "8cb2237d0679ca88db6464eac60da96345513964",
@@ -17,6 +17,16 @@ HTTP user agent header
 #define TEST_USER_AGENT                                                                                                            \
     HTTP_HEADER_USER_AGENT ":" PROJECT_NAME "/" PROJECT_VERSION "\r\n"
 
+/***********************************************************************************************************************************
+Request a range for HttpRangeRead tests
+***********************************************************************************************************************************/
+static HttpRequest *
+testRangeRequest(void *data, uint64_t offset, uint64_t size)
+{
+    return httpRequestNewP(
+        data, HTTP_VERB_GET_STR, STRDEF("/file"), .header = httpHeaderPutRange(httpHeaderNew(NULL), offset, VARUINT64(size)));
+}
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -104,6 +114,17 @@ testRun(void)
             httpHeaderToLog(httpHeaderDup(header, redact)), "{public: <redacted>, secret: 'secret-value'}",
             "dup and change redactions");
         TEST_RESULT_PTR(httpHeaderDup(NULL, NULL), NULL, "dup null header");
+
+        // Range
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_STR_Z(httpHeaderToLog(httpHeaderPutRange(httpHeaderNew(NULL), 0, NULL)), "{}", "no range");
+        TEST_RESULT_STR_Z(
+            httpHeaderToLog(httpHeaderPutRange(httpHeaderNew(NULL), 0, VARUINT64(10))), "{range: 'bytes=0-9'}", "range limit");
+        TEST_RESULT_STR_Z(
+            httpHeaderToLog(httpHeaderPutRange(httpHeaderNew(NULL), 5, NULL)), "{range: 'bytes=5-'}", "range offset");
+        TEST_RESULT_STR_Z(
+            httpHeaderToLog(httpHeaderPutRange(httpHeaderNew(NULL), 5, VARUINT64(1))), "{range: 'bytes=5-5'}",
+            "range offset and limit");
     }
 
     // *****************************************************************************************************************************
@@ -727,5 +748,237 @@ testRun(void)
         TEST_RESULT_BOOL(varLstEmpty(kvKeyList(statToKv())), false, "check");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("HttpRangeRead"))
+    {
+        // Reset the buffer size changed by prior tests
+        ioBufferSizeSet(8192);
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, true)
+            {
+                // Start HTTP test server
+                TEST_RESULT_VOID(
+                    hrnServerRunP(
+                        ioFdReadNew(STRDEF("test server read"), HARNESS_FORK_CHILD_READ(), 5000), hrnServerProtocolSocket),
+                    "http server run");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                IoWrite *http = hrnServerScriptBegin(
+                    ioFdWriteNew(STRDEF("test client write"), HARNESS_FORK_PARENT_WRITE_PROCESS(0), 2000));
+
+                HttpClient *client = httpClientNew(sckClientNew(hrnServerHost(), hrnServerPort(0), 5000), 5000);
+                HttpRangeRead *rangeRead = NULL;
+                Buffer *buffer = bufNew(8);
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error on missing content range");
+
+                hrnServerScriptAccept(http);
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=0-15\r\n\r\n");
+                hrnServerScriptReplyZ(http, "HTTP/1.1 206 Partial Content\r\ncontent-length:0\r\n\r\n");
+
+                TEST_ERROR(
+                    httpRangeReadNew(
+                        httpRequestResponse(testRangeRequest(client, 0, 16), false), STRDEF("/file"), 0, NULL, 16, 2,
+                        testRangeRequest, client),
+                    FormatError, "missing or invalid content-range for '/file'");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("read ranges with offset and limit");
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=4-19\r\n\r\n");
+                hrnServerScriptReplyZ(
+                    http,
+                    "HTTP/1.1 206 Partial Content\r\ncontent-range:bytes 4-19/40\r\ncontent-length:16\r\n\r\n456789abcdefghij");
+
+                hrnServerScriptAccept(http);
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=20-23\r\n\r\n");
+                hrnServerScriptReplyZ(
+                    http,
+                    "HTTP/1.1 206 Partial Content\r\ncontent-range:bytes 20-23/40\r\ncontent-length:4\r\n\r\nklmn");
+
+                TEST_ASSIGN(
+                    rangeRead,
+                    httpRangeReadNew(
+                        httpRequestResponse(testRangeRequest(client, 4, 16), false), STRDEF("/file"), 4, VARUINT64(20), 16, 2,
+                        testRangeRequest, client),
+                    "new range read");
+                TEST_RESULT_UINT(httpRangeRead(rangeRead, bufNew(24)), 20, "read");
+                TEST_RESULT_BOOL(httpRangeReadEof(rangeRead), true, "eof");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("read ranges and prefetch the ranges after the current range");
+
+                hrnServerScriptSwap(http);
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=0-15\r\n\r\n");
+                hrnServerScriptReplyZ(
+                    http,
+                    "HTTP/1.1 206 Partial Content\r\ncontent-range:bytes 0-15/40\r\ncontent-length:16\r\n\r\n0123456789abcdef");
+
+                hrnServerScriptSwap(http);
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=16-31\r\n\r\n");
+                hrnServerScriptReplyZ(
+                    http,
+                    "HTTP/1.1 206 Partial Content\r\ncontent-range:bytes 16-31/40\r\ncontent-length:16\r\n\r\nghijklmnopqrstuv");
+
+                hrnServerScriptSwap(http);
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=32-39\r\n\r\n");
+                hrnServerScriptReplyZ(
+                    http,
+                    "HTTP/1.1 206 Partial Content\r\ncontent-range:bytes 32-39/40\r\ncontent-length:8\r\n\r\nwxyzABCD");
+
+                TEST_ASSIGN(
+                    rangeRead,
+                    httpRangeReadNew(
+                        httpRequestResponse(testRangeRequest(client, 0, 16), false), STRDEF("/file"), 0, NULL, 16, 2,
+                        testRangeRequest, client),
+                    "new range read");
+                TEST_RESULT_UINT(lstSize(rangeRead->rangeList), 2, "second range requested");
+
+                // Prefetch in small chunks. This is set after the sessions have read a line so their line buffers are large enough.
+                ioBufferSizeSet(8);
+
+                TEST_RESULT_UINT(httpRangeRead(rangeRead, buffer), 8, "read");
+                TEST_RESULT_STR_Z(strNewBuf(buffer), "01234567", "check content");
+                TEST_RESULT_UINT(
+                    bufUsed(((HttpRangeReadRange *)lstGet(rangeRead->rangeList, 1))->content), 8, "second range chunk prefetched");
+
+                bufUsedZero(buffer);
+                TEST_RESULT_UINT(httpRangeRead(rangeRead, buffer), 8, "read");
+                TEST_RESULT_STR_Z(strNewBuf(buffer), "89abcdef", "check content");
+
+                bufUsedZero(buffer);
+                TEST_RESULT_UINT(httpRangeRead(rangeRead, buffer), 8, "read");
+                TEST_RESULT_STR_Z(strNewBuf(buffer), "ghijklmn", "check content");
+
+                bufUsedZero(buffer);
+                TEST_RESULT_UINT(httpRangeRead(rangeRead, buffer), 8, "read");
+                TEST_RESULT_STR_Z(strNewBuf(buffer), "opqrstuv", "check content");
+                TEST_RESULT_BOOL(httpRangeReadEof(rangeRead), false, "not eof");
+
+                bufUsedZero(buffer);
+                TEST_RESULT_UINT(httpRangeRead(rangeRead, buffer), 8, "read");
+                TEST_RESULT_STR_Z(strNewBuf(buffer), "wxyzABCD", "check content");
+                TEST_RESULT_BOOL(httpRangeReadEof(rangeRead), true, "eof");
+
+                TEST_RESULT_VOID(httpRangeReadFree(rangeRead), "free");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error on later range");
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=0-15\r\n\r\n");
+                hrnServerScriptReplyZ(
+                    http,
+                    "HTTP/1.1 206 Partial Content\r\ncontent-range:bytes 0-15/32\r\ncontent-length:16\r\n\r\n0123456789abcdef");
+
+                hrnServerScriptSwap(http);
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=16-31\r\n\r\n");
+                hrnServerScriptReplyZ(http, "HTTP/1.1 412 Precondition Failed\r\ncontent-length:0\r\n\r\n");
+
+                TEST_ASSIGN(
+                    rangeRead,
+                    httpRangeReadNew(
+                        httpRequestResponse(testRangeRequest(client, 0, 16), false), STRDEF("/file"), 0, NULL, 16, 2,
+                        testRangeRequest, client),
+                    "new range read");
+                TEST_RESULT_UINT(httpRangeRead(rangeRead, bufNew(16)), 16, "read first range");
+                TEST_ERROR(
+                    httpRangeRead(rangeRead, bufNew(16)), ProtocolError,
+                    "HTTP request failed with 412 (Precondition Failed):\n"
+                    "*** Path/Query ***:\n"
+                    "/file\n"
+                    "*** Request Headers ***:\n"
+                    "range: bytes=16-31\n"
+                    "*** Response Headers ***:\n"
+                    "content-length: 0");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error on range ignored");
+
+                hrnServerScriptSwap(http);
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=0-15\r\n\r\n");
+                hrnServerScriptReplyZ(
+                    http,
+                    "HTTP/1.1 206 Partial Content\r\ncontent-range:bytes 0-15/32\r\ncontent-length:16\r\n\r\n0123456789abcdef");
+
+                hrnServerScriptSwap(http);
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=16-31\r\n\r\n");
+                hrnServerScriptReplyZ(http, "HTTP/1.1 200 OK\r\ncontent-length:0\r\n\r\n");
+
+                TEST_ASSIGN(
+                    rangeRead,
+                    httpRangeReadNew(
+                        httpRequestResponse(testRangeRequest(client, 0, 16), false), STRDEF("/file"), 0, NULL, 16, 2,
+                        testRangeRequest, client),
+                    "new range read");
+                TEST_RESULT_UINT(httpRangeRead(rangeRead, bufNew(16)), 16, "read first range");
+                TEST_ERROR(
+                    httpRangeRead(rangeRead, bufNew(16)), FormatError, "expected range response for '/file' but got code 200");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("content smaller than the range size");
+
+                hrnServerScriptSwap(http);
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=0-15\r\n\r\n");
+                hrnServerScriptReplyZ(
+                    http, "HTTP/1.1 206 Partial Content\r\ncontent-range:bytes 0-9/10\r\ncontent-length:10\r\n\r\n0123456789");
+
+                TEST_ASSIGN(
+                    rangeRead,
+                    httpRangeReadNew(
+                        httpRequestResponse(testRangeRequest(client, 0, 16), false), STRDEF("/file"), 0, NULL, 16, 2,
+                        testRangeRequest, client),
+                    "new range read");
+                TEST_RESULT_UINT(lstSize(rangeRead->rangeList), 1, "no more ranges requested");
+
+                buffer = bufNew(16);
+
+                TEST_RESULT_UINT(httpRangeRead(rangeRead, buffer), 10, "read");
+                TEST_RESULT_STR_Z(strNewBuf(buffer), "0123456789", "check content");
+                TEST_RESULT_BOOL(httpRangeReadEof(rangeRead), true, "eof");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error on content shorter than the range");
+
+                hrnServerScriptSwap(http);
+
+                hrnServerScriptExpectZ(http, "GET /file HTTP/1.1\r\n" TEST_USER_AGENT "range:bytes=0-15\r\n\r\n");
+                hrnServerScriptReplyZ(
+                    http, "HTTP/1.1 206 Partial Content\r\ncontent-range:bytes 0-15/16\r\ncontent-length:10\r\n\r\n0123456789");
+
+                TEST_ASSIGN(
+                    rangeRead,
+                    httpRangeReadNew(
+                        httpRequestResponse(testRangeRequest(client, 0, 16), false), STRDEF("/file"), 0, NULL, 16, 2,
+                        testRangeRequest, client),
+                    "new range read");
+                TEST_ERROR(
+                    httpRangeRead(rangeRead, bufNew(16)), FormatError, "expected 16 bytes in range of '/file' but got 10");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("close connection and end server process");
+
+                hrnServerScriptClose(http);
+                hrnServerScriptEnd(http);
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
+    }
+
     FUNCTION_HARNESS_RETURN_VOID();
 }
@@ -312,6 +312,7 @@ testRun(void)
         TEST_RESULT_VOID(ioFilterGroupClear(ioReadFilterGroup(bufferRead)), "    clear size filter");
 
         IoFilter *sizeFilter = ioSizeNew();
+        TEST_RESULT_BOOL(ioFilterGroupOutput(ioReadFilterGroup(bufferRead)), false, "    no output filters");
         TEST_RESULT_VOID(
             ioFilterGroupAdd(ioReadFilterGroup(bufferRead), ioTestFilterMultiplyNew("double", 2, 3, 'X')),
             "    add filter to filter group");
@@ -319,6 +320,7 @@ testRun(void)
             ioFilterGroupInsert(ioReadFilterGroup(bufferRead), 0, sizeFilter), bufferRead->pub.filterGroup,
             "    add filter to filter group");
         TEST_RESULT_VOID(ioFilterGroupAdd(ioReadFilterGroup(bufferRead), ioSizeNew()), "    add filter to filter group");
+        TEST_RESULT_BOOL(ioFilterGroupOutput(ioReadFilterGroup(bufferRead)), true, "    output filter");
         IoFilter *bufferFilter = ioBufferNew();
         TEST_RESULT_VOID(ioFilterGroupAdd(ioReadFilterGroup(bufferRead), bufferFilter), "    add filter to filter group");
         TEST_RESULT_PTR(ioFilterMove(NULL, memContextTop()), NULL, "    move NULL filter to top context");
@@ -402,6 +404,8 @@ testRun(void)
         ioReadOpen(read);
         buffer = bufNew(6);
 
+        TEST_RESULT_BOOL(ioReadBuffered(read), false, "nothing buffered");
+
         // Start with a small read
         TEST_RESULT_UINT(ioReadSmall(read, buffer), 6, "read buffer");
         TEST_RESULT_STR_Z(strNewBuf(buffer), "AAAAAA", "    check buffer");
@@ -410,6 +414,7 @@ testRun(void)
 
         // Do line reads of various lengths
         TEST_RESULT_STR_Z(ioReadLine(read), "123", "read line");
+        TEST_RESULT_BOOL(ioReadBuffered(read), true, "data buffered");
         TEST_RESULT_STR_Z(ioReadLine(read), "1234", "read line");
         TEST_RESULT_STR_Z(ioReadLine(read), "", "read line");
         TEST_RESULT_STR_Z(ioReadLine(read), "12", "read line");
@@ -441,6 +446,17 @@ testRun(void)
         TEST_ERROR(ioReadLine(read), FileReadError, "unexpected eof while reading line");
         TEST_RESULT_UINT(ioRead(read, buffer), 0, "read buffer");
 
+        // Small read returns at eof rather than waiting for the buffer to fill
+        bufUsedZero(buffer);
+        TEST_RESULT_UINT(ioReadSmall(read, buffer), 0, "small read at eof");
+
+        read = ioBufferReadNew(BUFSTRDEF("AB"));
+        ioReadOpen(read);
+        buffer = bufNew(4);
+
+        TEST_RESULT_UINT(ioReadSmall(read, buffer), 2, "small read stops at eof");
+        TEST_RESULT_STR_Z(strNewBuf(buffer), "AB", "    check buffer");
+
         // Error if buffer is full and there is no linefeed
         ioBufferSizeSet(10);
         read = ioBufferReadNew(BUFSTRDEF("0123456789"));
@@ -3,6 +3,7 @@ Test Pack Type
 ***********************************************************************************************************************************/
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
+#include "common/type/json.h"
 
 #include "common/harnessPack.h"
 
@@ -310,6 +311,87 @@ testRun(void)
 
         TEST_ASSIGN(packRead, pckReadNewBuf(pack), "new read");
         TEST_RESULT_STR_Z(pckReadStrP(packRead), "test", "read string");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("pack/unpack variant");
+
+        ioBufferSizeSet(65536);
+
+        VariantList *varList = varLstNew();
+        varLstAdd(varList, varNewBool(true));
+        varLstAdd(varList, varNewInt(-1));
+        varLstAdd(varList, varNewInt64(77));
+        varLstAdd(varList, varNewUInt(3));
+        varLstAdd(varList, varNewUInt64(UINT64_MAX));
+        varLstAdd(varList, varNewStrZ("sample"));
+        varLstAdd(varList, varNewStr(NULL));
+        varLstAdd(varList, varNewVarLst(NULL));
+
+        KeyValue *kv = kvNew();
+        kvPut(kv, VARSTRDEF("key1"), VARSTRDEF("value1"));
+        kvPut(kv, VARSTRDEF("key2"), NULL);
+        kvPut(kv, VARSTRDEF("key3"), VARUINT64(5));
+        varLstAdd(varList, varNewKv(kv));
+        varLstAdd(varList, NULL);
+
+        pack = bufNew(0);
+
+        TEST_ASSIGN(packWrite, pckWriteNewBuf(pack), "new write");
+        TEST_RESULT_VOID(pckWriteVarP(packWrite, NULL), "write null");
+        TEST_RESULT_VOID(pckWriteVarP(packWrite, varNewKv(NULL)), "write null kv");
+        TEST_RESULT_VOID(pckWriteVarP(packWrite, varNewVarLst(varList)), "write list");
+        TEST_RESULT_VOID(pckWriteVarP(packWrite, NULL, .id = 5), "write null with id");
+        TEST_RESULT_VOID(pckWriteVarP(packWrite, VARSTRDEF("last"), .id = 6), "write string with id");
+        TEST_RESULT_VOID(pckWriteBinP(packWrite, BUFSTRDEF("bin")), "write bin");
+        TEST_RESULT_VOID(pckWriteEndP(packWrite), "write end");
+
+        TEST_ASSIGN(packRead, pckReadNewBuf(pack), "new read");
+        TEST_RESULT_PTR(pckReadVarP(packRead), NULL, "read null");
+        TEST_RESULT_PTR(pckReadVarP(packRead), NULL, "read null kv");
+        TEST_RESULT_STR_Z(
+            jsonFromVar(pckReadVarP(packRead)),
+            "[true,-1,77,3,18446744073709551615,\"sample\",null,null,{\"key1\":\"value1\",\"key2\":null,\"key3\":5},null]",
+            "read list");
+        TEST_RESULT_PTR(pckReadVarP(packRead, .id = 5), NULL, "read null with id");
+        TEST_RESULT_STR_Z(varStr(pckReadVarP(packRead, .id = 6)), "last", "read string with id");
+        TEST_ERROR(pckReadVarP(packRead), FormatError, "field 7 type 'bin' cannot be read as a variant");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("reset to read consecutive packs");
+
+        pack = bufNew(0);
+        write = ioBufferWriteNew(pack);
+        ioWriteOpen(write);
+
+        packWrite = pckWriteNew(write);
+        pckWriteStrP(packWrite, STRDEF("first"));
+        pckWriteU32P(packWrite, 1);
+        pckWriteEndP(packWrite);
+
+        packWrite = pckWriteNew(write);
+        pckWriteStrP(packWrite, STRDEF("second"), .id = 2);
+        pckWriteEndP(packWrite);
+
+        packWrite = pckWriteNew(write);
+        pckWriteU32P(packWrite, 3);
+        pckWriteEndP(packWrite);
+        ioWriteClose(write);
+
+        read = ioBufferReadNew(pack);
+        ioReadOpen(read);
+
+        TEST_ASSIGN(packRead, pckReadNew(read), "new read");
+        TEST_RESULT_STR_Z(pckReadStrP(packRead), "first", "read string");
+        TEST_RESULT_UINT(pckReadU32P(packRead), 1, "read u32");
+        TEST_RESULT_VOID(pckReadEndP(packRead), "read end");
+
+        TEST_RESULT_VOID(pckReadReset(packRead), "reset");
+        TEST_RESULT_STR_Z(pckReadStrP(packRead, .id = 2), "second", "read string");
+        TEST_RESULT_VOID(pckReadEndP(packRead), "read end");
+
+        TEST_RESULT_VOID(pckReadReset(packRead), "reset");
+        TEST_RESULT_UINT(pckReadU32P(packRead), 3, "read u32");
+        TEST_RESULT_VOID(pckReadEndP(packRead), "read end");
     }
 
     FUNCTION_HARNESS_RETURN_VOID();
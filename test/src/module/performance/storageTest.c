@@ -384,5 +384,69 @@ testRun(void)
 #endif // HAVE_LIBLZ4
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("benchmark page cache advice"))
+    {
+        // 4MB buffers are the current default
+        ioBufferSizeSet(4 * 1024 * 1024);
+
+        // Size of the file in MiB
+        CHECK(testScale() <= 1024 * 1024);
+        uint64_t blockTotal = (uint64_t)64 * testScale();
+
+        // Build a 1MiB block to write repeatedly
+        Buffer *block = bufNew(1024 * 1024);
+        memset(bufPtr(block), 0xAA, bufSize(block));
+        bufUsedSet(block, bufSize(block));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE_FMT("%" PRIu64 "MiB file", blockTotal);
+
+        #define BENCHMARK_WRITE(name, writeFlushParam)                                                                             \
+        {                                                                                                                          \
+            const Storage *storage = storagePosixNewP(STR(testPath()), .write = true, .writeFlush = writeFlushParam);              \
+            StorageWrite *write = storageNewWriteP(storage, STRDEF(name), .noAtomic = true);                                       \
+                                                                                                                                   \
+            uint64_t benchMarkBegin = timeMSec();                                                                                  \
+            ioWriteOpen(storageWriteIo(write));                                                                                    \
+                                                                                                                                   \
+            for (uint64_t blockIdx = 0; blockIdx < blockTotal; blockIdx++)                                                         \
+                ioWrite(storageWriteIo(write), block);                                                                             \
+                                                                                                                                   \
+            ioWriteClose(storageWriteIo(write));                                                                                   \
+            TEST_LOG_FMT("write %s time %" PRIu64 "ms", name, timeMSec() - benchMarkBegin);                                        \
+        }
+
+        #define BENCHMARK_READ(name, file, readAdviseParam)                                                                        \
+        {                                                                                                                          \
+            const Storage *storage = storagePosixNewP(STR(testPath()), .readAdvise = readAdviseParam);                             \
+            IoRead *read = storageReadIo(storageNewReadP(storage, STRDEF(file)));                                                  \
+            Buffer *buffer = bufNew(ioBufferSize());                                                                               \
+                                                                                                                                   \
+            uint64_t benchMarkBegin = timeMSec();                                                                                  \
+            ioReadOpen(read);                                                                                                      \
+                                                                                                                                   \
+            do                                                                                                                     \
+            {                                                                                                                      \
+                ioRead(read, buffer);                                                                                              \
+                bufUsedZero(buffer);                                                                                               \
+            }                                                                                                                      \
+            while (!ioReadEof(read));                                                                                              \
+                                                                                                                                   \
+            ioReadClose(read);                                                                                                     \
+            TEST_LOG_FMT("read %s time %" PRIu64 "ms", name, timeMSec() - benchMarkBegin);                                         \
+        }
+
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            BENCHMARK_WRITE("default", 0);
+            BENCHMARK_WRITE("write-flush", 8 * 1024 * 1024);
+
+            BENCHMARK_READ("default", "default", false);
+            BENCHMARK_READ("read-advise", "write-flush", true);
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
     FUNCTION_HARNESS_RETURN_VOID();
 }
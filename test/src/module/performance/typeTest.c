@@ -8,14 +8,17 @@ These starting values can then be scaled up for profiling and stress testing as
 running out of memory on the test systems or taking an undue amount of time.  It should be noted that in this context scaling to
 1000 is nowhere near turning it up to 11.
 ***********************************************************************************************************************************/
+#include "common/crypto/hash.h"
 #include "common/ini.h"
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
+#include "common/io/io.h"
 #include "common/stat.h"
 #include "common/time.h"
 #include "common/type/list.h"
 #include "common/type/object.h"
 #include "info/manifest.h"
+#include "postgres/interface.h"
 #include "postgres/version.h"
 
 #include "common/harnessInfo.h"
@@ -360,5 +363,89 @@ testRun(void)
         }
     }
 
+    // Compare throughput of the hash types
+    // *****************************************************************************************************************************
+    if (testBegin("cryptoHash()"))
+    {
+        CHECK(testScale() <= 1000);
+
+        // Generate a buffer of data to hash
+        Buffer *buffer = bufNew(ioBufferSize());
+
+        for (size_t bufferIdx = 0; bufferIdx < bufSize(buffer); bufferIdx++)
+            bufPtr(buffer)[bufferIdx] = (unsigned char)(bufferIdx * 31 + bufferIdx / 7);
+
+        bufUsedSet(buffer, bufSize(buffer));
+
+        const uint64_t runTotal = (uint64_t)testScale() * 256 * 1024 * 1024 / bufUsed(buffer);
+        const uint64_t sizeTotal = runTotal * bufUsed(buffer);
+
+        const String *const hashTypeList[] =
+        {
+            HASH_TYPE_CRC32C_STR,
+            HASH_TYPE_MD5_STR,
+            HASH_TYPE_SHA1_STR,
+            HASH_TYPE_SHA256_STR,
+        };
+
+        for (unsigned int hashTypeIdx = 0; hashTypeIdx < sizeof(hashTypeList) / sizeof(String *); hashTypeIdx++)
+        {
+            // ---------------------------------------------------------------------------------------------------------------------
+            TEST_TITLE_FMT("hash %s with %s", strZ(strSizeFormat(sizeTotal)), strZ(hashTypeList[hashTypeIdx]));
+
+            IoFilter *hash = cryptoHashNew(hashTypeList[hashTypeIdx]);
+
+            TimeMSec timeBegin = timeMSec();
+
+            for (uint64_t runIdx = 0; runIdx < runTotal; runIdx++)
+                ioFilterProcessIn(hash, buffer);
+
+            const String *result = varStr(ioFilterResult(hash));
+            TimeMSec timeTotal = timeMSec() - timeBegin;
+
+            TEST_LOG_FMT(
+                "%s completed in %ums (%.2fGB/s)", strZ(result), (unsigned int)timeTotal,
+                (double)sizeTotal / (double)(timeTotal == 0 ? 1 : timeTotal) * 1000 / (1024 * 1024 * 1024));
+
+            ioFilterFree(hash);
+        }
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("pgPageChecksum()"))
+    {
+        CHECK(testScale() <= 1000);
+
+        // Generate a buffer of pages to checksum
+        const unsigned int pageTotal = 1024;
+        Buffer *buffer = bufNew(PG_PAGE_SIZE_DEFAULT * pageTotal);
+
+        for (size_t bufferIdx = 0; bufferIdx < bufSize(buffer); bufferIdx++)
+            bufPtr(buffer)[bufferIdx] = (unsigned char)(bufferIdx * 31 + bufferIdx / 7);
+
+        bufUsedSet(buffer, bufSize(buffer));
+
+        const uint64_t runTotal = (uint64_t)testScale() * 1024 * 1024 * 1024 / bufUsed(buffer);
+        const uint64_t sizeTotal = runTotal * bufUsed(buffer);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE_FMT("checksum %s of pages", strZ(strSizeFormat(sizeTotal)));
+
+        uint16_t result = 0;
+        TimeMSec timeBegin = timeMSec();
+
+        for (uint64_t runIdx = 0; runIdx < runTotal; runIdx++)
+        {
+            for (unsigned int pageIdx = 0; pageIdx < pageTotal; pageIdx++)
+                result = (uint16_t)(result + pgPageChecksum(bufPtr(buffer) + pageIdx * PG_PAGE_SIZE_DEFAULT, pageIdx));
+        }
+
+        TimeMSec timeTotal = timeMSec() - timeBegin;
+
+        TEST_LOG_FMT(
+            "%04X completed in %ums (%.2fGB/s)", result, (unsigned int)timeTotal,
+            (double)sizeTotal / (double)(timeTotal == 0 ? 1 : timeTotal) * 1000 / (1024 * 1024 * 1024));
+    }
+
     FUNCTION_HARNESS_RETURN_VOID();
 }
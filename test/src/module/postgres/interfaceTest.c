@@ -181,6 +181,23 @@ testRun(void)
 
         TEST_RESULT_UINT(pgPageChecksum(page, 0), TEST_BIG_ENDIAN() ? 0xF55E : 0x0E1C, "check 0xFF filled page, block 0");
         TEST_RESULT_UINT(pgPageChecksum(page, 999), TEST_BIG_ENDIAN() ? 0xF1B9 : 0x0EC3, "check 0xFF filled page, block 999");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("portable implementation matches cpu implementation");
+
+        for (unsigned int pageIdx = 0; pageIdx < 64; pageIdx++)
+        {
+            for (unsigned int byteIdx = 0; byteIdx < PG_PAGE_SIZE_DEFAULT; byteIdx++)
+                page[byteIdx] = (unsigned char)(byteIdx * (pageIdx + 1) + byteIdx / (pageIdx + 7));
+
+            const uint16_t checksumSave = ((PageHeaderData *)page)->pd_checksum;
+
+            if (pgPageChecksumPortable(page, pageIdx * 131) != pgPageChecksum(page, pageIdx * 131))
+                THROW_FMT(AssertError, "checksum mismatch on page %u", pageIdx);
+
+            if (((PageHeaderData *)page)->pd_checksum != checksumSave)
+                THROW_FMT(AssertError, "checksum not restored on page %u", pageIdx);
+        }
     }
 
     // *****************************************************************************************************************************
@@ -6,12 +6,61 @@ Test Protocol
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
 #include "common/regExp.h"
+#include "common/type/pack.h"
 #include "storage/storage.h"
 #include "storage/posix/storage.h"
 #include "version.h"
 
 #include "common/harnessConfig.h"
 #include "common/harnessFork.h"
+#include "common/harnessPack.h"
+
+/***********************************************************************************************************************************
+Helpers to script the pack format
+***********************************************************************************************************************************/
+// Read a pack message and return it as a string
+static String *
+testPackRead(IoRead *read)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(IO_READ, read);
+    FUNCTION_HARNESS_END();
+
+    Buffer *prefix = bufNew(1);
+    ioRead(read, prefix);
+
+    if (*bufPtr(prefix) != PROTOCOL_MESSAGE_PACK)
+        THROW_FMT(AssertError, "expected pack prefix but got '%c'", *bufPtr(prefix));
+
+    FUNCTION_HARNESS_RETURN(STRING, hrnPackToStr(pckReadNew(read)));
+}
+
+// Begin a pack message. Fields are written to the returned pack and the message is completed with testPackWriteEnd().
+static PackWrite *
+testPackWriteBegin(IoWrite *write)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(IO_WRITE, write);
+    FUNCTION_HARNESS_END();
+
+    ioWrite(write, PROTOCOL_MESSAGE_PACK_BUF);
+
+    FUNCTION_HARNESS_RETURN(PACK_WRITE, pckWriteNew(write));
+}
+
+static void
+testPackWriteEnd(IoWrite *write, PackWrite *pack)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(IO_WRITE, write);
+        FUNCTION_HARNESS_PARAM(PACK_WRITE, pack);
+    FUNCTION_HARNESS_END();
+
+    pckWriteEndP(pack);
+    ioWriteFlush(write);
+
+    FUNCTION_HARNESS_RETURN_VOID();
+}
 
 /***********************************************************************************************************************************
 Test protocol request handler
@@ -445,11 +494,15 @@ testRun(void)
 
         TEST_RESULT_STR_Z(protocolCommandToLog(command), "{command: command1}", "check log");
         TEST_RESULT_STR_Z(protocolCommandJson(command), "{\"cmd\":\"command1\",\"param\":[\"param1\",\"param2\"]}", "check json");
+        TEST_RESULT_STR_Z(
+            hrnPackBufToStr(protocolCommandPack(command)), "1:str:command1, 2:array:[1:u32:2, 2:str:param1, 3:str:param2]",
+            "check pack");
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ASSIGN(command, protocolCommandNew(strNew("command2")), "create command");
         TEST_RESULT_STR_Z(protocolCommandToLog(command), "{command: command2}", "check log");
         TEST_RESULT_STR_Z(protocolCommandJson(command), "{\"cmd\":\"command2\"}", "check json");
+        TEST_RESULT_STR_Z(hrnPackBufToStr(protocolCommandPack(command)), "1:str:command2", "check pack");
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_VOID(protocolCommandFree(command), "free command");
@@ -636,6 +689,175 @@ testRun(void)
             HARNESS_FORK_PARENT_END();
         }
         HARNESS_FORK_END();
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("client using pack format");
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, true)
+            {
+                IoRead *read = ioFdReadNew(strNew("server read"), HARNESS_FORK_CHILD_READ(), 2000);
+                ioReadOpen(read);
+                IoWrite *write = ioFdWriteNew(strNew("server write"), HARNESS_FORK_CHILD_WRITE(), 2000);
+                ioWriteOpen(write);
+
+                // Greeting with pack format
+                ioWriteStrLine(
+                    write,
+                    strNew(
+                        "{\"format\":\"pack\",\"name\":\"pgBackRest\",\"service\":\"test\",\"version\":\"" PROJECT_VERSION
+                            "\"}"));
+                ioWriteFlush(write);
+
+                TEST_RESULT_STR_Z(testPackRead(read), "1:str:noop", "noop");
+                testPackWriteEnd(write, testPackWriteBegin(write));
+
+                // Throw errors
+                TEST_RESULT_STR_Z(testPackRead(read), "1:str:noop", "noop with error text");
+                PackWrite *pack = testPackWriteBegin(write);
+                pckWriteI32P(pack, 25, .id = 2);
+                pckWriteStrP(pack, STRDEF("sample error message"));
+                pckWriteStrP(pack, STRDEF("stack data"));
+                testPackWriteEnd(write, pack);
+
+                TEST_RESULT_STR_Z(testPackRead(read), "1:str:noop", "noop with no error text");
+                testPackWriteEnd(write, pckWriteI32P(testPackWriteBegin(write), 255, .id = 2));
+
+                // No output expected
+                TEST_RESULT_STR_Z(testPackRead(read), "1:str:noop", "noop with output returned");
+                testPackWriteEnd(write, pckWriteBoolP(testPackWriteBegin(write), true));
+
+                // Not a pack response
+                TEST_RESULT_STR_Z(testPackRead(read), "1:str:noop", "noop with json returned");
+                ioWriteStrLine(write, strNew("{}"));
+                ioWriteFlush(write);
+
+                // Send output
+                TEST_RESULT_STR_Z(testPackRead(read), "1:str:test, 2:array:[1:u32:1, 2:bool:true]", "test command");
+                ioWriteStrLine(write, strNew(".OUTPUT"));
+                pack = testPackWriteBegin(write);
+                pckWriteArrayBeginP(pack);
+                pckWriteU32P(pack, 2);
+                pckWriteStrP(pack, STRDEF("value1"));
+                pckWriteStrP(pack, STRDEF("value2"));
+                pckWriteArrayEndP(pack);
+                testPackWriteEnd(write, pack);
+
+                // Invalid line
+                TEST_RESULT_STR_Z(testPackRead(read), "1:str:invalid-line", "invalid line command");
+                ioWrite(write, LF_BUF);
+                ioWriteFlush(write);
+
+                // Error instead of output
+                TEST_RESULT_STR_Z(testPackRead(read), "1:str:error-instead-of-output", "error instead of output command");
+                testPackWriteEnd(write, pckWriteI32P(testPackWriteBegin(write), 255, .id = 2));
+
+                // Unexpected output
+                TEST_RESULT_STR_Z(testPackRead(read), "1:str:unexpected-output", "unexpected output");
+                testPackWriteEnd(write, testPackWriteBegin(write));
+
+                // Invalid prefix
+                TEST_RESULT_STR_Z(testPackRead(read), "1:str:invalid-prefix", "invalid prefix");
+                ioWriteStrLine(write, strNew("~line"));
+                ioWriteFlush(write);
+
+                // Wait for exit
+                TEST_RESULT_STR_Z(testPackRead(read), "1:str:exit", "exit command");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                IoRead *read = ioFdReadNew(strNew("client read"), HARNESS_FORK_PARENT_READ_PROCESS(0), 2000);
+                ioReadOpen(read);
+                IoWrite *write = ioFdWriteNew(strNew("client write"), HARNESS_FORK_PARENT_WRITE_PROCESS(0), 2000);
+                ioWriteOpen(write);
+
+                ProtocolClient *client = NULL;
+                TEST_ASSIGN(client, protocolClientNew(strNew("test client"), strNew("test"), read, write), "create client");
+                TEST_RESULT_BOOL(client->pack, true, "pack format");
+
+                // Throw errors
+                TEST_ERROR(
+                    protocolClientNoOp(client), AssertError,
+                    "raised from test client: sample error message\nstack data");
+
+                harnessLogLevelSet(logLevelDebug);
+                TEST_ERROR(
+                    protocolClientNoOp(client), UnknownError,
+                    "raised from test client: no details available\nno stack trace available");
+                harnessLogLevelReset();
+
+                // No output expected
+                TEST_ERROR(protocolClientNoOp(client), AssertError, "no output required by command");
+
+                // Not a pack response
+                TEST_ERROR(protocolClientNoOp(client), FormatError, "expected pack response");
+                TEST_RESULT_STR_Z(ioReadLine(read), "}", "skip remainder of json response");
+
+                // Get command output
+                const VariantList *output = NULL;
+
+                ProtocolCommand *command = protocolCommandNew(strNew("test"));
+                protocolCommandParamAdd(command, VARBOOL(true));
+
+                TEST_RESULT_VOID(protocolClientWriteCommand(client, command), "execute command with output");
+                TEST_RESULT_STR_Z(protocolClientReadLine(client), "OUTPUT", "check output");
+                TEST_ASSIGN(output, varVarLst(protocolClientReadOutput(client, true)), "execute command with output");
+                TEST_RESULT_UINT(varLstSize(output), 2, "check output size");
+                TEST_RESULT_STR_Z(varStr(varLstGet(output, 0)), "value1", "check value1");
+                TEST_RESULT_STR_Z(varStr(varLstGet(output, 1)), "value2", "check value2");
+
+                // Invalid line
+                TEST_RESULT_VOID(
+                    protocolClientWriteCommand(client, protocolCommandNew(strNew("invalid-line"))),
+                    "execute command that returns invalid line");
+                TEST_ERROR(protocolClientReadLine(client), FormatError, "unexpected empty line");
+
+                // Error instead of output
+                TEST_RESULT_VOID(
+                    protocolClientWriteCommand(client, protocolCommandNew(strNew("error-instead-of-output"))),
+                    "execute command that returns error instead of output");
+                TEST_ERROR(protocolClientReadLine(client), UnknownError, "raised from test client: no details available");
+
+                // Unexpected output
+                TEST_RESULT_VOID(
+                    protocolClientWriteCommand(client, protocolCommandNew(strNew("unexpected-output"))),
+                    "execute command that returns unexpected output");
+                TEST_ERROR(protocolClientReadLine(client), FormatError, "expected error but got output");
+
+                // Invalid prefix
+                TEST_RESULT_VOID(
+                    protocolClientWriteCommand(client, protocolCommandNew(strNew("invalid-prefix"))),
+                    "execute command that returns an invalid prefix");
+                TEST_ERROR(protocolClientReadLine(client), FormatError, "invalid prefix in '~line'");
+
+                // Free client
+                TEST_RESULT_VOID(protocolClientFree(client), "free client");
+
+                // EOF
+                Buffer *response = bufNew(0);
+                bufCat(
+                    response,
+                    BUFSTRDEF(
+                        "{\"format\":\"pack\",\"name\":\"pgBackRest\",\"service\":\"test\",\"version\":\"" PROJECT_VERSION
+                            "\"}\n"));
+                bufCat(response, PROTOCOL_MESSAGE_PACK_BUF);
+                bufCat(response, BUFSTRDEF("\000"));
+
+                read = ioBufferReadNew(response);
+                ioReadOpen(read);
+                write = ioBufferWriteNew(bufNew(0));
+                ioWriteOpen(write);
+
+                TEST_ASSIGN(client, protocolClientNew(strNew("test client"), strNew("test"), read, write), "create client");
+                TEST_ERROR(protocolClientNoOp(client), FileReadError, "unexpected eof while reading response");
+                TEST_RESULT_VOID(protocolClientFree(client), "free client");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
     }
 
     // *****************************************************************************************************************************
@@ -652,7 +874,8 @@ testRun(void)
 
                 // Check greeting
                 TEST_RESULT_STR_Z(
-                    ioReadLine(read), "{\"name\":\"pgBackRest\",\"service\":\"test\",\"version\":\"" PROJECT_VERSION "\"}",
+                    ioReadLine(read),
+                    "{\"format\":\"pack\",\"name\":\"pgBackRest\",\"service\":\"test\",\"version\":\"" PROJECT_VERSION "\"}",
                     "check greeting");
 
                 // Noop
@@ -690,6 +913,31 @@ testRun(void)
                 TEST_RESULT_STR_Z(ioReadLine(read), ".LINEOFTEXT", "complex request result");
                 TEST_RESULT_STR_Z(ioReadLine(read), ".", "complex request result");
 
+                // Pack commands
+                testPackWriteEnd(write, pckWriteStrP(testPackWriteBegin(write), STRDEF("noop")));
+                TEST_RESULT_STR_Z(testPackRead(read), "", "pack noop result");
+
+                testPackWriteEnd(write, pckWriteStrP(testPackWriteBegin(write), STRDEF("bogus")));
+
+                Buffer *prefix = bufNew(1);
+                TEST_RESULT_UINT(ioRead(read, prefix), 1, "read pack prefix");
+                TEST_RESULT_UINT(*bufPtr(prefix), PROTOCOL_MESSAGE_PACK, "check pack prefix");
+
+                PackRead *pack = pckReadNew(read);
+                TEST_RESULT_PTR(pckReadVarP(pack), NULL, "    check no output");
+                TEST_RESULT_INT(pckReadI32P(pack), 39, "    check code");
+                TEST_RESULT_STR_Z(pckReadStrP(pack), "invalid command 'bogus'", "    check message");
+                TEST_RESULT_BOOL(pckReadStrP(pack) != NULL, true, "    check stack exists");
+                TEST_RESULT_VOID(pckReadEndP(pack), "    check end");
+
+                testPackWriteEnd(write, pckWriteStrP(testPackWriteBegin(write), STRDEF("request-simple")));
+                TEST_RESULT_STR_Z(testPackRead(read), "1:bool:true", "pack simple request result");
+
+                testPackWriteEnd(write, pckWriteStrP(testPackWriteBegin(write), STRDEF("request-complex")));
+                TEST_RESULT_STR_Z(testPackRead(read), "1:bool:false", "pack complex request result");
+                TEST_RESULT_STR_Z(ioReadLine(read), ".LINEOFTEXT", "pack complex request result");
+                TEST_RESULT_STR_Z(ioReadLine(read), ".", "pack complex request result");
+
                 // Exit
                 TEST_RESULT_VOID(ioWriteStrLine(write, strNew("{\"cmd\":\"exit\"}")), "write exit");
                 TEST_RESULT_VOID(ioWriteFlush(write), "flush exit");
@@ -762,6 +1010,19 @@ testRun(void)
             HARNESS_FORK_PARENT_END();
         }
         HARNESS_FORK_END();
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("empty command and eof");
+
+        IoRead *read = ioBufferReadNew(BUFSTRDEF("\n"));
+        ioReadOpen(read);
+        IoWrite *write = ioBufferWriteNew(bufNew(0));
+        ioWriteOpen(write);
+
+        ProtocolServer *server = protocolServerNew(strNew("test server"), strNew("test"), read, write);
+
+        TEST_ERROR(protocolServerCommandGet(server), JsonFormatError, "expected '{' at ''");
+        TEST_ERROR(protocolServerCommandGet(server), FileReadError, "unexpected eof while reading command");
     }
 
     // *****************************************************************************************************************************
@@ -853,7 +1114,7 @@ testRun(void)
                 // -----------------------------------------------------------------------------------------------------------------
                 TestParallelJobCallback data = {.jobList = lstNewP(sizeof(ProtocolParallelJob *))};
                 ProtocolParallel *parallel = NULL;
-                TEST_ASSIGN(parallel, protocolParallelNew(2000, testParallelJobCallback, &data), "create parallel");
+                TEST_ASSIGN(parallel, protocolParallelNew(2000, 1, testParallelJobCallback, &data), "create parallel");
                 TEST_RESULT_STR_Z(protocolParallelToLog(parallel), "{state: pending, clientTotal: 0, jobTotal: 0}", "check log");
 
                 // Add client
@@ -959,7 +1220,7 @@ testRun(void)
                 TEST_TITLE("process zero jobs");
 
                 data = (TestParallelJobCallback){.jobList = lstNewP(sizeof(ProtocolParallelJob *))};
-                TEST_ASSIGN(parallel, protocolParallelNew(2000, testParallelJobCallback, &data), "create parallel");
+                TEST_ASSIGN(parallel, protocolParallelNew(2000, 1, testParallelJobCallback, &data), "create parallel");
                 TEST_RESULT_VOID(protocolParallelClientAdd(parallel, client[0]), "add client");
 
                 TEST_RESULT_INT(protocolParallelProcess(parallel), 0, "process zero jobs");
@@ -976,6 +1237,114 @@ testRun(void)
             HARNESS_FORK_PARENT_END();
         }
         HARNESS_FORK_END();
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, true)
+            {
+                IoRead *read = ioFdReadNew(strNew("server read"), HARNESS_FORK_CHILD_READ(), 10000);
+                ioReadOpen(read);
+                IoWrite *write = ioFdWriteNew(strNew("server write"), HARNESS_FORK_CHILD_WRITE(), 2000);
+                ioWriteOpen(write);
+
+                // Greeting with noop
+                ioWriteStrLine(write, strNew("{\"name\":\"pgBackRest\",\"service\":\"test\",\"version\":\"" PROJECT_VERSION "\"}"));
+                ioWriteFlush(write);
+
+                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"noop\"}", "noop");
+                ioWriteStrLine(write, strNew("{}"));
+                ioWriteFlush(write);
+
+                // Both commands are sent before any results are returned
+                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"command1\"}", "command1");
+                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"command2\"}", "command2");
+
+                ioWriteStrLine(write, strNew("{\"out\":1}\n{\"out\":2}"));
+                ioWriteFlush(write);
+
+                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"command3\"}", "command3");
+                ioWriteStrLine(write, strNew("{\"out\":3}"));
+                ioWriteFlush(write);
+
+                // The client is kept for more jobs after the executor is done
+                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"noop\"}", "noop");
+                ioWriteStrLine(write, strNew("{}"));
+                ioWriteFlush(write);
+
+                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"command4\"}", "command4");
+                ioWriteStrLine(write, strNew("{\"out\":4}"));
+                ioWriteFlush(write);
+
+                // Wait for exit
+                TEST_RESULT_STR_Z(ioReadLine(read), "{\"cmd\":\"exit\"}", "exit command");
+            }
+            HARNESS_FORK_CHILD_END();
+
+            HARNESS_FORK_PARENT_BEGIN()
+            {
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("queue multiple jobs on a client");
+
+                IoRead *read = ioFdReadNew(strNew("client read"), HARNESS_FORK_PARENT_READ_PROCESS(0), 2000);
+                ioReadOpen(read);
+                IoWrite *write = ioFdWriteNew(strNew("client write"), HARNESS_FORK_PARENT_WRITE_PROCESS(0), 2000);
+                ioWriteOpen(write);
+
+                ProtocolClient *client = NULL;
+                TEST_ASSIGN(client, protocolClientNew(strNew("test client"), strNew("test"), read, write), "create client");
+
+                TestParallelJobCallback data = {.jobList = lstNewP(sizeof(ProtocolParallelJob *))};
+                ProtocolParallel *parallel = NULL;
+                TEST_ASSIGN(parallel, protocolParallelNew(2000, 2, testParallelJobCallback, &data), "create parallel");
+                TEST_RESULT_VOID(protocolParallelClientAdd(parallel, client), "add client");
+                TEST_RESULT_VOID(protocolParallelClientKeepSet(parallel, true), "keep client");
+
+                for (unsigned int jobIdx = 1; jobIdx <= 3; jobIdx++)
+                {
+                    job = protocolParallelJobNew(VARUINT(jobIdx), protocolCommandNew(strNewFmt("command%u", jobIdx)));
+                    lstAdd(data.jobList, &job);
+                }
+
+                TEST_RESULT_UINT(protocolParallelProcess(parallel), 0, "send two jobs");
+                TEST_RESULT_UINT(protocolParallelProcess(parallel), 2, "two results read");
+
+                TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                TEST_RESULT_UINT(varUInt(protocolParallelJobKey(job)), 1, "    check key is 1");
+                TEST_RESULT_INT(varIntForce(protocolParallelJobResult(job)), 1, "    check result is 1");
+
+                TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                TEST_RESULT_UINT(varUInt(protocolParallelJobKey(job)), 2, "    check key is 2");
+                TEST_RESULT_INT(varIntForce(protocolParallelJobResult(job)), 2, "    check result is 2");
+
+                TEST_RESULT_UINT(protocolParallelProcess(parallel), 1, "one result read");
+
+                TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                TEST_RESULT_UINT(varUInt(protocolParallelJobKey(job)), 3, "    check key is 3");
+                TEST_RESULT_BOOL(protocolParallelDone(parallel), true, "check done");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("process more jobs with a kept client");
+
+                TEST_RESULT_VOID(protocolParallelKeepAlive(parallel), "keep alive");
+
+                job = protocolParallelJobNew(VARUINT(4), protocolCommandNew(strNew("command4")));
+                lstAdd(data.jobList, &job);
+
+                TEST_RESULT_UINT(protocolParallelProcess(parallel), 0, "send job");
+                TEST_RESULT_BOOL(protocolParallelDone(parallel), false, "check not done");
+                TEST_RESULT_UINT(protocolParallelProcess(parallel), 1, "one result read");
+
+                TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                TEST_RESULT_UINT(varUInt(protocolParallelJobKey(job)), 4, "    check key is 4");
+                TEST_RESULT_BOOL(protocolParallelDone(parallel), true, "check done");
+
+                TEST_RESULT_VOID(protocolParallelFree(parallel), "free parallel");
+                TEST_RESULT_VOID(protocolClientFree(client), "free client");
+            }
+            HARNESS_FORK_PARENT_END();
+        }
+        HARNESS_FORK_END();
     }
 
     // *****************************************************************************************************************************
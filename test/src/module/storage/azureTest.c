@@ -31,6 +31,8 @@ typedef struct TestRequestParam
     VAR_PARAM_HEADER;
     const char *content;
     const char *blobType;
+    const char *ifMatch;
+    const char *range;
 } TestRequestParam;
 
 #define testRequestP(write, verb, path, ...)                                                                                       \
@@ -85,6 +87,14 @@ testRequest(IoWrite *write, const char *verb, const char *path, TestRequestParam
     // Add host
     strCatFmt(request, "host:%s\r\n", strZ(hrnServerHost()));
 
+    // Add if-match
+    if (param.ifMatch != NULL)
+        strCatFmt(request, "if-match:%s\r\n", param.ifMatch);
+
+    // Add range
+    if (param.range != NULL)
+        strCatFmt(request, "range:bytes=%s\r\n", param.range);
+
     // Add blob type
     if (param.blobType != NULL)
         strCatFmt(request, "x-ms-blob-type:%s\r\n", param.blobType);
@@ -195,6 +205,8 @@ testRun(void)
         TEST_RESULT_STR_Z(((StorageAzure *)storageDriver(storage))->host, TEST_ACCOUNT ".blob.core.windows.net", "    check host");
         TEST_RESULT_STR_Z(((StorageAzure *)storageDriver(storage))->pathPrefix, "/" TEST_CONTAINER, "    check path prefix");
         TEST_RESULT_UINT(((StorageAzure *)storageDriver(storage))->blockSize, STORAGE_AZURE_BLOCKSIZE_MIN, "    check block size");
+        TEST_RESULT_UINT(
+            ((StorageAzure *)storageDriver(storage))->downloadConcurrency, 1, "    check download concurrency");
         TEST_RESULT_BOOL(storageFeature(storage, storageFeaturePath), false, "    check path feature");
         TEST_RESULT_BOOL(storageFeature(storage, storageFeatureCompress), false, "    check compress feature");
     }
@@ -211,7 +223,7 @@ testRun(void)
             (StorageAzure *)storageDriver(
                 storageAzureNew(
                     STRDEF("/repo"), false, NULL, TEST_CONTAINER_STR, TEST_ACCOUNT_STR, storageAzureKeyTypeShared,
-                    TEST_KEY_SHARED_STR, 16, NULL, STRDEF("blob.core.windows.net"), 443, 1000, true, NULL, NULL)),
+                    TEST_KEY_SHARED_STR, 16, 1, NULL, STRDEF("blob.core.windows.net"), 443, 1000, true, NULL, NULL)),
             "new azure storage - shared key");
 
         // -------------------------------------------------------------------------------------------------------------------------
@@ -242,6 +254,21 @@ testRun(void)
                 ", host: 'account.blob.core.windows.net', x-ms-version: '2019-02-02'}",
             "check headers");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("auth with range and if-match");
+
+        header = httpHeaderAdd(httpHeaderNew(NULL), HTTP_HEADER_CONTENT_LENGTH_STR, ZERO_STR);
+        httpHeaderAdd(header, HTTP_HEADER_IF_MATCH_STR, STRDEF("\"ETAG\""));
+        httpHeaderPutRange(header, 16, VARUINT64(16));
+
+        TEST_RESULT_VOID(storageAzureAuth(storage, HTTP_VERB_GET_STR, STRDEF("/path/file"), NULL, dateTime, header), "auth");
+        TEST_RESULT_STR_Z(
+            httpHeaderToLog(header),
+            "{authorization: 'SharedKey account:sSy8xosH5+UyvN0ns6Ss/kRH5CoYAT+xUpj+fJ+aAI4=', content-length: '0'"
+                ", date: 'Sun, 21 Jun 2020 12:46:19 GMT', host: 'account.blob.core.windows.net', if-match: '\"ETAG\"'"
+                ", range: 'bytes=16-31', x-ms-version: '2019-02-02'}",
+            "check headers");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("SAS auth");
 
@@ -250,7 +277,7 @@ testRun(void)
             (StorageAzure *)storageDriver(
                 storageAzureNew(
                     STRDEF("/repo"), false, NULL, TEST_CONTAINER_STR, TEST_ACCOUNT_STR, storageAzureKeyTypeSas, TEST_KEY_SAS_STR,
-                    16, NULL, STRDEF("blob.core.usgovcloudapi.net"), 443, 1000, true, NULL, NULL)),
+                    16, 1, NULL, STRDEF("blob.core.usgovcloudapi.net"), 443, 1000, true, NULL, NULL)),
             "new azure storage - sas key");
 
         query = httpQueryAdd(httpQueryNewP(), STRDEF("a"), STRDEF("b"));
@@ -854,6 +881,62 @@ testRun(void)
 
                 TEST_RESULT_VOID(storagePathRemoveP(storage, strNew("/path"), .recurse = true), "remove");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file with concurrent ranges");
+
+                // The block size is also the range size. Ranges after the first range are conditional on its ETag.
+                driver->blockSize = 16;
+                driver->downloadConcurrency = 2;
+
+                testRequestP(service, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(
+                    service, .code = 206, .header = "content-range:bytes 0-15/20\r\netag:\"ETAG1\"", .content = "0123456789abcdef");
+
+                hrnServerScriptAccept(service);
+
+                testRequestP(service, HTTP_VERB_GET, "/file.txt", .ifMatch = "\"ETAG1\"", .range = "16-19");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 16-19/20", .content = "ghij");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(storage, STRDEF("file.txt")))), "0123456789abcdefghij", "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get zero-length file with concurrent ranges");
+
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, HTTP_VERB_GET, "/file0.txt", .range = "0-15");
+                testResponseP(service, .code = 416);
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(storage, STRDEF("file0.txt")))), "", "get zero-length file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error when file changes between ranges");
+
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(
+                    service, .code = 206, .header = "content-range:bytes 0-15/20\r\netag:\"ETAG1\"", .content = "0123456789abcdef");
+
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, HTTP_VERB_GET, "/file.txt", .ifMatch = "\"ETAG1\"", .range = "16-19");
+                testResponseP(service, .code = 412);
+
+                TEST_ERROR_FMT(
+                    storageGetP(storageNewReadP(storage, STRDEF("file.txt"))), ProtocolError,
+                    "HTTP request failed with 412:\n"
+                    "*** Path/Query ***:\n"
+                    "/account/container/file.txt?sig=<redacted>\n"
+                    "*** Request Headers ***:\n"
+                    "content-length: 0\n"
+                    "host: %s\n"
+                    "if-match: \"ETAG1\"\n"
+                    "range: bytes=16-19",
+                    strZ(hrnServerHost()));
+
                 // -----------------------------------------------------------------------------------------------------------------
                 hrnServerScriptEnd(service);
             }
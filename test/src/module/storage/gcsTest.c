@@ -72,6 +72,7 @@ typedef struct TestRequestParam
     const char *object;
     const char *query;
     const char *range;
+    const char *readRange;
     const char *content;
 } TestRequestParam;
 
@@ -108,6 +109,10 @@ testRequest(IoWrite *write, const char *verb, TestRequestParam param)
     // Add host
     strCatFmt(request, "host:%s\r\n", strZ(hrnServerHost()));
 
+    // Add range
+    if (param.readRange != NULL)
+        strCatFmt(request, "range:bytes=%s\r\n", param.readRange);
+
     // Complete headers
     strCatZ(request, "\r\n");
 
@@ -212,6 +217,7 @@ testRun(void)
         TEST_RESULT_STR(((StorageGcs *)storageDriver(storage))->bucket, TEST_BUCKET_STR, "    check bucket");
         TEST_RESULT_STR_Z(((StorageGcs *)storageDriver(storage))->endpoint, "storage.googleapis.com", "    check endpoint");
         TEST_RESULT_UINT(((StorageGcs *)storageDriver(storage))->chunkSize, STORAGE_GCS_CHUNKSIZE_DEFAULT, "    check chunk size");
+        TEST_RESULT_UINT(((StorageGcs *)storageDriver(storage))->downloadConcurrency, 1, "    check download concurrency");
         TEST_RESULT_STR(((StorageGcs *)storageDriver(storage))->token, TEST_TOKEN_STR, "    check token");
         TEST_RESULT_BOOL(storageFeature(storage, storageFeaturePath), false, "    check path feature");
         TEST_RESULT_BOOL(storageFeature(storage, storageFeatureCompress), false, "    check compress feature");
@@ -232,7 +238,7 @@ testRun(void)
             (StorageGcs *)storageDriver(
                 storageGcsNew(
                     STRDEF("/repo"), false, NULL, TEST_BUCKET_STR, storageGcsKeyTypeService, TEST_KEY_FILE_STR, TEST_CHUNK_SIZE,
-                    TEST_ENDPOINT_STR, TEST_TIMEOUT, true, NULL, NULL)),
+                    1, TEST_ENDPOINT_STR, TEST_TIMEOUT, true, NULL, NULL)),
             "read-only gcs storage - service key");
         TEST_RESULT_STR_Z(httpUrlHost(storage->authUrl), "test.com", "check host");
         TEST_RESULT_STR_Z(httpUrlPath(storage->authUrl), "/token", "check path");
@@ -257,7 +263,7 @@ testRun(void)
             (StorageGcs *)storageDriver(
                 storageGcsNew(
                     STRDEF("/repo"), true, NULL, TEST_BUCKET_STR, storageGcsKeyTypeService, TEST_KEY_FILE_STR, TEST_CHUNK_SIZE,
-                    TEST_ENDPOINT_STR, TEST_TIMEOUT, true, NULL, NULL)),
+                    1, TEST_ENDPOINT_STR, TEST_TIMEOUT, true, NULL, NULL)),
             "read/write gcs storage - service key");
 
         TEST_RESULT_STR_Z(
@@ -419,6 +425,7 @@ testRun(void)
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("non-404 error");
 
+
                 testRequestP(service, HTTP_VERB_GET, .object = "file.txt", .query = "alt=media");
                 testResponseP(service, .code = 303, .content = "CONTENT");
 
@@ -446,7 +453,7 @@ testRun(void)
                 TEST_TITLE("write error");
 
                 testRequestP(
-                    service, HTTP_VERB_POST, .query = "fields=md5Hash%2Csize&name=file.txt&uploadType=media", .upload = true,
+                    service, HTTP_VERB_POST, .query = "fields=crc32c%2Csize&name=file.txt&uploadType=media", .upload = true,
                     .content = "ABCD");
                 testResponseP(service, .code = 403);
 
@@ -454,7 +461,7 @@ testRun(void)
                     storagePutP(storageNewWriteP(storage, strNew("file.txt")), BUFSTRDEF("ABCD")), ProtocolError,
                     "HTTP request failed with 403 (Forbidden):\n"
                     "*** Path/Query ***:\n"
-                    "/upload/storage/v1/b/bucket/o?fields=md5Hash%%2Csize&name=file.txt&uploadType=media\n"
+                    "/upload/storage/v1/b/bucket/o?fields=crc32c%%2Csize&name=file.txt&uploadType=media\n"
                     "*** Request Headers ***:\n"
                     "authorization: <redacted>\n"
                     "content-length: 4\n"
@@ -465,13 +472,13 @@ testRun(void)
                 TEST_TITLE("write file in one part (with retry)");
 
                 testRequestP(
-                    service, HTTP_VERB_POST, .query = "fields=md5Hash%2Csize&name=file.txt&uploadType=media", .upload = true,
+                    service, HTTP_VERB_POST, .query = "fields=crc32c%2Csize&name=file.txt&uploadType=media", .upload = true,
                     .content = "ABCD");
                 testResponseP(service, .code = 503);
                 testRequestP(
-                    service, HTTP_VERB_POST, .query = "fields=md5Hash%2Csize&name=file.txt&uploadType=media", .upload = true,
+                    service, HTTP_VERB_POST, .query = "fields=crc32c%2Csize&name=file.txt&uploadType=media", .upload = true,
                     .content = "ABCD");
-                testResponseP(service, .content = "{\"md5Hash\":\"ywjKSnu1+Wg8GRM6hIcspw==\"}");
+                testResponseP(service, .content = "{\"crc32c\":\"+5+Icg==\"}");
 
                 StorageWrite *write = NULL;
                 TEST_ASSIGN(write, storageNewWriteP(storage, strNew("file.txt")), "new write");
@@ -491,33 +498,33 @@ testRun(void)
                 TEST_TITLE("write zero-length file");
 
                 testRequestP(
-                    service, HTTP_VERB_POST, .query = "fields=md5Hash%2Csize&name=file.txt&uploadType=media", .upload = true,
+                    service, HTTP_VERB_POST, .query = "fields=crc32c%2Csize&name=file.txt&uploadType=media", .upload = true,
                     .content = "");
-                testResponseP(service, .content = "{\"md5Hash\":\"1B2M2Y8AsgTpgAmY7PhCfg==\",\"size\":\"0\"}");
+                testResponseP(service, .content = "{\"crc32c\":\"AAAAAA==\",\"size\":\"0\"}");
 
                 TEST_ASSIGN(write, storageNewWriteP(storage, strNew("file.txt")), "new write");
                 TEST_RESULT_VOID(storagePutP(write, NULL), "write");
 
                 // -----------------------------------------------------------------------------------------------------------------
-                TEST_TITLE("invalid md5");
+                TEST_TITLE("invalid crc32c");
 
                 testRequestP(
-                    service, HTTP_VERB_POST, .query = "fields=md5Hash%2Csize&name=file.txt&uploadType=media", .upload = true,
+                    service, HTTP_VERB_POST, .query = "fields=crc32c%2Csize&name=file.txt&uploadType=media", .upload = true,
                     .content = "");
-                testResponseP(service, .content = "{\"md5Hash\":\"ywjK\",\"size\":\"0\"}");
+                testResponseP(service, .content = "{\"crc32c\":\"ywjK\",\"size\":\"0\"}");
 
                 TEST_ASSIGN(write, storageNewWriteP(storage, strNew("file.txt")), "new write");
                 TEST_ERROR(
                     storagePutP(write, NULL), FormatError,
-                    "expected md5 'd41d8cd98f00b204e9800998ecf8427e' for '/file.txt' but actual is 'cb08ca'");
+                    "expected crc32c '00000000' for '/file.txt' but actual is 'cb08ca'");
 
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("invalid size");
 
                 testRequestP(
-                    service, HTTP_VERB_POST, .query = "fields=md5Hash%2Csize&name=file.txt&uploadType=media", .upload = true,
+                    service, HTTP_VERB_POST, .query = "fields=crc32c%2Csize&name=file.txt&uploadType=media", .upload = true,
                     .content = "");
-                testResponseP(service, .content = "{\"md5Hash\":\"1B2M2Y8AsgTpgAmY7PhCfg==\",\"size\":\"55\"}");
+                testResponseP(service, .content = "{\"crc32c\":\"AAAAAA==\",\"size\":\"55\"}");
 
                 TEST_ASSIGN(write, storageNewWriteP(storage, strNew("file.txt")), "new write");
                 TEST_ERROR(storagePutP(write, NULL), FormatError, "expected size 55 for '/file.txt' but actual is 0");
@@ -536,9 +543,9 @@ testRun(void)
 
                 testRequestP(
                     service, HTTP_VERB_PUT, .upload = true, .noAuth = true,
-                    .query = "fields=md5Hash%2Csize&name=file.txt&uploadType=resumable&upload_id=ulid1", .range = "16-31/32",
+                    .query = "fields=crc32c%2Csize&name=file.txt&uploadType=resumable&upload_id=ulid1", .range = "16-31/32",
                     .content = "7890123456789012");
-                testResponseP(service, .content = "{\"md5Hash\":\"dnF5x6K/8ZZRzpfSlMMM+w==\",\"size\":\"32\"}");
+                testResponseP(service, .content = "{\"crc32c\":\"lVpDTg==\",\"size\":\"32\"}");
 
                 TEST_ASSIGN(write, storageNewWriteP(storage, strNew("file.txt")), "new write");
                 TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("12345678901234567890123456789012")), "write");
@@ -562,9 +569,9 @@ testRun(void)
 
                 testRequestP(
                     service, HTTP_VERB_PUT, .upload = true, .noAuth = true,
-                    .query = "fields=md5Hash%2Csize&name=file.txt&uploadType=resumable&upload_id=ulid2", .range = "16-19/20",
+                    .query = "fields=crc32c%2Csize&name=file.txt&uploadType=resumable&upload_id=ulid2", .range = "16-19/20",
                     .content = "7890");
-                testResponseP(service, .content = "{\"md5Hash\":\"/YXmLZvrRUKHcexohBiycQ==\",\"size\":\"20\"}");
+                testResponseP(service, .content = "{\"crc32c\":\"qLSmuQ==\",\"size\":\"20\"}");
 
                 TEST_ASSIGN(write, storageNewWriteP(storage, strNew("file.txt")), "new write");
                 TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("12345678901234567890")), "write");
@@ -924,6 +931,68 @@ testRun(void)
 
                 TEST_RESULT_VOID(storagePathRemoveP(storage, strNew("/path"), .recurse = true), "remove");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file with concurrent ranges");
+
+                // The chunk size is also the range size. Ranges after the first range are conditional on its generation.
+                ((StorageGcs *)storageDriver(storage))->chunkSize = 16;
+                ((StorageGcs *)storageDriver(storage))->downloadConcurrency = 2;
+
+                testRequestP(service, HTTP_VERB_GET, .object = "file.txt", .query = "alt=media", .readRange = "0-15");
+                testResponseP(
+                    service, .code = 206, .header = "content-range:bytes 0-15/20\r\nx-goog-generation:1234",
+                    .content = "0123456789abcdef");
+
+                hrnServerScriptAccept(service);
+
+                testRequestP(
+                    service, HTTP_VERB_GET, .object = "file.txt", .query = "alt=media&ifGenerationMatch=1234",
+                    .readRange = "16-19");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 16-19/20", .content = "ghij");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(storage, STRDEF("file.txt")))), "0123456789abcdefghij", "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get zero-length file with concurrent ranges");
+
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, HTTP_VERB_GET, .object = "file0.txt", .query = "alt=media", .readRange = "0-15");
+                testResponseP(service, .code = 416);
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(storage, STRDEF("file0.txt")))), "", "get zero-length file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error when file changes between ranges");
+
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, HTTP_VERB_GET, .object = "file.txt", .query = "alt=media", .readRange = "0-15");
+                testResponseP(
+                    service, .code = 206, .header = "content-range:bytes 0-15/20\r\nx-goog-generation:1234",
+                    .content = "0123456789abcdef");
+
+                hrnServerScriptSwap(service);
+
+                testRequestP(
+                    service, HTTP_VERB_GET, .object = "file.txt", .query = "alt=media&ifGenerationMatch=1234",
+                    .readRange = "16-19");
+                testResponseP(service, .code = 412);
+
+                TEST_ERROR_FMT(
+                    storageGetP(storageNewReadP(storage, STRDEF("file.txt"))), ProtocolError,
+                    "HTTP request failed with 412:\n"
+                    "*** Path/Query ***:\n"
+                    "/storage/v1/b/bucket/o/file.txt?alt=media&ifGenerationMatch=1234\n"
+                    "*** Request Headers ***:\n"
+                    "authorization: <redacted>\n"
+                    "content-length: 0\n"
+                    "host: %s\n"
+                    "range: bytes=16-19",
+                    strZ(hrnServerHost()));
+
                 // -----------------------------------------------------------------------------------------------------------------
                 hrnServerScriptEnd(service);
             }
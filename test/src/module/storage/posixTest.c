@@ -1,6 +1,14 @@
 /***********************************************************************************************************************************
 Test Posix Storage
 ***********************************************************************************************************************************/
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+
+#include "common/crypto/hash.h"
+#include "common/io/filter/buffer.h"
+#include "common/io/filter/size.h"
 #include "common/io/io.h"
 #include "common/time.h"
 #include "storage/read.h"
@@ -26,6 +34,32 @@ storageTestPathExpression(const String *expression, const String *path)
     return result;
 }
 
+/***********************************************************************************************************************************
+Is a page of a file in the page cache?
+***********************************************************************************************************************************/
+#ifdef HAVE_MINCORE
+
+static bool
+testPageResident(const String *const file, const size_t page)
+{
+    const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    unsigned char resident = 0;
+
+    const int fd = open(strZ(file), O_RDONLY);
+    THROW_ON_SYS_ERROR(fd == -1, FileOpenError, "unable to open file");
+
+    void *const map = mmap(NULL, pageSize, PROT_READ, MAP_SHARED, fd, (off_t)(page * pageSize));
+    THROW_ON_SYS_ERROR(map == MAP_FAILED, FileOpenError, "unable to map file");
+    THROW_ON_SYS_ERROR(mincore(map, pageSize, &resident) == -1, FileReadError, "unable to check page cache");
+
+    munmap(map, pageSize);
+    close(fd);
+
+    return resident & 1;
+}
+
+#endif // HAVE_MINCORE
+
 /***********************************************************************************************************************************
 Macro to create a path and file that cannot be accessed
 ***********************************************************************************************************************************/
@@ -421,6 +455,23 @@ testRun(void)
                 .expression = STRDEF("\\/file$")),
             "filter");
         TEST_RESULT_STR_Z(callbackData.content, "path/file {file, s=8}\n", "check content");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("type only");
+
+        callbackData.content = strNew("");
+
+        TEST_RESULT_VOID(
+            storageInfoListP(
+                storageTest, strNew("pg"), hrnStorageInfoListCallback, &callbackData, .level = storageInfoLevelType,
+                .sortOrder = sortOrderAsc, .expression = STRDEF("^(file|path|pipe)$")),
+            "list");
+        TEST_RESULT_STR_Z(
+            callbackData.content,
+            "file {file}\n"
+            "path {path}\n"
+            "pipe {special}\n",
+            "check content");
     }
 
     // *****************************************************************************************************************************
@@ -490,6 +541,159 @@ testRun(void)
         TEST_RESULT_BOOL(storageCopyP(source, destination), true, "copy file");
         TEST_RESULT_BOOL(bufEq(expectedBuffer, storageGetP(storageNewReadP(storageTest, destinationFile))), true, "check file");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy directly when there are no filters");
+
+        ioBufferSizeSet(4);
+
+        source = storageNewReadP(storageTest, sourceFile, .offset = 1, .limit = VARUINT64(7));
+        destination = storageNewWriteP(storageTest, destinationFile);
+
+        TEST_RESULT_BOOL(storageCopyP(source, destination), true, "copy file");
+        TEST_RESULT_BOOL(((StorageReadPosix *)source->driver)->copyFd != -1, true, "check source copied");
+        TEST_RESULT_BOOL(((StorageWritePosix *)destination->driver)->copied, true, "check destination copied");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageTest, destinationFile))), "ESTFILE", "check file");
+
+#ifdef HAVE_COPY_FILE_RANGE
+        TEST_RESULT_BOOL(((StorageReadPosix *)source->driver)->copyKernel, true, "check copied in kernel");
+#endif
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy in pipeline process writes copy");
+
+        const String *sourceLargeFile = strNewFmt("%s/source-large.txt", testPath());
+        const Buffer *expectedLargeBuffer = BUFSTRDEF(
+            "0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF");
+        storagePutP(storageNewWriteP(storageTest, sourceLargeFile), expectedLargeBuffer);
+
+        source = storageNewReadP(storagePosixNewP(strNew(testPath()), .readPipeline = true), sourceLargeFile);
+        destination = storageNewWriteP(storageTest, destinationFile);
+
+        TEST_RESULT_BOOL(storageCopyP(source, destination), true, "copy file");
+        TEST_RESULT_BOOL(((StorageReadPosix *)source->driver)->copyKernel, false, "check not copied in kernel");
+        TEST_RESULT_BOOL(((StorageWritePosix *)destination->driver)->copied, true, "check destination copied");
+        TEST_RESULT_BOOL(
+            bufEq(expectedLargeBuffer, storageGetP(storageNewReadP(storageTest, destinationFile))), true, "check file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy with read-ahead writes copy");
+
+        source = storageNewReadP(storagePosixNewP(strNew(testPath()), .uring = true), sourceFile);
+        destination = storageNewWriteP(storageTest, destinationFile);
+
+        TEST_RESULT_BOOL(storageCopyP(source, destination), true, "copy file");
+        TEST_RESULT_BOOL(((StorageWritePosix *)destination->driver)->copied, true, "check destination copied");
+        TEST_RESULT_BOOL(bufEq(expectedBuffer, storageGetP(storageNewReadP(storageTest, destinationFile))), true, "check file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy directly when filters do not produce output");
+
+        source = storageNewReadP(storageTest, sourceFile, .offset = 1, .limit = VARUINT64(7));
+        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(source)), cryptoHashNew(HASH_TYPE_SHA1_STR));
+        destination = storageNewWriteP(storageTest, destinationFile);
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), ioSizeNew());
+
+        TEST_RESULT_BOOL(storageCopyP(source, destination), true, "copy file");
+        TEST_RESULT_BOOL(((StorageReadPosix *)source->driver)->copyFd != -1, true, "check source copied");
+        TEST_RESULT_BOOL(((StorageWritePosix *)destination->driver)->copied, true, "check destination copied");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageTest, destinationFile))), "ESTFILE", "check file");
+        TEST_RESULT_STR_Z(
+            varStr(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(source)), CRYPTO_HASH_FILTER_TYPE_STR)),
+            "68bab9e4942dbc3ad947da7a31a9324647554532", "check checksum");
+        TEST_RESULT_UINT(
+            varUInt64(ioFilterGroupResult(ioWriteFilterGroup(storageWriteIo(destination)), SIZE_FILTER_TYPE_STR)), 7, "check size");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("no direct copy when a filter produces output");
+
+        source = storageNewReadP(storageTest, sourceFile);
+        destination = storageNewWriteP(storageTest, destinationFile);
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), ioBufferNew());
+
+        TEST_RESULT_BOOL(storageCopyP(source, destination), true, "copy file");
+        TEST_RESULT_INT(((StorageReadPosix *)source->driver)->copyFd, -1, "check source not copied");
+        TEST_RESULT_BOOL(((StorageWritePosix *)destination->driver)->copied, false, "check destination not copied");
+        TEST_RESULT_BOOL(bufEq(expectedBuffer, storageGetP(storageNewReadP(storageTest, destinationFile))), true, "check file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("no direct copy when not supported by the drivers");
+
+        source = storageNewReadP(storageTest, sourceFile);
+        destination = storageNewWriteP(storageTest, destinationFile);
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(source)), true, "open source");
+        ioWriteOpen(storageWriteIo(destination));
+
+        ((StorageWritePosix *)destination->driver)->interface.copyFrom = NULL;
+        TEST_RESULT_BOOL(storageReadCopyTo(source, destination), false, "destination does not support copy");
+
+        ((StorageReadPosix *)source->driver)->interface.copyTo = NULL;
+        TEST_RESULT_BOOL(storageReadCopyTo(source, destination), false, "source does not support copy");
+
+        TEST_RESULT_VOID(ioReadClose(storageReadIo(source)), "close source");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(destination)), "close destination");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+#ifdef HAVE_COPY_FILE_RANGE
+        TEST_TITLE("data that was read is written when the source changed before the copy");
+
+        source = storageNewReadP(storageTest, sourceFile);
+        destination = storageNewWriteP(storageTest, destinationFile);
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(source)), true, "open source");
+        ioWriteOpen(storageWriteIo(destination));
+        TEST_RESULT_BOOL(storageReadCopyTo(source, destination), true, "copy to destination");
+
+        TEST_RESULT_UINT(
+            storageReadPosixCopy(source->driver, (const unsigned char *)"TESTFILE", 8, 0), 8, "copy matches the data read");
+        TEST_RESULT_UINT(
+            storageReadPosixCopy(source->driver, (const unsigned char *)"TESTFILX", 8, 0), 0, "copy does not match the data read");
+        TEST_RESULT_BOOL(((StorageReadPosix *)source->driver)->copyKernel, true, "check still copying in kernel");
+
+        TEST_RESULT_VOID(ioReadClose(storageReadIo(source)), "close source");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(destination)), "close destination");
+#endif
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("copy errors");
+
+        int pipeFd[2];
+        TEST_RESULT_INT(pipe(pipeFd), 0, "create pipe");
+
+        source = storageNewReadP(storageTest, sourceFile);
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(source)), true, "open source");
+        TEST_RESULT_VOID(storageReadPosixCopyTo(source->driver, pipeFd[1]), "copy to pipe");
+
+        Buffer *buffer = bufNew(ioBufferSize());
+
+        TEST_ERROR_FMT(
+            storageReadPosix(source->driver, buffer, true), FileWriteError,
+            "unable to write copy of '%s': [29] Illegal seek", strZ(sourceFile));
+
+#ifdef HAVE_COPY_FILE_RANGE
+        TEST_RESULT_BOOL(((StorageReadPosix *)source->driver)->copyKernel, false, "check fall back from kernel copy");
+#endif
+
+        close(pipeFd[0]);
+        close(pipeFd[1]);
+
+#ifdef HAVE_COPY_FILE_RANGE
+        const int fdReadOnly = open(strZ(sourceFile), O_RDONLY);
+
+        source = storageNewReadP(storageTest, sourceFile);
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(source)), true, "open source");
+        TEST_RESULT_VOID(storageReadPosixCopyTo(source->driver, fdReadOnly), "copy to read-only file");
+        bufUsedZero(buffer);
+
+        TEST_ERROR_FMT(
+            storageReadPosix(source->driver, buffer, true), FileReadError, "unable to copy '%s': [9] Bad file descriptor",
+            strZ(sourceFile));
+
+        close(fdReadOnly);
+#endif
+
+        ioBufferSizeSet(2);
+
         storageRemoveP(storageTest, sourceFile, .errorOnMissing = true);
         storageRemoveP(storageTest, destinationFile, .errorOnMissing = true);
     }
@@ -871,6 +1075,18 @@ testRun(void)
             buffer, storageGetP(storageNewReadP(storageTest, strNewFmt("%s/test.txt", testPath()), .limit = VARUINT64(7))), "get");
         TEST_RESULT_UINT(bufSize(buffer), 7, "check size");
         TEST_RESULT_BOOL(memcmp(bufPtrConst(buffer), "TESTFIL", bufSize(buffer)) == 0, true, "check content");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read from offset");
+
+        TEST_ASSIGN(
+            buffer,
+            storageGetP(storageNewReadP(storageTest, strNewFmt("%s/test.txt", testPath()), .offset = 4, .limit = VARUINT64(3))),
+            "get");
+        TEST_RESULT_STR_Z(strNewBuf(buffer), "FIL", "check content");
+
+        TEST_ASSIGN(buffer, storageGetP(storageNewReadP(storageTest, strNewFmt("%s/test.txt", testPath()), .offset = 4)), "get");
+        TEST_RESULT_STR_Z(strNewBuf(buffer), "FILE\n", "check content");
     }
 
     // *****************************************************************************************************************************
@@ -997,6 +1213,207 @@ testRun(void)
         TEST_RESULT_VOID(storageReadFree(storageNewReadP(storageTest, fileName)), "   free file");
 
         TEST_RESULT_VOID(storageReadMove(NULL, memContextTop()), "   move null file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read in a separate process");
+
+        Storage *storagePipeline = storagePosixNewP(strNew(testPath()), .readPipeline = true);
+
+        const String *fileLarge = strNewFmt("%s/large.file", testPath());
+        const Buffer *expectedLargeBuffer = BUFSTRDEF("0123456789ABCDEF0123456789ABCDEF0123456789");
+        storagePutP(storageNewWriteP(storageTest, fileLarge), expectedLargeBuffer);
+
+        TEST_ASSIGN(file, storageNewReadP(storagePipeline, fileLarge), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+        TEST_RESULT_BOOL(((StorageReadPosix *)file->driver)->processId != 0, true, "check pipeline process");
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(storageReadIo(file)), expectedLargeBuffer), true, "check file contents");
+        TEST_RESULT_INT(((StorageReadPosix *)file->driver)->processId, 0, "check pipeline process ended");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storagePipeline, fileLarge, .offset = 1, .limit = VARUINT64(33)))),
+            "123456789ABCDEF0123456789ABCDEF01", "read offset and limit");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("file that spans too few buffers is not read in a separate process");
+
+        const String *fileSmall = strNewFmt("%s/small.file", testPath());
+        storagePutP(storageNewWriteP(storageTest, fileSmall), BUFSTRDEF("AB"));
+
+        TEST_ASSIGN(file, storageNewReadP(storagePipeline, fileSmall), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+        TEST_RESULT_INT(((StorageReadPosix *)file->driver)->processId, 0, "check no pipeline process");
+        TEST_RESULT_STR_Z(strNewBuf(ioReadBuf(storageReadIo(file))), "AB", "check file contents");
+
+        TEST_ASSIGN(file, storageNewReadP(storagePipeline, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+        TEST_RESULT_INT(((StorageReadPosix *)file->driver)->processId, 0, "check no pipeline process");
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(storageReadIo(file)), expectedBuffer), true, "check file contents");
+
+        TEST_ASSIGN(file, storageNewReadP(storagePipeline, fileLarge, .limit = VARUINT64(31)), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+        TEST_RESULT_INT(((StorageReadPosix *)file->driver)->processId, 0, "check no pipeline process");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("close before the file has been read");
+
+        TEST_ASSIGN(file, storageNewReadP(storagePipeline, fileLarge), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+
+        bufUsedZero(outBuffer);
+        TEST_RESULT_UINT(ioRead(storageReadIo(file), outBuffer), 2, "read part of file");
+        TEST_RESULT_STR_Z(strNewBuf(outBuffer), "01", "check contents");
+        TEST_RESULT_VOID(ioReadClose(storageReadIo(file)), "close file");
+        TEST_RESULT_INT(((StorageReadPosix *)file->driver)->processId, 0, "check pipeline process ended");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("error in pipeline process");
+
+        const String *pathRead = strNewFmt("%s/pipeline", testPath());
+        storagePutP(storageNewWriteP(storageTest, strNewFmt("%s/file", strZ(pathRead))), NULL);
+
+        TEST_ERROR_FMT(
+            storageGetP(storageNewReadP(storagePipeline, pathRead)), FileReadError, "unable to read '%s': [21] Is a directory",
+            strZ(pathRead));
+
+#ifdef HAVE_IO_URING
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read ahead with io_uring");
+
+        Storage *storageUring = storagePosixNewP(strNew(testPath()), .uring = true);
+
+        TEST_ASSIGN(file, storageNewReadP(storageUring, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+        TEST_RESULT_BOOL(((StorageReadPosix *)file->driver)->ring != NULL, true, "check ring");
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(storageReadIo(file)), expectedBuffer), true, "check file contents");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageUring, fileName, .offset = 1, .limit = VARUINT64(5)))), "ESTFI",
+            "read offset and limit");
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageUring, fileName, .offset = 3, .limit = VARUINT64(4)))), "TFIL",
+            "read offset and limit on buffer boundary");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read ahead into a buffer larger than the read-ahead buffers");
+
+        TEST_ASSIGN(file, storageNewReadP(storageUring, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+
+        Buffer *largeBuffer = bufNew(64);
+        TEST_RESULT_UINT(storageReadPosix(file->driver, largeBuffer, true), 9, "read file");
+        TEST_RESULT_BOOL(bufEq(largeBuffer, expectedBuffer), true, "check file contents");
+        TEST_RESULT_BOOL(storageReadPosixEof(file->driver), true, "eof");
+        TEST_RESULT_VOID(ioReadClose(storageReadIo(file)), "close file");
+        TEST_RESULT_PTR(((StorageReadPosix *)file->driver)->ring, NULL, "check ring freed");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("file not larger than the buffer is not read ahead");
+
+        TEST_ASSIGN(file, storageNewReadP(storageUring, fileSmall), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+        TEST_RESULT_PTR(((StorageReadPosix *)file->driver)->ring, NULL, "check no ring");
+        TEST_RESULT_STR_Z(strNewBuf(ioReadBuf(storageReadIo(file))), "AB", "check file contents");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("io_uring is preferred to a separate process");
+
+        TEST_ASSIGN(
+            file, storageNewReadP(storagePosixNewP(strNew(testPath()), .readPipeline = true, .uring = true), fileName),
+            "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+        TEST_RESULT_BOOL(((StorageReadPosix *)file->driver)->ring != NULL, true, "check ring");
+        TEST_RESULT_INT(((StorageReadPosix *)file->driver)->processId, 0, "check no pipeline process");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("free before the file has been read");
+
+        TEST_ASSIGN(file, storageNewReadP(storageUring, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+
+        bufUsedZero(outBuffer);
+        TEST_RESULT_UINT(ioRead(storageReadIo(file), outBuffer), 2, "read part of file");
+        TEST_RESULT_STR_Z(strNewBuf(outBuffer), "TE", "check contents");
+        TEST_RESULT_VOID(storageReadFree(file), "free file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("error in read ahead");
+
+        TEST_ERROR_FMT(
+            storageGetP(storageNewReadP(storageUring, pathRead)), FileReadError, "unable to read '%s': [21] Is a directory",
+            strZ(pathRead));
+#endif // HAVE_IO_URING
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read with page cache advice");
+
+        Storage *storageAdvise = storagePosixNewP(strNew(testPath()), .readAdvise = true);
+
+        TEST_ASSIGN(file, storageNewReadP(storageAdvise, fileName), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+
+        bufUsedZero(outBuffer);
+        TEST_RESULT_UINT(ioRead(storageReadIo(file), outBuffer), 2, "read part of file");
+        TEST_RESULT_UINT(((StorageReadPosix *)file->driver)->adviseDrop, 2, "check pages dropped");
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(storageReadIo(file)), BUFSTRDEF("STFILE\n")), true, "check file contents");
+        TEST_RESULT_UINT(((StorageReadPosix *)file->driver)->adviseDrop, 9, "check pages dropped");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageAdvise, fileName, .offset = 1, .limit = VARUINT64(5)))), "ESTFI",
+            "read offset and limit");
+
+#ifdef HAVE_MINCORE
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("pages in the page cache before the read are not dropped");
+
+        const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+        const String *const filePage = strNewFmt("%s/page.file", testPath());
+        Buffer *const pageBuffer = bufNew(pageSize * 4);
+
+        memset(bufPtr(pageBuffer), 'P', bufSize(pageBuffer));
+        bufUsedSet(pageBuffer, bufSize(pageBuffer));
+
+        // The file is synced when written so all pages can be dropped. Drop all pages except the first.
+        storagePutP(storageNewWriteP(storageTest, filePage), pageBuffer);
+
+        int fd = open(strZ(filePage), O_RDONLY);
+        TEST_RESULT_INT(posix_fadvise(fd, (off_t)pageSize, 0, POSIX_FADV_DONTNEED), 0, "drop pages after the first");
+        close(fd);
+
+        TEST_RESULT_BOOL(testPageResident(filePage, 0), true, "first page is in the page cache");
+        TEST_RESULT_BOOL(testPageResident(filePage, 3), false, "last page is not in the page cache");
+
+        ioBufferSizeSet(pageSize);
+
+        TEST_ASSIGN(file, storageNewReadP(storageAdvise, filePage), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+        TEST_RESULT_BOOL(((StorageReadPosix *)file->driver)->advise, true, "check pages are dropped");
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(storageReadIo(file)), pageBuffer), true, "check file contents");
+
+        ioBufferSizeSet(2);
+
+        TEST_RESULT_BOOL(testPageResident(filePage, 0), true, "first page is still in the page cache");
+        TEST_RESULT_BOOL(testPageResident(filePage, 3), false, "last page was dropped");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("pages are not dropped when the file is empty");
+
+        HRN_STORAGE_PUT_EMPTY(storageTest, "page.empty");
+
+        TEST_ASSIGN(file, storageNewReadP(storageAdvise, STRDEF("page.empty")), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+        TEST_RESULT_BOOL(((StorageReadPosix *)file->driver)->advise, false, "check pages are not dropped");
+        TEST_RESULT_VOID(storageReadFree(file), "free file");
+#endif // HAVE_MINCORE
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read in a separate process with page cache advice");
+
+        TEST_ASSIGN(
+            file, storageNewReadP(storagePosixNewP(strNew(testPath()), .readPipeline = true, .readAdvise = true), fileLarge),
+            "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+        TEST_RESULT_BOOL(((StorageReadPosix *)file->driver)->advise, false, "check pipeline process drops pages");
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(storageReadIo(file)), expectedLargeBuffer), true, "check file contents");
     }
 
     // *****************************************************************************************************************************
@@ -1122,6 +1539,137 @@ testRun(void)
         TEST_RESULT_INT(storageInfoP(storageTest, strPath(fileName)).mode, 0700, "    check path mode");
         TEST_RESULT_INT(storageInfoP(storageTest, fileName).mode, 0600, "    check file mode");
 
+        storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+
+#ifdef HAVE_IO_URING
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write behind with io_uring");
+
+        Storage *storageUring = storagePosixNewP(strNew(testPath()), .write = true, .uring = true);
+        const String *fileNameTmp = strNewFmt("%s.pgbackrest.tmp", strZ(fileName));
+        Buffer *bufferLarge = bufNew(0);
+
+        for (unsigned int bufferIdx = 0; bufferIdx < 8; bufferIdx++)
+            bufCat(bufferLarge, bufferIdx == 7 ? BUFSTRDEF("LAST") : buffer);
+
+        TEST_ASSIGN(file, storageNewWriteP(storageUring, fileName), "new write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "first write is not queued");
+        TEST_RESULT_PTR(((StorageWritePosix *)file->driver)->ring, NULL, "check no ring");
+
+        for (unsigned int bufferIdx = 1; bufferIdx < 7; bufferIdx++)
+            TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "queue write");
+
+        TEST_RESULT_BOOL(((StorageWritePosix *)file->driver)->ring != NULL, true, "check ring");
+        TEST_RESULT_VOID(storageWritePosix(file->driver, BUFSTRDEF("LAST")), "queue write");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "close file");
+        TEST_RESULT_PTR(((StorageWritePosix *)file->driver)->ring, NULL, "check ring freed");
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), bufferLarge), true, "check file contents");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write behind without sync");
+
+        TEST_ASSIGN(file, storageNewWriteP(storageUring, fileName, .noSyncFile = true), "new write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "write");
+        TEST_RESULT_VOID(storageWritePosix(file->driver, BUFSTRDEF("LAST")), "queue write");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "close file");
+
+        TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(storageTest, fileName))), "TESTFILE\nLAST", "check file contents");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("short write is retried and then errors");
+
+        HARNESS_FORK_BEGIN()
+        {
+            HARNESS_FORK_CHILD_BEGIN(0, false)
+            {
+                // Limit the file size so the write is short and the retry fails
+                signal(SIGXFSZ, SIG_IGN);
+                setrlimit(RLIMIT_FSIZE, &(struct rlimit){.rlim_cur = 12, .rlim_max = RLIM_INFINITY});
+
+                TEST_ASSIGN(file, storageNewWriteP(storageUring, fileName), "new write file");
+                TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+                TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "write");
+                TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "queue write");
+                TEST_ERROR_FMT(
+                    ioWriteClose(storageWriteIo(file)), FileWriteError, "unable to write '%s': [27] File too large",
+                    strZ(fileNameTmp));
+                TEST_RESULT_BOOL(((StorageWritePosix *)file->driver)->behindRetry, true, "check write was retried");
+            }
+            HARNESS_FORK_CHILD_END();
+        }
+        HARNESS_FORK_END();
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write error on queued write");
+
+        TEST_ASSIGN(file, storageNewWriteP(storageUring, fileName), "new write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "write");
+
+        // Replace the file descriptor with a read-only descriptor so queued writes will fail
+        int fdReadOnly = open("/dev/null", O_RDONLY);
+        dup2(fdReadOnly, ((StorageWritePosix *)file->driver)->fd);
+        close(fdReadOnly);
+
+        for (unsigned int bufferIdx = 0; bufferIdx < STORAGE_POSIX_URING_DEPTH; bufferIdx++)
+            TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "queue write");
+
+        TEST_ERROR_FMT(
+            storageWritePosix(file->driver, buffer), FileWriteError, "unable to write '%s': [9] Bad file descriptor",
+            strZ(fileNameTmp));
+        TEST_RESULT_VOID(storageWriteFree(file), "free file");
+
+        storageRemoveP(storageTest, fileNameTmp, .errorOnMissing = true);
+        storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+#endif // HAVE_IO_URING
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write with flush");
+
+        Storage *storageFlush = storagePosixNewP(strNew(testPath()), .write = true, .writeFlush = 10);
+
+        TEST_ASSIGN(file, storageNewWriteP(storageFlush, fileName), "new write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "write");
+        TEST_RESULT_UINT(((StorageWritePosix *)file->driver)->flushOffset, 0, "check not flushed");
+        TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "write");
+        TEST_RESULT_UINT(((StorageWritePosix *)file->driver)->flushOffset, 18, "check flushed");
+        TEST_RESULT_UINT(((StorageWritePosix *)file->driver)->flushDrop, 0, "check not dropped");
+        TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "write");
+        TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "write");
+        TEST_RESULT_UINT(((StorageWritePosix *)file->driver)->flushOffset, 36, "check flushed");
+        TEST_RESULT_UINT(((StorageWritePosix *)file->driver)->flushDrop, 18, "check dropped");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "close file");
+
+        TEST_RESULT_STR_Z(
+            strNewBuf(storageGetP(storageNewReadP(storageTest, fileName))), "TESTFILE\nTESTFILE\nTESTFILE\nTESTFILE\n",
+            "check file contents");
+
+#ifdef HAVE_SYNC_FILE_RANGE
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("flush error");
+
+        TEST_ASSIGN(file, storageNewWriteP(storageFlush, fileName, .noAtomic = true), "new write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+
+        // Replace the file descriptor with a pipe so the flush will fail
+        int pipeFd[2];
+        THROW_ON_SYS_ERROR(pipe(pipeFd) == -1, KernelError, "unable to create pipe");
+        dup2(pipeFd[1], ((StorageWritePosix *)file->driver)->fd);
+        close(pipeFd[1]);
+
+        TEST_RESULT_VOID(storageWritePosix(file->driver, buffer), "write");
+        TEST_ERROR_FMT(
+            storageWritePosix(file->driver, buffer), FileSyncError, STORAGE_ERROR_WRITE_SYNC ": [29] Illegal seek", strZ(fileName));
+
+        close(pipeFd[0]);
+        ((StorageWritePosix *)file->driver)->interface.syncFile = false;
+        TEST_RESULT_VOID(storageWriteFree(file), "free file");
+#endif // HAVE_SYNC_FILE_RANGE
+
         storageRemoveP(storageTest, fileName, .errorOnMissing = true);
     }
 
@@ -1276,6 +1824,8 @@ testRun(void)
 
         TEST_RESULT_STR(storage->path, strNewFmt("%s/db", testPath()), "check pg storage path");
         TEST_RESULT_BOOL(storage->write, false, "check pg storage write");
+        TEST_RESULT_BOOL(((StoragePosix *)storageDriver(storage))->readPipeline, false, "check pg storage read pipeline");
+        TEST_RESULT_BOOL(((StoragePosix *)storageDriver(storage))->uring, false, "check pg storage io_uring");
         TEST_RESULT_STR(storagePgIdx(1)->path, strNewFmt("%s/db2", testPath()), "check pg 2 storage path");
 
         TEST_RESULT_PTR(storageHelper.storagePgWrite, NULL, "pg write storage not cached");
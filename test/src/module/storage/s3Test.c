@@ -26,6 +26,8 @@ typedef struct TestRequestParam
     const char *content;
     const char *accessKey;
     const char *securityToken;
+    const char *range;
+    const char *ifMatch;
 } TestRequestParam;
 
 #define testRequestP(write, s3, verb, path, ...)                                                                                   \
@@ -63,7 +65,15 @@ testRequest(IoWrite *write, Storage *s3, const char *verb, const char *path, Tes
         if (param.content != NULL)
             strCatZ(request, "content-md5;");
 
-        strCatZ(request, "host;x-amz-content-sha256;x-amz-date");
+        strCatZ(request, "host;");
+
+        if (param.ifMatch != NULL)
+            strCatZ(request, "if-match;");
+
+        if (param.range != NULL)
+            strCatZ(request, "range;");
+
+        strCatZ(request, "x-amz-content-sha256;x-amz-date");
 
         if (securityToken != NULL)
             strCatZ(request, ";x-amz-security-token");
@@ -93,6 +103,14 @@ testRequest(IoWrite *write, Storage *s3, const char *verb, const char *path, Tes
     else
         strCatFmt(request, "host:%s\r\n", strZ(hrnServerHost()));
 
+    // Add if-match
+    if (param.ifMatch != NULL)
+        strCatFmt(request, "if-match:%s\r\n", param.ifMatch);
+
+    // Add range
+    if (param.range != NULL)
+        strCatFmt(request, "range:bytes=%s\r\n", param.range);
+
     // Add content checksum and date if s3 service
     if (s3 != NULL)
     {
@@ -260,6 +278,8 @@ testRun(void)
         TEST_RESULT_STR(driver->accessKey, accessKey, "check access key");
         TEST_RESULT_STR(driver->secretAccessKey, secretAccessKey, "check secret access key");
         TEST_RESULT_STR(driver->securityToken, NULL, "check security token");
+        TEST_RESULT_UINT(driver->uploadConcurrency, 1, "check upload concurrency");
+        TEST_RESULT_UINT(driver->downloadConcurrency, 1, "check download concurrency");
         TEST_RESULT_STR(
             httpClientToLog(driver->httpClient),
             strNewFmt(
@@ -320,12 +340,16 @@ testRun(void)
         hrnCfgArgRawZ(argList, cfgOptRepoS3Endpoint, "custom.endpoint:333");
         hrnCfgArgRawZ(argList, cfgOptRepoStorageCaPath, "/path/to/cert");
         hrnCfgArgRawFmt(argList, cfgOptRepoStorageCaFile, "%s/" HRN_SERVER_CERT_PREFIX ".crt", testRepoPath());
+        hrnCfgArgRawZ(argList, cfgOptRepoS3UploadConcurrency, "4");
+        hrnCfgArgRawZ(argList, cfgOptRepoStorageReadConcurrency, "3");
         hrnCfgEnvRaw(cfgOptRepoS3Token, securityToken);
         harnessCfgLoad(cfgCmdArchivePush, argList);
 
         driver = (StorageS3 *)storageDriver(storageRepoGet(0, false));
 
         TEST_RESULT_STR(driver->securityToken, securityToken, "check security token");
+        TEST_RESULT_UINT(driver->uploadConcurrency, 4, "check upload concurrency");
+        TEST_RESULT_UINT(driver->downloadConcurrency, 3, "check download concurrency");
         TEST_RESULT_STR(
             httpClientToLog(driver->httpClient),
             strNewFmt(
@@ -434,6 +458,16 @@ testRun(void)
 
                 TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(s3, strNew("file0.txt")))), "", "get zero-length file");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file range");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "10-15");
+                testResponseP(service, .code = 206, .content = "sample");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, STRDEF("file.txt"), .offset = 10, .limit = VARUINT64(6)))), "sample",
+                    "get file range");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("switch to temp credentials");
 
@@ -1007,6 +1041,62 @@ testRun(void)
                     "test3.txt {}\n",
                     "check");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("write file in chunks with concurrent parts");
+
+                // This test leaves two sessions in the client so it must be run just before the client is replaced
+                driver->uploadConcurrency = 2;
+
+                testRequestP(service, s3, HTTP_VERB_POST, "/file.txt?uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<InitiateMultipartUploadResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Bucket>bucket</Bucket>"
+                        "<Key>file.txt</Key>"
+                        "<UploadId>CC77</UploadId>"
+                        "</InitiateMultipartUploadResult>");
+
+                // The first part is sent on the current session and the second part requires a new session
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=1&uploadId=CC77", .content = "1234567890123456");
+                testResponseP(service, .header = "etag:CC771");
+
+                hrnServerScriptAccept(service);
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=2&uploadId=CC77", .content = "7890123456789012");
+                testResponseP(service, .header = "etag:CC772");
+
+                // The oldest part is completed to make room for each new part, which then reuses the session of the completed part
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=3&uploadId=CC77", .content = "3456789012345678");
+                testResponseP(service, .header = "etag:CC773");
+
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=4&uploadId=CC77", .content = "9012");
+                testResponseP(service, .header = "etag:CC774");
+
+                // Outstanding parts are completed on close and the part ids are in part order
+                hrnServerScriptSwap(service);
+
+                testRequestP(
+                    service, s3, HTTP_VERB_POST, "/file.txt?uploadId=CC77",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<CompleteMultipartUpload>"
+                        "<Part><PartNumber>1</PartNumber><ETag>CC771</ETag></Part>"
+                        "<Part><PartNumber>2</PartNumber><ETag>CC772</ETag></Part>"
+                        "<Part><PartNumber>3</PartNumber><ETag>CC773</ETag></Part>"
+                        "<Part><PartNumber>4</PartNumber><ETag>CC774</ETag></Part>"
+                        "</CompleteMultipartUpload>\n");
+                testResponseP(service);
+
+                TEST_ASSIGN(write, storageNewWriteP(s3, strNew("file.txt")), "new write");
+                TEST_RESULT_VOID(
+                    storagePutP(write, BUFSTRDEF("1234567890123456789012345678901234567890123456789012")), "write");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("switch to path-style URIs");
 
@@ -1175,6 +1265,124 @@ testRun(void)
 
                 TEST_RESULT_VOID(storageRemoveP(s3, strNew("/path/to/test.txt")), "remove");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get zero-length file with ranges");
+
+                driver->partSize = 16;
+                driver->downloadConcurrency = 2;
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file0.txt", .range = "0-15");
+                testResponseP(service, .code = 416);
+
+                TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(s3, STRDEF("file0.txt")))), "", "get zero-length file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file with ranges when range is ignored");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "0-15");
+                testResponseP(service, .content = "this is a sample file");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, STRDEF("file.txt")))), "this is a sample file", "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error on missing content range");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "0-15");
+                testResponseP(service, .code = 206);
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3, STRDEF("file.txt"))), FormatError,
+                    "missing or invalid content-range for '/file.txt'");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file with concurrent ranges");
+
+                // The first range is requested on the current session and the second range requires a new session. Ranges after the
+                // first are conditional on the ETag of the first range.
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "0-15");
+                testResponseP(
+                    service, .code = 206, .header = "content-range:bytes 0-15/40\r\netag:\"ETAG1\"", .content = "0123456789abcdef");
+
+                hrnServerScriptAccept(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "16-31", .ifMatch = "\"ETAG1\"");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 16-31/40", .content = "ghijklmnopqrstuv");
+
+                // The first session is reused for the third range once the first range has been read
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "32-39", .ifMatch = "\"ETAG1\"");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 32-39/40", .content = "wxyzABCD");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, STRDEF("file.txt")))), "0123456789abcdefghijklmnopqrstuvwxyzABCD",
+                    "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file range with concurrent ranges");
+
+                // Sessions are reused in the order they were released
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "4-19");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 4-19/40", .content = "456789abcdefghij");
+
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "20-33");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 20-33/40", .content = "klmnopqrstuvwx");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, STRDEF("file.txt"), .offset = 4, .limit = VARUINT64(30)))),
+                    "456789abcdefghijklmnopqrstuvwx", "get file range");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file with concurrent ranges prefetched in chunks");
+
+                // With a small buffer the ranges after the current range are prefetched a chunk at a time
+                size_t bufferSizeOld = ioBufferSize();
+                ioBufferSizeSet(8);
+
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "0-15");
+                testResponseP(
+                    service, .code = 206, .header = "content-range:bytes 0-15/40\r\netag:\"ETAG2\"", .content = "0123456789abcdef");
+
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "16-31", .ifMatch = "\"ETAG2\"");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 16-31/40", .content = "ghijklmnopqrstuv");
+
+                // The third range is requested on the first session once the first range has been read. It is small enough to be
+                // prefetched completely, so its session is released before the session of the second range.
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "32-39", .ifMatch = "\"ETAG2\"");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 32-39/40", .content = "wxyzABCD");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, STRDEF("file.txt")))), "0123456789abcdefghijklmnopqrstuvwxyzABCD",
+                    "get file");
+
+                ioBufferSizeSet(bufferSizeOld);
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error when range is ignored after the first range");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "0-15");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 0-15/40", .content = "0123456789abcdef");
+
+                hrnServerScriptSwap(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/bucket/file.txt", .range = "16-31");
+                testResponseP(service, .content = "0123456789abcdefghijklmnopqrstuvwxyzABCD");
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3, STRDEF("file.txt"))), FormatError,
+                    "expected range response for '/file.txt' but got code 200");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 hrnServerScriptEnd(service);
             }